@@ -0,0 +1,121 @@
+#!/usr/bin/env python
+#
+#  BLIS
+#  An object-based framework for developing high-performance BLAS-like
+#  libraries.
+#
+#  Copyright (C) 2026, The University of Texas at Austin
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#   - Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#   - Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#   - Neither the name(s) of the copyright holder(s) nor the names of its
+#     contributors may be used to endorse or promote products derived
+#     from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+#  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+#  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+#  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+#  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+#  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+#  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+#  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+#  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+#  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+#  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+#
+# Compare two sets of results written by the BLIS benchmark suite
+# (bench_libblis.x -j) and flag the experiments whose median performance
+# regressed. An experiment is flagged when its median GFLOPS dropped by
+# more than the threshold and by more than the combined spread of the two
+# measurements, so that noisy experiments are not reported as regressions.
+# The script exits with status 1 if any regression was found.
+#
+
+# Import modules
+import sys
+import json
+import argparse
+
+def load_results( filename ):
+
+	with open( filename ) as f:
+		data = json.load( f )
+
+	results = {}
+	for r in data[ "results" ]:
+		key = ( r[ "op" ], r[ "dt" ], r[ "stor" ],
+		        r[ "m" ], r[ "n" ], r[ "k" ], r[ "batch" ], r[ "threads" ],
+		        r.get( "instances", 1 ), r.get( "evict_mb", 0 ) )
+		results[ key ] = r
+
+	return data, results
+
+def key_string( key ):
+
+	op, dt, stor, m, n, k, batch, nt, inst, evict = key
+	return "%-18s %s %s %6d %6d %6d b%-5d t%-3d i%-3d e%-4d" % \
+	       ( op, dt, stor, m, n, k, batch, nt, inst, evict )
+
+def main():
+
+	parser = argparse.ArgumentParser( description = "Compare BLIS benchmark results." )
+	parser.add_argument( "baseline", help = "JSON results of the baseline" )
+	parser.add_argument( "current",  help = "JSON results to compare against the baseline" )
+	parser.add_argument( "-t", "--threshold", type = float, default = 5.0,
+	                     help = "minimum slowdown (in percent) to flag (default: 5)" )
+	parser.add_argument( "-v", "--verbose", action = "store_true",
+	                     help = "print all experiments, not only regressions" )
+	args = parser.parse_args()
+
+	base_data, base = load_results( args.baseline )
+	curr_data, curr = load_results( args.current )
+
+	print( "%% baseline: BLIS %s (%s)" % ( base_data[ "version" ], base_data[ "config" ] ) )
+	print( "%% current:  BLIS %s (%s)" % ( curr_data[ "version" ], curr_data[ "config" ] ) )
+
+	n_regress = 0
+	n_compared = 0
+
+	for key in sorted( set( base ) & set( curr ) ):
+
+		b = base[ key ]
+		c = curr[ key ]
+
+		if b[ "gflops_med" ] <= 0.0:
+			continue
+
+		n_compared += 1
+
+		change = 100.0 * ( c[ "gflops_med" ] - b[ "gflops_med" ] ) / b[ "gflops_med" ]
+		noise  = b[ "spread_pct" ] + c[ "spread_pct" ]
+		regress = -change > max( args.threshold, noise )
+
+		if regress:
+			n_regress += 1
+
+		if regress or args.verbose:
+			print( "%s %10.3f -> %10.3f GFLOPS (%+6.1f%%, spread %4.1f%%)%s" %
+			       ( key_string( key ), b[ "gflops_med" ], c[ "gflops_med" ],
+			         change, noise, "  REGRESSION" if regress else "" ) )
+
+	only_base = len( set( base ) - set( curr ) )
+	only_curr = len( set( curr ) - set( base ) )
+
+	print( "%% compared %d experiments; %d regressions" % ( n_compared, n_regress ) )
+	if only_base or only_curr:
+		print( "%% %d experiments only in the baseline; %d only in the current results" %
+		       ( only_base, only_curr ) )
+
+	return 1 if n_regress > 0 else 0
+
+if __name__ == "__main__":
+	sys.exit( main() )
@@ -0,0 +1,523 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "bench_libblis.h"
+
+
+static void libblis_bench_usage( const char* binary )
+{
+	fprintf( stderr,
+	"\n"
+	"Usage: %s [-i input] [-r repeats] [-j file.json] [-c file.csv] [-q]\n"
+	"       [-e size] [-k instances] [-m | -n] [-t threads] [-s size]\n"
+	"\n"
+	"  -i input      Read the benchmark sweeps from 'input' (default: '%s').\n"
+	"  -r repeats    Time each experiment 'repeats' times (default: %d).\n"
+	"  -j file.json  Write the results to 'file.json' in JSON format.\n"
+	"  -c file.csv   Write the results to 'file.csv' in CSV format.\n"
+	"  -q            Do not print the results to standard output.\n"
+	"  -e size       Evict the operands from the caches before each repeat by\n"
+	"                reading a buffer of 'size' MB (default: 0, warm caches).\n"
+	"  -k instances  Run 'instances' instances of each experiment concurrently,\n"
+	"                each in its own thread (default: 1).\n"
+	"  -m            Only measure the peak flop rate and memory bandwidth.\n"
+	"  -n            Do not measure the peak flop rate and memory bandwidth\n"
+	"                (and do not report performance relative to the roofline).\n"
+	"  -t threads    Measure the aggregate peak flop rate and bandwidth with\n"
+	"                'threads' threads (default: the number of cores, %ld).\n"
+	"  -s size       Measure bandwidth on vectors of 'size' MB in total\n"
+	"                (default: %d).\n"
+	"\n",
+	binary, BENCH_INPUT_FILENAME, DEFAULT_NUM_REPEATS,
+	( long )libblis_bench_num_cores(), DEFAULT_STREAM_MBYTES );
+}
+
+static void libblis_bench_parse_cl( int argc, char** argv, bench_params_t* params )
+{
+	snprintf( params->input_filename, MAX_FILENAME_LENGTH, "%s", BENCH_INPUT_FILENAME );
+	params->json_filename[ 0 ] = '\0';
+	params->csv_filename[ 0 ]  = '\0';
+	params->n_repeats          = DEFAULT_NUM_REPEATS;
+	params->quiet              = FALSE;
+	params->evict_bytes        = 0;
+	params->n_instances        = 1;
+	params->characterize       = TRUE;
+	params->characterize_only  = FALSE;
+	params->nt_all             = libblis_bench_num_cores();
+	params->stream_bytes       = ( size_t )DEFAULT_STREAM_MBYTES << 20;
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		const char* arg = argv[ i ];
+		const char* val = i + 1 < argc ? argv[ i + 1 ] : NULL;
+
+		if      ( strcmp( arg, "-q" ) == 0 ) { params->quiet = TRUE; continue; }
+		else if ( strcmp( arg, "-m" ) == 0 ) { params->characterize_only = TRUE; continue; }
+		else if ( strcmp( arg, "-n" ) == 0 ) { params->characterize = FALSE; continue; }
+		else if ( val == NULL )              { libblis_bench_usage( argv[ 0 ] ); exit( 1 ); }
+		else if ( strcmp( arg, "-i" ) == 0 ) snprintf( params->input_filename, MAX_FILENAME_LENGTH, "%s", val );
+		else if ( strcmp( arg, "-j" ) == 0 ) snprintf( params->json_filename,  MAX_FILENAME_LENGTH, "%s", val );
+		else if ( strcmp( arg, "-c" ) == 0 ) snprintf( params->csv_filename,   MAX_FILENAME_LENGTH, "%s", val );
+		else if ( strcmp( arg, "-r" ) == 0 ) params->n_repeats = bli_max( 1, atol( val ) );
+		else if ( strcmp( arg, "-e" ) == 0 ) params->evict_bytes = ( size_t )bli_max( 0, atol( val ) ) << 20;
+		else if ( strcmp( arg, "-k" ) == 0 ) params->n_instances = bli_min( bli_max( 1, atol( val ) ), MAX_NUM_INSTANCES );
+		else if ( strcmp( arg, "-t" ) == 0 ) params->nt_all = bli_max( 1, atol( val ) );
+		else if ( strcmp( arg, "-s" ) == 0 ) params->stream_bytes = ( size_t )bli_max( 1, atol( val ) ) << 20;
+		else                                 { libblis_bench_usage( argv[ 0 ] ); exit( 1 ); }
+
+		++i;
+	}
+
+	if ( params->characterize_only ) params->characterize = TRUE;
+}
+
+
+//
+// --- Input file parsing ------------------------------------------------------
+//
+
+// Parse a dimension, which is either the letter 'p' (the swept problem size)
+// or a non-negative integer.
+static bool libblis_bench_parse_dim( const char* str, dim_t* dim )
+{
+	char* end;
+
+	if ( strcmp( str, "p" ) == 0 ) { *dim = -1; return TRUE; }
+
+	*dim = strtol( str, &end, 10 );
+
+	return *end == '\0' && *dim >= 0;
+}
+
+// Parse a sweep of problem sizes, given as "first:last:inc", where inc may
+// be prefixed with 'x' to multiply rather than add, or as a single size.
+static bool libblis_bench_parse_sizes( const char* str, bench_sweep_t* sweep )
+{
+	long first, last, inc;
+	char mult[ 2 ] = "";
+
+	sweep->p_mult = FALSE;
+
+	if ( sscanf( str, "%ld:%ld:%1[x]%ld", &first, &last, mult, &inc ) == 4 )
+		sweep->p_mult = TRUE;
+	else if ( sscanf( str, "%ld:%ld:%ld", &first, &last, &inc ) == 3 )
+		;
+	else if ( sscanf( str, "%ld", &first ) == 1 )
+		{ last = first; inc = 1; }
+	else
+		return FALSE;
+
+	if ( first < 0 || last < first || inc < 1 || ( sweep->p_mult && ( inc < 2 || first < 1 ) ) )
+		return FALSE;
+
+	sweep->p_first = first;
+	sweep->p_last  = last;
+	sweep->p_inc   = inc;
+
+	return TRUE;
+}
+
+static bool libblis_bench_parse_threads( char* str, bench_sweep_t* sweep )
+{
+	sweep->n_nt = 0;
+
+	for ( char* tok = strtok( str, "," ); tok != NULL; tok = strtok( NULL, "," ) )
+	{
+		if ( sweep->n_nt == MAX_NUM_THREAD_COUNTS ) return FALSE;
+
+		sweep->nt[ sweep->n_nt ] = atol( tok );
+
+		if ( sweep->nt[ sweep->n_nt ] < 1 ) return FALSE;
+
+		sweep->n_nt += 1;
+	}
+
+	return sweep->n_nt > 0;
+}
+
+static dim_t libblis_bench_read_input( const char* filename, bench_sweep_t* sweeps )
+{
+	FILE* is = fopen( filename, "r" );
+	char  line[ INPUT_BUFFER_SIZE ];
+	dim_t n_sweeps = 0;
+	dim_t line_num = 0;
+
+	if ( is == NULL )
+	{
+		fprintf( stderr, "bench: could not open input file '%s'.\n", filename );
+		exit( 1 );
+	}
+
+	while ( fgets( line, INPUT_BUFFER_SIZE, is ) != NULL )
+	{
+		char op[ MAX_OP_NAME_LENGTH ], dt[ 16 ], stor[ 16 ];
+		char dims[ 3 ][ 32 ], sizes[ 64 ], threads[ 128 ], batch[ 32 ];
+
+		line_num += 1;
+
+		// Strip comments and skip blank lines.
+		char* comment = strchr( line, INPUT_COMMENT_CHAR );
+		if ( comment != NULL ) *comment = '\0';
+
+		int n_read = sscanf( line, "%31s %15s %15s %31s %31s %31s %63s %127s %31s",
+		                     op, dt, stor, dims[ 0 ], dims[ 1 ], dims[ 2 ],
+		                     sizes, threads, batch );
+
+		if ( n_read <= 0 ) continue;
+
+		bench_sweep_t* sweep = &sweeps[ n_sweeps ];
+		bool           valid = n_read == 9 && n_sweeps < MAX_NUM_SWEEPS;
+
+		if ( valid )
+		{
+			snprintf( sweep->op_str, MAX_OP_NAME_LENGTH, "%s", op );
+
+			valid = strlen( dt ) <= MAX_NUM_DATATYPES &&
+			        strspn( dt, "sdcz" ) == strlen( dt ) &&
+			        strlen( stor ) == 3 &&
+			        strspn( stor, "cr" ) == 3;
+		}
+
+		if ( valid )
+		{
+			memcpy( sweep->dt_str,   dt,   strlen( dt ) + 1 );
+			memcpy( sweep->stor_str, stor, 4 );
+		}
+
+		for ( dim_t i = 0; valid && i < 3; ++i )
+			valid = libblis_bench_parse_dim( dims[ i ], &sweep->dim_fixed[ i ] );
+
+		valid = valid && libblis_bench_parse_sizes( sizes, sweep );
+		valid = valid && libblis_bench_parse_threads( threads, sweep );
+
+		if ( valid )
+		{
+			sweep->batch = atol( batch );
+			valid = sweep->batch >= 1;
+		}
+
+		if ( !valid )
+		{
+			fprintf( stderr, "bench: %s:%ld: invalid sweep.\n", filename, ( long )line_num );
+			exit( 1 );
+		}
+
+		if ( libblis_bench_lookup_op( sweep->op_str ) == NULL )
+		{
+			fprintf( stderr, "bench: %s:%ld: skipping unavailable operation '%s'.\n",
+			         filename, ( long )line_num, sweep->op_str );
+			continue;
+		}
+
+		n_sweeps += 1;
+	}
+
+	fclose( is );
+
+	return n_sweeps;
+}
+
+
+//
+// --- Driver ------------------------------------------------------------------
+//
+
+// The buffer read by libblis_bench_evict(), and the sink for the values read
+// from it (which keeps the compiler from optimizing the reads away).
+static double*         evict_buf  = NULL;
+static volatile double evict_sink = 0.0;
+
+// Evict the operands of the previous repeat from the caches by reading a
+// buffer that is (presumably) larger than the last-level cache.
+static void libblis_bench_evict( size_t bytes )
+{
+	const dim_t n   = bytes / sizeof( double );
+	double      sum = 0.0;
+
+	// One element per cache line suffices to load the whole line.
+	for ( dim_t i = 0; i < n; i += 8 )
+		sum += evict_buf[ i ];
+
+	evict_sink = sum;
+}
+
+typedef struct instance_arg_s
+{
+	const bench_params_t*  params;
+	const bench_op_t*      op;
+	      bench_prob_t*    prob;
+	bli_pthread_barrier_t* barrier;
+
+	// The time of each repeat of this instance, and the time within which
+	// all instances completed each repeat.
+	double*                times;
+	double*                walls;
+} instance_arg_t;
+
+static void* libblis_bench_instance_thread( void* arg_v )
+{
+	instance_arg_t*       arg    = arg_v;
+	const bench_params_t* params = arg->params;
+	const bench_op_t*     op     = arg->op;
+	bench_prob_t*         prob   = arg->prob;
+
+	// Perform one untimed run to warm up the caches and the threads.
+	if ( op->reset ) op->reset( prob );
+	op->exec( prob );
+
+	for ( dim_t r = 0; r < params->n_repeats; ++r )
+	{
+		if ( op->reset ) op->reset( prob );
+		if ( params->evict_bytes > 0 ) libblis_bench_evict( params->evict_bytes );
+
+		// Start all instances together so that they contend for the shared
+		// caches and memory bandwidth throughout the repeat.
+		double t_wall = libblis_bench_sync_clock( arg->barrier );
+		double t      = bli_clock();
+
+		op->exec( prob );
+
+		arg->times[ r ] = bli_clock() - t;
+		arg->walls[ r ] = libblis_bench_sync_clock( arg->barrier ) - t_wall;
+	}
+
+	return NULL;
+}
+
+static void libblis_bench_run_experiment
+     (
+       const bench_params_t*  params,
+       const bench_machine_t* mach,
+       const bench_op_t*      op,
+             bench_prob_t*    probs,
+             dim_t            nt,
+             bench_result_t*  res
+     )
+{
+	const dim_t     n_inst = params->n_instances;
+	const dim_t     n_rep  = params->n_repeats;
+	bench_prob_t*   prob   = &probs[ 0 ];
+	double*         times  = malloc( n_inst * n_rep * sizeof( double ) );
+	double*         walls  = malloc( n_inst * n_rep * sizeof( double ) );
+	instance_arg_t* args   = malloc( n_inst * sizeof( instance_arg_t ) );
+
+	bli_pthread_barrier_t barrier;
+
+	bli_pthread_barrier_init( &barrier, NULL, n_inst );
+
+	// Each instance uses nt threads.
+	bli_thread_set_num_threads( nt );
+
+	for ( dim_t i = 0; i < n_inst; ++i )
+	{
+		args[ i ].params  = params;
+		args[ i ].op      = op;
+		args[ i ].prob    = &probs[ i ];
+		args[ i ].barrier = &barrier;
+		args[ i ].times   = &times[ i * n_rep ];
+		args[ i ].walls   = &walls[ i * n_rep ];
+	}
+
+	libblis_bench_run_concurrent( n_inst, libblis_bench_instance_thread,
+	                              args, sizeof( instance_arg_t ) );
+
+	const double dt_scale = bli_is_complex( prob->dt ) ? 4.0 : 1.0;
+	const double flops    = op->flops( prob->m, prob->n, prob->k ) * prob->batch * dt_scale;
+	const double bytes    = op->elems( prob->m, prob->n, prob->k ) * prob->batch *
+	                        bli_dt_size( prob->dt );
+
+	res->op           = op;
+	res->dt_char      = prob->dt_char;
+	res->m            = prob->m;
+	res->n            = prob->n;
+	res->k            = prob->k;
+	res->batch        = prob->batch;
+	res->nt           = nt;
+	res->n_instances  = n_inst;
+	res->evict_mbytes = params->evict_bytes >> 20;
+
+	snprintf( res->stor_str, sizeof( res->stor_str ), "%.3s", prob->stor );
+
+	op->kernels( prob, res->kernel_str, sizeof( res->kernel_str ) );
+
+	// The first instance ran in this thread, so the last rntm_t is its own.
+	if ( op->threaded )
+	{
+		rntm_t rntm;
+
+		bli_thread_get_last_rntm( &rntm );
+
+		snprintf( res->ways_str, sizeof( res->ways_str ), "%ldx%ldx%ldx%ldx%ld",
+		          ( long )bli_rntm_jc_ways( &rntm ), ( long )bli_rntm_pc_ways( &rntm ),
+		          ( long )bli_rntm_ic_ways( &rntm ), ( long )bli_rntm_jr_ways( &rntm ),
+		          ( long )bli_rntm_ir_ways( &rntm ) );
+	}
+	else
+	{
+		snprintf( res->ways_str, sizeof( res->ways_str ), "-" );
+	}
+
+	// All instances measure the same wall-clock times.
+	libblis_bench_compute_stats( flops, bytes, times, n_inst * n_rep, walls, n_rep, res );
+
+	res->ai       = flops / bytes;
+	res->roof_pct = -1.0;
+
+	if ( mach->valid )
+		res->roof_pct = 100.0 * res->gflops_med /
+		                libblis_bench_roofline_gflops( mach, prob->dt, nt, res->ai );
+
+	bli_pthread_barrier_destroy( &barrier );
+	free( args );
+	free( walls );
+	free( times );
+}
+
+int main( int argc, char** argv )
+{
+	bench_params_t  params;
+	bench_machine_t mach    = { .valid = FALSE };
+	bench_sweep_t*  sweeps  = malloc( MAX_NUM_SWEEPS * sizeof( bench_sweep_t ) );
+	bench_prob_t*   probs   = NULL;
+	bench_result_t* results = NULL;
+	dim_t           n_res   = 0;
+	dim_t           n_alloc = 0;
+
+	bli_init();
+
+	libblis_bench_parse_cl( argc, argv, &params );
+
+	const dim_t n_sweeps = params.characterize_only ? 0 :
+	                       libblis_bench_read_input( params.input_filename, sweeps );
+
+	if ( !params.quiet )
+	{
+		printf( "%% BLIS %s, configuration '%s', threading '%s', %ld repeats\n",
+		        bli_info_get_version_str(),
+		        bli_arch_string( bli_arch_query_id() ),
+		        bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() ),
+		        ( long )params.n_repeats );
+		if ( params.evict_bytes > 0 )
+			printf( "%% caches evicted before each repeat with a %ld MB buffer\n",
+			        ( long )( params.evict_bytes >> 20 ) );
+		if ( params.n_instances > 1 )
+			printf( "%% %ld concurrent instances of each experiment\n",
+			        ( long )params.n_instances );
+	}
+
+	if ( params.characterize )
+	{
+		libblis_bench_characterize( params.nt_all, params.stream_bytes, &mach );
+
+		if ( !params.quiet ) libblis_bench_output_machine( stdout, &mach );
+	}
+
+	if ( !params.quiet && n_sweeps > 0 )
+		libblis_bench_output_header( stdout );
+
+	probs = malloc( params.n_instances * sizeof( bench_prob_t ) );
+
+	if ( params.evict_bytes > 0 )
+	{
+		evict_buf = malloc( params.evict_bytes );
+
+		for ( dim_t i = 0; i < params.evict_bytes / sizeof( double ); ++i )
+			evict_buf[ i ] = 1.0;
+	}
+
+	for ( dim_t s = 0; s < n_sweeps; ++s )
+	{
+		const bench_sweep_t* sweep = &sweeps[ s ];
+		const bench_op_t*    op    = libblis_bench_lookup_op( sweep->op_str );
+
+		for ( const char* dt_c = sweep->dt_str; *dt_c != '\0'; ++dt_c )
+		for ( dim_t p = sweep->p_first; p <= sweep->p_last;
+		      p = sweep->p_mult ? p * sweep->p_inc : p + sweep->p_inc )
+		{
+			// Each instance has its own operands.
+			for ( dim_t i = 0; i < params.n_instances; ++i )
+			{
+				bench_prob_t* prob = &probs[ i ];
+
+				bli_param_map_char_to_blis_dt( *dt_c, &prob->dt );
+				prob->dt_char = *dt_c;
+				memcpy( prob->stor, sweep->stor_str, 3 );
+				prob->m     = sweep->dim_fixed[ 0 ] < 0 ? p : sweep->dim_fixed[ 0 ];
+				prob->n     = sweep->dim_fixed[ 1 ] < 0 ? p : sweep->dim_fixed[ 1 ];
+				prob->k     = sweep->dim_fixed[ 2 ] < 0 ? p : sweep->dim_fixed[ 2 ];
+				prob->batch = sweep->batch;
+
+				op->create( prob );
+			}
+
+			for ( dim_t t = 0; t < sweep->n_nt; ++t )
+			{
+				if ( n_res == n_alloc )
+				{
+					n_alloc = bli_max( 64, 2 * n_alloc );
+					results = realloc( results, n_alloc * sizeof( bench_result_t ) );
+				}
+
+				libblis_bench_run_experiment( &params, &mach, op, probs, sweep->nt[ t ], &results[ n_res ] );
+
+				if ( !params.quiet )
+				{
+					libblis_bench_output_result( stdout, &results[ n_res ] );
+					fflush( stdout );
+				}
+
+				n_res += 1;
+			}
+
+			for ( dim_t i = 0; i < params.n_instances; ++i )
+				libblis_bench_prob_free( &probs[ i ] );
+		}
+	}
+
+	if ( params.json_filename[ 0 ] != '\0' )
+		libblis_bench_write_json( params.json_filename, &mach, results, n_res );
+	if ( params.csv_filename[ 0 ] != '\0' )
+		libblis_bench_write_csv( params.csv_filename, results, n_res );
+
+	free( evict_buf );
+	free( results );
+	free( probs );
+	free( sweeps );
+
+	bli_finalize();
+
+	return 0;
+}
+
@@ -0,0 +1,260 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// --- System headers ----------------------------------------------------------
+//
+
+// For string manipulation functions.
+#include <string.h>
+
+// For other string manipulation functions (e.g. isspace()).
+#include <ctype.h>
+
+//
+// --- Constants and types -----------------------------------------------------
+//
+
+#define BENCH_INPUT_FILENAME         "input.bench"
+#define INPUT_COMMENT_CHAR           '#'
+
+#define INPUT_BUFFER_SIZE            512
+#define MAX_FILENAME_LENGTH          1000
+#define MAX_OP_NAME_LENGTH           32
+#define MAX_KERNEL_NAME_LENGTH       256
+#define MAX_NUM_DATATYPES            4
+#define MAX_NUM_THREAD_COUNTS        16
+#define MAX_NUM_SWEEPS               256
+#define MAX_NUM_INSTANCES            256
+#define DEFAULT_NUM_REPEATS          5
+#define FLOPS_PER_UNIT_PERF          1e9
+#define BYTES_PER_UNIT_BW            1e9
+#define DEFAULT_STREAM_MBYTES        256
+
+// One line of the input file: an operation, the datatypes and storage to
+// benchmark it with, and the problem sizes and thread counts to sweep.
+typedef struct bench_sweep_s
+{
+	char   op_str[ MAX_OP_NAME_LENGTH ];
+	char   dt_str[ MAX_NUM_DATATYPES + 1 ];
+	char   stor_str[ 4 ];
+
+	// Each of m, n, and k is either fixed (dim_fixed >= 0) or equal to the
+	// swept problem size p (dim_fixed < 0).
+	dim_t  dim_fixed[ 3 ];
+
+	// The sweep over p: first, last, and an increment that is either added
+	// to p (p_mult == FALSE) or multiplies p (p_mult == TRUE).
+	dim_t  p_first;
+	dim_t  p_last;
+	dim_t  p_inc;
+	bool   p_mult;
+
+	dim_t  nt[ MAX_NUM_THREAD_COUNTS ];
+	dim_t  n_nt;
+
+	dim_t  batch;
+} bench_sweep_t;
+
+// The operands of one benchmark problem. Operations that take fewer operands
+// leave the rest unused. Each array holds one element per problem in the
+// batch.
+typedef struct bench_prob_s
+{
+	num_t  dt;
+	char   dt_char;
+	char   stor[ 3 ];
+	dim_t  m;
+	dim_t  n;
+	dim_t  k;
+	dim_t  batch;
+
+	obj_t* a;
+	obj_t* b;
+	obj_t* c;
+	obj_t* c_save;
+
+	// Pointers to the operand buffers, for interfaces that take arrays of
+	// pointers.
+	void** ptrs;
+} bench_prob_t;
+
+// The description of one benchmarked operation.
+typedef struct bench_op_s
+{
+	const char* name;
+
+	// Whether the operation is parallelized by BLIS. Thread factorizations
+	// are reported only for such operations.
+	bool        threaded;
+
+	// Create the operands, restore the output operand before each repeat
+	// (optional, untimed), and execute the operation on the whole batch.
+	void      (*create)( bench_prob_t* prob );
+	void      (*reset)( bench_prob_t* prob );
+	void      (*exec)( bench_prob_t* prob );
+
+	// The flop count and the number of elements that must be moved to or
+	// from memory for one problem of the batch (in the real domain; both are
+	// scaled for complex datatypes by the driver).
+	double    (*flops)( dim_t m, dim_t n, dim_t k );
+	double    (*elems)( dim_t m, dim_t n, dim_t k );
+
+	// Write the names of the kernels the operation uses.
+	void      (*kernels)( const bench_prob_t* prob, char* str, size_t len );
+} bench_op_t;
+
+// The measured performance of one experiment.
+typedef struct bench_result_s
+{
+	const bench_op_t* op;
+	char   dt_char;
+	char   stor_str[ 4 ];
+	dim_t  m;
+	dim_t  n;
+	dim_t  k;
+	dim_t  batch;
+	dim_t  nt;
+	dim_t  n_instances;
+	dim_t  evict_mbytes;
+	char   ways_str[ 64 ];
+	char   kernel_str[ MAX_KERNEL_NAME_LENGTH ];
+
+	// The statistics of the times of all repeats of all instances. The
+	// performance at the 99th percentile of the times measures the slow
+	// tail (and is only meaningful with many repeats).
+	dim_t  n_repeats;
+	double time_med;
+	double time_p99;
+	double gflops_med;
+	double gflops_best;
+	double gflops_p99;
+	double gflops_worst;
+	double spread_pct;
+	double gbs_med;
+
+	// The aggregate performance of all instances, based on the median of
+	// the times within which all instances completed one repeat.
+	double gflops_agg;
+
+	// The arithmetic intensity (flops per byte of compulsory memory
+	// traffic) and the median performance as a percentage of the roofline
+	// bound at that intensity (or a negative value if the machine was not
+	// characterized).
+	double ai;
+	double roof_pct;
+} bench_result_t;
+
+// The level-1v kernels used to measure memory bandwidth, after the four
+// kernels of the STREAM benchmark.
+enum
+{
+	BENCH_STREAM_COPY = 0, // y := x        (copyv)
+	BENCH_STREAM_SCALE,    // y := alpha x  (scal2v)
+	BENCH_STREAM_ADD,      // y := y + x    (addv)
+	BENCH_STREAM_TRIAD,    // y := y + a x  (axpyv)
+	BENCH_NUM_STREAM
+};
+
+extern const char* bench_stream_names[ BENCH_NUM_STREAM ];
+
+// The measured peak flop rate and memory bandwidth of the machine. Index 0
+// holds the measurements with one thread and index 1 those with nt[ 1 ]
+// concurrent threads (by default, one per core).
+typedef struct bench_machine_s
+{
+	bool   valid;
+	dim_t  nt[ 2 ];
+
+	// The peak flop rate of the gemm microkernel, indexed by datatype.
+	double gflops_peak[ 2 ][ BLIS_NUM_FP_TYPES ];
+
+	// The bandwidth of the level-1v kernels on vectors that do not fit in
+	// cache (double precision).
+	double gbs[ 2 ][ BENCH_NUM_STREAM ];
+} bench_machine_t;
+
+// The command line parameters.
+typedef struct bench_params_s
+{
+	char   input_filename[ MAX_FILENAME_LENGTH ];
+	char   json_filename[ MAX_FILENAME_LENGTH ];
+	char   csv_filename[ MAX_FILENAME_LENGTH ];
+	dim_t  n_repeats;
+	bool   quiet;
+
+	// The size of the buffer that is read between repeats to evict the
+	// operands from the caches (zero to keep the caches warm), and the
+	// number of instances of each experiment that run concurrently (each in
+	// its own thread and on its own operands).
+	size_t evict_bytes;
+	dim_t  n_instances;
+
+	// Whether to characterize the machine (and whether to only do that), the
+	// number of threads of the all-core measurements, and the total size of
+	// the vectors used to measure bandwidth.
+	bool   characterize;
+	bool   characterize_only;
+	dim_t  nt_all;
+	size_t stream_bytes;
+} bench_params_t;
+
+
+//
+// --- Prototypes --------------------------------------------------------------
+//
+
+// bench_ops.c
+const bench_op_t* libblis_bench_lookup_op( const char* name );
+void              libblis_bench_prob_free( bench_prob_t* prob );
+void              libblis_bench_kernel_name( num_t dt, ukr_t ukr, char* str, size_t len );
+
+// bench_thread.c
+void   libblis_bench_run_concurrent( dim_t nt, void* ( *func )( void* ), void* args, size_t arg_size );
+double libblis_bench_sync_clock( bli_pthread_barrier_t* barrier );
+dim_t  libblis_bench_num_cores( void );
+
+// bench_roofline.c
+void   libblis_bench_characterize( dim_t nt_all, size_t stream_bytes, bench_machine_t* mach );
+double libblis_bench_roofline_gflops( const bench_machine_t* mach, num_t dt, dim_t nt, double ai );
+
+// bench_output.c
+void libblis_bench_compute_stats( double flops, double bytes, double* times, dim_t n, double* walls, dim_t n_walls, bench_result_t* res );
+void libblis_bench_output_header( FILE* os );
+void libblis_bench_output_result( FILE* os, const bench_result_t* res );
+void libblis_bench_output_machine( FILE* os, const bench_machine_t* mach );
+void libblis_bench_write_json( const char* filename, const bench_machine_t* mach, const bench_result_t* res, dim_t n );
+void libblis_bench_write_csv( const char* filename, const bench_result_t* res, dim_t n );
+
@@ -0,0 +1,653 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// dladdr() and, on Linux, the ELF symbol table are used to look up the names
+// of the kernels registered in the context.
+#if defined(__linux__) || defined(__APPLE__)
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#define BENCH_HAVE_DLADDR
+#endif
+
+#if defined(__linux__) && defined(__LP64__)
+#include <elf.h>
+#define BENCH_HAVE_ELF
+#endif
+
+#include "blis.h"
+#include "bench_libblis.h"
+
+
+//
+// --- Operand management ------------------------------------------------------
+//
+
+static void libblis_bench_mobj_create( num_t dt, char stor, dim_t m, dim_t n, obj_t* a )
+{
+	if ( stor == 'r' ) bli_obj_create( dt, m, n, n, 1, a );
+	else               bli_obj_create( dt, m, n, 0, 0, a );
+
+	bli_randm( a );
+}
+
+static void libblis_bench_vobj_create( num_t dt, dim_t m, obj_t* x )
+{
+	bli_obj_create( dt, m, 1, 0, 0, x );
+
+	bli_randv( x );
+}
+
+// Operands that are not created keep a NULL buffer.
+static obj_t* libblis_bench_obj_array_alloc( dim_t n )
+{
+	return calloc( n, sizeof( obj_t ) );
+}
+
+static void libblis_bench_prob_alloc( bench_prob_t* prob, bool save_c )
+{
+	prob->a      = libblis_bench_obj_array_alloc( prob->batch );
+	prob->b      = libblis_bench_obj_array_alloc( prob->batch );
+	prob->c      = libblis_bench_obj_array_alloc( prob->batch );
+	prob->c_save = save_c ? libblis_bench_obj_array_alloc( prob->batch ) : NULL;
+	prob->ptrs   = NULL;
+}
+
+void libblis_bench_prob_free( bench_prob_t* prob )
+{
+	for ( dim_t i = 0; i < prob->batch; ++i )
+	{
+		if ( bli_obj_buffer( &prob->a[ i ] ) ) bli_obj_free( &prob->a[ i ] );
+		if ( bli_obj_buffer( &prob->b[ i ] ) ) bli_obj_free( &prob->b[ i ] );
+		if ( bli_obj_buffer( &prob->c[ i ] ) ) bli_obj_free( &prob->c[ i ] );
+		if ( prob->c_save ) bli_obj_free( &prob->c_save[ i ] );
+	}
+
+	free( prob->a );
+	free( prob->b );
+	free( prob->c );
+	free( prob->c_save );
+	free( prob->ptrs );
+}
+
+
+//
+// --- Kernel names ------------------------------------------------------------
+//
+
+#ifdef BENCH_HAVE_ELF
+
+// Look up the name of the function at address f in the symbol table of the
+// ELF object that contains it. Unlike dladdr() alone, this also finds the
+// kernels, which are not exported from the library.
+static bool libblis_bench_elf_sym_name( const Dl_info* info, void_fp f, char* str, size_t len )
+{
+	FILE*      fp    = fopen( info->dli_fname, "rb" );
+	bool       found = FALSE;
+	Elf64_Ehdr eh;
+
+	if ( fp == NULL ) fp = fopen( "/proc/self/exe", "rb" );
+	if ( fp == NULL ) return FALSE;
+
+	if ( fread( &eh, sizeof( eh ), 1, fp ) != 1 ||
+	     memcmp( eh.e_ident, ELFMAG, SELFMAG ) != 0 ||
+	     eh.e_ident[ EI_CLASS ] != ELFCLASS64 ||
+	     eh.e_shentsize != sizeof( Elf64_Shdr ) )
+	{
+		fclose( fp );
+		return FALSE;
+	}
+
+	Elf64_Shdr* sh = malloc( eh.e_shnum * sizeof( Elf64_Shdr ) );
+
+	if ( fseek( fp, eh.e_shoff, SEEK_SET ) != 0 ||
+	     fread( sh, sizeof( Elf64_Shdr ), eh.e_shnum, fp ) != eh.e_shnum )
+		eh.e_shnum = 0;
+
+	// Symbol values are offsets from the load address in shared objects and
+	// position-independent executables.
+	const uintptr_t target = ( uintptr_t )f -
+	                         ( eh.e_type == ET_DYN ? ( uintptr_t )info->dli_fbase : 0 );
+
+	for ( dim_t i = 0; i < eh.e_shnum && !found; ++i )
+	{
+		if ( sh[ i ].sh_type != SHT_SYMTAB || sh[ i ].sh_link >= eh.e_shnum ) continue;
+
+		const Elf64_Shdr* sh_str = &sh[ sh[ i ].sh_link ];
+		Elf64_Sym*        syms   = malloc( sh[ i ].sh_size );
+		char*             strs   = malloc( sh_str->sh_size );
+
+		if ( fseek( fp, sh[ i ].sh_offset, SEEK_SET ) == 0 &&
+		     fread( syms, 1, sh[ i ].sh_size, fp ) == sh[ i ].sh_size &&
+		     fseek( fp, sh_str->sh_offset, SEEK_SET ) == 0 &&
+		     fread( strs, 1, sh_str->sh_size, fp ) == sh_str->sh_size )
+		{
+			for ( size_t j = 0; j < sh[ i ].sh_size / sizeof( Elf64_Sym ); ++j )
+			{
+				if ( ELF64_ST_TYPE( syms[ j ].st_info ) == STT_FUNC &&
+				     syms[ j ].st_value == target &&
+				     syms[ j ].st_name < sh_str->sh_size )
+				{
+					snprintf( str, len, "%s", strs + syms[ j ].st_name );
+					found = TRUE;
+					break;
+				}
+			}
+		}
+
+		free( syms );
+		free( strs );
+	}
+
+	free( sh );
+	fclose( fp );
+
+	return found;
+}
+
+#endif
+
+// Look up the name of the function at address f (or, failing that, format
+// its address).
+static void libblis_bench_func_name( void_fp f, char* str, size_t len )
+{
+#ifdef BENCH_HAVE_DLADDR
+	Dl_info info;
+
+	if ( dladdr( ( void* )f, &info ) != 0 )
+	{
+		if ( info.dli_sname != NULL && info.dli_saddr == ( void* )f )
+		{
+			snprintf( str, len, "%s", info.dli_sname );
+			return;
+		}
+#ifdef BENCH_HAVE_ELF
+		if ( libblis_bench_elf_sym_name( &info, f, str, len ) ) return;
+#endif
+	}
+#endif
+
+	snprintf( str, len, "%p", ( void* )f );
+}
+
+void libblis_bench_kernel_name( num_t dt, ukr_t ukr, char* str, size_t len )
+{
+	// Cache the names that were looked up, since each lookup may read the
+	// symbol table of the executable or library.
+	static struct { void_fp f; char name[ MAX_KERNEL_NAME_LENGTH ]; } cache[ 64 ];
+	static dim_t n_cache = 0;
+
+	const cntx_t* cntx = bli_gks_query_cntx();
+	void_fp       f    = bli_cntx_get_ukr_dt( dt, ukr, cntx );
+
+	if ( f == NULL )
+	{
+		snprintf( str, len, "none" );
+		return;
+	}
+
+	for ( dim_t i = 0; i < n_cache; ++i )
+	{
+		if ( cache[ i ].f == f )
+		{
+			snprintf( str, len, "%s", cache[ i ].name );
+			return;
+		}
+	}
+
+	libblis_bench_func_name( f, str, len );
+
+	if ( n_cache < 64 )
+	{
+		cache[ n_cache ].f = f;
+		snprintf( cache[ n_cache ].name, MAX_KERNEL_NAME_LENGTH, "%s", str );
+		n_cache += 1;
+	}
+}
+
+// Write the names of two kernels separated by a '+'.
+static void libblis_bench_kernel_name2( num_t dt, ukr_t ukr0, ukr_t ukr1, char* str, size_t len )
+{
+	char name0[ MAX_KERNEL_NAME_LENGTH ];
+	char name1[ MAX_KERNEL_NAME_LENGTH ];
+
+	libblis_bench_kernel_name( dt, ukr0, name0, sizeof( name0 ) );
+	libblis_bench_kernel_name( dt, ukr1, name1, sizeof( name1 ) );
+
+	snprintf( str, len, "%s+%s", name0, name1 );
+}
+
+// Return the gemmsup kernel id that corresponds to the storage of C, A,
+// and B.
+static ukr_t libblis_bench_gemmsup_ukr( const char* stor )
+{
+	return BLIS_GEMMSUP_RRR_UKR + 4 * ( stor[ 0 ] == 'c' ) +
+	                              2 * ( stor[ 1 ] == 'c' ) +
+	                              1 * ( stor[ 2 ] == 'c' );
+}
+
+
+//
+// --- Level-1v operations -----------------------------------------------------
+//
+
+static void axpyv_create( bench_prob_t* p )
+{
+	libblis_bench_prob_alloc( p, FALSE );
+
+	for ( dim_t i = 0; i < p->batch; ++i )
+	{
+		libblis_bench_vobj_create( p->dt, p->m, &p->a[ i ] );
+		libblis_bench_vobj_create( p->dt, p->m, &p->c[ i ] );
+	}
+}
+
+static void axpyv_exec( bench_prob_t* p )
+{
+	for ( dim_t i = 0; i < p->batch; ++i )
+		bli_axpyv( &BLIS_TWO, &p->a[ i ], &p->c[ i ] );
+}
+
+static double axpyv_flops( dim_t m, dim_t n, dim_t k ) { return 2.0 * m; }
+static double axpyv_elems( dim_t m, dim_t n, dim_t k ) { return 3.0 * m; }
+
+static void axpyv_kernels( const bench_prob_t* p, char* str, size_t len )
+{
+	libblis_bench_kernel_name( p->dt, BLIS_AXPYV_KER, str, len );
+}
+
+static void dotv_create( bench_prob_t* p )
+{
+	libblis_bench_prob_alloc( p, FALSE );
+
+	for ( dim_t i = 0; i < p->batch; ++i )
+	{
+		libblis_bench_vobj_create( p->dt, p->m, &p->a[ i ] );
+		libblis_bench_vobj_create( p->dt, p->m, &p->b[ i ] );
+		bli_obj_create_1x1( p->dt, &p->c[ i ] );
+	}
+}
+
+static void dotv_exec( bench_prob_t* p )
+{
+	for ( dim_t i = 0; i < p->batch; ++i )
+		bli_dotv( &p->a[ i ], &p->b[ i ], &p->c[ i ] );
+}
+
+static double dotv_flops( dim_t m, dim_t n, dim_t k ) { return 2.0 * m; }
+static double dotv_elems( dim_t m, dim_t n, dim_t k ) { return 2.0 * m; }
+
+static void dotv_kernels( const bench_prob_t* p, char* str, size_t len )
+{
+	libblis_bench_kernel_name( p->dt, BLIS_DOTV_KER, str, len );
+}
+
+
+//
+// --- Level-2 operations ------------------------------------------------------
+//
+
+static void gemv_create( bench_prob_t* p )
+{
+	libblis_bench_prob_alloc( p, FALSE );
+
+	for ( dim_t i = 0; i < p->batch; ++i )
+	{
+		libblis_bench_mobj_create( p->dt, p->stor[ 0 ], p->m, p->n, &p->a[ i ] );
+		libblis_bench_vobj_create( p->dt, p->n, &p->b[ i ] );
+		libblis_bench_vobj_create( p->dt, p->m, &p->c[ i ] );
+	}
+}
+
+static void gemv_exec( bench_prob_t* p )
+{
+	for ( dim_t i = 0; i < p->batch; ++i )
+		bli_gemv( &BLIS_ONE, &p->a[ i ], &p->b[ i ], &BLIS_ONE, &p->c[ i ] );
+}
+
+static double gemv_flops( dim_t m, dim_t n, dim_t k ) { return 2.0 * m * n; }
+static double gemv_elems( dim_t m, dim_t n, dim_t k ) { return 1.0 * m * n + n + 2.0 * m; }
+
+static void gemv_kernels( const bench_prob_t* p, char* str, size_t len )
+{
+	libblis_bench_kernel_name2( p->dt, BLIS_AXPYF_KER, BLIS_DOTXF_KER, str, len );
+}
+
+static void ger_create( bench_prob_t* p )
+{
+	libblis_bench_prob_alloc( p, FALSE );
+
+	for ( dim_t i = 0; i < p->batch; ++i )
+	{
+		libblis_bench_vobj_create( p->dt, p->m, &p->a[ i ] );
+		libblis_bench_vobj_create( p->dt, p->n, &p->b[ i ] );
+		libblis_bench_mobj_create( p->dt, p->stor[ 0 ], p->m, p->n, &p->c[ i ] );
+	}
+}
+
+static void ger_exec( bench_prob_t* p )
+{
+	for ( dim_t i = 0; i < p->batch; ++i )
+		bli_ger( &BLIS_ONE, &p->a[ i ], &p->b[ i ], &p->c[ i ] );
+}
+
+static double ger_flops( dim_t m, dim_t n, dim_t k ) { return 2.0 * m * n; }
+static double ger_elems( dim_t m, dim_t n, dim_t k ) { return 2.0 * m * n + m + n; }
+
+static void ger_kernels( const bench_prob_t* p, char* str, size_t len )
+{
+	libblis_bench_kernel_name( p->dt, BLIS_AXPYV_KER, str, len );
+}
+
+
+//
+// --- Level-3 operations ------------------------------------------------------
+//
+
+static void gemm_create( bench_prob_t* p )
+{
+	libblis_bench_prob_alloc( p, FALSE );
+
+	for ( dim_t i = 0; i < p->batch; ++i )
+	{
+		libblis_bench_mobj_create( p->dt, p->stor[ 1 ], p->m, p->k, &p->a[ i ] );
+		libblis_bench_mobj_create( p->dt, p->stor[ 2 ], p->k, p->n, &p->b[ i ] );
+		libblis_bench_mobj_create( p->dt, p->stor[ 0 ], p->m, p->n, &p->c[ i ] );
+	}
+}
+
+static void gemm_exec( bench_prob_t* p )
+{
+	for ( dim_t i = 0; i < p->batch; ++i )
+		bli_gemm( &BLIS_ONE, &p->a[ i ], &p->b[ i ], &BLIS_ONE, &p->c[ i ] );
+}
+
+// Execute gemm with the small/unpacked (sup) path disabled, so that only
+// the conventional (packing) implementation is measured.
+static void gemm_nat_exec( bench_prob_t* p )
+{
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+
+	bli_rntm_init_from_global( &rntm );
+	bli_rntm_disable_l3_sup( &rntm );
+
+	for ( dim_t i = 0; i < p->batch; ++i )
+		bli_gemm_ex( &BLIS_ONE, &p->a[ i ], &p->b[ i ], &BLIS_ONE, &p->c[ i ], NULL, &rntm );
+}
+
+static void gemm_tiny_exec( bench_prob_t* p )
+{
+	for ( dim_t i = 0; i < p->batch; ++i )
+	{
+		const obj_t* a = &p->a[ i ];
+		const obj_t* b = &p->b[ i ];
+		      obj_t* c = &p->c[ i ];
+
+		const void* one = bli_obj_buffer_for_const( p->dt, &BLIS_ONE );
+
+#undef  GENTCASE
+#define GENTCASE( ctype, ch ) \
+		case PASTEMAC(ch,type): \
+			PASTEMAC(ch,gemm_tiny) \
+			( \
+			  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, \
+			  p->m, p->n, p->k, \
+			  one, \
+			  bli_obj_buffer( a ), bli_obj_row_stride( a ), bli_obj_col_stride( a ), \
+			  bli_obj_buffer( b ), bli_obj_row_stride( b ), bli_obj_col_stride( b ), \
+			  one, \
+			  bli_obj_buffer( c ), bli_obj_row_stride( c ), bli_obj_col_stride( c ) \
+			); \
+			break;
+
+		switch ( p->dt )
+		{
+			GENTCASE( float,    s )
+			GENTCASE( double,   d )
+			GENTCASE( scomplex, c )
+			GENTCASE( dcomplex, z )
+			default: break;
+		}
+	}
+}
+
+static double gemm_flops( dim_t m, dim_t n, dim_t k ) { return 2.0 * m * n * k; }
+static double gemm_elems( dim_t m, dim_t n, dim_t k ) { return 1.0 * m * k + 1.0 * k * n + 2.0 * m * n; }
+
+static void gemm_kernels( const bench_prob_t* p, char* str, size_t len )
+{
+	libblis_bench_kernel_name2( p->dt, BLIS_GEMM_UKR, libblis_bench_gemmsup_ukr( p->stor ), str, len );
+}
+
+static void gemm_nat_kernels( const bench_prob_t* p, char* str, size_t len )
+{
+	libblis_bench_kernel_name( p->dt, BLIS_GEMM_UKR, str, len );
+}
+
+static void gemm_tiny_kernels( const bench_prob_t* p, char* str, size_t len )
+{
+	libblis_bench_kernel_name( p->dt, BLIS_GEMM_TINY_UKR, str, len );
+}
+
+// Create the operands of a strided batch of gemm problems as the first
+// problem of a batch stored contiguously, one matrix after another.
+static void libblis_bench_mobj_create_strided( num_t dt, char stor, dim_t m, dim_t n,
+                                               dim_t batch, obj_t* a )
+{
+	if ( stor == 'r' )
+	{
+		bli_obj_create( dt, m * batch, n, n, 1, a );
+		bli_randm( a );
+		bli_obj_set_length( m, a );
+	}
+	else
+	{
+		bli_obj_create( dt, m, n * batch, 1, m, a );
+		bli_randm( a );
+		bli_obj_set_width( n, a );
+	}
+}
+
+static void gemm_batch_strided_create( bench_prob_t* p )
+{
+	libblis_bench_prob_alloc( p, FALSE );
+
+	libblis_bench_mobj_create_strided( p->dt, p->stor[ 1 ], p->m, p->k, p->batch, &p->a[ 0 ] );
+	libblis_bench_mobj_create_strided( p->dt, p->stor[ 2 ], p->k, p->n, p->batch, &p->b[ 0 ] );
+	libblis_bench_mobj_create_strided( p->dt, p->stor[ 0 ], p->m, p->n, p->batch, &p->c[ 0 ] );
+}
+
+static void gemm_batch_strided_exec( bench_prob_t* p )
+{
+	bli_gemm_batch_strided
+	(
+	  &BLIS_ONE,
+	  &p->a[ 0 ], p->m * p->k,
+	  &p->b[ 0 ], p->k * p->n,
+	  &BLIS_ONE,
+	  &p->c[ 0 ], p->m * p->n,
+	  p->batch
+	);
+}
+
+#ifdef BLIS_ENABLE_BLAS
+
+// The BLAS interface requires column-stored operands, so the storage given
+// in the input file is ignored.
+static void gemm_batch_create( bench_prob_t* p )
+{
+	libblis_bench_prob_alloc( p, FALSE );
+
+	p->ptrs = malloc( 3 * p->batch * sizeof( void* ) );
+
+	for ( dim_t i = 0; i < p->batch; ++i )
+	{
+		libblis_bench_mobj_create( p->dt, 'c', p->m, p->k, &p->a[ i ] );
+		libblis_bench_mobj_create( p->dt, 'c', p->k, p->n, &p->b[ i ] );
+		libblis_bench_mobj_create( p->dt, 'c', p->m, p->n, &p->c[ i ] );
+
+		p->ptrs[ 0 * p->batch + i ] = bli_obj_buffer( &p->a[ i ] );
+		p->ptrs[ 1 * p->batch + i ] = bli_obj_buffer( &p->b[ i ] );
+		p->ptrs[ 2 * p->batch + i ] = bli_obj_buffer( &p->c[ i ] );
+	}
+}
+
+static void gemm_batch_exec( bench_prob_t* p )
+{
+	const f77_char trans       = 'N';
+	const f77_int  m           = p->m;
+	const f77_int  n           = p->n;
+	const f77_int  k           = p->k;
+	const f77_int  lda         = bli_obj_col_stride( &p->a[ 0 ] );
+	const f77_int  ldb         = bli_obj_col_stride( &p->b[ 0 ] );
+	const f77_int  ldc         = bli_obj_col_stride( &p->c[ 0 ] );
+	const f77_int  group_count = 1;
+	const f77_int  group_size  = p->batch;
+
+	const void*    one         = bli_obj_buffer_for_const( p->dt, &BLIS_ONE );
+	void**         a_array     = p->ptrs + 0 * p->batch;
+	void**         b_array     = p->ptrs + 1 * p->batch;
+	void**         c_array     = p->ptrs + 2 * p->batch;
+
+#undef  GENTCASE
+#define GENTCASE( ftype, ch ) \
+	case PASTEMAC(ch,type): \
+		PASTEF77(ch,gemm_batch) \
+		( \
+		  &trans, &trans, &m, &n, &k, \
+		  one, \
+		  ( const ftype** )a_array, &lda, \
+		  ( const ftype** )b_array, &ldb, \
+		  one, \
+		  ( ftype** )c_array, &ldc, \
+		  &group_count, &group_size \
+		); \
+		break;
+
+	switch ( p->dt )
+	{
+		GENTCASE( float,    s )
+		GENTCASE( double,   d )
+		GENTCASE( scomplex, c )
+		GENTCASE( dcomplex, z )
+		default: break;
+	}
+}
+
+static void gemm_batch_kernels( const bench_prob_t* p, char* str, size_t len )
+{
+	libblis_bench_kernel_name2( p->dt, BLIS_GEMM_UKR, BLIS_GEMMSUP_CCC_UKR, str, len );
+}
+
+#endif
+
+static void trsm_create( bench_prob_t* p )
+{
+	obj_t shift;
+
+	libblis_bench_prob_alloc( p, TRUE );
+
+	// Shift the diagonal of A so that the solution neither grows nor decays
+	// quickly from one repeat to the next.
+	bli_obj_create_1x1( p->dt, &shift );
+	bli_setsc( ( double )p->m, 0.0, &shift );
+
+	for ( dim_t i = 0; i < p->batch; ++i )
+	{
+		libblis_bench_mobj_create( p->dt, p->stor[ 1 ], p->m, p->m, &p->a[ i ] );
+		libblis_bench_mobj_create( p->dt, p->stor[ 0 ], p->m, p->n, &p->c[ i ] );
+		libblis_bench_mobj_create( p->dt, p->stor[ 0 ], p->m, p->n, &p->c_save[ i ] );
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, &p->a[ i ] );
+		bli_obj_set_uplo( BLIS_LOWER, &p->a[ i ] );
+		bli_shiftd( &shift, &p->a[ i ] );
+		bli_mktrim( &p->a[ i ] );
+
+		bli_copym( &p->c[ i ], &p->c_save[ i ] );
+	}
+
+	bli_obj_free( &shift );
+}
+
+static void trsm_reset( bench_prob_t* p )
+{
+	for ( dim_t i = 0; i < p->batch; ++i )
+		bli_copym( &p->c_save[ i ], &p->c[ i ] );
+}
+
+static void trsm_exec( bench_prob_t* p )
+{
+	for ( dim_t i = 0; i < p->batch; ++i )
+		bli_trsm( BLIS_LEFT, &BLIS_ONE, &p->a[ i ], &p->c[ i ] );
+}
+
+static double trsm_flops( dim_t m, dim_t n, dim_t k ) { return 1.0 * m * m * n; }
+static double trsm_elems( dim_t m, dim_t n, dim_t k ) { return 0.5 * m * m + 2.0 * m * n; }
+
+static void trsm_kernels( const bench_prob_t* p, char* str, size_t len )
+{
+	libblis_bench_kernel_name2( p->dt, BLIS_GEMMTRSM_L_UKR, BLIS_GEMM_UKR, str, len );
+}
+
+
+//
+// --- Operation table ---------------------------------------------------------
+//
+
+static const bench_op_t bench_ops[] =
+{
+	// name                 threaded create                     reset       exec                     flops        elems        kernels
+	{ "axpyv",              FALSE,   axpyv_create,              NULL,       axpyv_exec,              axpyv_flops, axpyv_elems, axpyv_kernels      },
+	{ "dotv",               FALSE,   dotv_create,               NULL,       dotv_exec,               dotv_flops,  dotv_elems,  dotv_kernels       },
+	{ "gemv",               FALSE,   gemv_create,               NULL,       gemv_exec,               gemv_flops,  gemv_elems,  gemv_kernels       },
+	{ "ger",                FALSE,   ger_create,                NULL,       ger_exec,                ger_flops,   ger_elems,   ger_kernels        },
+	{ "gemm",               TRUE,    gemm_create,               NULL,       gemm_exec,               gemm_flops,  gemm_elems,  gemm_kernels       },
+	{ "gemm_nat",           TRUE,    gemm_create,               NULL,       gemm_nat_exec,           gemm_flops,  gemm_elems,  gemm_nat_kernels   },
+	{ "gemm_tiny",          FALSE,   gemm_create,               NULL,       gemm_tiny_exec,          gemm_flops,  gemm_elems,  gemm_tiny_kernels  },
+	{ "gemm_batch_strided", TRUE,    gemm_batch_strided_create, NULL,       gemm_batch_strided_exec, gemm_flops,  gemm_elems,  gemm_kernels       },
+#ifdef BLIS_ENABLE_BLAS
+	{ "gemm_batch",         TRUE,    gemm_batch_create,         NULL,       gemm_batch_exec,         gemm_flops,  gemm_elems,  gemm_batch_kernels },
+#endif
+	{ "trsm",               TRUE,    trsm_create,               trsm_reset, trsm_exec,               trsm_flops,  trsm_elems,  trsm_kernels       },
+};
+
+const bench_op_t* libblis_bench_lookup_op( const char* name )
+{
+	for ( size_t i = 0; i < sizeof( bench_ops ) / sizeof( bench_ops[ 0 ] ); ++i )
+	{
+		if ( strcmp( bench_ops[ i ].name, name ) == 0 ) return &bench_ops[ i ];
+	}
+
+	return NULL;
+}
+
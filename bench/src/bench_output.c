@@ -0,0 +1,268 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "bench_libblis.h"
+
+
+//
+// --- Statistics --------------------------------------------------------------
+//
+
+static int libblis_bench_cmp_double( const void* a, const void* b )
+{
+	const double x = *( const double* )a;
+	const double y = *( const double* )b;
+
+	return ( x > y ) - ( x < y );
+}
+
+// Return the q-quantile (0 <= q <= 1) of the n sorted values in x, with
+// linear interpolation between neighbouring values.
+static double libblis_bench_quantile( const double* x, dim_t n, double q )
+{
+	const double pos = q * ( n - 1 );
+	const dim_t  lo  = ( dim_t )pos;
+	const dim_t  hi  = bli_min( lo + 1, n - 1 );
+
+	return x[ lo ] + ( pos - lo ) * ( x[ hi ] - x[ lo ] );
+}
+
+// Compute the statistics of the n times of individual instances and of the
+// n_walls times within which all instances completed (flops and bytes are
+// those of one instance).
+void libblis_bench_compute_stats( double flops, double bytes, double* times, dim_t n, double* walls, dim_t n_walls, bench_result_t* res )
+{
+	qsort( times, n,       sizeof( double ), libblis_bench_cmp_double );
+	qsort( walls, n_walls, sizeof( double ), libblis_bench_cmp_double );
+
+	const double t_min = times[ 0 ];
+	const double t_max = times[ n - 1 ];
+	const double t_med = libblis_bench_quantile( times, n, 0.50 );
+	const double t_p99 = libblis_bench_quantile( times, n, 0.99 );
+	const double t_q1  = libblis_bench_quantile( times, n, 0.25 );
+	const double t_q3  = libblis_bench_quantile( times, n, 0.75 );
+	const double t_agg = libblis_bench_quantile( walls, n_walls, 0.50 );
+
+	res->n_repeats    = n_walls;
+	res->time_med     = t_med;
+	res->time_p99     = t_p99;
+	res->gflops_med   = flops / t_med / FLOPS_PER_UNIT_PERF;
+	res->gflops_best  = flops / t_min / FLOPS_PER_UNIT_PERF;
+	res->gflops_p99   = flops / t_p99 / FLOPS_PER_UNIT_PERF;
+	res->gflops_worst = flops / t_max / FLOPS_PER_UNIT_PERF;
+	res->spread_pct   = 100.0 * ( t_q3 - t_q1 ) / t_med;
+	res->gbs_med      = bytes / t_med / BYTES_PER_UNIT_BW;
+	res->gflops_agg   = res->n_instances * flops / t_agg / FLOPS_PER_UNIT_PERF;
+}
+
+
+//
+// --- Output ------------------------------------------------------------------
+//
+
+void libblis_bench_output_header( FILE* os )
+{
+	fprintf( os, "%-18s %2s %4s %6s %6s %6s %5s %3s %4s %10s %10s %10s %10s %7s %9s %7s %10s\n",
+	         "op", "dt", "stor", "m", "n", "k", "batch", "nt", "inst",
+	         "gflops", "best", "p99", "worst", "spread", "GB/s", "roof", "aggregate" );
+}
+
+void libblis_bench_output_result( FILE* os, const bench_result_t* res )
+{
+	fprintf( os, "%-18s %2c %4s %6ld %6ld %6ld %5ld %3ld %4ld %10.3f %10.3f %10.3f %10.3f %6.1f%% %9.3f",
+	         res->op->name, res->dt_char, res->stor_str,
+	         ( long )res->m, ( long )res->n, ( long )res->k,
+	         ( long )res->batch, ( long )res->nt, ( long )res->n_instances,
+	         res->gflops_med, res->gflops_best, res->gflops_p99, res->gflops_worst,
+	         res->spread_pct, res->gbs_med );
+
+	if ( res->roof_pct >= 0.0 ) fprintf( os, " %6.1f%%", res->roof_pct );
+	else                        fprintf( os, " %7s", "-" );
+
+	fprintf( os, " %10.3f\n", res->gflops_agg );
+}
+
+// The datatypes in the order in which they are output.
+static const num_t bench_dts[ BLIS_NUM_FP_TYPES ] =
+{ BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+
+void libblis_bench_output_machine( FILE* os, const bench_machine_t* mach )
+{
+	fprintf( os, "%% %7s %9s %9s %9s %9s %9s %9s %9s %9s\n",
+	         "threads", "peak s", "peak d", "peak c", "peak z",
+	         bench_stream_names[ 0 ], bench_stream_names[ 1 ],
+	         bench_stream_names[ 2 ], bench_stream_names[ 3 ] );
+
+	for ( dim_t i = 0; i < 2; ++i )
+	{
+		fprintf( os, "%% %7ld", ( long )mach->nt[ i ] );
+
+		for ( dim_t j = 0; j < BLIS_NUM_FP_TYPES; ++j )
+			fprintf( os, " %9.3f", mach->gflops_peak[ i ][ bench_dts[ j ] ] );
+		for ( dim_t s = 0; s < BENCH_NUM_STREAM; ++s )
+			fprintf( os, " %9.3f", mach->gbs[ i ][ s ] );
+
+		fprintf( os, "\n" );
+	}
+
+	fprintf( os, "%% (peak flop rates of the gemm microkernels in GFLOPS; bandwidths of the\n"
+	             "%% level-1v kernels in GB/s)\n" );
+}
+
+static void libblis_bench_write_json_machine( FILE* os, const bench_machine_t* mach )
+{
+	fprintf( os, "  \"machine\": [\n" );
+
+	for ( dim_t i = 0; i < 2; ++i )
+	{
+		fprintf( os, "    { \"threads\": %ld, \"peak_gflops\": { ", ( long )mach->nt[ i ] );
+
+		for ( dim_t j = 0; j < BLIS_NUM_FP_TYPES; ++j )
+		{
+			char dt_char;
+
+			bli_param_map_blis_to_char_dt( bench_dts[ j ], &dt_char );
+
+			fprintf( os, "\"%c\": %.4f%s", dt_char, mach->gflops_peak[ i ][ bench_dts[ j ] ],
+			         j + 1 < BLIS_NUM_FP_TYPES ? ", " : "" );
+		}
+
+		fprintf( os, " }, \"bandwidth_gbs\": { " );
+
+		for ( dim_t s = 0; s < BENCH_NUM_STREAM; ++s )
+			fprintf( os, "\"%s\": %.4f%s", bench_stream_names[ s ], mach->gbs[ i ][ s ],
+			         s + 1 < BENCH_NUM_STREAM ? ", " : "" );
+
+		fprintf( os, " } }%s\n", i == 0 ? "," : "" );
+	}
+
+	fprintf( os, "  ],\n" );
+}
+
+static const char* libblis_bench_config_str( void )
+{
+	return bli_arch_string( bli_arch_query_id() );
+}
+
+void libblis_bench_write_json( const char* filename, const bench_machine_t* mach, const bench_result_t* res, dim_t n )
+{
+	FILE* os = fopen( filename, "w" );
+
+	if ( os == NULL )
+	{
+		fprintf( stderr, "bench: could not open '%s' for writing.\n", filename );
+		return;
+	}
+
+	fprintf( os, "{\n" );
+	fprintf( os, "  \"version\": \"%s\",\n", bli_info_get_version_str() );
+	fprintf( os, "  \"config\": \"%s\",\n", libblis_bench_config_str() );
+	fprintf( os, "  \"thread_impl\": \"%s\",\n",
+	         bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() ) );
+
+	if ( mach->valid ) libblis_bench_write_json_machine( os, mach );
+
+	fprintf( os, "  \"results\": [\n" );
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		const bench_result_t* r = &res[ i ];
+
+		fprintf( os, "    { \"op\": \"%s\", \"dt\": \"%c\", \"stor\": \"%s\", "
+		             "\"m\": %ld, \"n\": %ld, \"k\": %ld, \"batch\": %ld, "
+		             "\"threads\": %ld, \"instances\": %ld, \"evict_mb\": %ld, "
+		             "\"ways\": \"%s\", \"kernels\": \"%s\", "
+		             "\"repeats\": %ld, \"time_med\": %.6e, \"time_p99\": %.6e, "
+		             "\"gflops_med\": %.4f, \"gflops_best\": %.4f, "
+		             "\"gflops_p99\": %.4f, \"gflops_worst\": %.4f, "
+		             "\"spread_pct\": %.2f, \"gbs_med\": %.4f, "
+		             "\"gflops_agg\": %.4f, \"ai\": %.4f, \"roofline_pct\": ",
+		         r->op->name, r->dt_char, r->stor_str,
+		         ( long )r->m, ( long )r->n, ( long )r->k, ( long )r->batch,
+		         ( long )r->nt, ( long )r->n_instances, ( long )r->evict_mbytes,
+		         r->ways_str, r->kernel_str,
+		         ( long )r->n_repeats, r->time_med, r->time_p99,
+		         r->gflops_med, r->gflops_best, r->gflops_p99, r->gflops_worst,
+		         r->spread_pct, r->gbs_med, r->gflops_agg, r->ai );
+
+		if ( r->roof_pct >= 0.0 ) fprintf( os, "%.2f", r->roof_pct );
+		else                      fprintf( os, "null" );
+
+		fprintf( os, " }%s\n", i + 1 < n ? "," : "" );
+	}
+
+	fprintf( os, "  ]\n" );
+	fprintf( os, "}\n" );
+
+	fclose( os );
+}
+
+void libblis_bench_write_csv( const char* filename, const bench_result_t* res, dim_t n )
+{
+	FILE* os = fopen( filename, "w" );
+
+	if ( os == NULL )
+	{
+		fprintf( stderr, "bench: could not open '%s' for writing.\n", filename );
+		return;
+	}
+
+	fprintf( os, "version,config,op,dt,stor,m,n,k,batch,threads,instances,"
+	             "evict_mb,ways,kernels,repeats,time_med,time_p99,gflops_med,"
+	             "gflops_best,gflops_p99,gflops_worst,spread_pct,gbs_med,"
+	             "gflops_agg,ai,roofline_pct\n" );
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		const bench_result_t* r = &res[ i ];
+
+		fprintf( os, "%s,%s,%s,%c,%s,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%s,%s,%ld,%.6e,%.6e,"
+		             "%.4f,%.4f,%.4f,%.4f,%.2f,%.4f,%.4f,%.4f,",
+		         bli_info_get_version_str(), libblis_bench_config_str(),
+		         r->op->name, r->dt_char, r->stor_str,
+		         ( long )r->m, ( long )r->n, ( long )r->k, ( long )r->batch,
+		         ( long )r->nt, ( long )r->n_instances, ( long )r->evict_mbytes,
+		         r->ways_str, r->kernel_str,
+		         ( long )r->n_repeats, r->time_med, r->time_p99,
+		         r->gflops_med, r->gflops_best, r->gflops_p99, r->gflops_worst,
+		         r->spread_pct, r->gbs_med, r->gflops_agg, r->ai );
+
+		if ( r->roof_pct >= 0.0 ) fprintf( os, "%.2f\n", r->roof_pct );
+		else                      fprintf( os, "\n" );
+	}
+
+	fclose( os );
+}
+
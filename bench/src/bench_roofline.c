@@ -0,0 +1,321 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "bench_libblis.h"
+
+// The depths between which the gemm microkernel is timed. Only the
+// difference between the two timings is used to compute the peak flop rate,
+// which removes the cost of loading and storing C from the measurement.
+#define PEAK_K_LO           16
+#define PEAK_K_HI           256
+
+// The minimum duration of one timed batch of microkernel calls.
+#define PEAK_MIN_TIME       0.02
+
+#define NUM_TRIALS          3
+
+const char* bench_stream_names[ BENCH_NUM_STREAM ] = { "copy", "scale", "add", "triad" };
+
+
+//
+// --- Peak flop rate ----------------------------------------------------------
+//
+
+typedef struct peak_arg_s
+{
+	num_t                  dt;
+	dim_t                  n_calls;
+	bli_pthread_barrier_t* barrier;
+	double                 gflops;
+} peak_arg_t;
+
+static void* libblis_bench_peak_thread( void* arg_v )
+{
+	peak_arg_t*   arg  = arg_v;
+	const num_t   dt   = arg->dt;
+	const cntx_t* cntx = bli_gks_query_cntx();
+	gemm_ukr_ft   f    = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx );
+	const dim_t   mr   = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t   nr   = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t   pmr  = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+	const dim_t   pnr  = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+	const siz_t   dts  = bli_dt_size( dt );
+	const void*   one  = bli_obj_buffer_for_const( dt, &BLIS_ONE );
+	err_t         r_val;
+
+	// The micro-panels are zero so that C does not overflow.
+	void* a = bli_malloc_user( pmr * PEAK_K_HI * dts, &r_val );
+	void* b = bli_malloc_user( pnr * PEAK_K_HI * dts, &r_val );
+	void* c = bli_malloc_user( mr * nr * dts, &r_val );
+
+	memset( a, 0, pmr * PEAK_K_HI * dts );
+	memset( b, 0, pnr * PEAK_K_HI * dts );
+	memset( c, 0, mr * nr * dts );
+
+	auxinfo_t data;
+
+	bli_auxinfo_set_next_a( a, &data );
+	bli_auxinfo_set_next_b( b, &data );
+	bli_auxinfo_set_is_a( 1, &data );
+	bli_auxinfo_set_is_b( 1, &data );
+
+	double t_lo = DBL_MAX;
+	double t_hi = DBL_MAX;
+
+	for ( dim_t trial = 0; trial < NUM_TRIALS; ++trial )
+	{
+		for ( dim_t kk = 0; kk < 2; ++kk )
+		{
+			const dim_t k = kk == 0 ? PEAK_K_LO : PEAK_K_HI;
+
+			double t = libblis_bench_sync_clock( arg->barrier );
+
+			for ( dim_t i = 0; i < arg->n_calls; ++i )
+				f( mr, nr, k, one, a, b, one, c, 1, mr, &data, ( cntx_t* )cntx );
+
+			t = libblis_bench_sync_clock( arg->barrier ) - t;
+
+			if ( kk == 0 ) t_lo = bli_min( t_lo, t );
+			else           t_hi = bli_min( t_hi, t );
+		}
+	}
+
+	const double dt_scale = bli_is_complex( dt ) ? 4.0 : 1.0;
+	const double flops    = 2.0 * mr * nr * ( PEAK_K_HI - PEAK_K_LO ) *
+	                        arg->n_calls * dt_scale;
+
+	arg->gflops = flops / bli_max( t_hi - t_lo, 1e-9 ) / FLOPS_PER_UNIT_PERF;
+
+	bli_free_user( a );
+	bli_free_user( b );
+	bli_free_user( c );
+
+	return NULL;
+}
+
+// Measure the aggregate peak flop rate of nt threads, each running the gemm
+// microkernel for datatype dt on operands that reside in the L1 cache.
+static double libblis_bench_measure_peak( num_t dt, dim_t nt, dim_t n_calls )
+{
+	bli_pthread_barrier_t barrier;
+	peak_arg_t*           args = malloc( nt * sizeof( peak_arg_t ) );
+
+	bli_pthread_barrier_init( &barrier, NULL, nt );
+
+	for ( dim_t t = 0; t < nt; ++t )
+	{
+		args[ t ].dt      = dt;
+		args[ t ].n_calls = n_calls;
+		args[ t ].barrier = &barrier;
+	}
+
+	libblis_bench_run_concurrent( nt, libblis_bench_peak_thread, args, sizeof( peak_arg_t ) );
+
+	const double gflops = args[ 0 ].gflops * nt;
+
+	bli_pthread_barrier_destroy( &barrier );
+	free( args );
+
+	return gflops;
+}
+
+// Find a number of microkernel calls that takes at least PEAK_MIN_TIME at
+// depth PEAK_K_HI.
+static dim_t libblis_bench_calibrate_peak( num_t dt )
+{
+	const cntx_t* cntx  = bli_gks_query_cntx();
+	const dim_t   mr    = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t   nr    = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	dim_t         n_calls;
+
+	for ( n_calls = 64; ; n_calls *= 2 )
+	{
+		const double gflops = libblis_bench_measure_peak( dt, 1, n_calls );
+		const double t      = 2.0 * mr * nr * PEAK_K_HI * n_calls *
+		                      ( bli_is_complex( dt ) ? 4.0 : 1.0 ) /
+		                      ( gflops * FLOPS_PER_UNIT_PERF );
+
+		if ( t >= PEAK_MIN_TIME || n_calls >= ( 1 << 24 ) ) break;
+	}
+
+	return n_calls;
+}
+
+
+//
+// --- Memory bandwidth --------------------------------------------------------
+//
+
+typedef struct stream_arg_s
+{
+	dim_t                  n;
+	bli_pthread_barrier_t* barrier;
+	double                 time[ BENCH_NUM_STREAM ];
+} stream_arg_t;
+
+static void* libblis_bench_stream_thread( void* arg_v )
+{
+	stream_arg_t* arg   = arg_v;
+	const num_t   dt    = BLIS_DOUBLE;
+	const dim_t   n     = arg->n;
+	const cntx_t* cntx  = bli_gks_query_cntx();
+	const double  alpha = 3.0;
+	err_t         r_val;
+
+	copyv_ker_ft  copyv  = bli_cntx_get_ukr_dt( dt, BLIS_COPYV_KER,  cntx );
+	scal2v_ker_ft scal2v = bli_cntx_get_ukr_dt( dt, BLIS_SCAL2V_KER, cntx );
+	addv_ker_ft   addv   = bli_cntx_get_ukr_dt( dt, BLIS_ADDV_KER,   cntx );
+	axpyv_ker_ft  axpyv  = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER,  cntx );
+
+	// Each thread initializes its own vectors so that, on NUMA systems, they
+	// are placed in memory that is local to the thread.
+	double* x = bli_malloc_user( n * sizeof( double ), &r_val );
+	double* y = bli_malloc_user( n * sizeof( double ), &r_val );
+
+	for ( dim_t i = 0; i < n; ++i ) { x[ i ] = 1.0; y[ i ] = 2.0; }
+
+	for ( dim_t s = 0; s < BENCH_NUM_STREAM; ++s )
+		arg->time[ s ] = DBL_MAX;
+
+	for ( dim_t trial = 0; trial < NUM_TRIALS; ++trial )
+	{
+		for ( dim_t s = 0; s < BENCH_NUM_STREAM; ++s )
+		{
+			double t = libblis_bench_sync_clock( arg->barrier );
+
+			switch ( s )
+			{
+				case BENCH_STREAM_COPY:  copyv( BLIS_NO_CONJUGATE, n, x, 1, y, 1, ( cntx_t* )cntx ); break;
+				case BENCH_STREAM_SCALE: scal2v( BLIS_NO_CONJUGATE, n, &alpha, x, 1, y, 1, ( cntx_t* )cntx ); break;
+				case BENCH_STREAM_ADD:   addv( BLIS_NO_CONJUGATE, n, x, 1, y, 1, ( cntx_t* )cntx ); break;
+				case BENCH_STREAM_TRIAD: axpyv( BLIS_NO_CONJUGATE, n, &alpha, x, 1, y, 1, ( cntx_t* )cntx ); break;
+			}
+
+			t = libblis_bench_sync_clock( arg->barrier ) - t;
+
+			arg->time[ s ] = bli_min( arg->time[ s ], t );
+		}
+	}
+
+	bli_free_user( x );
+	bli_free_user( y );
+
+	return NULL;
+}
+
+// Measure the aggregate bandwidth of nt threads, each streaming through its
+// share of two vectors of the given total size with the level-1v kernels.
+static void libblis_bench_measure_stream( dim_t nt, size_t bytes, double* gbs )
+{
+	// The number of vectors read and written by each kernel.
+	const double n_vecs[ BENCH_NUM_STREAM ] = { 2.0, 2.0, 3.0, 3.0 };
+
+	bli_pthread_barrier_t barrier;
+	stream_arg_t*         args = malloc( nt * sizeof( stream_arg_t ) );
+	const dim_t           n    = bli_max( 1, bytes / sizeof( double ) / nt );
+
+	bli_pthread_barrier_init( &barrier, NULL, nt );
+
+	for ( dim_t t = 0; t < nt; ++t )
+	{
+		args[ t ].n       = n;
+		args[ t ].barrier = &barrier;
+	}
+
+	libblis_bench_run_concurrent( nt, libblis_bench_stream_thread, args, sizeof( stream_arg_t ) );
+
+	for ( dim_t s = 0; s < BENCH_NUM_STREAM; ++s )
+		gbs[ s ] = n_vecs[ s ] * n * nt * sizeof( double ) /
+		           args[ 0 ].time[ s ] / BYTES_PER_UNIT_BW;
+
+	bli_pthread_barrier_destroy( &barrier );
+	free( args );
+}
+
+
+//
+// --- Machine characterization and roofline -----------------------------------
+//
+
+void libblis_bench_characterize( dim_t nt_all, size_t stream_bytes, bench_machine_t* mach )
+{
+	mach->nt[ 0 ] = 1;
+	mach->nt[ 1 ] = nt_all;
+
+	for ( num_t dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	{
+		const dim_t n_calls = libblis_bench_calibrate_peak( dt );
+
+		for ( dim_t i = 0; i < 2; ++i )
+		{
+			if ( i == 1 && nt_all == 1 )
+				mach->gflops_peak[ 1 ][ dt ] = mach->gflops_peak[ 0 ][ dt ];
+			else
+				mach->gflops_peak[ i ][ dt ] = libblis_bench_measure_peak( dt, mach->nt[ i ], n_calls );
+		}
+	}
+
+	libblis_bench_measure_stream( 1, stream_bytes, mach->gbs[ 0 ] );
+
+	if ( nt_all == 1 )
+		memcpy( mach->gbs[ 1 ], mach->gbs[ 0 ], sizeof( mach->gbs[ 0 ] ) );
+	else
+		libblis_bench_measure_stream( nt_all, stream_bytes, mach->gbs[ 1 ] );
+
+	mach->valid = TRUE;
+}
+
+double libblis_bench_roofline_gflops( const bench_machine_t* mach, num_t dt, dim_t nt, double ai )
+{
+	// Complex operations may be computed with the 1m method, which runs at
+	// the speed of the real microkernel of the same precision.
+	const num_t dt_r = bli_dt_proj_to_real( dt );
+
+	double peak[ 2 ], bw[ 2 ];
+
+	for ( dim_t i = 0; i < 2; ++i )
+	{
+		peak[ i ] = bli_max( mach->gflops_peak[ i ][ dt ], mach->gflops_peak[ i ][ dt_r ] );
+		bw[ i ]   = mach->gbs[ i ][ BENCH_STREAM_TRIAD ];
+	}
+
+	// Interpolate between the single-threaded and all-thread measurements by
+	// assuming that each thread adds the single-threaded peak and bandwidth
+	// until the aggregate measurement is reached.
+	const double peak_nt = bli_min( nt * peak[ 0 ], peak[ 1 ] );
+	const double bw_nt   = bli_min( nt * bw[ 0 ],   bw[ 1 ] );
+
+	return bli_min( peak_nt, ai * bw_nt * BYTES_PER_UNIT_BW / FLOPS_PER_UNIT_PERF );
+}
@@ -0,0 +1,80 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// For sysconf().
+#if defined(__linux__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#include "blis.h"
+#include "bench_libblis.h"
+
+
+//
+// --- Concurrent execution ----------------------------------------------------
+//
+
+void libblis_bench_run_concurrent( dim_t nt, void* ( *func )( void* ), void* args, size_t arg_size )
+{
+	bli_pthread_t* threads = malloc( nt * sizeof( bli_pthread_t ) );
+
+	for ( dim_t t = 1; t < nt; ++t )
+		bli_pthread_create( &threads[ t ], NULL, func, ( char* )args + t * arg_size );
+
+	// The calling thread executes the first instance.
+	func( args );
+
+	for ( dim_t t = 1; t < nt; ++t )
+		bli_pthread_join( threads[ t ], NULL );
+
+	free( threads );
+}
+
+// Return the wall-clock time of executing the rest of a timed region in all
+// threads. Each thread calls this once before and once after the region.
+double libblis_bench_sync_clock( bli_pthread_barrier_t* barrier )
+{
+	bli_pthread_barrier_wait( barrier );
+
+	return bli_clock();
+}
+
+dim_t libblis_bench_num_cores( void )
+{
+#ifdef _SC_NPROCESSORS_ONLN
+	return bli_max( 1, sysconf( _SC_NPROCESSORS_ONLN ) );
+#else
+	return 1;
+#endif
+}
@@ -400,6 +400,7 @@ LIB_DIR            := lib
 INCLUDE_DIR        := include
 BLASTEST_DIR       := blastest
 TESTSUITE_DIR      := testsuite
+BENCH_DIR          := bench
 
 VEND_DIR           := vendor
 VEND_CPP_DIR       := $(VEND_DIR)/cpp
@@ -462,6 +463,14 @@ TESTSUITE_SALT_GEN := input.general.salt
 TESTSUITE_SALT_OPS := input.operations.salt
 TESTSUITE_OUT_FILE := output.testsuite
 
+# The names of the benchmark suite input files, comparison script, and
+# output files.
+BENCH_CONF         := input.bench
+BENCH_FAST_CONF    := input.bench.fast
+BENCH_COMPARE      := compare-bench.py
+BENCH_OUT_JSON     := output.bench.json
+BENCH_OUT_CSV      := output.bench.csv
+
 # CHANGELOG file.
 CHANGELOG          := CHANGELOG
 
@@ -51,6 +51,18 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  // level-3
 	  BLIS_GEMM_UKR,       BLIS_FLOAT ,   bli_sgemm_skx_asm_32x12_l2,
 	  BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_skx_asm_16x14,
+	  BLIS_GEMM_UKR,       BLIS_SCOMPLEX, bli_cgemm_skx_int_6x16,
+	  BLIS_GEMM_UKR,       BLIS_DCOMPLEX, bli_zgemm_skx_int_6x8,
+	  BLIS_GEMM_EDGE_UKR,  BLIS_FLOAT ,   bli_sgemm_skx_int_32x12_edge,
+	  BLIS_GEMM_EDGE_UKR,  BLIS_DOUBLE,   bli_dgemm_skx_int_16x14_edge,
+	  BLIS_GEMM_TINY_UKR,  BLIS_FLOAT ,   bli_sgemm_tiny_haswell,
+	  BLIS_GEMM_TINY_UKR,  BLIS_DOUBLE,   bli_dgemm_tiny_haswell,
+
+	  // packm
+	  BLIS_PACKM_KER,      BLIS_FLOAT ,   bli_spackm_skx_int_32x12,
+	  BLIS_PACKM_KER,      BLIS_DOUBLE,   bli_dpackm_skx_int_16x14,
+	  BLIS_PACKM_KER,      BLIS_SCOMPLEX, bli_cpackm_skx_int_6x16,
+	  BLIS_PACKM_KER,      BLIS_DCOMPLEX, bli_zpackm_skx_int_6x8,
 
 	  // axpyf
 	  BLIS_AXPYF_KER,     BLIS_FLOAT,  bli_saxpyf_zen_int_8,
@@ -96,6 +108,25 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int10,
 #endif
 
+	  // gemmsup
+	  BLIS_GEMMSUP_RRR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_DOUBLE, bli_dgemmsup_rd_skx_int_12x16m,
+	  BLIS_GEMMSUP_RCR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16m,
+	  BLIS_GEMMSUP_RCC_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_DOUBLE, bli_dgemmsup_rd_skx_int_12x16n,
+	  BLIS_GEMMSUP_CCR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16n,
+	  BLIS_GEMMSUP_CCC_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16n,
+
+	  BLIS_GEMMSUP_RRR_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_FLOAT , bli_sgemmsup_rd_skx_int_12x32m,
+	  BLIS_GEMMSUP_RCR_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32m,
+	  BLIS_GEMMSUP_RCC_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_FLOAT , bli_sgemmsup_rd_skx_int_12x32n,
+	  BLIS_GEMMSUP_CCR_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32n,
+	  BLIS_GEMMSUP_CCC_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32n,
+
 	  BLIS_VA_END
 	);
 
@@ -107,21 +138,61 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  // level-3
 	  BLIS_GEMM_UKR_ROW_PREF, BLIS_FLOAT , FALSE,
 	  BLIS_GEMM_UKR_ROW_PREF, BLIS_DOUBLE, FALSE,
+	  BLIS_GEMM_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMM_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMM_EDGE_UKR_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMM_EDGE_UKR_PREF, BLIS_DOUBLE, TRUE,
+
+	  // gemmsup
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
 
 	  BLIS_VA_END
 	);
 
 	// Initialize level-3 blocksize objects with architecture-specific values.
 	//                                           s      d      c      z
-	bli_blksz_init_easy( &blkszs[ BLIS_MR ],    32,    16,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    12,    14,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_MC ],   480,   240,    -1,    -1 );
-	bli_blksz_init     ( &blkszs[ BLIS_KC ],   384,   256,    -1,    -1,
-	                                           480,   320,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  3072,  3752,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MR ],    32,    16,     6,     6 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    12,    14,    16,     8 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC ],   480,   240,   144,    72 );
+	bli_blksz_init     ( &blkszs[ BLIS_KC ],   384,   256,   384,   256,
+	                                           480,   320,   480,   320 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  3072,  3752,  3072,  3752 );
 	bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,    5,    5 );
 	bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,    -1,    -1 );
 
+	// -------------------------------------------------------------------------
+
+	// Initialize sup thresholds with architecture-appropriate values.
+	//                                          s     d     c     z
+	bli_blksz_init_easy( &blkszs[ BLIS_MT ],  201,  201,   -1,   -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NT ],  201,  201,   -1,   -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KT ],  201,  201,   -1,   -1 );
+
+	// Initialize level-3 sup blocksize objects with architecture-specific
+	// values.
+	//                                           s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR_SUP ],    12,    12,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_SUP ],    32,    16,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_SUP ],   240,   120,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_SUP ],   256,   256,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_SUP ],  3072,  3072,    -1,    -1 );
+
 	// Update the context with the current architecture's register and cache
 	// blocksizes (and multiples) for native execution.
 	bli_cntx_set_blkszs
@@ -139,6 +210,18 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  BLIS_AF, &blkszs[ BLIS_AF ], BLIS_AF,
 	  BLIS_DF, &blkszs[ BLIS_DF ], BLIS_DF,
 
+	  // gemmsup thresholds
+	  BLIS_MT, &blkszs[ BLIS_MT ], BLIS_MT,
+	  BLIS_NT, &blkszs[ BLIS_NT ], BLIS_NT,
+	  BLIS_KT, &blkszs[ BLIS_KT ], BLIS_KT,
+
+	  // level-3 sup
+	  BLIS_NC_SUP, &blkszs[ BLIS_NC_SUP ], BLIS_NR_SUP,
+	  BLIS_KC_SUP, &blkszs[ BLIS_KC_SUP ], BLIS_KR_SUP,
+	  BLIS_MC_SUP, &blkszs[ BLIS_MC_SUP ], BLIS_MR_SUP,
+	  BLIS_NR_SUP, &blkszs[ BLIS_NR_SUP ], BLIS_NR_SUP,
+	  BLIS_MR_SUP, &blkszs[ BLIS_MR_SUP ], BLIS_MR_SUP,
+
 	  BLIS_VA_END
 	);
 }
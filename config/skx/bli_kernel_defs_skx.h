@@ -40,9 +40,13 @@
 
 #define BLIS_MR_s   32
 #define BLIS_MR_d   16
+#define BLIS_MR_c   6
+#define BLIS_MR_z   6
 
 #define BLIS_NR_s   12
 #define BLIS_NR_d   14
+#define BLIS_NR_c   16
+#define BLIS_NR_z   8
 
 //#endif
 
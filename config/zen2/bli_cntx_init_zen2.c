@@ -55,6 +55,14 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  BLIS_GEMM_UKR,       BLIS_SCOMPLEX, bli_cgemm_haswell_asm_3x8,
 	  BLIS_GEMM_UKR,       BLIS_DCOMPLEX, bli_zgemm_haswell_asm_3x4,
 
+	  // gemm (edge cases)
+	  BLIS_GEMM_EDGE_UKR,  BLIS_FLOAT,    bli_sgemm_haswell_int_6x16_edge,
+	  BLIS_GEMM_EDGE_UKR,  BLIS_DOUBLE,   bli_dgemm_haswell_int_6x8_edge,
+
+	  // gemm (tiny)
+	  BLIS_GEMM_TINY_UKR,  BLIS_FLOAT,    bli_sgemm_tiny_haswell,
+	  BLIS_GEMM_TINY_UKR,  BLIS_DOUBLE,   bli_dgemm_tiny_haswell,
+
 	  // gemmtrsm_l
 	  BLIS_GEMMTRSM_L_UKR, BLIS_FLOAT,    bli_sgemmtrsm_l_haswell_asm_6x16,
 	  BLIS_GEMMTRSM_L_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_l_haswell_asm_6x8,
@@ -164,6 +172,21 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  BLIS_VA_END
 	);
 
+	// Update the context with optimized mixed-precision packm kernels. These
+	// typecast A to the precision of the packed micropanel during packing.
+	bli_cntx_set_ukr2s
+	(
+	  cntx,
+
+	  // packm
+	  BLIS_PACKM_KER, BLIS_FLOAT,    BLIS_DOUBLE,   bli_sdpackm_haswell_int_6x8,
+	  BLIS_PACKM_KER, BLIS_DOUBLE,   BLIS_FLOAT,    bli_dspackm_haswell_int_6x16,
+	  BLIS_PACKM_KER, BLIS_SCOMPLEX, BLIS_DCOMPLEX, bli_czpackm_haswell_int_3x4,
+	  BLIS_PACKM_KER, BLIS_DCOMPLEX, BLIS_SCOMPLEX, bli_zcpackm_haswell_int_3x8,
+
+	  BLIS_VA_END
+	);
+
 	// Update the context with storage preferences.
 	bli_cntx_set_ukr_prefs
 	(
@@ -175,6 +198,10 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  BLIS_GEMM_UKR_ROW_PREF,       BLIS_SCOMPLEX, TRUE,
 	  BLIS_GEMM_UKR_ROW_PREF,       BLIS_DCOMPLEX, TRUE,
 
+	  // gemm (edge cases)
+	  BLIS_GEMM_EDGE_UKR_PREF,      BLIS_FLOAT,    TRUE,
+	  BLIS_GEMM_EDGE_UKR_PREF,      BLIS_DOUBLE,   TRUE,
+
 	  // gemmtrsm_l
 	  BLIS_GEMMTRSM_L_UKR_ROW_PREF, BLIS_FLOAT,    TRUE,
 	  BLIS_GEMMTRSM_L_UKR_ROW_PREF, BLIS_DOUBLE,   TRUE,
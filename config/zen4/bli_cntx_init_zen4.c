@@ -0,0 +1,220 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+void bli_cntx_init_zen4( cntx_t* cntx )
+{
+	blksz_t blkszs[ BLIS_NUM_BLKSZS ];
+
+	// Set default kernel blocksizes and functions.
+	bli_cntx_init_zen4_ref( cntx );
+
+	// -------------------------------------------------------------------------
+
+	// Update the context with optimized native gemm micro-kernels.
+	bli_cntx_set_ukrs
+	(
+	  cntx,
+
+	  // level-3
+	  BLIS_GEMM_UKR,       BLIS_FLOAT ,   bli_sgemm_skx_asm_32x12_l2,
+	  BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_skx_asm_16x14,
+	  BLIS_GEMM_UKR,       BLIS_SCOMPLEX, bli_cgemm_skx_int_6x16,
+	  BLIS_GEMM_UKR,       BLIS_DCOMPLEX, bli_zgemm_skx_int_6x8,
+	  BLIS_GEMM_EDGE_UKR,  BLIS_FLOAT ,   bli_sgemm_skx_int_32x12_edge,
+	  BLIS_GEMM_EDGE_UKR,  BLIS_DOUBLE,   bli_dgemm_skx_int_16x14_edge,
+	  BLIS_GEMM_TINY_UKR,  BLIS_FLOAT ,   bli_sgemm_tiny_haswell,
+	  BLIS_GEMM_TINY_UKR,  BLIS_DOUBLE,   bli_dgemm_tiny_haswell,
+
+	  // packm
+	  BLIS_PACKM_KER,      BLIS_FLOAT ,   bli_spackm_skx_int_32x12,
+	  BLIS_PACKM_KER,      BLIS_DOUBLE,   bli_dpackm_skx_int_16x14,
+	  BLIS_PACKM_KER,      BLIS_SCOMPLEX, bli_cpackm_skx_int_6x16,
+	  BLIS_PACKM_KER,      BLIS_DCOMPLEX, bli_zpackm_skx_int_6x8,
+
+	  // axpyf
+	  BLIS_AXPYF_KER,      BLIS_FLOAT,    bli_saxpyf_zen4_int_8,
+	  BLIS_AXPYF_KER,      BLIS_DOUBLE,   bli_daxpyf_zen4_int_8,
+	  BLIS_AXPYF_KER,      BLIS_SCOMPLEX, bli_caxpyf_zen_int_5,
+	  BLIS_AXPYF_KER,      BLIS_DCOMPLEX, bli_zaxpyf_zen_int_5,
+
+	  // dotxf
+	  BLIS_DOTXF_KER,      BLIS_FLOAT,    bli_sdotxf_zen4_int_8,
+	  BLIS_DOTXF_KER,      BLIS_DOUBLE,   bli_ddotxf_zen4_int_8,
+
+	  // amaxv
+	  BLIS_AMAXV_KER,      BLIS_FLOAT,    bli_samaxv_zen_int,
+	  BLIS_AMAXV_KER,      BLIS_DOUBLE,   bli_damaxv_zen_int,
+
+	  // axpyv
+	  BLIS_AXPYV_KER,      BLIS_FLOAT,    bli_saxpyv_zen4_int,
+	  BLIS_AXPYV_KER,      BLIS_DOUBLE,   bli_daxpyv_zen4_int,
+	  BLIS_AXPYV_KER,      BLIS_SCOMPLEX, bli_caxpyv_zen_int_5,
+	  BLIS_AXPYV_KER,      BLIS_DCOMPLEX, bli_zaxpyv_zen_int_5,
+
+	  // dotv
+	  BLIS_DOTV_KER,       BLIS_FLOAT,    bli_sdotv_zen4_int,
+	  BLIS_DOTV_KER,       BLIS_DOUBLE,   bli_ddotv_zen4_int,
+
+	  // dotxv
+	  BLIS_DOTXV_KER,      BLIS_FLOAT,    bli_sdotxv_zen4_int,
+	  BLIS_DOTXV_KER,      BLIS_DOUBLE,   bli_ddotxv_zen4_int,
+
+	  // scalv
+	  BLIS_SCALV_KER,      BLIS_FLOAT,    bli_sscalv_zen4_int,
+	  BLIS_SCALV_KER,      BLIS_DOUBLE,   bli_dscalv_zen4_int,
+
+	  // gemmsup
+	  BLIS_GEMMSUP_RRR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_DOUBLE, bli_dgemmsup_rd_skx_int_12x16m,
+	  BLIS_GEMMSUP_RCR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16m,
+	  BLIS_GEMMSUP_RCC_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_DOUBLE, bli_dgemmsup_rd_skx_int_12x16n,
+	  BLIS_GEMMSUP_CCR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16n,
+	  BLIS_GEMMSUP_CCC_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16n,
+
+	  BLIS_GEMMSUP_RRR_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_FLOAT , bli_sgemmsup_rd_skx_int_12x32m,
+	  BLIS_GEMMSUP_RCR_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32m,
+	  BLIS_GEMMSUP_RCC_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_FLOAT , bli_sgemmsup_rd_skx_int_12x32n,
+	  BLIS_GEMMSUP_CCR_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32n,
+	  BLIS_GEMMSUP_CCC_UKR, BLIS_FLOAT , bli_sgemmsup_rv_skx_int_12x32n,
+
+	  BLIS_VA_END
+	);
+
+	// Update the context with storage preferences.
+	bli_cntx_set_ukr_prefs
+	(
+	  cntx,
+
+	  // level-3
+	  BLIS_GEMM_UKR_ROW_PREF, BLIS_FLOAT , FALSE,
+	  BLIS_GEMM_UKR_ROW_PREF, BLIS_DOUBLE, FALSE,
+	  BLIS_GEMM_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMM_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMM_EDGE_UKR_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMM_EDGE_UKR_PREF, BLIS_DOUBLE, TRUE,
+
+	  // gemmsup
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_FLOAT , TRUE,
+
+	  BLIS_VA_END
+	);
+
+	// Initialize level-3 blocksize objects with architecture-specific values.
+	//
+	// Zen4 has a 32 KB L1d and a 1 MB L2 per core. KC is chosen so that a
+	// KC x NR micropanel of B stays resident in L1 while A is streamed from
+	// L2, and MC so that the MC x KC block of A occupies about two thirds
+	// of L2.
+	//                                           s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR ],    32,    16,     6,     6 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    12,    14,    16,     8 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC ],   416,   320,   240,   120 );
+	bli_blksz_init     ( &blkszs[ BLIS_KC ],   384,   256,   384,   256,
+	                                           480,   320,   480,   320 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  4080,  4032,  4080,  4080 );
+	bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,     5,     5 );
+	bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,    -1,    -1 );
+
+	// -------------------------------------------------------------------------
+
+	// Initialize sup thresholds with architecture-appropriate values.
+	//                                          s     d     c     z
+	bli_blksz_init_easy( &blkszs[ BLIS_MT ],  201,  201,   -1,   -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NT ],  201,  201,   -1,   -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KT ],  201,  201,   -1,   -1 );
+
+	// Initialize level-3 sup blocksize objects with architecture-specific
+	// values.
+	//                                           s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR_SUP ],    12,    12,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_SUP ],    32,    16,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_SUP ],   360,   240,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_SUP ],   384,   256,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_SUP ],  4096,  4080,    -1,    -1 );
+
+	// Update the context with the current architecture's register and cache
+	// blocksizes (and multiples) for native execution.
+	bli_cntx_set_blkszs
+	(
+	  cntx,
+
+	  // level-3
+	  BLIS_NC, &blkszs[ BLIS_NC ], BLIS_NR,
+	  BLIS_KC, &blkszs[ BLIS_KC ], BLIS_KR,
+	  BLIS_MC, &blkszs[ BLIS_MC ], BLIS_MR,
+	  BLIS_NR, &blkszs[ BLIS_NR ], BLIS_NR,
+	  BLIS_MR, &blkszs[ BLIS_MR ], BLIS_MR,
+
+	  // level-1f
+	  BLIS_AF, &blkszs[ BLIS_AF ], BLIS_AF,
+	  BLIS_DF, &blkszs[ BLIS_DF ], BLIS_DF,
+
+	  // gemmsup thresholds
+	  BLIS_MT, &blkszs[ BLIS_MT ], BLIS_MT,
+	  BLIS_NT, &blkszs[ BLIS_NT ], BLIS_NT,
+	  BLIS_KT, &blkszs[ BLIS_KT ], BLIS_KT,
+
+	  // level-3 sup
+	  BLIS_NC_SUP, &blkszs[ BLIS_NC_SUP ], BLIS_NR_SUP,
+	  BLIS_KC_SUP, &blkszs[ BLIS_KC_SUP ], BLIS_KR_SUP,
+	  BLIS_MC_SUP, &blkszs[ BLIS_MC_SUP ], BLIS_MR_SUP,
+	  BLIS_NR_SUP, &blkszs[ BLIS_NR_SUP ], BLIS_NR_SUP,
+	  BLIS_MR_SUP, &blkszs[ BLIS_MR_SUP ], BLIS_MR_SUP,
+
+	  BLIS_VA_END
+	);
+}
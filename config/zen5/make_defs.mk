@@ -0,0 +1,137 @@
+#
+#
+#  BLIS
+#  An object-based framework for developing high-performance BLAS-like
+#  libraries.
+#
+#  Copyright (C) 2026, The University of Texas at Austin
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#   - Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#   - Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#   - Neither the name(s) of the copyright holder(s) nor the names of its
+#     contributors may be used to endorse or promote products derived
+#     from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+#  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+#  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+#  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+#  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+#  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+#  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+#  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+#  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+#  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+#  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#
+
+
+# Declare the name of the current configuration and add it to the
+# running list of configurations included by common.mk.
+THIS_CONFIG    := zen5
+#CONFIGS_INCL   += $(THIS_CONFIG)
+
+#
+# --- Determine the C compiler and related flags ---
+#
+
+# NOTE: The build system will append these variables with various
+# general-purpose/configuration-agnostic flags in common.mk. You
+# may specify additional flags here as needed.
+CPPROCFLAGS    :=
+CMISCFLAGS     :=
+CPICFLAGS      := -fPIC
+CWARNFLAGS     :=
+
+ifneq ($(DEBUG_TYPE),off)
+CDBGFLAGS      := -g
+endif
+
+ifeq ($(DEBUG_TYPE),noopt)
+COPTFLAGS      := -O0
+else
+COPTFLAGS      := -O3
+endif
+
+# The AVX-512 instruction sets needed by the zen4 and skx kernels, for
+# compilers that do not yet recognize -march=znver4.
+CAVX512FLAGS       := -mavx512f -mavx512dq -mavx512bw -mavx512vl -mavx512cd
+
+# Flags specific to optimized and reference kernels.
+# NOTE: The -fomit-frame-pointer option is needed for some kernels because
+# they make explicit use of the rbp register.
+# NOTE: Unlike on skx, the reference kernels are also compiled for AVX-512,
+# since Zen5 executes 512-bit instructions without lowering its clock rate.
+CKOPTFLAGS         := $(COPTFLAGS) -fomit-frame-pointer
+CROPTFLAGS         := $(CKOPTFLAGS)
+CKVECFLAGS         := -mavx2 -mfma
+CRVECFLAGS         := $(CKVECFLAGS)
+ifeq ($(CC_VENDOR),gcc)
+  ifeq ($(GCC_OT_10_3_0),yes) # gcc versions older than 10.3.
+    CVECFLAGS_VER  := -march=skylake-avx512
+  else
+  ifeq ($(GCC_OT_13_1_0),yes) # gcc versions 10.3 or newer, but older than 13.1.
+    CVECFLAGS_VER  := -march=znver3 $(CAVX512FLAGS)
+  else
+  ifeq ($(GCC_OT_14_1_0),yes) # gcc versions 13.1 or newer, but older than 14.1.
+    CVECFLAGS_VER  := -march=znver4
+  else                        # gcc versions 14.1 or newer.
+    CVECFLAGS_VER  := -march=znver5
+  endif
+  endif
+  endif
+  CKVECFLAGS       += -mfpmath=sse
+  CRVECFLAGS       += -funsafe-math-optimizations -ffp-contract=fast
+else
+ifeq ($(CC_VENDOR),clang)
+  ifeq ($(CLANG_OT_12_0_0),yes) # clang versions older than 12.0.
+    CVECFLAGS_VER  := -march=skylake-avx512
+  else
+  ifeq ($(CLANG_OT_16_0_0),yes) # clang versions 12.0 or newer, but older than 16.0.
+    CVECFLAGS_VER  := -march=znver3 $(CAVX512FLAGS)
+  else
+  ifeq ($(OS_NAME),Darwin)      # Apple clang may lag behind in znver4/5 support.
+    CVECFLAGS_VER  := -march=znver3 $(CAVX512FLAGS)
+  else
+  ifeq ($(CLANG_OT_19_0_0),yes) # clang versions 16.0 or newer, but older than 19.0.
+    CVECFLAGS_VER  := -march=znver4
+  else                          # clang versions 19.0 or newer.
+    CVECFLAGS_VER  := -march=znver5
+  endif
+  endif
+  endif
+  endif
+  CKVECFLAGS       += -mfpmath=sse
+  CRVECFLAGS       += -funsafe-math-optimizations -ffp-contract=fast
+else
+ifeq ($(CC_VENDOR),aocc)
+  ifeq ($(AOCC_OT_3_0_0),yes)   # aocc versions older than 3.0.
+    CVECFLAGS_VER  := -march=skylake-avx512
+  else                          # aocc versions 3.0 or newer.
+    CVECFLAGS_VER  := -march=znver3 $(CAVX512FLAGS)
+  endif
+  CKVECFLAGS       += -mfpmath=sse
+  CRVECFLAGS       += -funsafe-math-optimizations -ffp-contract=fast
+else
+ifeq ($(CC_VENDOR),icc)
+  CVECFLAGS_VER    := -xCORE-AVX512
+else
+  $(error gcc, clang, aocc or icc is required for this configuration.)
+endif
+endif
+endif
+endif
+CKVECFLAGS         += $(CVECFLAGS_VER)
+CRVECFLAGS         += $(CVECFLAGS_VER)
+
+# Store all of the variables here to new variables containing the
+# configuration name.
+$(eval $(call store-make-defs,$(THIS_CONFIG)))
+
@@ -0,0 +1,229 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include "blis.h"
+
+#define NB 4
+
+void chol_tile( void* params );
+
+int main( int argc, char** argv )
+{
+	obj_t  a, a_save, l, r;
+	obj_t  akk[ NB ];
+	dim_t  n, b;
+	double resid, dummy;
+
+
+	//
+	// This file demonstrates recording a tiled Cholesky factorization as a
+	// graph of tasks (dag_t) and executing it on a pool of worker threads.
+	//
+
+	//
+	// Example 1: Build a symmetric positive definite matrix.
+	//
+
+	printf( "\n#\n#  -- Example 1 --\n#\n\n" );
+
+	// The matrix is partitioned into NB x NB tiles of size b x b.
+	b = 4; n = NB * b;
+
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &a_save );
+
+	// Randomize a and shift its diagonal by n so that it is positive definite
+	// once it is made symmetric.
+	bli_randm( &a );
+	bli_obj_set_struc( BLIS_SYMMETRIC, &a );
+	bli_obj_set_uplo( BLIS_LOWER, &a );
+	bli_mksymm( &a );
+	bli_obj_set_struc( BLIS_GENERAL, &a );
+	bli_obj_set_uplo( BLIS_DENSE, &a );
+
+	obj_t shift;
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &shift );
+	bli_setsc( ( double )n, 0.0, &shift );
+	bli_shiftd( &shift, &a );
+
+	bli_copym( &a, &a_save );
+
+	bli_printm( "a: symmetric positive definite", &a, "% 5.2f", "" );
+
+
+	//
+	// Example 2: Record the tiled Cholesky factorization A = L * L^T.
+	//
+
+	printf( "\n#\n#  -- Example 2 --\n#\n\n" );
+
+	// Create a dag_t whose tasks will run on four threads. No computation
+	// takes place while the tasks are recorded.
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+	bli_rntm_set_num_threads( 4, &rntm );
+
+	dag_t* dag = bli_dag_create( NULL, &rntm );
+
+	for ( dim_t k = 0; k < NB; ++k )
+	{
+		// Factorize the diagonal tile with a user-supplied task. The task's
+		// parameters must remain valid until the dag_t is executed, which is
+		// why the views of the diagonal tiles are kept in an array.
+		bli_acquire_mpart( k*b, k*b, b, b, &a, &akk[ k ] );
+
+		const obj_t* w[] = { &akk[ k ] };
+		bli_dag_func( chol_tile, &akk[ k ], 0, NULL, 1, w, dag );
+
+		// The views passed to level-3 operations are copied, so these may be
+		// reused as soon as the operation has been recorded.
+		obj_t lkk;
+		lkk = akk[ k ];
+		bli_obj_set_struc( BLIS_TRIANGULAR, &lkk );
+		bli_obj_set_uplo( BLIS_LOWER, &lkk );
+		bli_obj_set_onlytrans( BLIS_TRANSPOSE, &lkk );
+
+		// Update the tiles below the diagonal tile: A(i,k) := A(i,k) L(k,k)^-T.
+		for ( dim_t i = k + 1; i < NB; ++i )
+		{
+			obj_t aik;
+			bli_acquire_mpart( i*b, k*b, b, b, &a, &aik );
+			bli_dag_trsm( BLIS_RIGHT, &BLIS_ONE, &lkk, &aik, dag );
+		}
+
+		// Update the trailing tiles: A(i,j) := A(i,j) - A(i,k) A(j,k)^T.
+		for ( dim_t i = k + 1; i < NB; ++i )
+		{
+			obj_t aik, aii;
+			bli_acquire_mpart( i*b, k*b, b, b, &a, &aik );
+			bli_acquire_mpart( i*b, i*b, b, b, &a, &aii );
+			bli_obj_set_struc( BLIS_SYMMETRIC, &aii );
+			bli_obj_set_uplo( BLIS_LOWER, &aii );
+			bli_dag_syrk( &BLIS_MINUS_ONE, &aik, &BLIS_ONE, &aii, dag );
+
+			for ( dim_t j = k + 1; j < i; ++j )
+			{
+				obj_t ajk, aij;
+				bli_acquire_mpart( j*b, k*b, b, b, &a, &ajk );
+				bli_acquire_mpart( i*b, j*b, b, b, &a, &aij );
+				bli_obj_set_onlytrans( BLIS_TRANSPOSE, &ajk );
+				bli_dag_gemm( &BLIS_MINUS_ONE, &aik, &ajk, &BLIS_ONE, &aij, dag );
+			}
+		}
+	}
+
+	printf( "recorded %d tasks\n", ( int )bli_dag_num_tasks( dag ) );
+
+
+	//
+	// Example 3: Execute the tasks and check the factorization.
+	//
+
+	printf( "\n#\n#  -- Example 3 --\n#\n\n" );
+
+	// Tasks whose inputs are ready run concurrently; for example, once the
+	// first column of tiles has been factorized, the second diagonal tile
+	// may be factorized while the rest of the trailing matrix is updated.
+	bli_dag_execute( dag );
+	bli_dag_free( dag );
+
+	// Extract L from the lower triangle of a.
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &l );
+	bli_copym( &a, &l );
+	bli_obj_set_diag_offset( 1, &l );
+	bli_obj_set_uplo( BLIS_UPPER, &l );
+	bli_setm( &BLIS_ZERO, &l );
+	bli_obj_set_diag_offset( 0, &l );
+	bli_obj_set_uplo( BLIS_DENSE, &l );
+
+	bli_printm( "l: Cholesky factor", &l, "% 5.2f", "" );
+
+	// Compute r = a - l * l^T, which should be (numerically) zero.
+	obj_t lt;
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &r );
+	bli_copym( &a_save, &r );
+	bli_obj_alias_with_trans( BLIS_TRANSPOSE, &l, &lt );
+	bli_gemm( &BLIS_MINUS_ONE, &l, &lt, &BLIS_ONE, &r );
+
+	obj_t norm;
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &norm );
+	bli_normfm( &r, &norm );
+	bli_getsc( &norm, &resid, &dummy );
+
+	printf( "|| a - l * l^T ||_F = %.3e\n", resid );
+
+	// Free the objects.
+	bli_obj_free( &a );
+	bli_obj_free( &a_save );
+	bli_obj_free( &l );
+	bli_obj_free( &r );
+
+	return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+// Factorize the (lower triangle of the) b x b tile in place.
+void chol_tile( void* params )
+{
+	obj_t*  a   = params;
+	dim_t   n   = bli_obj_length( a );
+	double* p   = bli_obj_buffer_at_off( a );
+	inc_t   rs  = bli_obj_row_stride( a );
+	inc_t   cs  = bli_obj_col_stride( a );
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		double ajj = p[ j*rs + j*cs ];
+
+		for ( dim_t k = 0; k < j; ++k )
+			ajj -= p[ j*rs + k*cs ] * p[ j*rs + k*cs ];
+
+		ajj = sqrt( ajj );
+		p[ j*rs + j*cs ] = ajj;
+
+		for ( dim_t i = j + 1; i < n; ++i )
+		{
+			double aij = p[ i*rs + j*cs ];
+
+			for ( dim_t k = 0; k < j; ++k )
+				aij -= p[ i*rs + k*cs ] * p[ j*rs + k*cs ];
+
+			p[ i*rs + j*cs ] = aij / ajj;
+		}
+	}
+}
+
@@ -41,6 +41,7 @@
 #include "bli_packm_scalar.h"
 
 #include "bli_packm_struc_cxk.h"
+#include "bli_packm_sum.h"
 
 #include "bli_packm_blk_var1.h"
 
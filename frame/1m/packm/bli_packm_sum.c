@@ -0,0 +1,137 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             struc_t strucc, \
+             diag_t  diagc, \
+             uplo_t  uploc, \
+             conj_t  conjc, \
+             pack_t  schema, \
+             bool    invdiag, \
+             dim_t   panel_dim, \
+             dim_t   panel_len, \
+             dim_t   panel_dim_max, \
+             dim_t   panel_len_max, \
+             dim_t   panel_dim_off, \
+             dim_t   panel_len_off, \
+             dim_t   panel_bcast, \
+       const void*   kappa, \
+       const void*   c, inc_t incc, inc_t ldc, \
+             void*   p,             inc_t ldp, \
+       const void*   params, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const packm_sum_params_t* sparams = params; \
+\
+	const ctype kappa_cast = *( const ctype* )kappa; \
+	      ctype kappa_0    = kappa_cast * ( ctype )sparams->coef[ 0 ]; \
+\
+	/* Pack the first term, scaled by its coefficient, with the wrapped
+	   packing kernel. This also takes care of zero-filling the edges of
+	   the micropanel. */ \
+	sparams->ukr \
+	( \
+	  strucc, \
+	  diagc, \
+	  uploc, \
+	  conjc, \
+	  schema, \
+	  invdiag, \
+	  panel_dim, \
+	  panel_len, \
+	  panel_dim_max, \
+	  panel_len_max, \
+	  panel_dim_off, \
+	  panel_len_off, \
+	  panel_bcast, \
+	  &kappa_0, \
+	  c, incc, ldc, \
+	  p,       ldp, \
+	  sparams->params, \
+	  ( cntx_t* )cntx  \
+	); \
+\
+	ctype* restrict p_cast = p; \
+\
+	/* Accumulate the remaining terms into the packed micropanel. Only real
+	   domain operands are supported, so conjc may be ignored. */ \
+	for ( dim_t t = 1; t < sparams->n_terms; ++t ) \
+	{ \
+		const ctype* restrict c_t    = ( const ctype* )( ( const char* )c + sparams->off[ t ] ); \
+		const ctype           kappa_t = kappa_cast * ( ctype )sparams->coef[ t ]; \
+\
+		if ( panel_bcast == 1 ) \
+		{ \
+			for ( dim_t l = 0; l < panel_len; ++l ) \
+			for ( dim_t i = 0; i < panel_dim; ++i ) \
+				p_cast[ i + l*ldp ] += kappa_t * c_t[ i*incc + l*ldc ]; \
+		} \
+		else \
+		{ \
+			for ( dim_t l = 0; l < panel_len; ++l ) \
+			for ( dim_t i = 0; i < panel_dim; ++i ) \
+			{ \
+				const ctype cil = kappa_t * c_t[ i*incc + l*ldc ]; \
+\
+				for ( dim_t r = 0; r < panel_bcast; ++r ) \
+					p_cast[ i*panel_bcast + r + l*ldp ] += cil; \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCRO_BASIC( packm_sum )
+
+// -----------------------------------------------------------------------------
+
+void bli_packm_sum_ukr( num_t dt, func_t* ukr )
+{
+	static void_fp packm_sum_fp[ BLIS_NUM_FP_TYPES ] =
+	{
+		( void_fp )bli_spackm_sum, NULL,
+		( void_fp )bli_dpackm_sum, NULL,
+	};
+
+	bli_func_init_null( ukr );
+	bli_func_set_dt( packm_sum_fp[ dt ], dt, ukr );
+}
+
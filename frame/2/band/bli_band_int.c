@@ -0,0 +1,720 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The arguments of a band operation, shared by the threads that compute it.
+typedef struct
+{
+	      uplo_t  uploa;
+	      trans_t transa;
+	      diag_t  diaga;
+	      conj_t  conja;
+	      conj_t  conjx;
+	      conj_t  conjh;
+	      dim_t   m;
+	      dim_t   n;
+	      dim_t   kl;
+	      dim_t   ku;
+	const void*   alpha;
+	const void*   a;
+	      inc_t   rs_a;
+	      inc_t   cs_a;
+	const void*   x;
+	      inc_t   incx;
+	const void*   beta;
+	      void*   y;
+	      inc_t   incy;
+	const cntx_t* cntx;
+} band_params_t;
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             trans_t transa, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   kl, \
+             dim_t   ku, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	conj_t conja = bli_extract_conj( transa ); \
+	bool   trans = bli_does_trans( transa ); \
+\
+	/* The variants traverse the band by columns, so if the rows of A are
+	   stored with the smaller stride, we operate on A^T instead. */ \
+	if ( bli_abs( cs_a ) < bli_abs( rs_a ) ) \
+	{ \
+		bli_swap_dims( &m, &n ); \
+		bli_swap_dims( &kl, &ku ); \
+		bli_swap_incs( &rs_a, &cs_a ); \
+		trans = !trans; \
+	} \
+\
+	if ( trans ) \
+		PASTEMAC(ch,gbmv_unf_var1)( conja, conjx, m, n, kl, ku, alpha, \
+		                            a, rs_a, cs_a, x, incx, y, incy, cntx ); \
+	else \
+		PASTEMAC(ch,gbmv_unf_var2)( conja, conjx, m, n, kl, ku, alpha, \
+		                            a, rs_a, cs_a, x, incx, y, incy, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC( gbmv_unf )
+
+
+// Scale (or, if beta is zero, overwrite) the elements of y that a thread
+// computes.
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+             dim_t   n, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	if ( bli_teq0s( ch, *beta ) ) \
+		PASTEMAC(ch,setv,BLIS_TAPI_EX_SUF) \
+		( BLIS_NO_CONJUGATE, n, beta, y, incy, cntx, NULL ); \
+	else \
+		PASTEMAC(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( BLIS_NO_CONJUGATE, n, beta, y, incy, cntx, NULL ); \
+}
+
+INSERT_GENTFUNC_BASIC( band_scal_y )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname,_thread) \
+     ( \
+             thrcomm_t* gl_comm, \
+             dim_t      tid, \
+       const void*      params \
+     ) \
+{ \
+	const band_params_t* p = params; \
+\
+	const trans_t transa = p->transa; \
+	const dim_t   m      = p->m; \
+	const dim_t   n      = p->n; \
+	const dim_t   kl     = p->kl; \
+	const dim_t   ku     = p->ku; \
+	const inc_t   rs_a   = p->rs_a; \
+	const inc_t   cs_a   = p->cs_a; \
+	const inc_t   incx   = p->incx; \
+	const inc_t   incy   = p->incy; \
+	const ctype*  a      = p->a; \
+	const ctype*  x      = p->x; \
+	      ctype*  y      = p->y; \
+\
+	const bool  trans = bli_does_trans( transa ); \
+	const dim_t nt    = bli_thrcomm_num_threads( gl_comm ); \
+\
+	/* Each thread computes the elements i0 <= i < i1 of y. */ \
+	dim_t i0, i1; \
+	bli_thread_range_sub( tid, nt, trans ? n : m, 1, false, &i0, &i1 ); \
+\
+	if ( i1 <= i0 ) return; \
+\
+	PASTEMAC(ch,band_scal_y)( i1 - i0, p->beta, y + i0*incy, incy, p->cntx ); \
+\
+	/* Locate the rows r0 <= i < r1 and columns c0 <= j < c1 of A that
+	   contribute to these elements. */ \
+	dim_t r0, r1, c0, c1; \
+\
+	if ( trans ) { c0 = i0; c1 = i1; r0 = bli_max( 0, i0 - ku ); r1 = bli_min( m, i1 + kl ); } \
+	else         { r0 = i0; r1 = i1; c0 = bli_max( 0, i0 - kl ); c1 = bli_min( n, i1 + ku ); } \
+\
+	if ( r1 <= r0 || c1 <= c0 ) return; \
+\
+	/* The submatrix of A with its top-left element at A(r0,c0) is a band
+	   matrix with kl - ( r0 - c0 ) subdiagonals and ku + ( r0 - c0 )
+	   superdiagonals. */ \
+	PASTEMAC(ch,gbmv_unf) \
+	( \
+	  transa, \
+	  p->conjx, \
+	  r1 - r0, \
+	  c1 - c0, \
+	  kl - ( r0 - c0 ), \
+	  ku + ( r0 - c0 ), \
+	  p->alpha, \
+	  a + r0*rs_a + c0*cs_a, rs_a, cs_a, \
+	  x + ( trans ? r0 : c0 )*incx, incx, \
+	  y + i0*incy, incy, \
+	  p->cntx  \
+	); \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             trans_t transa, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   kl, \
+             dim_t   ku, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	band_params_t params = \
+	{ \
+	  .transa = transa, .conjx = conjx, \
+	  .m = m, .n = n, .kl = kl, .ku = ku, \
+	  .alpha = alpha, .a = a, .rs_a = rs_a, .cs_a = cs_a, \
+	  .x = x, .incx = incx, .beta = beta, .y = y, .incy = incy, \
+	  .cntx = cntx, \
+	}; \
+\
+	bli_l2_thread_launch( ( kl + ku + 1 ) * bli_min( m, n ), rntm, \
+	                      PASTEMAC(ch,varname,_thread), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( gbmv_int )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname,_thread) \
+     ( \
+             thrcomm_t* gl_comm, \
+             dim_t      tid, \
+       const void*      params \
+     ) \
+{ \
+	const band_params_t* p = params; \
+\
+	const conj_t  conja  = p->conja; \
+	const conj_t  conjx  = p->conjx; \
+	const conj_t  conjh  = p->conjh; \
+	const dim_t   m      = p->m; \
+	const dim_t   k      = p->kl; \
+	const inc_t   rs_a   = p->rs_a; \
+	const inc_t   cs_a   = p->cs_a; \
+	const inc_t   incx   = p->incx; \
+	const inc_t   incy   = p->incy; \
+	const ctype*  alpha  = p->alpha; \
+	const ctype*  a      = p->a; \
+	const ctype*  x      = p->x; \
+	      ctype*  y      = p->y; \
+	const cntx_t* cntx   = p->cntx; \
+\
+	/* The strictly upper triangle of A is the (conjugate) transpose of
+	   the strictly lower triangle. */ \
+	const trans_t transa  = ( trans_t )conja; \
+	const trans_t transat = bli_trans_toggled( ( trans_t )bli_apply_conj( conjh, conja ) ); \
+\
+	const dim_t nt = bli_thrcomm_num_threads( gl_comm ); \
+\
+	/* Each thread computes the elements i0 <= i < i1 of y. */ \
+	dim_t i0, i1; \
+	bli_thread_range_sub( tid, nt, m, 1, false, &i0, &i1 ); \
+\
+	if ( i1 <= i0 ) return; \
+\
+	PASTEMAC(ch,band_scal_y)( i1 - i0, p->beta, y + i0*incy, incy, cntx ); \
+\
+	/* Compute the elements in blocks, so that the part of the band that
+	   contributes to a block remains in cache for both passes over it. */ \
+	const dim_t nb = bli_max( BLIS_L2_BAND_BLOCK_WORK / ( k + 1 ), 1 ); \
+\
+	for ( dim_t p0 = i0; p0 < i1; p0 += nb ) \
+	{ \
+		const dim_t p1 = bli_min( i1, p0 + nb ); \
+		const dim_t c0 = bli_max( 0, p0 - k ); \
+		const dim_t r1 = bli_min( m, p1 + k ); \
+\
+		/* y1 = y1 + alpha * tril( A10, -1 ) * x0; */ \
+		PASTEMAC(ch,gbmv_unf) \
+		( \
+		  transa, conjx, \
+		  p1 - p0, p1 - c0, k - ( p0 - c0 ), -1 + ( p0 - c0 ), \
+		  alpha, \
+		  a + p0*rs_a + c0*cs_a, rs_a, cs_a, \
+		  x + c0*incx, incx, \
+		  y + p0*incy, incy, \
+		  cntx  \
+		); \
+\
+		/* y1 = y1 + alpha * tril( A21, -1 )^H * x2; */ \
+		PASTEMAC(ch,gbmv_unf) \
+		( \
+		  transat, conjx, \
+		  r1 - p0, p1 - p0, k, -1, \
+		  alpha, \
+		  a + p0*rs_a + p0*cs_a, rs_a, cs_a, \
+		  x + p0*incx, incx, \
+		  y + p0*incy, incy, \
+		  cntx  \
+		); \
+\
+		/* y1 = y1 + alpha * diag( A11 ) * x1; */ \
+		for ( dim_t i = p0; i < p1; ++i ) \
+		{ \
+			ctype alpha11, alpha_chi1; \
+\
+			bli_tcopycjs( ch,ch, conja, a[ i*rs_a + i*cs_a ], alpha11 ); \
+\
+			/* For hbmv, ignore the imaginary part of the diagonal. */ \
+			if ( bli_is_conj( conjh ) ) \
+				bli_tseti0s( ch, alpha11 ); \
+\
+			bli_tcopycjs( ch,ch, conjx, x[ i*incx ], alpha_chi1 ); \
+			bli_tscals( ch,ch,ch, *alpha, alpha_chi1 ); \
+			bli_taxpys( ch,ch,ch,ch, alpha11, alpha_chi1, y[ i*incy ] ); \
+		} \
+	} \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             conj_t  conja, \
+             conj_t  conjx, \
+             conj_t  conjh, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	/* The algorithm is expressed in terms of the lower triangular case;
+	   the upper triangular case is supported by swapping the row and
+	   column strides of A and, for hbmv, toggling the conjugation of A. */ \
+	if ( bli_is_upper( uploa ) ) \
+	{ \
+		bli_swap_incs( &rs_a, &cs_a ); \
+		conja = bli_apply_conj( conjh, conja ); \
+	} \
+\
+	band_params_t params = \
+	{ \
+	  .conja = conja, .conjx = conjx, .conjh = conjh, \
+	  .m = m, .kl = k, \
+	  .alpha = alpha, .a = a, .rs_a = rs_a, .cs_a = cs_a, \
+	  .x = x, .incx = incx, .beta = beta, .y = y, .incy = incy, \
+	  .cntx = cntx, \
+	}; \
+\
+	bli_l2_thread_launch( ( 2 * k + 1 ) * m, rntm, \
+	                      PASTEMAC(ch,varname,_thread), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( hbmv_int )
+
+
+// Multiply (tbmv) or solve (tbsv) in place with a triangular band matrix.
+// A is m x m with k subdiagonals (if lower) or superdiagonals (if upper).
+// A band stored by columns is traversed by columns with axpyv, and a band
+// stored by rows by rows with dotxv, in the order that leaves the elements
+// of x that are still needed intact. Segments shorter than the fusing
+// factor are computed inline, since they would not amortize the cost of a
+// kernel call.
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             conj_t  conja, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	dotxv_ker_ft kfp_dv = bli_cntx_get_ukr_dt( dt, BLIS_DOTXV_KER, cntx ); \
+	dim_t        b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_AF, cntx ); \
+\
+	const bool  lower   = bli_is_lower( uploa ); \
+	const bool  by_rows = ( bli_abs( cs_a ) < bli_abs( rs_a ) ); \
+\
+	ctype* one = PASTEMAC(ch,1); \
+\
+	ctype alpha11, alpha1, chi1; \
+\
+	for ( dim_t iter = 0; iter < m; ++iter ) \
+	{ \
+		const dim_t j = ( lower ? m - iter - 1 : iter ); \
+\
+		/* The off-diagonal elements of row (or column) j lie in columns
+		   (or rows) l_beg <= l < l_end. */ \
+		const dim_t l_beg = ( lower == by_rows ? bli_max( 0, j - k ) : j + 1 ); \
+		const dim_t l_end = ( lower == by_rows ? j : bli_min( m, j + k + 1 ) ); \
+\
+		bli_tcopycjs( ch,ch, conja, a[ j*rs_a + j*cs_a ], alpha11 ); \
+\
+		if ( by_rows ) \
+		{ \
+			/* chi1 = alpha11 * chi1 + a10^T * x0; (or a12^T * x2) */ \
+			if ( bli_is_nonunit_diag( diaga ) ) \
+				bli_tscals( ch,ch,ch, alpha11, x[ j*incx ] ); \
+\
+			if ( l_end - l_beg >= b_fuse ) \
+				kfp_dv( conja, BLIS_NO_CONJUGATE, l_end - l_beg, one, \
+				        a + j*rs_a + l_beg*cs_a, cs_a, x + l_beg*incx, incx, \
+				        one, x + j*incx, cntx ); \
+			else \
+				for ( dim_t l = l_beg; l < l_end; ++l ) \
+				{ \
+					bli_tcopycjs( ch,ch, conja, a[ j*rs_a + l*cs_a ], alpha1 ); \
+					bli_taxpys( ch,ch,ch,ch, alpha1, x[ l*incx ], x[ j*incx ] ); \
+				} \
+		} \
+		else \
+		{ \
+			/* x2 = x2 + chi1 * a21; (or x0 = x0 + chi1 * a01;)
+			   chi1 = alpha11 * chi1; */ \
+			chi1 = x[ j*incx ]; \
+\
+			if ( l_end - l_beg >= b_fuse ) \
+				kfp_av( conja, l_end - l_beg, &chi1, \
+				        a + l_beg*rs_a + j*cs_a, rs_a, x + l_beg*incx, incx, cntx ); \
+			else \
+				for ( dim_t l = l_beg; l < l_end; ++l ) \
+				{ \
+					bli_tcopycjs( ch,ch, conja, a[ l*rs_a + j*cs_a ], alpha1 ); \
+					bli_taxpys( ch,ch,ch,ch, alpha1, chi1, x[ l*incx ] ); \
+				} \
+\
+			if ( bli_is_nonunit_diag( diaga ) ) \
+				bli_tscals( ch,ch,ch, alpha11, x[ j*incx ] ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( tbmv_unb )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             conj_t  conja, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	dotxv_ker_ft kfp_dv = bli_cntx_get_ukr_dt( dt, BLIS_DOTXV_KER, cntx ); \
+	dim_t        b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_AF, cntx ); \
+\
+	const bool  lower   = bli_is_lower( uploa ); \
+	const bool  by_rows = ( bli_abs( cs_a ) < bli_abs( rs_a ) ); \
+\
+	ctype* one       = PASTEMAC(ch,1); \
+	ctype* minus_one = PASTEMAC(ch,m1); \
+\
+	ctype alpha11, alpha1, minus_chi1; \
+\
+	for ( dim_t iter = 0; iter < m; ++iter ) \
+	{ \
+		const dim_t j = ( lower ? iter : m - iter - 1 ); \
+\
+		/* The off-diagonal elements of row (or column) j lie in columns
+		   (or rows) l_beg <= l < l_end. */ \
+		const dim_t l_beg = ( lower == by_rows ? bli_max( 0, j - k ) : j + 1 ); \
+		const dim_t l_end = ( lower == by_rows ? j : bli_min( m, j + k + 1 ) ); \
+\
+		/* chi1 = chi1 - a10^T * x0; (or a12^T * x2) */ \
+		if ( by_rows ) \
+		{ \
+			if ( l_end - l_beg >= b_fuse ) \
+				kfp_dv( conja, BLIS_NO_CONJUGATE, l_end - l_beg, minus_one, \
+				        a + j*rs_a + l_beg*cs_a, cs_a, x + l_beg*incx, incx, \
+				        one, x + j*incx, cntx ); \
+			else \
+				for ( dim_t l = l_beg; l < l_end; ++l ) \
+				{ \
+					bli_tcopycjs( ch,ch, conja, a[ j*rs_a + l*cs_a ], alpha1 ); \
+					bli_tneg2s( ch,ch, alpha1, alpha1 ); \
+					bli_taxpys( ch,ch,ch,ch, alpha1, x[ l*incx ], x[ j*incx ] ); \
+				} \
+		} \
+\
+		/* chi1 = chi1 / alpha11; */ \
+		if ( bli_is_nonunit_diag( diaga ) ) \
+		{ \
+			bli_tcopycjs( ch,ch, conja, a[ j*rs_a + j*cs_a ], alpha11 ); \
+			bli_tinvscals( ch,ch,ch, alpha11, x[ j*incx ] ); \
+		} \
+\
+		/* x2 = x2 - chi1 * a21; (or x0 = x0 - chi1 * a01;) */ \
+		if ( !by_rows ) \
+		{ \
+			bli_tneg2s( ch,ch, x[ j*incx ], minus_chi1 ); \
+\
+			if ( l_end - l_beg >= b_fuse ) \
+				kfp_av( conja, l_end - l_beg, &minus_chi1, \
+				        a + l_beg*rs_a + j*cs_a, rs_a, x + l_beg*incx, incx, cntx ); \
+			else \
+				for ( dim_t l = l_beg; l < l_end; ++l ) \
+				{ \
+					bli_tcopycjs( ch,ch, conja, a[ l*rs_a + j*cs_a ], alpha1 ); \
+					bli_taxpys( ch,ch,ch,ch, alpha1, minus_chi1, x[ l*incx ] ); \
+				} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( tbsv_unb )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname,_thread) \
+     ( \
+             thrcomm_t* gl_comm, \
+             dim_t      tid, \
+       const void*      params \
+     ) \
+{ \
+	const band_params_t* p = params; \
+\
+	const uplo_t  uploa  = p->uploa; \
+	const conj_t  conja  = p->conja; \
+	const diag_t  diaga  = p->diaga; \
+	const dim_t   m      = p->m; \
+	const dim_t   k      = p->kl; \
+	const inc_t   rs_a   = p->rs_a; \
+	const inc_t   cs_a   = p->cs_a; \
+	const inc_t   incx   = p->incy; \
+	const ctype*  alpha  = p->alpha; \
+	const ctype*  a      = p->a; \
+	      ctype*  x      = p->y; \
+	const cntx_t* cntx   = p->cntx; \
+\
+	ctype* one = PASTEMAC(ch,1); \
+\
+	const dim_t nt = bli_thrcomm_num_threads( gl_comm ); \
+\
+	if ( nt == 1 ) \
+	{ \
+		/* x = alpha * x; */ \
+		PASTEMAC(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( BLIS_NO_CONJUGATE, m, alpha, x, incx, cntx, NULL ); \
+\
+		/* x = A * x; */ \
+		PASTEMAC(ch,tbmv_unb) \
+		( \
+		  uploa, conja, diaga, m, k, \
+		  a, rs_a, cs_a, \
+		  x, incx, \
+		  cntx  \
+		); \
+\
+		return; \
+	} \
+\
+	/* With multiple threads, the product is computed out of place from a
+	   copy w of alpha * x, with each thread computing a range of elements
+	   of x. */ \
+	ctype* w = NULL; \
+\
+	if ( tid == 0 ) \
+	{ \
+		err_t r_val; \
+		w = bli_malloc_intl( m * sizeof( ctype ), &r_val ); \
+	} \
+\
+	w = bli_thrcomm_bcast( tid, w, gl_comm ); \
+\
+	dim_t i0, i1; \
+	bli_thread_range_sub( tid, nt, m, 1, false, &i0, &i1 ); \
+\
+	/* w1 = alpha * x1; */ \
+	PASTEMAC(ch,scal2v,BLIS_TAPI_EX_SUF) \
+	( BLIS_NO_CONJUGATE, i1 - i0, alpha, x + i0*incx, incx, w + i0, 1, cntx, NULL ); \
+\
+	bli_thrcomm_barrier( tid, gl_comm ); \
+\
+	/* x1 = diag( A11 ) * w1; */ \
+	for ( dim_t i = i0; i < i1; ++i ) \
+	{ \
+		x[ i*incx ] = w[ i ]; \
+\
+		if ( bli_is_nonunit_diag( diaga ) ) \
+		{ \
+			ctype alpha11; \
+			bli_tcopycjs( ch,ch, conja, a[ i*rs_a + i*cs_a ], alpha11 ); \
+			bli_tscals( ch,ch,ch, alpha11, x[ i*incx ] ); \
+		} \
+	} \
+\
+	/* x1 = x1 + tril( A1, -1 ) * w; (or triu( A1, 1 ) * w) */ \
+	const dim_t kl = ( bli_is_lower( uploa ) ? k : -1 ); \
+	const dim_t ku = ( bli_is_lower( uploa ) ? -1 : k ); \
+	const dim_t c0 = bli_max( 0, i0 - kl ); \
+	const dim_t c1 = bli_min( m, i1 + ku ); \
+\
+	if ( i0 < i1 && c0 < c1 ) \
+		PASTEMAC(ch,gbmv_unf) \
+		( \
+		  ( trans_t )conja, BLIS_NO_CONJUGATE, \
+		  i1 - i0, c1 - c0, kl - ( i0 - c0 ), ku + ( i0 - c0 ), \
+		  one, \
+		  a + i0*rs_a + c0*cs_a, rs_a, cs_a, \
+		  w + c0, 1, \
+		  x + i0*incx, incx, \
+		  cntx  \
+		); \
+\
+	bli_thrcomm_barrier( tid, gl_comm ); \
+\
+	if ( tid == 0 ) bli_free_intl( w ); \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	/* Express transa( A ) as conja( A ) by swapping the row and column
+	   strides of A and toggling its uplo. */ \
+	if ( bli_does_trans( transa ) ) \
+	{ \
+		bli_swap_incs( &rs_a, &cs_a ); \
+		bli_toggle_uplo( &uploa ); \
+	} \
+\
+	band_params_t params = \
+	{ \
+	  .uploa = uploa, .conja = bli_extract_conj( transa ), .diaga = diaga, \
+	  .m = m, .kl = k, \
+	  .alpha = alpha, .a = a, .rs_a = rs_a, .cs_a = cs_a, \
+	  .y = x, .incy = incx, \
+	  .cntx = cntx, \
+	}; \
+\
+	bli_l2_thread_launch( ( k + 1 ) * m, rntm, \
+	                      PASTEMAC(ch,varname,_thread), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( tbmv_int )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	/* The solve is inherently sequential, so rntm is not consulted. */ \
+	( void )rntm; \
+\
+	/* Express transa( A ) as conja( A ) by swapping the row and column
+	   strides of A and toggling its uplo. */ \
+	const conj_t conja = bli_extract_conj( transa ); \
+\
+	if ( bli_does_trans( transa ) ) \
+	{ \
+		bli_swap_incs( &rs_a, &cs_a ); \
+		bli_toggle_uplo( &uploa ); \
+	} \
+\
+	/* x = alpha * x; */ \
+	PASTEMAC(ch,scalv,BLIS_TAPI_EX_SUF) \
+	( BLIS_NO_CONJUGATE, m, alpha, x, incx, cntx, NULL ); \
+\
+	/* x = inv( A ) * x; */ \
+	PASTEMAC(ch,tbsv_unb) \
+	( \
+	  uploa, conja, diaga, m, k, \
+	  a, rs_a, cs_a, \
+	  x, incx, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( tbsv_int )
+
@@ -0,0 +1,167 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             conj_t  conja, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   kl, \
+             dim_t   ku, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Query the context for the kernel function pointers and fusing
+	   factor. */ \
+	axpyf_ker_ft kfp_af = bli_cntx_get_ukr_dt( dt, BLIS_AXPYF_KER, cntx ); \
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	dim_t        b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_AF, cntx ); \
+\
+	/* Only the columns j_beg <= j < j_end intersect rows 0 <= i < m. */ \
+	const dim_t j_beg = bli_max( 0, -kl ); \
+	const dim_t j_end = bli_min( n, m + ku ); \
+\
+	/* A band narrower than the fusing factor cannot fill the axpyf
+	   kernel, so each of its columns is computed inline. */ \
+	if ( kl + ku + 1 < 2 * b_fuse ) \
+	{ \
+		for ( dim_t c = j_beg; c < j_end; ++c ) \
+		{ \
+			const dim_t  c_beg = bli_max( 0, c - ku ); \
+			const dim_t  c_end = bli_min( m, c + kl + 1 ); \
+			const ctype* a1    = a + c*cs_a; \
+\
+			ctype alpha_chi1; \
+\
+			bli_tcopycjs( ch,ch, conjx, x[ c*incx ], alpha_chi1 ); \
+			bli_tscals( ch,ch,ch, *alpha, alpha_chi1 ); \
+\
+			for ( dim_t i = c_beg; i < c_end; ++i ) \
+			{ \
+				ctype alpha1; \
+				bli_tcopycjs( ch,ch, conja, a1[ i*rs_a ], alpha1 ); \
+				bli_taxpys( ch,ch,ch,ch, alpha_chi1, alpha1, y[ i*incy ] ); \
+			} \
+		} \
+\
+		return; \
+	} \
+\
+	dim_t f; \
+\
+	for ( dim_t j = j_beg; j < j_end; j += f ) \
+	{ \
+		f = bli_min( b_fuse, j_end - j ); \
+\
+		/* Column c of the band spans rows max( 0, c - ku ) <= i <
+		   min( m, c + kl + 1 ); the rows i_beg <= i < i_end are spanned by
+		   all columns of the current block. */ \
+		dim_t i_beg = bli_max( 0, j + f - 1 - ku ); \
+		dim_t i_end = bli_min( m, j + kl + 1 ); \
+\
+		/* If the block has no rows in common, process each column in its
+		   entirety below. */ \
+		if ( i_end <= i_beg ) { i_beg = m; i_end = m; } \
+		else \
+		{ \
+			/* y1 = y1 + alpha * A1 * x1; */ \
+			kfp_af \
+			( \
+			  conja, \
+			  conjx, \
+			  i_end - i_beg, \
+			  f, \
+			  alpha, \
+			  a + i_beg*rs_a + j*cs_a, rs_a, cs_a, \
+			  x + j*incx, incx, \
+			  y + i_beg*incy, incy, \
+			  cntx  \
+			); \
+		} \
+\
+		/* Update y with the leading and trailing elements of each column
+		   that lie outside of the rows in common. Pieces shorter than the
+		   fusing factor (all of them, if the band is narrow) are computed
+		   inline, since they would not amortize the cost of a kernel
+		   call. */ \
+		for ( dim_t c = j; c < j + f; ++c ) \
+		{ \
+			const dim_t c_beg = bli_max( 0, c - ku ); \
+			const dim_t c_end = bli_min( m, c + kl + 1 ); \
+			const dim_t p_beg[ 2 ] = { c_beg, bli_max( i_end, c_beg ) }; \
+			const dim_t p_end[ 2 ] = { bli_min( i_beg, c_end ), c_end }; \
+\
+			ctype alpha_chi1; \
+\
+			bli_tcopycjs( ch,ch, conjx, x[ c*incx ], alpha_chi1 ); \
+			bli_tscals( ch,ch,ch, *alpha, alpha_chi1 ); \
+\
+			for ( dim_t p = 0; p < 2; ++p ) \
+			{ \
+				const dim_t n_p = p_end[ p ] - p_beg[ p ]; \
+				const ctype* a_p = a + p_beg[ p ]*rs_a + c*cs_a; \
+				      ctype* y_p = y + p_beg[ p ]*incy; \
+\
+				if ( n_p >= b_fuse ) \
+				{ \
+					kfp_av( conja, n_p, &alpha_chi1, a_p, rs_a, y_p, incy, cntx ); \
+				} \
+				else \
+				{ \
+					for ( dim_t i = 0; i < n_p; ++i ) \
+					{ \
+						ctype alpha1; \
+						bli_tcopycjs( ch,ch, conja, a_p[ i*rs_a ], alpha1 ); \
+						bli_taxpys( ch,ch,ch,ch, alpha_chi1, alpha1, y_p[ i*incy ] ); \
+					} \
+				} \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( gbmv_unf_var2 )
+
@@ -0,0 +1,182 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// A band matrix A with kl subdiagonals and ku superdiagonals is described
+// by a pointer to A(0,0) and the strides rs_a and cs_a: element A(i,j),
+// where -ku <= i - j <= kl, is located at a[ i*rs_a + j*cs_a ], and the
+// elements outside of the band are never referenced. The band storage of
+// the BLAS (column j of the band stored in column j of an array with
+// leading dimension lda, with A(j,j) in row ku) corresponds to a pointer
+// to A(0,0) at offset ku, rs_a = 1, and cs_a = lda - 1; the row-major band
+// storage of the CBLAS corresponds to rs_a = lda - 1 and cs_a = 1. The
+// same description, with kl = 0 or ku = 0, is used for the stored triangle
+// of a symmetric, Hermitian, or triangular band matrix.
+//
+
+// The number of elements of a band that are processed together, and thus
+// kept in cache, between the two passes that hbmv/sbmv make over the band
+// (one for the stored triangle and one for its transpose).
+#ifndef BLIS_L2_BAND_BLOCK_WORK
+#define BLIS_L2_BAND_BLOCK_WORK 16384
+#endif
+
+
+//
+// Prototype the variants that update y with the product of a band matrix
+// and x in terms of level-1f kernels: var1 computes y += alpha * A^T * x
+// with dotxf, and var2 computes y += alpha * A * x with axpyf, with both
+// traversing the band by columns.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             conj_t  conja, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   kl, \
+             dim_t   ku, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( gbmv_unf_var1 )
+INSERT_GENTPROT_BASIC( gbmv_unf_var2 )
+
+
+//
+// Prototype the function that computes y += alpha * transa(A) * conjx(x)
+// for a band matrix A with the variant that traverses the band along
+// whichever of its rows or columns is stored with unit stride (or the
+// smaller stride). kl and ku may be negative, in which case the band
+// excludes the diagonal.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             trans_t transa, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   kl, \
+             dim_t   ku, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( gbmv_unf )
+
+
+//
+// Prototype the internal back-ends of the band operations, which divide
+// the elements of the output vector among threads.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             trans_t transa, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   kl, \
+             dim_t   ku, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( gbmv_int )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             conj_t  conja, \
+             conj_t  conjx, \
+             conj_t  conjh, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( hbmv_int )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( tbmv_int )
+INSERT_GENTPROT_BASIC( tbsv_int )
+
@@ -72,3 +72,8 @@
 #include "bli_trmv.h"
 #include "bli_trsv.h"
 
+// Band and packed storage
+#include "bli_l2_thread.h"
+#include "bli_l2_band.h"
+#include "bli_l2_packed.h"
+
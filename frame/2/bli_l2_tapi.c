@@ -509,5 +509,416 @@ INSERT_GENTFUNC_BASIC( trmv, trmv, trmv_unf_var1, trmv_unf_var2 )
 INSERT_GENTFUNC_BASIC( trsv, trmv, trsv_unf_var1, trsv_unf_var2 )
 
 
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, intname ) \
+\
+void PASTEMAC(ch,opname,EX_SUF) \
+     ( \
+             trans_t transa, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   kl, \
+             dim_t   ku, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	dim_t m_y, n_x; \
+\
+	/* Determine the dimensions of y and x. */ \
+	bli_set_dims_with_trans( transa, m, n, &m_y, &n_x ); \
+\
+	/* If y has zero elements, return early. */ \
+	if ( bli_zero_dim1( m_y ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( n_x ) || bli_teq0s( ch, *alpha ) ) \
+	{ \
+		PASTEMAC(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m_y, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Diagonals beyond the corners of A contain no elements. */ \
+	kl = bli_min( kl, m - 1 ); \
+	ku = bli_min( ku, n - 1 ); \
+\
+	PASTEMAC(ch,intname) \
+	( \
+	  transa, \
+	  conjx, \
+	  m, \
+	  n, \
+	  kl, \
+	  ku, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  x, incx, \
+	  beta, \
+	  y, incy, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( gbmv, gbmv_int )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, intname, conjh ) \
+\
+void PASTEMAC(ch,opname,EX_SUF) \
+     ( \
+             uplo_t uploa, \
+             conj_t conja, \
+             conj_t conjx, \
+             dim_t  m, \
+             dim_t  k, \
+       const ctype* alpha, \
+       const ctype* a, inc_t rs_a, inc_t cs_a, \
+       const ctype* x, inc_t incx, \
+       const ctype* beta, \
+             ctype* y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( m ) || bli_teq0s( ch, *alpha ) ) \
+	{ \
+		PASTEMAC(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Diagonals beyond the corners of A contain no elements. */ \
+	k = bli_min( k, m - 1 ); \
+\
+	PASTEMAC(ch,intname) \
+	( \
+	  uploa, \
+	  conja, \
+	  conjx, \
+	  conjh, /* used to distinguish hbmv from sbmv */ \
+	  m, \
+	  k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  x, incx, \
+	  beta, \
+	  y, incy, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( hbmv, hbmv_int, BLIS_CONJUGATE )
+INSERT_GENTFUNC_BASIC( sbmv, hbmv_int, BLIS_NO_CONJUGATE )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, intname ) \
+\
+void PASTEMAC(ch,opname,EX_SUF) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( bli_teq0s( ch, *alpha ) ) \
+	{ \
+		PASTEMAC(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Diagonals beyond the corners of A contain no elements. */ \
+	k = bli_min( k, m - 1 ); \
+\
+	PASTEMAC(ch,intname) \
+	( \
+	  uploa, \
+	  transa, \
+	  diaga, \
+	  m, \
+	  k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  x, incx, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( tbmv, tbmv_int )
+INSERT_GENTFUNC_BASIC( tbsv, tbsv_int )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, intname, conjh ) \
+\
+void PASTEMAC(ch,opname,EX_SUF) \
+     ( \
+             uplo_t uploa, \
+             conj_t conja, \
+             conj_t conjx, \
+             dim_t  m, \
+       const ctype* alpha, \
+       const ctype* ap, \
+       const ctype* x, inc_t incx, \
+       const ctype* beta, \
+             ctype* y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( m ) || bli_teq0s( ch, *alpha ) ) \
+	{ \
+		PASTEMAC(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,intname) \
+	( \
+	  uploa, \
+	  conja, \
+	  conjx, \
+	  conjh, /* used to distinguish hpmv from spmv */ \
+	  m, \
+	  alpha, \
+	  ap, \
+	  x, incx, \
+	  beta, \
+	  y, incy, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( hpmv, hpmv_int, BLIS_CONJUGATE )
+INSERT_GENTFUNC_BASIC( spmv, hpmv_int, BLIS_NO_CONJUGATE )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, intname, conjh ) \
+\
+void PASTEMAC(ch,opname,EX_SUF) \
+     ( \
+             uplo_t   uploa, \
+             conj_t   conjx, \
+             dim_t    m, \
+       const ctype_r* alpha, \
+       const ctype*   x, inc_t incx, \
+             ctype*   ap  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	ctype alpha_local; \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || bli_teq0s( chr, *alpha ) ) return; \
+\
+	/* Make a local copy of alpha, cast into the complex domain, so that
+	   the same back-end implements both hpr and spr. */ \
+	bli_tcopys( chr,ch, *alpha, alpha_local ); \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	PASTEMAC(ch,intname) \
+	( \
+	  uploa, \
+	  conjx, \
+	  conjh, /* used to distinguish hpr from spr */ \
+	  m, \
+	  &alpha_local, \
+	  x, incx, \
+	  ap, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC( hpr, hpr_int, BLIS_CONJUGATE )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, intname, conjh ) \
+\
+void PASTEMAC(ch,opname,EX_SUF) \
+     ( \
+             uplo_t uploa, \
+             conj_t conjx, \
+             dim_t  m, \
+       const ctype* alpha, \
+       const ctype* x, inc_t incx, \
+             ctype* ap  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || bli_teq0s( ch, *alpha ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	PASTEMAC(ch,intname) \
+	( \
+	  uploa, \
+	  conjx, \
+	  conjh, \
+	  m, \
+	  alpha, \
+	  x, incx, \
+	  ap, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( spr, hpr_int, BLIS_NO_CONJUGATE )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, intname ) \
+\
+void PASTEMAC(ch,opname,EX_SUF) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  ap, \
+             ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( bli_teq0s( ch, *alpha ) ) \
+	{ \
+		PASTEMAC(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,intname) \
+	( \
+	  uploa, \
+	  transa, \
+	  diaga, \
+	  m, \
+	  alpha, \
+	  ap, \
+	  x, incx, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( tpmv, tpmv_int )
+INSERT_GENTFUNC_BASIC( tpsv, tpsv_int )
+
+
 #endif
 
@@ -0,0 +1,85 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+void bli_l2_thread_launch
+     (
+             dim_t         work,
+       const rntm_t*       rntm,
+             thread_func_t func,
+       const void*         params
+     )
+{
+	// Problems that are too small to be worth parallelizing are computed
+	// by the calling thread without consulting the runtime.
+	if ( work < 2 * BLIS_L2_THREAD_MIN_WORK )
+	{
+		func( &BLIS_SINGLE_COMM, 0, params );
+		return;
+	}
+
+	rntm_t rntm_l;
+	if ( rntm != NULL ) rntm_l = *rntm;
+	else bli_rntm_init_from_global( &rntm_l );
+
+	// Reserve the threads from the thread budget. The ways of parallelism
+	// are irrelevant here; only the total number of threads is used.
+	bli_rntm_factorize( work, 1, 0, &rntm_l );
+
+	const dim_t budget_grant = bli_rntm_budget_grant( &rntm_l );
+
+	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
+	dim_t   nt = bli_rntm_num_threads( &rntm_l );
+
+	// As in the level-3 thread decorators, diagnose a threading
+	// implementation that is unavailable (or a custom one for which no
+	// launcher was registered).
+	if ( bli_error_checking_is_enabled() )
+		bli_l3_thread_decorator_check( &rntm_l );
+
+	if ( !bli_rntm_auto_factor( &rntm_l ) )
+		nt = bli_rntm_jc_ways( &rntm_l ) * bli_rntm_pc_ways( &rntm_l ) *
+		     bli_rntm_ic_ways( &rntm_l ) * bli_rntm_jr_ways( &rntm_l ) *
+		     bli_rntm_ir_ways( &rntm_l );
+
+	nt = bli_min( nt, work / BLIS_L2_THREAD_MIN_WORK );
+
+	if ( nt < 1 || ti == BLIS_SINGLE ) nt = 1;
+
+	bli_thread_launch( nt == 1 ? BLIS_SINGLE : ti, nt, func, params );
+
+	bli_thread_budget_release( budget_grant );
+}
+
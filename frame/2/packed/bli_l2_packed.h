@@ -0,0 +1,114 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// A symmetric, Hermitian, or triangular matrix in packed storage is stored
+// as in the BLAS: the columns of its lower (or upper) triangle are stored
+// one after another, so that element A(i,j) of the m x m matrix is located
+// at ap[ i - j + j*m - j*(j-1)/2 ] for i >= j (if lower), or at
+// ap[ i + j*(j+1)/2 ] for i <= j (if upper). The row-major packed storage of
+// the CBLAS corresponds to the packed storage of the transpose, with the
+// opposite uplo.
+//
+
+// Return the offset of the first stored element of column j.
+BLIS_INLINE dim_t bli_packed_col_off( uplo_t uplo, dim_t m, dim_t j )
+{
+	return ( bli_is_lower( uplo ) ? j*m - ( j*( j - 1 ) )/2
+	                              : ( j*( j + 1 ) )/2 );
+}
+
+
+//
+// Prototype the internal back-ends of the packed operations.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             conj_t  conja, \
+             conj_t  conjx, \
+             conj_t  conjh, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  ap, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( hpmv_int )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             conj_t  conjx, \
+             conj_t  conjh, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  x, inc_t incx, \
+             ctype*  ap, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( hpr_int )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  ap, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( tpmv_int )
+INSERT_GENTPROT_BASIC( tpsv_int )
+
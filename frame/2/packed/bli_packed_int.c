@@ -0,0 +1,593 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The arguments of a packed operation, shared by the threads that compute
+// it.
+typedef struct
+{
+	      uplo_t  uploa;
+	      conj_t  conja;
+	      conj_t  conjx;
+	      conj_t  conjh;
+	      dim_t   m;
+	const void*   alpha;
+	      void*   ap;
+	const void*   x;
+	      inc_t   incx;
+	const void*   beta;
+	      void*   y;
+	      inc_t   incy;
+	const cntx_t* cntx;
+} packed_params_t;
+
+// Divide the columns of a packed triangle among nt threads so that each
+// thread is assigned about the same number of elements. Column j of the
+// upper triangle holds j + 1 elements, so the columns before column c hold
+// c*(c+1)/2 of them; the lower triangle is partitioned as the mirror image
+// of the upper triangle.
+static void bli_packed_range
+     (
+       uplo_t uplo,
+       dim_t  tid,
+       dim_t  nt,
+       dim_t  m,
+       dim_t* c0,
+       dim_t* c1
+     )
+{
+	const double total = 0.5 * ( double )m * ( double )( m + 1 );
+
+	dim_t bound[ 2 ];
+
+	for ( dim_t b = 0; b < 2; ++b )
+	{
+		const dim_t t = ( bli_is_lower( uplo ) ? nt - tid - b : tid + b );
+
+		if      ( t == 0  ) bound[ b ] = 0;
+		else if ( t == nt ) bound[ b ] = m;
+		else
+		{
+			const double work = total * ( double )t / ( double )nt;
+			const dim_t  c    = ( dim_t )( 0.5 * ( sqrt( 1.0 + 8.0 * work ) - 1.0 ) + 0.5 );
+
+			bound[ b ] = bli_min( bli_max( c, 0 ), m );
+		}
+
+		if ( bli_is_lower( uplo ) ) bound[ b ] = m - bound[ b ];
+	}
+
+	*c0 = bound[ 0 ];
+	*c1 = bound[ 1 ];
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname,_thread) \
+     ( \
+             thrcomm_t* gl_comm, \
+             dim_t      tid, \
+       const void*      params \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	const packed_params_t* p = params; \
+\
+	const uplo_t  uploa  = p->uploa; \
+	const conj_t  conja  = p->conja; \
+	const conj_t  conjx  = p->conjx; \
+	const conj_t  conjh  = p->conjh; \
+	const dim_t   m      = p->m; \
+	const inc_t   incx   = p->incx; \
+	const inc_t   incy   = p->incy; \
+	const ctype*  alpha  = p->alpha; \
+	const ctype*  beta   = p->beta; \
+	const ctype*  ap     = p->ap; \
+	const ctype*  x      = p->x; \
+	      ctype*  y      = p->y; \
+	const cntx_t* cntx   = p->cntx; \
+\
+	ctype* zero = PASTEMAC(ch,0); \
+\
+	const conj_t conjat = bli_apply_conj( conjh, conja ); \
+	const dim_t  nt     = bli_thrcomm_num_threads( gl_comm ); \
+\
+	/* With one thread, y is updated in place. With multiple threads, each
+	   thread accumulates the contributions of its columns of A into a
+	   vector z of its own, and the vectors are then summed into y. */ \
+	ctype* ws = NULL; \
+	ctype* z; \
+	inc_t  incz; \
+	dim_t  c0, c1; \
+\
+	if ( nt == 1 ) \
+	{ \
+		if ( bli_teq0s( ch, *beta ) ) \
+			PASTEMAC(ch,setv,BLIS_TAPI_EX_SUF)( BLIS_NO_CONJUGATE, m, beta, y, incy, cntx, NULL ); \
+		else \
+			PASTEMAC(ch,scalv,BLIS_TAPI_EX_SUF)( BLIS_NO_CONJUGATE, m, beta, y, incy, cntx, NULL ); \
+\
+		z = y; incz = incy; c0 = 0; c1 = m; \
+	} \
+	else \
+	{ \
+		if ( tid == 0 ) \
+		{ \
+			err_t r_val; \
+			ws = bli_malloc_intl( nt * m * sizeof( ctype ), &r_val ); \
+		} \
+\
+		ws = bli_thrcomm_bcast( tid, ws, gl_comm ); \
+\
+		z = ws + tid * m; incz = 1; \
+\
+		PASTEMAC(ch,setv,BLIS_TAPI_EX_SUF)( BLIS_NO_CONJUGATE, m, zero, z, incz, cntx, NULL ); \
+\
+		bli_packed_range( uploa, tid, nt, m, &c0, &c1 ); \
+	} \
+\
+	/* Query the context for the kernel function pointer. */ \
+	dotaxpyv_ker_ft kfp_dav = bli_cntx_get_ukr_dt( dt, BLIS_DOTAXPYV_KER, cntx ); \
+\
+	for ( dim_t j = c0; j < c1; ++j ) \
+	{ \
+		/* Locate the off-diagonal part of column j (a21 if lower, a01 if
+		   upper) and the parts of x and z that it multiplies and updates. */ \
+		const ctype* a1    = ap + bli_packed_col_off( uploa, m, j ); \
+		const ctype* alpha11; \
+		const ctype* a_off; \
+		const ctype* x_off; \
+		      ctype* z_off; \
+		      dim_t  n_off; \
+\
+		if ( bli_is_lower( uploa ) ) \
+		{ \
+			alpha11 = a1; \
+			a_off   = a1 + 1; \
+			x_off   = x + ( j + 1 )*incx; \
+			z_off   = z + ( j + 1 )*incz; \
+			n_off   = m - j - 1; \
+		} \
+		else \
+		{ \
+			alpha11 = a1 + j; \
+			a_off   = a1; \
+			x_off   = x; \
+			z_off   = z; \
+			n_off   = j; \
+		} \
+\
+		ctype conja_alpha11, alpha_chi1, rho; \
+\
+		bli_tcopycjs( ch,ch, conja, *alpha11, conja_alpha11 ); \
+\
+		/* For hpmv, ignore the imaginary part of the diagonal. */ \
+		if ( bli_is_conj( conjh ) ) \
+			bli_tseti0s( ch, conja_alpha11 ); \
+\
+		bli_tcopycjs( ch,ch, conjx, x[ j*incx ], alpha_chi1 ); \
+		bli_tscals( ch,ch,ch, *alpha, alpha_chi1 ); \
+		bli_tset0s( ch, rho ); \
+\
+		/* rho = conjat( a_off )^T * conjx( x_off );
+		   z_off = z_off + alpha * chi1 * conja( a_off ); */ \
+		kfp_dav \
+		( \
+		  conjat, \
+		  conja, \
+		  conjx, \
+		  n_off, \
+		  &alpha_chi1, \
+		  a_off, 1, \
+		  x_off, incx, \
+		  &rho, \
+		  z_off, incz, \
+		  cntx  \
+		); \
+\
+		/* zeta1 = zeta1 + alpha * rho + alpha * chi1 * alpha11; */ \
+		bli_taxpys( ch,ch,ch,ch, *alpha, rho, z[ j*incz ] ); \
+		bli_taxpys( ch,ch,ch,ch, conja_alpha11, alpha_chi1, z[ j*incz ] ); \
+	} \
+\
+	if ( nt == 1 ) return; \
+\
+	bli_thrcomm_barrier( tid, gl_comm ); \
+\
+	/* Each thread scales a range of y by beta and adds to it the
+	   corresponding elements of all of the vectors z. */ \
+	dim_t i0, i1; \
+	bli_thread_range_sub( tid, nt, m, 1, false, &i0, &i1 ); \
+\
+	if ( i0 < i1 ) \
+	{ \
+		if ( bli_teq0s( ch, *beta ) ) \
+			PASTEMAC(ch,copyv,BLIS_TAPI_EX_SUF)( BLIS_NO_CONJUGATE, i1 - i0, ws + i0, 1, y + i0*incy, incy, cntx, NULL ); \
+		else \
+			PASTEMAC(ch,xpbyv,BLIS_TAPI_EX_SUF)( BLIS_NO_CONJUGATE, i1 - i0, ws + i0, 1, beta, y + i0*incy, incy, cntx, NULL ); \
+\
+		for ( dim_t t = 1; t < nt; ++t ) \
+			PASTEMAC(ch,addv,BLIS_TAPI_EX_SUF)( BLIS_NO_CONJUGATE, i1 - i0, ws + t*m + i0, 1, y + i0*incy, incy, cntx, NULL ); \
+	} \
+\
+	bli_thrcomm_barrier( tid, gl_comm ); \
+\
+	if ( tid == 0 ) bli_free_intl( ws ); \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             conj_t  conja, \
+             conj_t  conjx, \
+             conj_t  conjh, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  ap, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	packed_params_t params = \
+	{ \
+	  .uploa = uploa, .conja = conja, .conjx = conjx, .conjh = conjh, \
+	  .m = m, .alpha = alpha, .ap = ( ctype* )ap, \
+	  .x = x, .incx = incx, .beta = beta, .y = y, .incy = incy, \
+	  .cntx = cntx, \
+	}; \
+\
+	bli_l2_thread_launch( ( m * ( m + 1 ) ) / 2, rntm, \
+	                      PASTEMAC(ch,varname,_thread), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( hpmv_int )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname,_thread) \
+     ( \
+             thrcomm_t* gl_comm, \
+             dim_t      tid, \
+       const void*      params \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	const packed_params_t* p = params; \
+\
+	const uplo_t  uploa  = p->uploa; \
+	const conj_t  conjx  = p->conjx; \
+	const conj_t  conjh  = p->conjh; \
+	const dim_t   m      = p->m; \
+	const inc_t   incx   = p->incx; \
+	const ctype*  alpha  = p->alpha; \
+	      ctype*  ap     = p->ap; \
+	const ctype*  x      = p->x; \
+	const cntx_t* cntx   = p->cntx; \
+\
+	/* The columns of A are updated independently, so each thread updates
+	   a range of them. */ \
+	dim_t c0, c1; \
+	bli_packed_range( uploa, tid, bli_thrcomm_num_threads( gl_comm ), m, &c0, &c1 ); \
+\
+	/* Query the context for the kernel function pointer. */ \
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+	for ( dim_t j = c0; j < c1; ++j ) \
+	{ \
+		ctype* a1 = ap + bli_packed_col_off( uploa, m, j ); \
+		ctype* gamma11; \
+		ctype* a_off; \
+		const ctype* x_off; \
+		dim_t  n_off; \
+\
+		if ( bli_is_lower( uploa ) ) \
+		{ \
+			gamma11 = a1; \
+			a_off   = a1 + 1; \
+			x_off   = x + ( j + 1 )*incx; \
+			n_off   = m - j - 1; \
+		} \
+		else \
+		{ \
+			gamma11 = a1 + j; \
+			a_off   = a1; \
+			x_off   = x; \
+			n_off   = j; \
+		} \
+\
+		ctype conjx0_chi1, conjx1_chi1, alpha_chi1, alpha_chi1_chi1; \
+\
+		/* Apply conjx to chi1, and conjh to obtain the conjugate that
+		   scales column j. */ \
+		bli_tcopycjs( ch,ch, conjx, x[ j*incx ], conjx0_chi1 ); \
+		bli_tcopycjs( ch,ch, bli_apply_conj( conjh, conjx ), x[ j*incx ], conjx1_chi1 ); \
+\
+		bli_tscal2s( ch,ch,ch,ch, *alpha, conjx1_chi1, alpha_chi1 ); \
+		bli_tscal2s( ch,ch,ch,ch, alpha_chi1, conjx0_chi1, alpha_chi1_chi1 ); \
+\
+		/* a_off = a_off + alpha * conjx( x_off ) * conj?( chi1 ); */ \
+		kfp_av \
+		( \
+		  conjx, \
+		  n_off, \
+		  &alpha_chi1, \
+		  x_off, incx, \
+		  a_off, 1, \
+		  cntx  \
+		); \
+\
+		/* gamma11 = gamma11 + alpha * chi1 * conj?( chi1 ); */ \
+		bli_tadds( ch,ch,ch, alpha_chi1_chi1, *gamma11 ); \
+\
+		/* For hpr, explicitly set the imaginary component of gamma11 to
+		   zero. */ \
+		if ( bli_is_conj( conjh ) ) \
+			bli_tseti0s( ch, *gamma11 ); \
+	} \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             conj_t  conjx, \
+             conj_t  conjh, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  x, inc_t incx, \
+             ctype*  ap, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	packed_params_t params = \
+	{ \
+	  .uploa = uploa, .conjx = conjx, .conjh = conjh, \
+	  .m = m, .alpha = alpha, .ap = ap, \
+	  .x = x, .incx = incx, \
+	  .cntx = cntx, \
+	}; \
+\
+	bli_l2_thread_launch( ( m * ( m + 1 ) ) / 2, rntm, \
+	                      PASTEMAC(ch,varname,_thread), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC( hpr_int )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  ap, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype* one = PASTEMAC(ch,1); \
+\
+	/* Each element of x depends on the elements updated before it, so
+	   rntm is not consulted. */ \
+	( void )rntm; \
+\
+	const conj_t conja = bli_extract_conj( transa ); \
+	const bool   lower = bli_is_lower( uploa ); \
+\
+	/* The packed layout cannot be transposed by swapping strides, so
+	   transa( A ) is traversed directly: A is applied by columns with
+	   axpyv and A^T is applied by rows of A^T (columns of A) with dotxv,
+	   in whichever order leaves the unused elements of x intact. */ \
+	const bool forward = ( bli_does_trans( transa ) ? lower : !lower ); \
+\
+	/* x = alpha * x; */ \
+	PASTEMAC(ch,scalv,BLIS_TAPI_EX_SUF) \
+	( BLIS_NO_CONJUGATE, m, alpha, x, incx, cntx, NULL ); \
+\
+	/* Query the context for the kernel function pointers. */ \
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	dotxv_ker_ft kfp_dv = bli_cntx_get_ukr_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+	for ( dim_t iter = 0; iter < m; ++iter ) \
+	{ \
+		const dim_t  j     = ( forward ? iter : m - iter - 1 ); \
+		const ctype* a1    = ap + bli_packed_col_off( uploa, m, j ); \
+		const ctype* a11   = ( lower ? a1 : a1 + j ); \
+		const ctype* a_off = ( lower ? a1 + 1 : a1 ); \
+		      ctype* x_off = ( lower ? x + ( j + 1 )*incx : x ); \
+		const dim_t  n_off = ( lower ? m - j - 1 : j ); \
+		      ctype* chi1  = x + j*incx; \
+\
+		ctype alpha11; \
+\
+		if ( bli_does_trans( transa ) ) \
+		{ \
+			/* chi1 = alpha11 * chi1 + conja( a_off )^T * x_off; */ \
+			if ( bli_is_nonunit_diag( diaga ) ) \
+			{ \
+				bli_tcopycjs( ch,ch, conja, *a11, alpha11 ); \
+				bli_tscals( ch,ch,ch, alpha11, *chi1 ); \
+			} \
+\
+			kfp_dv \
+			( \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  n_off, \
+			  one, \
+			  a_off, 1, \
+			  x_off, incx, \
+			  one, \
+			  chi1, \
+			  cntx  \
+			); \
+		} \
+		else \
+		{ \
+			/* x_off = x_off + chi1 * conja( a_off ); */ \
+			kfp_av \
+			( \
+			  conja, \
+			  n_off, \
+			  chi1, \
+			  a_off, 1, \
+			  x_off, incx, \
+			  cntx  \
+			); \
+\
+			/* chi1 = alpha11 * chi1; */ \
+			if ( bli_is_nonunit_diag( diaga ) ) \
+			{ \
+				bli_tcopycjs( ch,ch, conja, *a11, alpha11 ); \
+				bli_tscals( ch,ch,ch, alpha11, *chi1 ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( tpmv_int )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  ap, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype* one       = PASTEMAC(ch,1); \
+	ctype* minus_one = PASTEMAC(ch,m1); \
+\
+	/* The solve is inherently sequential, so rntm is not consulted. */ \
+	( void )rntm; \
+\
+	const conj_t conja = bli_extract_conj( transa ); \
+	const bool   lower = bli_is_lower( uploa ); \
+\
+	/* Solve forward if transa( A ) is lower triangular and backward if it
+	   is upper triangular, with axpyv for A and dotxv for A^T as in tpmv. */ \
+	const bool forward = ( bli_does_trans( transa ) ? !lower : lower ); \
+\
+	/* x = alpha * x; */ \
+	PASTEMAC(ch,scalv,BLIS_TAPI_EX_SUF) \
+	( BLIS_NO_CONJUGATE, m, alpha, x, incx, cntx, NULL ); \
+\
+	/* Query the context for the kernel function pointers. */ \
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	dotxv_ker_ft kfp_dv = bli_cntx_get_ukr_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+	for ( dim_t iter = 0; iter < m; ++iter ) \
+	{ \
+		const dim_t  j     = ( forward ? iter : m - iter - 1 ); \
+		const ctype* a1    = ap + bli_packed_col_off( uploa, m, j ); \
+		const ctype* a11   = ( lower ? a1 : a1 + j ); \
+		const ctype* a_off = ( lower ? a1 + 1 : a1 ); \
+		      ctype* x_off = ( lower ? x + ( j + 1 )*incx : x ); \
+		const dim_t  n_off = ( lower ? m - j - 1 : j ); \
+		      ctype* chi1  = x + j*incx; \
+\
+		ctype alpha11, minus_chi1; \
+\
+		if ( bli_does_trans( transa ) ) \
+		{ \
+			/* chi1 = chi1 - conja( a_off )^T * x_off; */ \
+			kfp_dv \
+			( \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  n_off, \
+			  minus_one, \
+			  a_off, 1, \
+			  x_off, incx, \
+			  one, \
+			  chi1, \
+			  cntx  \
+			); \
+		} \
+\
+		/* chi1 = chi1 / alpha11; */ \
+		if ( bli_is_nonunit_diag( diaga ) ) \
+		{ \
+			bli_tcopycjs( ch,ch, conja, *a11, alpha11 ); \
+			bli_tinvscals( ch,ch,ch, alpha11, *chi1 ); \
+		} \
+\
+		if ( !bli_does_trans( transa ) ) \
+		{ \
+			/* x_off = x_off - chi1 * conja( a_off ); */ \
+			bli_tneg2s( ch,ch, *chi1, minus_chi1 ); \
+\
+			kfp_av \
+			( \
+			  conja, \
+			  n_off, \
+			  &minus_chi1, \
+			  a_off, 1, \
+			  x_off, incx, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( tpsv_int )
+
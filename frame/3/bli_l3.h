@@ -37,6 +37,7 @@
 #include "bli_l3_thrinfo.h"
 #include "bli_l3_decor.h"
 #include "bli_l3_sup_decor.h"
+#include "bli_l3_batch_decor.h"
 
 #include "bli_l3_check.h"
 #include "bli_l3_packab.h"
@@ -53,6 +54,9 @@
 #include "bli_l3_oapi.h"
 #include "bli_l3_oapi_ex.h"
 
+// Prototype non-blocking object APIs.
+#include "bli_l3_async.h"
+
 // Prototype typed APIs (basic and expert).
 #include "bli_l3_tapi.h"
 #include "bli_l3_tapi_ex.h"
@@ -73,6 +77,11 @@
 #include "bli_l3_sup_vars.h"
 #include "bli_l3_sup_packm.h"
 #include "bli_l3_sup_packm_var.h"
+#include "bli_l3_tiny.h"
+
+// Prototype the packed micro-panel matrix format and its utilities.
+#include "bli_l3_packed.h"
+#include "bli_l3_batch.h"
 
 // Prototype microkernel wrapper APIs.
 #include "bli_l3_ukr_oapi.h"
@@ -86,3 +95,6 @@
 #include "bli_trmm.h"
 #include "bli_trsm.h"
 #include "bli_gemmt.h"
+#include "bli_tcontract.h"
+#include "bli_dag.h"
+#include "bli_jit.h"
@@ -0,0 +1,268 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+struct l3_async_s
+{
+	opid_t        family;
+	side_t        side;
+
+	obj_t         alpha;
+	obj_t         a;
+	obj_t         b;
+	obj_t         beta;
+	obj_t         c;
+
+	const cntx_t* cntx;
+	rntm_t        rntm;
+
+	bli_pthread_t thread;
+	bool          joinable;
+	bool          done;
+};
+
+// -----------------------------------------------------------------------------
+
+void bli_l3_async_copy_scalar( const obj_t* src, obj_t* dst )
+{
+	if ( src == NULL ) return;
+
+	// The global constants outlive any operation. Other scalars may live on
+	// the caller's stack (and may even point to their own internal scalar),
+	// so we copy their values into the handle.
+	if ( bli_obj_is_const( src ) ) *dst = *src;
+	else bli_obj_scalar_init_detached_copy_of( bli_obj_dt( src ),
+	                                           BLIS_NO_CONJUGATE, src, dst );
+}
+
+void bli_l3_async_copy_matrix( const obj_t* src, obj_t* dst )
+{
+	if ( src == NULL ) return;
+
+	*dst = *src;
+
+	// Neither the caller's obj_t nor its root (e.g. the matrix a subview was
+	// acquired from) need outlive the call, so the copy is made its own
+	// root. A subview inherits the structure, uplo and diagonal offset of
+	// its root, so nothing consulted through the root is lost.
+	bli_obj_set_as_root( dst );
+}
+
+static void* bli_l3_async_entry( void* data )
+{
+	l3_async_t* h = data;
+
+	const cntx_t* cntx = h->cntx;
+	const rntm_t* rntm = &h->rntm;
+
+	switch ( h->family )
+	{
+		case BLIS_GEMM:  bli_gemm_ex( &h->alpha, &h->a, &h->b, &h->beta, &h->c, cntx, rntm ); break;
+		case BLIS_GEMMT: bli_gemmt_ex( &h->alpha, &h->a, &h->b, &h->beta, &h->c, cntx, rntm ); break;
+		case BLIS_HER2K: bli_her2k_ex( &h->alpha, &h->a, &h->b, &h->beta, &h->c, cntx, rntm ); break;
+		case BLIS_SYR2K: bli_syr2k_ex( &h->alpha, &h->a, &h->b, &h->beta, &h->c, cntx, rntm ); break;
+		case BLIS_HEMM:  bli_hemm_ex( h->side, &h->alpha, &h->a, &h->b, &h->beta, &h->c, cntx, rntm ); break;
+		case BLIS_SYMM:  bli_symm_ex( h->side, &h->alpha, &h->a, &h->b, &h->beta, &h->c, cntx, rntm ); break;
+		case BLIS_TRMM3: bli_trmm3_ex( h->side, &h->alpha, &h->a, &h->b, &h->beta, &h->c, cntx, rntm ); break;
+		case BLIS_HERK:  bli_herk_ex( &h->alpha, &h->a, &h->beta, &h->c, cntx, rntm ); break;
+		case BLIS_SYRK:  bli_syrk_ex( &h->alpha, &h->a, &h->beta, &h->c, cntx, rntm ); break;
+		case BLIS_TRMM:  bli_trmm_ex( h->side, &h->alpha, &h->a, &h->b, cntx, rntm ); break;
+		case BLIS_TRSM:  bli_trsm_ex( h->side, &h->alpha, &h->a, &h->b, cntx, rntm ); break;
+		default: break;
+	}
+
+	__atomic_store_n( &h->done, TRUE, __ATOMIC_RELEASE );
+
+	return NULL;
+}
+
+static err_t bli_l3_async_start
+     (
+             opid_t       family,
+             side_t       side,
+       const obj_t*       alpha,
+       const obj_t*       a,
+       const obj_t*       b,
+       const obj_t*       beta,
+       const obj_t*       c,
+       const cntx_t*      cntx,
+       const rntm_t*      rntm,
+             l3_async_t** handle
+     )
+{
+	bli_init_once();
+
+	err_t r_val;
+
+	l3_async_t* h = bli_malloc_intl( sizeof( l3_async_t ), &r_val );
+
+	h->family = family;
+	h->side   = side;
+	h->cntx   = cntx;
+	h->done   = FALSE;
+
+	bli_l3_async_copy_scalar( alpha, &h->alpha );
+	bli_l3_async_copy_matrix( a, &h->a );
+	bli_l3_async_copy_matrix( b, &h->b );
+	bli_l3_async_copy_scalar( beta, &h->beta );
+	bli_l3_async_copy_matrix( c, &h->c );
+
+	// The global rntm_t is thread-local, so the caller's settings must be
+	// captured here rather than on the background thread.
+	if ( rntm != NULL ) h->rntm = *rntm;
+	else bli_rntm_init_from_global( &h->rntm );
+
+	*handle = h;
+
+	// If a background thread cannot be created, perform the operation on the
+	// calling thread so that the handle is complete when we return.
+	h->joinable = ( bli_pthread_create( &h->thread, NULL, bli_l3_async_entry, h ) == 0 );
+
+	if ( !h->joinable ) bli_l3_async_entry( h );
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+bool bli_l3_async_test( const l3_async_t* handle )
+{
+	return __atomic_load_n( &handle->done, __ATOMIC_ACQUIRE );
+}
+
+void bli_l3_async_wait( l3_async_t* handle )
+{
+	// An operation that ran on the calling thread has no thread to join.
+	if ( handle->joinable )
+		bli_pthread_join( handle->thread, NULL );
+
+	bli_free_intl( handle );
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENFRONT
+#define GENFRONT( opname, family ) \
+\
+err_t PASTEMAC(opname,_async) \
+     ( \
+       const obj_t*       alpha, \
+       const obj_t*       a, \
+       const obj_t*       b, \
+       const obj_t*       beta, \
+       const obj_t*       c, \
+       const cntx_t*      cntx, \
+       const rntm_t*      rntm, \
+             l3_async_t** handle  \
+     ) \
+{ \
+	return bli_l3_async_start( family, BLIS_LEFT, alpha, a, b, beta, c, \
+	                           cntx, rntm, handle ); \
+}
+
+GENFRONT( gemm,  BLIS_GEMM )
+GENFRONT( gemmt, BLIS_GEMMT )
+GENFRONT( her2k, BLIS_HER2K )
+GENFRONT( syr2k, BLIS_SYR2K )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, family ) \
+\
+err_t PASTEMAC(opname,_async) \
+     ( \
+             side_t       side, \
+       const obj_t*       alpha, \
+       const obj_t*       a, \
+       const obj_t*       b, \
+       const obj_t*       beta, \
+       const obj_t*       c, \
+       const cntx_t*      cntx, \
+       const rntm_t*      rntm, \
+             l3_async_t** handle  \
+     ) \
+{ \
+	return bli_l3_async_start( family, side, alpha, a, b, beta, c, \
+	                           cntx, rntm, handle ); \
+}
+
+GENFRONT( hemm,  BLIS_HEMM )
+GENFRONT( symm,  BLIS_SYMM )
+GENFRONT( trmm3, BLIS_TRMM3 )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, family ) \
+\
+err_t PASTEMAC(opname,_async) \
+     ( \
+       const obj_t*       alpha, \
+       const obj_t*       a, \
+       const obj_t*       beta, \
+       const obj_t*       c, \
+       const cntx_t*      cntx, \
+       const rntm_t*      rntm, \
+             l3_async_t** handle  \
+     ) \
+{ \
+	return bli_l3_async_start( family, BLIS_LEFT, alpha, a, NULL, beta, c, \
+	                           cntx, rntm, handle ); \
+}
+
+GENFRONT( herk, BLIS_HERK )
+GENFRONT( syrk, BLIS_SYRK )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, family ) \
+\
+err_t PASTEMAC(opname,_async) \
+     ( \
+             side_t       side, \
+       const obj_t*       alpha, \
+       const obj_t*       a, \
+       const obj_t*       b, \
+       const cntx_t*      cntx, \
+       const rntm_t*      rntm, \
+             l3_async_t** handle  \
+     ) \
+{ \
+	return bli_l3_async_start( family, side, alpha, a, b, NULL, NULL, \
+	                           cntx, rntm, handle ); \
+}
+
+GENFRONT( trmm, BLIS_TRMM )
+GENFRONT( trsm, BLIS_TRSM )
+
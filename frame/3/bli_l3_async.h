@@ -0,0 +1,137 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Non-blocking object-based interfaces. Each call starts the operation on a
+// background thread, which then runs the operation's parallel region as
+// usual, and returns a handle that the caller may poll with
+// bli_l3_async_test() and must eventually pass to bli_l3_async_wait().
+//
+// The matrix objects (and their buffers) must remain valid, and C must not be
+// accessed, until bli_l3_async_wait() returns. Scalars are copied, and if the
+// rntm_t is NULL, the calling thread's global settings are captured at the
+// time of the call.
+//
+
+typedef struct l3_async_s l3_async_t;
+
+// Return TRUE if the operation has completed. This never blocks.
+BLIS_EXPORT_BLIS bool bli_l3_async_test( const l3_async_t* handle );
+
+// Block until the operation has completed and release the handle.
+BLIS_EXPORT_BLIS void bli_l3_async_wait( l3_async_t* handle );
+
+// Copy a scalar or matrix operand for an operation that will run after the
+// caller's obj_t may have gone out of scope. NULL operands are ignored.
+void bli_l3_async_copy_scalar( const obj_t* src, obj_t* dst );
+void bli_l3_async_copy_matrix( const obj_t* src, obj_t* dst );
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS err_t PASTEMAC(opname,_async) \
+     ( \
+       const obj_t*       alpha, \
+       const obj_t*       a, \
+       const obj_t*       b, \
+       const obj_t*       beta, \
+       const obj_t*       c, \
+       const cntx_t*      cntx, \
+       const rntm_t*      rntm, \
+             l3_async_t** handle  \
+     );
+
+GENPROT( gemm )
+GENPROT( gemmt )
+GENPROT( her2k )
+GENPROT( syr2k )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS err_t PASTEMAC(opname,_async) \
+     ( \
+             side_t       side, \
+       const obj_t*       alpha, \
+       const obj_t*       a, \
+       const obj_t*       b, \
+       const obj_t*       beta, \
+       const obj_t*       c, \
+       const cntx_t*      cntx, \
+       const rntm_t*      rntm, \
+             l3_async_t** handle  \
+     );
+
+GENPROT( hemm )
+GENPROT( symm )
+GENPROT( trmm3 )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS err_t PASTEMAC(opname,_async) \
+     ( \
+       const obj_t*       alpha, \
+       const obj_t*       a, \
+       const obj_t*       beta, \
+       const obj_t*       c, \
+       const cntx_t*      cntx, \
+       const rntm_t*      rntm, \
+             l3_async_t** handle  \
+     );
+
+GENPROT( herk )
+GENPROT( syrk )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS err_t PASTEMAC(opname,_async) \
+     ( \
+             side_t       side, \
+       const obj_t*       alpha, \
+       const obj_t*       a, \
+       const obj_t*       b, \
+       const cntx_t*      cntx, \
+       const rntm_t*      rntm, \
+             l3_async_t** handle  \
+     );
+
+GENPROT( trmm )
+GENPROT( trsm )
+
@@ -0,0 +1,551 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+static void bli_tri_batch_one
+     (
+             opid_t  family,
+             side_t  side,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	if ( family == BLIS_TRSM ) bli_trsm_ex( side, alpha, a, b, cntx, rntm );
+	else                       bli_trmm_ex( side, alpha, a, b, cntx, rntm );
+}
+
+// Compute a batch of trsm or trmm problems. The operands of the i-th
+// problem are given either by a_array[ i ] and b_array[ i ] or (if the
+// arrays are NULL) by offsetting the buffers of a and b by i * stride_a
+// and i * stride_b elements. In either case, a and b describe the
+// dimensions, strides, and properties of the operands of all problems.
+static void bli_tri_batch
+     (
+             opid_t        family,
+             side_t        side,
+       const obj_t*        alpha,
+       const obj_t*        a, inc_t stride_a, void* const* a_array,
+       const obj_t*        b, inc_t stride_b, void* const* b_array,
+             dim_t         batch,
+       const cntx_t*       cntx,
+       const rntm_t*       rntm
+     )
+{
+	if ( batch == 0 || bli_obj_has_zero_dim( b ) ) return;
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// If all problems share A and the B_i are stored one after another along
+	// the dimension that A does not touch, the batch is one wide problem,
+	// in which each block of A is packed (and its diagonal inverted, in the
+	// case of trsm) only once.
+	if ( a_array == NULL && stride_a == 0 && !bli_obj_has_trans( b ) )
+	{
+		obj_t b_wide;
+		bli_obj_alias_to( b, &b_wide );
+
+		if ( bli_is_left( side ) && bli_obj_is_col_stored( b ) &&
+		     stride_b == bli_obj_width( b ) * bli_obj_col_stride( b ) )
+		{
+			bli_obj_set_width( bli_obj_width( b ) * batch, &b_wide );
+			bli_tri_batch_one( family, side, alpha, a, &b_wide, cntx, rntm );
+			return;
+		}
+
+		if ( bli_is_right( side ) && bli_obj_is_row_stored( b ) &&
+		     stride_b == bli_obj_length( b ) * bli_obj_row_stride( b ) )
+		{
+			bli_obj_set_length( bli_obj_length( b ) * batch, &b_wide );
+			bli_tri_batch_one( family, side, alpha, a, &b_wide, cntx, rntm );
+			return;
+		}
+	}
+
+	const num_t dt = bli_obj_dt( b );
+
+	// Problems that are trivial or have mixed datatypes are computed one at
+	// a time.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ||
+	     bli_obj_dt( a ) != dt ||
+	     bli_obj_comp_prec( b ) != bli_obj_prec( b ) )
+	{
+		l3_batch_opnd_t a_opnd, b_opnd;
+
+		bli_l3_batch_opnd_init( a, a, stride_a, a_array, &a_opnd );
+		bli_l3_batch_opnd_init( b, b, stride_b, b_array, &b_opnd );
+
+		for ( dim_t i = 0; i < batch; ++i )
+		{
+			obj_t a_i, b_i;
+
+			bli_l3_batch_acquire( i, &a_opnd, &a_i );
+			bli_l3_batch_acquire( i, &b_opnd, &b_i );
+
+			bli_tri_batch_one( family, side, alpha, &a_i, &b_i, cntx, rntm );
+		}
+
+		return;
+	}
+
+	ind_t im = BLIS_NAT;
+
+	if ( bli_obj_is_complex( b ) )
+		im = ( family == BLIS_TRSM ? bli_trsmind_find_avail( dt )
+		                           : bli_trmmind_find_avail( dt ) );
+
+	rntm_t rntm_l;
+	if ( rntm != NULL ) rntm_l = *rntm;
+	else bli_rntm_init_from_global( &rntm_l );
+
+	const dim_t m = bli_obj_length( b );
+	const dim_t n = bli_obj_width( b );
+
+	bli_rntm_factorize( m, n, bli_obj_width( a ), &rntm_l );
+
+	const dim_t budget_grant = bli_rntm_budget_grant( &rntm_l );
+
+	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
+	dim_t   nt = bli_rntm_num_threads( &rntm_l );
+
+	if ( bli_error_checking_is_enabled() )
+		bli_l3_thread_decorator_check( &rntm_l );
+
+	// As in bli_l3_thread_decorator(), favor a sequential threading
+	// implementation over the number of threads requested.
+	if ( 1 < nt && ti == BLIS_SINGLE )
+	{
+		nt = 1;
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_l );
+		bli_rntm_set_num_threads_only( 1, &rntm_l );
+	}
+
+	// Apply the same transformations as bli_trsm_ex() and bli_trmm_ex() to
+	// aliases of A and B, keeping track of whether A and B were swapped.
+	obj_t a_local, b_local, c_local;
+	bool  swapped = false;
+
+	bli_obj_alias_submatrix( a, &a_local );
+	bli_obj_alias_submatrix( b, &b_local );
+	bli_obj_alias_submatrix( b, &c_local );
+
+	union
+	{
+		gemm_cntl_t gemm;
+		trsm_cntl_t trsm;
+	} cntl;
+
+	if ( family == BLIS_TRSM )
+	{
+		if ( bli_is_right( side ) )
+		{
+			bli_toggle_side( &side );
+			bli_obj_induce_trans( &a_local );
+			bli_obj_induce_trans( &b_local );
+			bli_obj_induce_trans( &c_local );
+		}
+
+		bli_trsm_cntl_init( im, alpha, &a_local, &b_local, alpha, &c_local,
+		                    cntx, &cntl.trsm );
+	}
+	else
+	{
+		if ( bli_is_right( side ) )
+		{
+			bli_obj_swap( &a_local, &b_local );
+			swapped = true;
+		}
+
+		if ( bli_gemm_cntl_init( im, BLIS_TRMM, alpha, &a_local, &b_local,
+		                         &BLIS_ZERO, &c_local, cntx, &cntl.gemm ) )
+			swapped = !swapped;
+	}
+
+	l3_batch_opnd_t a_opnd, b_opnd, c_opnd;
+
+	bli_l3_batch_opnd_init( &a_local, swapped ? b : a, swapped ? stride_b : stride_a,
+	                        swapped ? b_array : a_array, &a_opnd );
+	bli_l3_batch_opnd_init( &b_local, swapped ? a : b, swapped ? stride_a : stride_b,
+	                        swapped ? a_array : b_array, &b_opnd );
+	bli_l3_batch_opnd_init( &c_local, b, stride_b, b_array, &c_opnd );
+
+	// Unless the ways of parallelism were set explicitly, each thread
+	// computes whole problems. If there are fewer problems than threads,
+	// the threads are divided into as many groups as possible, and the ways
+	// of parallelism are factorized again for the threads of each group.
+	dim_t  n_groups = 1;
+	rntm_t rntm_g   = rntm_l;
+
+	if ( bli_rntm_auto_factor( &rntm_l ) )
+	{
+		for ( n_groups = bli_min( nt, batch ); nt % n_groups != 0; --n_groups ) ;
+
+		bli_rntm_set_num_threads_only( nt / n_groups, &rntm_g );
+		bli_rntm_factorize_ways( m, n, bli_obj_width( a ), &rntm_g );
+
+		// The factorization may have reduced the number of threads.
+		nt = n_groups * bli_rntm_num_threads( &rntm_g );
+	}
+
+	bli_l3_batch_thread_decorator
+	(
+	  NULL,
+	  NULL,
+	  &a_opnd,
+	  &b_opnd,
+	  &c_opnd,
+	  batch,
+	  n_groups,
+	  ti,
+	  nt,
+	  cntx,
+	  ( cntl_t* )&cntl,
+	  &rntm_g
+	);
+
+	bli_thread_budget_release( budget_grant );
+}
+
+// Check the operands of a batch. In the pointer-array interfaces, the
+// objects of all problems must agree with those of the first problem in
+// everything but their buffers.
+static void bli_tri_batch_check
+     (
+             opid_t  family,
+             side_t  side,
+       const obj_t*  alpha,
+       const obj_t*  a, bool a_is_array,
+       const obj_t*  b, bool b_is_array,
+             dim_t   batch,
+       const cntx_t* cntx
+     )
+{
+	if ( batch < 0 )
+		bli_check_error_code( BLIS_NEGATIVE_DIMENSION );
+
+	if ( batch == 0 ) return;
+
+	if ( family == BLIS_TRSM ) bli_trsm_check( side, alpha, a, b, cntx );
+	else                       bli_trmm_check( side, alpha, a, b, cntx );
+
+	for ( dim_t i = 1; i < batch; ++i )
+	{
+		const obj_t* a_i = ( a_is_array ? &a[ i ] : a );
+		const obj_t* b_i = ( b_is_array ? &b[ i ] : b );
+
+		if ( a_i->info                != a->info                  ||
+		     bli_obj_length( a_i )     != bli_obj_length( a )      ||
+		     bli_obj_width( a_i )      != bli_obj_width( a )       ||
+		     bli_obj_row_off( a_i )    != bli_obj_row_off( a )     ||
+		     bli_obj_col_off( a_i )    != bli_obj_col_off( a )     ||
+		     bli_obj_diag_offset( a_i ) != bli_obj_diag_offset( a ) ||
+		     bli_obj_row_stride( a_i ) != bli_obj_row_stride( a )  ||
+		     bli_obj_col_stride( a_i ) != bli_obj_col_stride( a )  ||
+		     b_i->info                != b->info                  ||
+		     bli_obj_length( b_i )     != bli_obj_length( b )      ||
+		     bli_obj_width( b_i )      != bli_obj_width( b )       ||
+		     bli_obj_row_off( b_i )    != bli_obj_row_off( b )     ||
+		     bli_obj_col_off( b_i )    != bli_obj_col_off( b )     ||
+		     bli_obj_row_stride( b_i ) != bli_obj_row_stride( b )  ||
+		     bli_obj_col_stride( b_i ) != bli_obj_col_stride( b ) )
+			bli_check_error_code( BLIS_INCONSISTENT_BATCH_OPERANDS );
+	}
+}
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, family ) \
+\
+void PASTEMAC(opname,_batch_strided_ex) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a, inc_t stride_a, \
+       const obj_t*  b, inc_t stride_b, \
+             dim_t   batch, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	if ( bli_error_checking_is_enabled() ) \
+		bli_tri_batch_check( family, side, alpha, a, FALSE, b, FALSE, batch, cntx ); \
+\
+	bli_tri_batch \
+	( \
+	  family, side, alpha, \
+	  a, stride_a, NULL, \
+	  b, stride_b, NULL, \
+	  batch, cntx, rntm \
+	); \
+} \
+\
+void PASTEMAC(opname,_batch_strided) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a, inc_t stride_a, \
+       const obj_t*  b, inc_t stride_b, \
+             dim_t   batch  \
+     ) \
+{ \
+	PASTEMAC(opname,_batch_strided_ex)( side, alpha, a, stride_a, b, stride_b, \
+	                                    batch, NULL, NULL ); \
+} \
+\
+void PASTEMAC(opname,_batch_ex) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a_array, \
+       const obj_t*  b_array, \
+             dim_t   batch, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	if ( bli_error_checking_is_enabled() ) \
+		bli_tri_batch_check( family, side, alpha, a_array, TRUE, b_array, TRUE, batch, cntx ); \
+\
+	if ( batch == 0 ) return; \
+\
+	/* Gather the buffers of the objects. */ \
+	err_t  r_val; \
+	void** bufs = bli_malloc_intl( 2 * batch * sizeof( void* ), &r_val ); \
+\
+	for ( dim_t i = 0; i < batch; ++i ) \
+	{ \
+		bufs[ i ]         = bli_obj_buffer( &a_array[ i ] ); \
+		bufs[ batch + i ] = bli_obj_buffer( &b_array[ i ] ); \
+	} \
+\
+	bli_tri_batch \
+	( \
+	  family, side, alpha, \
+	  &a_array[ 0 ], 0, bufs, \
+	  &b_array[ 0 ], 0, bufs + batch, \
+	  batch, cntx, rntm \
+	); \
+\
+	bli_free_intl( bufs ); \
+} \
+\
+void PASTEMAC(opname,_batch) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a_array, \
+       const obj_t*  b_array, \
+             dim_t   batch  \
+     ) \
+{ \
+	PASTEMAC(opname,_batch_ex)( side, alpha, a_array, b_array, batch, NULL, NULL ); \
+}
+
+GENFRONT( trsm, BLIS_TRSM )
+GENFRONT( trmm, BLIS_TRMM )
+
+
+// Initialize objects for the operands of a typed batch interface.
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname,_batch_init) \
+     ( \
+             side_t  side, \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   n, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype*  b, inc_t rs_b, inc_t cs_b, \
+             obj_t*  alphao, \
+             obj_t*  ao, \
+             obj_t*  bo  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+	const dim_t mn_a = ( bli_is_left( side ) ? m : n ); \
+\
+	bli_obj_init_finish_1x1( dt, ( ctype* )alpha, alphao ); \
+\
+	bli_obj_init_finish( dt, mn_a, mn_a, ( ctype* )a, rs_a, cs_a, ao ); \
+	bli_obj_init_finish( dt, m,    n,    ( ctype* )b, rs_b, cs_b, bo ); \
+\
+	bli_obj_set_uplo( uploa, ao ); \
+	bli_obj_set_diag( diaga, ao ); \
+	bli_obj_set_conjtrans( transa, ao ); \
+\
+	bli_obj_set_struc( BLIS_TRIANGULAR, ao ); \
+}
+
+INSERT_GENTFUNC_BASIC( tri )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, family ) \
+\
+void PASTEMAC(ch,opname,_batch_strided_ex) \
+     ( \
+             side_t  side, \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   n, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+             ctype*  b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+             dim_t   batch, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	obj_t alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t bo     = BLIS_OBJECT_INITIALIZER; \
+\
+	PASTEMAC(ch,tri,_batch_init) \
+	( \
+	  side, uploa, transa, diaga, m, n, \
+	  alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+	  &alphao, &ao, &bo \
+	); \
+\
+	PASTEMAC(opname,_batch_strided_ex) \
+	( \
+	  side, &alphao, &ao, stride_a, &bo, stride_b, batch, cntx, rntm \
+	); \
+} \
+\
+void PASTEMAC(ch,opname,_batch_strided) \
+     ( \
+             side_t  side, \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   n, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+             ctype*  b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+             dim_t   batch  \
+     ) \
+{ \
+	PASTEMAC(ch,opname,_batch_strided_ex) \
+	( \
+	  side, uploa, transa, diaga, m, n, \
+	  alpha, a, rs_a, cs_a, stride_a, b, rs_b, cs_b, stride_b, \
+	  batch, NULL, NULL \
+	); \
+} \
+\
+void PASTEMAC(ch,opname,_batch_ex) \
+     ( \
+             side_t         side, \
+             uplo_t         uploa, \
+             trans_t        transa, \
+             diag_t         diaga, \
+             dim_t          m, \
+             dim_t          n, \
+       const ctype*         alpha, \
+       const ctype* const*  a_array, inc_t rs_a, inc_t cs_a, \
+             ctype* const*  b_array, inc_t rs_b, inc_t cs_b, \
+             dim_t          batch, \
+       const cntx_t*        cntx, \
+       const rntm_t*        rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	if ( batch == 0 ) return; \
+\
+	obj_t alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t bo     = BLIS_OBJECT_INITIALIZER; \
+\
+	PASTEMAC(ch,tri,_batch_init) \
+	( \
+	  side, uploa, transa, diaga, m, n, \
+	  alpha, a_array[ 0 ], rs_a, cs_a, b_array[ 0 ], rs_b, cs_b, \
+	  &alphao, &ao, &bo \
+	); \
+\
+	if ( bli_error_checking_is_enabled() ) \
+		bli_tri_batch_check( family, side, &alphao, &ao, FALSE, &bo, FALSE, batch, cntx ); \
+\
+	bli_tri_batch \
+	( \
+	  family, side, &alphao, \
+	  &ao, 0, ( void* const* )a_array, \
+	  &bo, 0, ( void* const* )b_array, \
+	  batch, cntx, rntm \
+	); \
+} \
+\
+void PASTEMAC(ch,opname,_batch) \
+     ( \
+             side_t         side, \
+             uplo_t         uploa, \
+             trans_t        transa, \
+             diag_t         diaga, \
+             dim_t          m, \
+             dim_t          n, \
+       const ctype*         alpha, \
+       const ctype* const*  a_array, inc_t rs_a, inc_t cs_a, \
+             ctype* const*  b_array, inc_t rs_b, inc_t cs_b, \
+             dim_t          batch  \
+     ) \
+{ \
+	PASTEMAC(ch,opname,_batch_ex) \
+	( \
+	  side, uploa, transa, diaga, m, n, \
+	  alpha, a_array, rs_a, cs_a, b_array, rs_b, cs_b, \
+	  batch, NULL, NULL \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( trsm, BLIS_TRSM )
+INSERT_GENTFUNC_BASIC( trmm, BLIS_TRMM )
+
@@ -0,0 +1,176 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Batched trsm and trmm compute many independent problems of the same
+// shape, e.g. the small triangular systems of a block-Jacobi preconditioner,
+// with one call:
+//
+//   B_i := alpha * inv(transa(A_i)) * B_i   (or B_i * inv(transa(A_i)))
+//   B_i := alpha * transa(A_i) * B_i        (or B_i * transa(A_i))
+//
+// In the strided interfaces, A_i and B_i are located stride_a and stride_b
+// elements beyond A_{i-1} and B_{i-1}; stride_a may be zero to apply the
+// same triangular matrix to all problems (in which case the problems may be
+// computed as one wide problem, so that A is packed only once). In the
+// pointer-array interfaces, the operands of each problem are given by an
+// array of objects (which may differ only in their buffers) or an array of
+// buffers.
+//
+// The control tree and context are set up once for the whole batch, and
+// each thread (or group of threads, if there are fewer problems than
+// threads) computes whole problems, reusing its packing buffers.
+//
+
+//
+// Prototype object APIs (basic and expert).
+//
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,_batch_strided) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a, inc_t stride_a, \
+       const obj_t*  b, inc_t stride_b, \
+             dim_t   batch  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,_batch_strided_ex) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a, inc_t stride_a, \
+       const obj_t*  b, inc_t stride_b, \
+             dim_t   batch, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,_batch) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a_array, \
+       const obj_t*  b_array, \
+             dim_t   batch  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,_batch_ex) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a_array, \
+       const obj_t*  b_array, \
+             dim_t   batch, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     );
+
+GENPROT( trsm )
+GENPROT( trmm )
+
+
+//
+// Prototype BLAS-like interfaces with typed operands (basic and expert).
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname,_batch_strided) \
+     ( \
+             side_t  side, \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   n, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+             ctype*  b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+             dim_t   batch  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname,_batch_strided_ex) \
+     ( \
+             side_t  side, \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   n, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+             ctype*  b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+             dim_t   batch, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname,_batch) \
+     ( \
+             side_t         side, \
+             uplo_t         uploa, \
+             trans_t        transa, \
+             diag_t         diaga, \
+             dim_t          m, \
+             dim_t          n, \
+       const ctype*         alpha, \
+       const ctype* const*  a_array, inc_t rs_a, inc_t cs_a, \
+             ctype* const*  b_array, inc_t rs_b, inc_t cs_b, \
+             dim_t          batch  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname,_batch_ex) \
+     ( \
+             side_t         side, \
+             uplo_t         uploa, \
+             trans_t        transa, \
+             diag_t         diaga, \
+             dim_t          m, \
+             dim_t          n, \
+       const ctype*         alpha, \
+       const ctype* const*  a_array, inc_t rs_a, inc_t cs_a, \
+             ctype* const*  b_array, inc_t rs_b, inc_t cs_b, \
+             dim_t          batch, \
+       const cntx_t*        cntx, \
+       const rntm_t*        rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( trsm )
+INSERT_GENTPROT_BASIC( trmm )
+
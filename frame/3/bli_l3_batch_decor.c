@@ -0,0 +1,180 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+typedef struct
+{
+	      l3_batch_sup_ft  sup_fp;
+	const void*            sup_params;
+	const l3_batch_opnd_t* a;
+	const l3_batch_opnd_t* b;
+	const l3_batch_opnd_t* c;
+	      dim_t            batch;
+	      dim_t            n_groups;
+	const cntx_t*          cntx;
+	const cntl_t*          cntl;
+	const rntm_t*          rntm;
+	      array_t*         array;
+} l3_batch_decor_params_t;
+
+void bli_l3_batch_opnd_init
+     (
+       const obj_t*           obj,
+       const obj_t*           src,
+             inc_t            stride,
+             void* const*     array,
+             l3_batch_opnd_t* opnd
+     )
+{
+	opnd->obj    = obj;
+	opnd->stride = stride;
+	opnd->array  = array;
+	opnd->off    = ( char* )bli_obj_buffer( obj ) - ( char* )bli_obj_buffer( src );
+}
+
+void bli_l3_batch_acquire
+     (
+             dim_t            i,
+       const l3_batch_opnd_t* opnd,
+             obj_t*           obj_i
+     )
+{
+	char* buf;
+
+	if ( opnd->array != NULL )
+		buf = ( char* )opnd->array[ i ] + opnd->off;
+	else
+		buf = ( char* )bli_obj_buffer( opnd->obj ) +
+		      i * opnd->stride * ( inc_t )bli_obj_elem_size( opnd->obj );
+
+	bli_obj_alias_to( opnd->obj, obj_i );
+	bli_obj_set_buffer( buf, obj_i );
+}
+
+static void bli_l3_batch_thread_decorator_entry
+     (
+             thrcomm_t* gl_comm,
+             dim_t      tid,
+       const void*      data_void
+     )
+{
+	const l3_batch_decor_params_t* data = data_void;
+
+	rntm_t rntm_l   = *data->rntm;
+	dim_t  n_groups = data->n_groups;
+
+	bli_l3_thread_decorator_thread_check( gl_comm, &rntm_l );
+
+	// bli_l3_thread_decorator_thread_check() reduces the communicator to a
+	// single thread if OpenMP created only one thread for the parallel
+	// region (e.g. because BLIS was called from within a parallel region
+	// with nesting disabled), in which case that thread computes the entire
+	// batch.
+	if ( bli_thrcomm_num_threads( gl_comm ) == 1 ) n_groups = 1;
+
+	// Create the root node of the current thread's thrinfo_t structure and
+	// split the threads into groups. Each group grows its own thrinfo_t tree
+	// for the (shared) control tree, and the pack buffers that hang from it
+	// are reused by all of the problems computed by the group.
+	pool_t*    sba_pool = bli_sba_array_elem( tid, data->array );
+	thrinfo_t* root     = bli_thrinfo_create_root( gl_comm, tid, sba_pool, bli_pba_query() );
+	thrinfo_t* group    = bli_thrinfo_split( n_groups, root );
+
+	bli_thrinfo_attach_sub_node( group, root );
+
+	if ( data->sup_fp == NULL )
+		bli_l3_thrinfo_grow( group, &rntm_l, data->cntl );
+
+	for ( dim_t i = bli_thrinfo_work_id( group ); i < data->batch; i += n_groups )
+	{
+		obj_t a_i, b_i, c_i;
+
+		bli_l3_batch_acquire( i, data->a, &a_i );
+		bli_l3_batch_acquire( i, data->b, &b_i );
+		bli_l3_batch_acquire( i, data->c, &c_i );
+
+		if ( data->sup_fp != NULL )
+			data->sup_fp( &a_i, &b_i, &c_i, data->sup_params, data->cntx, &rntm_l );
+		else
+			bli_l3_int( &a_i, &b_i, &c_i, data->cntx, data->cntl, group );
+	}
+
+	// NOTE: As in bli_l3_thread_decorator(), the barrier prevents the chief
+	// of a group from releasing memory before its peers are done using it.
+	bli_thrinfo_barrier( root );
+	bli_thrinfo_free( root );
+}
+
+void bli_l3_batch_thread_decorator
+     (
+             l3_batch_sup_ft  sup_fp,
+       const void*            sup_params,
+       const l3_batch_opnd_t* a,
+       const l3_batch_opnd_t* b,
+       const l3_batch_opnd_t* c,
+             dim_t            batch,
+             dim_t            n_groups,
+             timpl_t          ti,
+             dim_t            nt,
+       const cntx_t*          cntx,
+       const cntl_t*          cntl,
+       const rntm_t*          rntm
+     )
+{
+	array_t* array = bli_sba_checkout_array( nt );
+
+	l3_batch_decor_params_t params;
+	params.sup_fp     = sup_fp;
+	params.sup_params = sup_params;
+	params.a          = a;
+	params.b          = b;
+	params.c          = c;
+	params.batch      = batch;
+	params.n_groups   = n_groups;
+	params.cntx       = cntx;
+	params.cntl       = cntl;
+	params.rntm       = rntm;
+	params.array      = array;
+
+	// Report the parallelism with which this call was executed.
+	bli_thread_set_last_rntm( rntm );
+
+	bli_thread_launch( nt == 1 ? BLIS_SINGLE : ti, nt,
+	                   bli_l3_batch_thread_decorator_entry, &params );
+
+	bli_sba_checkin_array( array );
+}
+
@@ -0,0 +1,107 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_L3_BATCH_DECOR_H
+#define BLIS_L3_BATCH_DECOR_H
+
+//
+// The thread decorator shared by the batched level-3 operations. Each
+// thread (or group of threads, if there are fewer problems than threads)
+// computes whole problems of the batch, reusing the control tree and the
+// pack buffers hanging from its thrinfo_t tree for all of them.
+//
+
+// One operand of the problems of a batch: the buffer of the i-th problem is
+// either stride elements beyond that of the (i-1)-th problem, or the i-th
+// element of array (offset by the same amount as the buffer of obj relative
+// to the object from which it was derived).
+typedef struct
+{
+	const obj_t*       obj;
+	      inc_t        stride;
+	      void* const* array;
+	      ptrdiff_t    off;
+} l3_batch_opnd_t;
+
+// Compute one problem of a batch without a control tree (e.g. via the sup
+// path), sequentially.
+typedef void (*l3_batch_sup_ft)
+     (
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  c,
+       const void*   params,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     );
+
+void bli_l3_batch_opnd_init
+     (
+       const obj_t*           obj,
+       const obj_t*           src,
+             inc_t            stride,
+             void* const*     array,
+             l3_batch_opnd_t* opnd
+     );
+
+void bli_l3_batch_acquire
+     (
+             dim_t            i,
+       const l3_batch_opnd_t* opnd,
+             obj_t*           obj_i
+     );
+
+// Compute the problems of a batch with nt threads divided into n_groups
+// groups. Each problem is computed by bli_l3_int() with cntl, or, if sup_fp
+// is not NULL, by sup_fp (in which case cntl is not used and each group
+// should consist of one thread).
+void bli_l3_batch_thread_decorator
+     (
+             l3_batch_sup_ft  sup_fp,
+       const void*            sup_params,
+       const l3_batch_opnd_t* a,
+       const l3_batch_opnd_t* b,
+       const l3_batch_opnd_t* c,
+             dim_t            batch,
+             dim_t            n_groups,
+             timpl_t          ti,
+             dim_t            nt,
+       const cntx_t*          cntx,
+       const cntl_t*          cntl,
+       const rntm_t*          rntm
+     );
+
+#endif
+
@@ -60,6 +60,10 @@ void bli_gemm_check
 
 	e_val = bli_check_general_object( c );
 	bli_check_error_code( e_val );
+
+	// Check any operands stored as packed micro-panels.
+
+	bli_gemm_packed_check( a, b, c, cntx );
 }
 
 void bli_gemmt_check
@@ -41,34 +41,37 @@
 
 struct l3_decor_params_s
 {
-	const obj_t*   a;
-	const obj_t*   b;
-	const obj_t*   c;
-	const cntx_t*  cntx;
-	const cntl_t*  cntl;
-	      rntm_t*  rntm;
-	      array_t* array;
+	const obj_t*                    a;
+	const obj_t*                    b;
+	const obj_t*                    c;
+	const cntx_t*                   cntx;
+	const cntl_t*                   cntl;
+	      rntm_t*                   rntm;
+	      array_t*                  array;
+	      l3_thrinfo_cache_entry_t* tcache;
 };
 typedef struct l3_decor_params_s l3_decor_params_t;
 
 static void bli_l3_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, const void* data_void )
 {
-	const l3_decor_params_t* data    = data_void;
+	const l3_decor_params_t*        data    = data_void;
 
-	const obj_t*             a       = data->a;
-	const obj_t*             b       = data->b;
-	const obj_t*             c       = data->c;
-	const cntx_t*            cntx    = data->cntx;
-	const cntl_t*            cntl    = data->cntl;
-	      rntm_t*            rntm    = data->rntm;
-	      array_t*           array   = data->array;
+	const obj_t*                    a       = data->a;
+	const obj_t*                    b       = data->b;
+	const obj_t*                    c       = data->c;
+	const cntx_t*                   cntx    = data->cntx;
+	const cntl_t*                   cntl    = data->cntl;
+	      rntm_t*                   rntm    = data->rntm;
+	      array_t*                  array   = data->array;
+	      l3_thrinfo_cache_entry_t* tcache  = data->tcache;
 
 	bli_l3_thread_decorator_thread_check( gl_comm, rntm );
 
-	// Create the root node of the current thread's thrinfo_t structure.
+	// Create the root node of the current thread's thrinfo_t structure, or
+	// reuse the one cached by a previous call with the same factorization.
 	// The root node is the *parent* of the node corresponding to the first
 	// control tree node.
-	thrinfo_t* thread = bli_l3_thrinfo_create( tid, gl_comm, array, rntm, cntl );
+	thrinfo_t* thread = bli_l3_thrinfo_cache_acquire( tcache, tid, gl_comm, array, rntm, cntl );
 
 	bli_l3_int
 	(
@@ -86,7 +89,7 @@ static void bli_l3_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, const
 	// using it. See PR #702 for more info [1].
 	// [1] https://github.com/flame/blis/pull/702
 	bli_thrinfo_barrier( thread );
-	bli_thrinfo_free( thread );
+	bli_l3_thrinfo_cache_release( tcache, thread );
 }
 
 void bli_l3_thread_decorator
@@ -113,6 +116,10 @@ void bli_l3_thread_decorator
 	  &rntm_l
 	);
 
+	// Remember the threads reserved from the thread budget (if any) during
+	// factorization so that they can be returned after the call.
+	const dim_t budget_grant = bli_rntm_budget_grant( &rntm_l );
+
 	// Query the threading implementation and the number of threads requested.
 	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
 	dim_t   nt = bli_rntm_num_threads( &rntm_l );
@@ -164,6 +171,10 @@ void bli_l3_thread_decorator
 	// resize the array_t, if necessary.
 	array_t* array = bli_sba_checkout_array( nt );
 
+	// Check out a set of cached thrinfo_t trees matching the threading
+	// implementation, number of threads, and loop factorization, if any.
+	l3_thrinfo_cache_entry_t* tcache = bli_l3_thrinfo_cache_checkout( ti, nt, &rntm_l, cntl );
+
 	l3_decor_params_t params;
 	params.a        = a;
 	params.b        = b;
@@ -172,12 +183,22 @@ void bli_l3_thread_decorator
 	params.cntl     = cntl;
 	params.rntm     = &rntm_l;
 	params.array    = array;
+	params.tcache   = tcache;
+
+	// Report the parallelism with which this call was executed.
+	bli_thread_set_last_rntm( &rntm_l );
 
 	// Launch the threads using the threading implementation specified by ti,
 	// and use bli_l3_thread_decorator_entry() as their entry points. The
 	// params struct will be passed along to each thread.
 	bli_thread_launch( ti, nt, bli_l3_thread_decorator_entry, &params );
 
+	// Return the reserved threads to the budget.
+	bli_thread_budget_release( budget_grant );
+
+	// Return the thrinfo_t trees (now populated) to the cache.
+	bli_l3_thrinfo_cache_checkin( tcache );
+
 	// Check the array_t back into the small block allocator. Similar to the
 	// check-out, this is done using a lock embedded within the sba to ensure
 	// mutual exclusion.
@@ -215,6 +236,15 @@ void bli_l3_thread_decorator_check
 		fprintf( stderr, "libblis: %s: line %d\n", __FILE__, ( int )__LINE__ );
 		bli_abort();
 	}
+
+	if ( ti == BLIS_CUSTOM && !bli_thread_custom_is_set() )
+	{
+		fprintf( stderr, "\n" );
+		fprintf( stderr, "libblis: User requested threading implementation \"%s\", but no custom thread\n", bli_thread_get_thread_impl_str( ti ) );
+		fprintf( stderr, "libblis: launcher was registered. Call bli_thread_set_custom() first.\n" );
+		fprintf( stderr, "libblis: %s: line %d\n", __FILE__, ( int )__LINE__ );
+		bli_abort();
+	}
 }
 
 void bli_l3_thread_decorator_thread_check
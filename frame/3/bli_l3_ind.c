@@ -41,7 +41,8 @@ static const bool bli_l3_ind_oper_impl[BLIS_NUM_IND_METHODS][BLIS_NUM_LEVEL3_OPS
 {
         /*   gemm  gemmt  hemm  herk  her2k  symm  syrk  syr2k  trmm3  trmm  trsm  */
 /* 1m   */ { TRUE, TRUE,  TRUE, TRUE, TRUE,  TRUE, TRUE, TRUE,  TRUE,  TRUE, TRUE  },
-/* nat  */ { TRUE, TRUE,  TRUE, TRUE, TRUE,  TRUE, TRUE, TRUE,  TRUE,  TRUE, TRUE  }
+/* nat  */ { TRUE, TRUE,  TRUE, TRUE, TRUE,  TRUE, TRUE, TRUE,  TRUE,  TRUE, TRUE  },
+/* 3m   */ { TRUE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE }
 };
 
 //
@@ -62,6 +63,20 @@ bool bli_l3_ind_oper_st[BLIS_NUM_IND_METHODS][BLIS_NUM_LEVEL3_OPS][2] =
              {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}  },
 /* nat  */ { {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},
              {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE}    },
+/* 3m   */ { {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE},
+             {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}  },
+};
+
+// This array gives the order, from highest to lowest priority, in which the
+// induced methods are considered when searching for an available method. It
+// is kept separate from the ind_t values so that new methods can be appended
+// to ind_t without changing the values of existing methods. Native execution
+// must be last since it is always available.
+static const ind_t bli_l3_ind_search_order[BLIS_NUM_IND_METHODS] =
+{
+	BLIS_3M,
+	BLIS_1M,
+	BLIS_NAT,
 };
 
 // A mutex to allow synchronous access to the bli_l3_ind_oper_st array.
@@ -123,11 +138,13 @@ ind_t bli_l3_ind_oper_find_avail( opid_t oper, num_t dt )
 	// If the operation is not level-3, return native execution.
 	if ( !bli_opid_is_level3( oper ) ) return BLIS_NAT;
 
-	// Iterate over all induced methods and search for the first one
-	// that is available (ie: both implemented and enabled) for the
-	// current operation and datatype.
-	for ( im = 0; im < BLIS_NUM_IND_METHODS; ++im )
+	// Iterate over all induced methods in order of priority and search for
+	// the first one that is available (ie: both implemented and enabled) for
+	// the current operation and datatype.
+	for ( dim_t i = 0; i < BLIS_NUM_IND_METHODS; ++i )
 	{
+		im = bli_l3_ind_search_order[ i ];
+
 		bool enabled = bli_l3_ind_oper_is_impl( oper, im );
 		bool stat    = bli_l3_ind_oper_get_enable( oper, im, dt );
 
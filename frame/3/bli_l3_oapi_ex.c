@@ -68,12 +68,18 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 	if ( bli_l3_return_early_if_trivial( alpha, a, b, beta, c ) == BLIS_SUCCESS )
 		return;
 
+	// Operands stored as packed micro-panels (see bli_obj_create_packed()) are
+	// only supported by the native conventional implementation.
+	const bool packed = bli_obj_is_panel_packed( a ) ||
+	                    bli_obj_is_panel_packed( b ) ||
+	                    bli_obj_is_panel_packed( c );
+
 	// Execute the small/unpacked oapi handler. If it finds that the problem
 	// does not fall within the thresholds that define "small", or for some
 	// other reason decides not to use the small/unpacked implementation,
 	// the function returns with BLIS_FAILURE, which causes execution to
 	// proceed towards the conventional implementation.
-	if ( bli_gemmsup( alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
+	if ( !packed && bli_gemmsup( alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
 		return;
 
 	// Default to using native execution.
@@ -85,7 +91,8 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 	// precisions to vary while using 1m, which is what we do here, is unique
 	// to gemm; other level-3 operations use 1m only if all storage datatypes
 	// are equal (and they ignore the computation precision).
-	if ( bli_obj_is_complex( c ) &&
+	if ( !packed &&
+	     bli_obj_is_complex( c ) &&
 	     bli_obj_is_complex( a ) &&
 	     bli_obj_is_complex( b ) )
 	{
@@ -100,6 +107,19 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 	// method id determined above.
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
 
+	// The 3m method is implemented by its own handler, which executes three
+	// real-domain passes through the conventional implementation. If the
+	// handler declines the problem (e.g. because the storage datatypes are
+	// mixed), fall back to 1m (if enabled) or native execution.
+	if ( im == BLIS_3M )
+	{
+		if ( bli_gemm_3m( alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
+			return;
+
+		im = bli_l3_ind_oper_get_enable( BLIS_GEMM, BLIS_1M, dt ) ? BLIS_1M
+		                                                          : BLIS_NAT;
+	}
+
 #if 0
 #ifdef BLIS_ENABLE_SMALL_MATRIX
 	// Only handle small problems separately for homogeneous datatypes.
@@ -170,6 +190,14 @@ void PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)
 	if ( bli_l3_return_early_if_trivial( alpha, a, b, beta, c ) == BLIS_SUCCESS )
 		return;
 
+	// Execute the small/unpacked oapi handler. If it finds that the problem
+	// does not fall within the thresholds that define "small", or for some
+	// other reason decides not to use the small/unpacked implementation,
+	// the function returns with BLIS_FAILURE, which causes execution to
+	// proceed towards the conventional implementation.
+	if ( bli_gemmtsup( alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
+		return;
+
 	// Default to using native execution.
 	num_t dt = bli_obj_dt( c );
 	ind_t im = BLIS_NAT;
@@ -47,6 +47,22 @@ void bli_l3_packa
 {
 	obj_t a_local, a_pack;
 
+	// If A is already stored as packed micro-panels (see
+	// bli_obj_create_packed()), proceed with execution using A as-is.
+	if ( bli_obj_is_panel_packed( a ) )
+	{
+		bli_l3_int
+		(
+		  a,
+		  b,
+		  c,
+		  cntx,
+		  bli_cntl_sub_node( 0, cntl ),
+		  bli_thrinfo_sub_node( 0, thread_par )
+		);
+		return;
+	}
+
 	bli_obj_alias_to( a, &a_local );
 	if ( bli_obj_has_trans( a ) )
 	{
@@ -90,6 +106,22 @@ void bli_l3_packb
 {
 	obj_t bt_local, bt_pack;
 
+	// If B is already stored as packed micro-panels (see
+	// bli_obj_create_packed()), proceed with execution using B as-is.
+	if ( bli_obj_is_panel_packed( b ) )
+	{
+		bli_l3_int
+		(
+		  a,
+		  b,
+		  c,
+		  cntx,
+		  bli_cntl_sub_node( 0, cntl ),
+		  bli_thrinfo_sub_node( 0, thread_par )
+		);
+		return;
+	}
+
 	// We always pass B^T to bli_l3_packm.
 	bli_obj_alias_to( b, &bt_local );
 	if ( bli_obj_has_trans( b ) )
@@ -0,0 +1,268 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+void bli_obj_create_packed
+     (
+             side_t  side,
+             num_t   dt,
+             dim_t   m,
+             dim_t   n,
+       const cntx_t* cntx,
+             obj_t*  p
+     )
+{
+	bli_init_once();
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	if ( bli_error_checking_is_enabled() )
+	{
+		bli_check_error_code( bli_check_valid_side( side ) );
+		bli_check_error_code( bli_check_floating_datatype( dt ) );
+	}
+
+	// A packed B is created as a packed B^T, which has the same layout as a
+	// packed A, and then transposed.
+	const bool    left    = bli_is_left( side );
+	const bszid_t bs_id   = ( left ? BLIS_MR  : BLIS_NR  );
+	const bszid_t bb_id   = ( left ? BLIS_BBM : BLIS_BBN );
+	const dim_t   m_p     = ( left ? m : n );
+	const dim_t   n_p     = ( left ? n : m );
+
+	const dim_t   pd      = bli_cntx_get_blksz_def_dt( dt, bs_id, cntx );
+	const dim_t   pd_pack = bli_cntx_get_blksz_max_dt( dt, bs_id, cntx );
+	const dim_t   bcast   = bli_cntx_get_blksz_max_dt( dt, bb_id, cntx );
+	const dim_t   kr      = bli_cntx_get_blksz_def_dt( dt, BLIS_KR, cntx );
+
+	// Writing packed micro-panels in which each element is duplicated is not
+	// supported.
+	if ( bcast != 1 )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	bli_obj_create_without_buffer( dt, m_p, n_p, p );
+
+	// Compute the padded dimensions and the panel stride in the same way
+	// as bli_packm_init().
+	const dim_t m_p_pad = bli_align_dim_to_mult( m_p, pd, true );
+	const dim_t n_p_pad = bli_align_dim_to_mult( n_p, kr, true );
+	      inc_t ps_p    = pd_pack * n_p_pad;
+
+	if ( bli_is_odd( ps_p ) ) ps_p += 1;
+
+	// Allocate the buffer and zero it so that the padding region of the
+	// micro-panels is initialized.
+	siz_t size_p = ps_p * ( m_p_pad / pd ) * bli_obj_elem_size( p );
+	err_t r_val;
+	void* buf    = bli_malloc_user( size_p, &r_val );
+
+	memset( buf, 0, size_p );
+
+	bli_obj_set_buffer( buf, p );
+	bli_obj_set_pack_schema( BLIS_PACKED_PANELS, p );
+	bli_obj_set_padded_dims( m_p_pad, n_p_pad, p );
+	bli_obj_set_strides( 1, pd_pack, p );
+	bli_obj_set_imag_stride( 1, p );
+	bli_obj_set_panel_dim( pd, p );
+	bli_obj_set_panel_stride( ps_p, p );
+	bli_obj_set_panel_length( pd, p );
+	bli_obj_set_panel_width( n_p, p );
+
+	if ( !left ) bli_obj_induce_trans( p );
+}
+
+dim_t bli_packed_num_panels
+     (
+       const obj_t* p
+     )
+{
+	const dim_t pd  = bli_obj_panel_dim( p );
+	const dim_t dim = ( bli_obj_is_packed_along_m( p ) ? bli_obj_length( p )
+	                                                   : bli_obj_width( p ) );
+
+	return dim / pd + ( dim % pd ? 1 : 0 );
+}
+
+void bli_acquire_packed_panel
+     (
+             dim_t  i,
+       const obj_t* p,
+             obj_t* panel
+     )
+{
+	const bool  along_m = bli_obj_is_packed_along_m( p );
+	const dim_t pd      = bli_obj_panel_dim( p );
+	const inc_t ps      = bli_obj_panel_stride( p );
+	const dim_t dim     = ( along_m ? bli_obj_length( p ) : bli_obj_width( p ) );
+	const dim_t dim_i   = bli_min( pd, dim - i * pd );
+
+	char* buf = bli_obj_buffer_at_off( p );
+	buf += i * ps * bli_obj_elem_size( p );
+
+	// The panel is an ordinary (unpacked) strided matrix.
+	bli_obj_alias_to( p, panel );
+	bli_obj_set_buffer( buf, panel );
+	bli_obj_set_offs( 0, 0, panel );
+	bli_obj_set_as_root( panel );
+	bli_obj_set_pack_schema( BLIS_NOT_PACKED, panel );
+
+	if ( along_m ) bli_obj_set_dims( dim_i, bli_obj_width( p ), panel );
+	else           bli_obj_set_dims( bli_obj_length( p ), dim_i, panel );
+}
+
+void bli_copym_to_packed
+     (
+       const obj_t* a,
+       const obj_t* p
+     )
+{
+	if ( bli_error_checking_is_enabled() )
+		bli_check_error_code( bli_check_conformal_dims( a, p ) );
+
+	const bool  along_m = bli_obj_is_packed_along_m( p );
+	const dim_t pd      = bli_obj_panel_dim( p );
+
+	for ( dim_t i = 0; i < bli_packed_num_panels( p ); ++i )
+	{
+		obj_t a1, p1;
+
+		if ( along_m ) bli_acquire_mpart_t2b( BLIS_SUBPART1, i * pd, pd, a, &a1 );
+		else           bli_acquire_mpart_l2r( BLIS_SUBPART1, i * pd, pd, a, &a1 );
+
+		bli_acquire_packed_panel( i, p, &p1 );
+
+		bli_copym( &a1, &p1 );
+	}
+}
+
+void bli_copym_from_packed
+     (
+       const obj_t* p,
+       const obj_t* a
+     )
+{
+	if ( bli_error_checking_is_enabled() )
+		bli_check_error_code( bli_check_conformal_dims( p, a ) );
+
+	const bool  along_m = bli_obj_is_packed_along_m( p );
+	const dim_t pd      = bli_obj_panel_dim( p );
+
+	for ( dim_t i = 0; i < bli_packed_num_panels( p ); ++i )
+	{
+		obj_t p1, a1;
+
+		bli_acquire_packed_panel( i, p, &p1 );
+
+		if ( along_m ) bli_acquire_mpart_t2b( BLIS_SUBPART1, i * pd, pd, a, &a1 );
+		else           bli_acquire_mpart_l2r( BLIS_SUBPART1, i * pd, pd, a, &a1 );
+
+		bli_copym( &p1, &a1 );
+	}
+}
+
+void bli_scalm_packed
+     (
+       const obj_t* beta,
+       const obj_t* p
+     )
+{
+	for ( dim_t i = 0; i < bli_packed_num_panels( p ); ++i )
+	{
+		obj_t p1;
+
+		bli_acquire_packed_panel( i, p, &p1 );
+
+		bli_scalm( beta, &p1 );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+static bool bli_gemm_packed_is_a( const obj_t* p, num_t dt, const cntx_t* cntx )
+{
+	return bli_obj_is_packed_along_m( p ) &&
+	       bli_obj_panel_dim( p )  == bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ) &&
+	       bli_obj_row_stride( p ) == 1 &&
+	       bli_obj_col_stride( p ) == bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+}
+
+static bool bli_gemm_packed_is_b( const obj_t* p, num_t dt, const cntx_t* cntx )
+{
+	return bli_obj_is_packed_along_n( p ) &&
+	       bli_obj_panel_dim( p )  == bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ) &&
+	       bli_obj_row_stride( p ) == bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ) &&
+	       bli_obj_col_stride( p ) == 1;
+}
+
+void bli_gemm_packed_check
+     (
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  c,
+       const cntx_t* cntx
+     )
+{
+	const bool packed_a = bli_obj_is_panel_packed( a );
+	const bool packed_b = bli_obj_is_panel_packed( b );
+	const bool packed_c = bli_obj_is_panel_packed( c );
+
+	if ( !packed_a && !packed_b && !packed_c ) return;
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	const num_t dt = bli_obj_dt( c );
+
+	// Packed operands are only supported when no typecasting is needed.
+	if ( bli_obj_dt( a ) != dt || bli_obj_dt( b ) != dt ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) )
+		bli_check_error_code( BLIS_PACKED_OPERAND_MISMATCH );
+
+	// The micro-panels of packed operands cannot be transposed or conjugated
+	// on the fly.
+	if ( ( packed_a && bli_obj_has_trans( a ) ) ||
+	     ( packed_b && bli_obj_has_trans( b ) ) ||
+	     ( packed_c && bli_obj_has_trans( c ) ) ||
+	     ( packed_a && bli_obj_has_conj( a ) ) ||
+	     ( packed_b && bli_obj_has_conj( b ) ) )
+		bli_check_error_code( BLIS_PACKED_OPERAND_MISMATCH );
+
+	// Finally, the micro-panels must match the register blocksizes.
+	if ( ( packed_a && !bli_gemm_packed_is_a( a, dt, cntx ) ) ||
+	     ( packed_b && !bli_gemm_packed_is_b( b, dt, cntx ) ) ||
+	     ( packed_c && !bli_gemm_packed_is_a( c, dt, cntx ) &&
+	                   !bli_gemm_packed_is_b( c, dt, cntx ) ) )
+		bli_check_error_code( BLIS_PACKED_OPERAND_MISMATCH );
+}
+
@@ -0,0 +1,100 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// A packed matrix stores its elements in the micro-panel format that gemm
+// produces when it packs an operand: a packed A (side = BLIS_LEFT) consists
+// of MR x n micro-panels laid out along the m dimension, and a packed B
+// (side = BLIS_RIGHT) of m x NR micro-panels laid out along the n dimension.
+// Packed matrices may be passed to bli_gemm() in place of A or B, in which
+// case they are not packed again, or in place of C, in which case gemm
+// writes its result directly in the packed format. Thus, in a chain such
+// as C1 := A B; C2 := C1 D, the intermediate C1 can be created with
+// bli_obj_create_packed( BLIS_LEFT, ... ) and fed to the second gemm
+// without ever being stored in (or repacked from) conventional storage.
+//
+// Packed matrices are supported only by the native conventional gemm
+// implementation. All operands must share the same datatype, packed
+// operands must not be transposed or conjugated, and the micro-panels must
+// match the register blocksizes of the context used by gemm.
+//
+
+BLIS_EXPORT_BLIS void bli_obj_create_packed
+     (
+             side_t  side,
+             num_t   dt,
+             dim_t   m,
+             dim_t   n,
+       const cntx_t* cntx,
+             obj_t*  p
+     );
+
+BLIS_EXPORT_BLIS dim_t bli_packed_num_panels
+     (
+       const obj_t* p
+     );
+
+BLIS_EXPORT_BLIS void bli_acquire_packed_panel
+     (
+             dim_t  i,
+       const obj_t* p,
+             obj_t* panel
+     );
+
+BLIS_EXPORT_BLIS void bli_copym_to_packed
+     (
+       const obj_t* a,
+       const obj_t* p
+     );
+
+BLIS_EXPORT_BLIS void bli_copym_from_packed
+     (
+       const obj_t* p,
+       const obj_t* a
+     );
+
+BLIS_EXPORT_BLIS void bli_scalm_packed
+     (
+       const obj_t* beta,
+       const obj_t* p
+     );
+
+void bli_gemm_packed_check
+     (
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  c,
+       const cntx_t* cntx
+     );
+
@@ -90,6 +90,12 @@ err_t bli_gemmsup
 	if ( !bli_rntm_l3_sup( &rntm_l ) )
 		return BLIS_FAILURE;
 
+	// If enabled, try a kernel generated at runtime for this problem shape.
+	// This returns BLIS_FAILURE if the shape is not supported.
+	if ( bli_jit_is_enabled() &&
+	     bli_jit_gemm( alpha, a, b, beta, c ) == BLIS_SUCCESS )
+		return BLIS_SUCCESS;
+
 #if 0
 const num_t dt = bli_obj_dt( c );
 const dim_t m  = bli_obj_length( c );
@@ -178,6 +184,9 @@ err_t bli_gemmtsup
 	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
 	else                { rntm_l = *rntm;                       }
 
+	if ( !bli_rntm_l3_sup( &rntm_l ) )
+		return BLIS_FAILURE;
+
 	// We've now ruled out the possibility that the sup thresholds are
 	// unsatisfied.
 	// This implies that the sup thresholds (at least one of them) are met.
@@ -109,6 +109,10 @@ err_t bli_l3_sup_thread_decorator
 {
 	rntm_t rntm_l = *rntm;
 
+	// Remember the threads reserved from the thread budget (if any) when the
+	// rntm_t was factorized so that they can be returned after the call.
+	const dim_t budget_grant = bli_rntm_budget_grant( &rntm_l );
+
 	// Query the threading implementation and the number of threads requested.
 	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
 	dim_t   nt = bli_rntm_num_threads( &rntm_l );
@@ -172,8 +176,14 @@ err_t bli_l3_sup_thread_decorator
 	params.rntm   = &rntm_l;
 	params.array  = array;
 
+	// Report the parallelism with which this call was executed.
+	bli_thread_set_last_rntm( &rntm_l );
+
 	bli_thread_launch( ti, nt, bli_l3_sup_thread_decorator_entry, &params );
 
+	// Return the reserved threads to the budget.
+	bli_thread_budget_release( budget_grant );
+
 	bli_sba_checkin_array( array );
 
 	return BLIS_SUCCESS;
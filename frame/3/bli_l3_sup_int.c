@@ -268,155 +268,72 @@ err_t bli_gemmtsup_int
 
 	const dim_t  m           = bli_obj_length( c );
 	const dim_t  n           = m;
+	const dim_t  k           = bli_obj_width_after_trans( a );
 	const dim_t  MR          = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
 	const dim_t  NR          = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t  KC          = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_KC, cntx );
 	const bool   auto_factor = bli_rntm_auto_factor( rntm );
 	const dim_t  n_threads   = bli_rntm_num_threads( rntm );
-	bool         use_bp      = TRUE;
 	dim_t        jc_new;
+	dim_t        pc_new      = 1;
 	dim_t        ic_new;
 
+	// Only the block-panel algorithm (var2m) is implemented for gemmt, so the
+	// operation is transposed whenever the storage combination is not the
+	// one the microkernel prefers.
+	const trans_t trans = ( is_primary ? BLIS_NO_TRANSPOSE : BLIS_TRANSPOSE );
 
-	if ( is_primary )
+	// If the parallel thread factorization was automatic, we update it
+	// with a new factorization based on the matrix dimensions in units
+	// of micropanels.
+	if ( auto_factor )
 	{
-		// This branch handles:
-		//  - rrr rrc rcr crr for row-preferential kernels
-		//  - rcc crc ccr ccc for column-preferential kernels
-
-		const dim_t mu = m / MR;
-		const dim_t nu = n / NR;
-
-		// Decide which algorithm to use (block-panel var2m or panel-block
-		// var1n) based on the number of micropanels in the m and n dimensions.
-		// Also, recalculate the automatic thread factorization.
-		if         ( mu >= nu )    use_bp = TRUE;
-		else /* if ( mu <  nu ) */ use_bp = FALSE;
-
-		// If the parallel thread factorization was automatic, we update it
-		// with a new factorization based on the matrix dimensions in units
-		// of micropanels.
-		if ( auto_factor )
+		// The m dimension becomes the n dimension after a transposition.
+		const dim_t mu = ( is_primary ? m / MR : n / MR );
+		const dim_t nu = ( is_primary ? n / NR : m / NR );
+
+		// Only the lower or upper triangle of C is computed, so there is
+		// roughly half of the mu * nu microtiles worth of work available
+		// in the m and n dimensions. If that is too little to keep all of the
+		// threads busy, and k is deep enough that each thread would still
+		// iterate over at least one full KC block, also parallelize the k
+		// dimension (the partial products are reduced into C by the variant).
+		const dim_t n_tiles = ( mu * ( nu + 1 ) ) / 2;
+
+		if ( n_tiles < 4 * n_threads )
 		{
-			if ( use_bp )
+			for ( dim_t pc_try = n_threads; 1 < pc_try; --pc_try )
 			{
-				// In the block-panel algorithm, the m dimension is parallelized
-				// with ic_nt and the n dimension is parallelized with jc_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &ic_new, &jc_new );
+				if ( n_threads % pc_try == 0 && KC <= k / pc_try )
+				{
+					pc_new = pc_try;
+					break;
+				}
 			}
-			else // if ( !use_bp )
-			{
-				// In the panel-block algorithm, the m dimension is parallelized
-				// with jc_nt and the n dimension is parallelized with ic_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &jc_new, &ic_new );
-			}
-
-			// Update the ways of parallelism for the jc and ic loops, and then
-			// update the current thread's root thrinfo_t node according to the
-			// new ways of parallelism value for the jc loop.
-			rntm_t rntm_l = *rntm;
-			bli_rntm_set_ways_only( jc_new, 1, ic_new, 1, 1, &rntm_l );
-			bli_l3_sup_thrinfo_update( &rntm_l, thread );
 		}
 
-
-		if ( use_bp )
-		{
-			#ifdef TRACEVAR
-			if ( bli_thrinfo_am_chief( thread ) )
-			printf( "bli_l3_sup_int(): var2m primary\n" );
-			#endif
-			// block-panel macrokernel; m -> mc, mr; n -> nc, nr: var2()
-#if 0
-			bli_gemmtsup_ref_var2m( BLIS_NO_TRANSPOSE,
-			                        alpha, a, b, beta, c,
-			                        stor_id, cntx, rntm, thread );
-#endif
-		}
-		else // use_pb
-		{
-			#ifdef TRACEVAR
-			if ( bli_thrinfo_am_chief( thread ) )
-			printf( "bli_l3_sup_int(): var1n primary\n" );
-			#endif
-			// panel-block macrokernel; m -> nc*,mr; n -> mc*,nr: var1()
-#if 0
-			bli_gemmtsup_ref_var1n( BLIS_NO_TRANSPOSE,
-			                        alpha, a, b, beta, c,
-			                        stor_id, cntx, rntm, thread );
-#endif
-			// *requires nudging of nc up to be a multiple of mr.
-		}
+		// In the block-panel algorithm, the m dimension is parallelized
+		// with ic_nt and the n dimension is parallelized with jc_nt.
+		bli_thread_partition_2x2( n_threads / pc_new, mu, nu, &ic_new, &jc_new );
+
+		// Update the ways of parallelism for the jc, pc, and ic loops, and
+		// then update the current thread's root thrinfo_t node according to
+		// the new ways of parallelism.
+		rntm_t rntm_l = *rntm;
+		bli_rntm_set_ways_only( jc_new, 1, ic_new, 1, 1, &rntm_l );
+		bli_rntm_set_ways_for_only( BLIS_KC, pc_new, &rntm_l );
+		bli_l3_sup_thrinfo_update( &rntm_l, thread );
 	}
-	else
-	{
-		// This branch handles:
-		//  - rrr rrc rcr crr for column-preferential kernels
-		//  - rcc crc ccr ccc for row-preferential kernels
-
-		const dim_t mu = n / MR; // the n becomes m after a transposition
-		const dim_t nu = m / NR; // the m becomes n after a transposition
-
-		// Decide which algorithm to use (block-panel var2m or panel-block
-		// var1n) based on the number of micropanels in the m and n dimensions.
-		// Also, recalculate the automatic thread factorization.
-		if         ( mu >= nu )    use_bp = TRUE;
-		else /* if ( mu <  nu ) */ use_bp = FALSE;
-
-		// If the parallel thread factorization was automatic, we update it
-		// with a new factorization based on the matrix dimensions in units
-		// of micropanels.
-		if ( auto_factor )
-		{
-			if ( use_bp )
-			{
-				// In the block-panel algorithm, the m dimension is parallelized
-				// with ic_nt and the n dimension is parallelized with jc_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &ic_new, &jc_new );
-			}
-			else // if ( !use_bp )
-			{
-				// In the panel-block algorithm, the m dimension is parallelized
-				// with jc_nt and the n dimension is parallelized with ic_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &jc_new, &ic_new );
-			}
-
-			// Update the ways of parallelism for the jc and ic loops, and then
-			// update the current thread's root thrinfo_t node according to the
-			// new ways of parallelism value for the jc loop.
-			rntm_t rntm_l = *rntm;
-			bli_rntm_set_ways_only( jc_new, 1, ic_new, 1, 1, &rntm_l );
-			bli_l3_sup_thrinfo_update( &rntm_l, thread );
-		}
 
+	#ifdef TRACEVAR
+	if ( bli_thrinfo_am_chief( thread ) )
+	printf( "bli_l3_sup_int(): gemmt var2m %s\n", is_primary ? "primary" : "non-primary" );
+	#endif
 
-		if ( use_bp )
-		{
-			#ifdef TRACEVAR
-			if ( bli_thrinfo_am_chief( thread ) )
-			printf( "bli_l3_sup_int(): var2m non-primary\n" );
-			#endif
-			// panel-block macrokernel; m -> nc, nr; n -> mc, mr: var2() + trans
-#if 0
-			bli_gemmtsup_ref_var2m( BLIS_TRANSPOSE,
-			                        alpha, a, b, beta, c,
-			                        stor_id, cntx, rntm, thread );
-#endif
-		}
-		else // use_pb
-		{
-			#ifdef TRACEVAR
-			if ( bli_thrinfo_am_chief( thread ) )
-			printf( "bli_l3_sup_int(): var1n non-primary\n" );
-			#endif
-			// block-panel macrokernel; m -> mc*,nr; n -> nc*,mr: var1() + trans
-#if 0
-			bli_gemmtsup_ref_var1n( BLIS_TRANSPOSE,
-			                        alpha, a, b, beta, c,
-			                        stor_id, cntx, rntm, thread );
-#endif
-			// *requires nudging of mc up to be a multiple of nr.
-		}
-	}
+	// block-panel macrokernel; m -> mc, mr; n -> nc, nr: var2() (+ trans)
+	bli_gemmtsup_ref_var2m( trans,
+	                        alpha, a, b, beta, c,
+	                        stor_id, cntx, rntm, thread );
 
 	// Return success so that the caller knows that we computed the solution.
 	return BLIS_SUCCESS;
@@ -51,6 +51,7 @@ typedef void (*PASTECH(opname,_ker_ft)) \
      );
 
 GENTDEF( gemmsup )
+GENTDEF( gemmtiny )
 
 
 #endif
@@ -49,6 +49,8 @@
        const void*  beta, \
              void*  c, inc_t rs_c, inc_t cs_c
 
+#define gemmtiny_params gemmsup_params
+
 
 #endif
 
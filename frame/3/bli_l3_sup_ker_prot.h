@@ -50,6 +50,7 @@ void PASTEMAC(ch,funcname) \
      );
 
 #define GEMMSUP_KER_PROT( ctype, ch, fn )  SUPTPROT( ctype, ch, fn, gemmsup );
+#define GEMMTINY_KER_PROT( ctype, ch, fn ) SUPTPROT( ctype, ch, fn, gemmtiny );
 
 
 #endif
@@ -89,14 +89,14 @@ void PASTEMAC(ch,varname) \
 		bli_toggle_trans( &transc ); \
 	} \
 \
-	/* Prepare to pack to row-stored column panels. */ \
-	iter_dim       = n; \
-	panel_len_full = m; \
-	panel_len_max  = m_max; \
+	/* Prepare to pack to column-stored row panels. */ \
+	iter_dim       = m; \
+	panel_len_full = n; \
+	panel_len_max  = n_max; \
 	panel_dim_max  = pd_p; \
-	vs_c           = cs_c; \
-	ldc            = rs_c; \
-	ldp            = rs_p; \
+	vs_c           = rs_c; \
+	ldc            = cs_c; \
+	ldp            = cs_p; \
 \
 	num_t  dt      = PASTEMAC(ch,type); \
 	ukr_t ker_id   = BLIS_PACKM_KER; \
@@ -328,13 +328,13 @@ void PASTEMAC(ch,varname) \
 		bli_toggle_trans( &transc ); \
 	} \
 \
-	/* Prepare to pack to a column-stored matrix. */ \
-	iter_dim       = n; \
-	vector_len     = m; \
-	incc           = rs_c; \
-	ldc            = cs_c; \
-	incp           = 1; \
-	ldp            = cs_p; \
+	/* Prepare to pack to a row-stored matrix. */ \
+	iter_dim       = m; \
+	vector_len     = n; \
+	incc           = cs_c; \
+	ldc            = rs_c; \
+	incp           = cs_p; \
+	ldp            = rs_p; \
 \
 	/* Compute the total number of iterations we'll need. */ \
 	n_iter = iter_dim; \
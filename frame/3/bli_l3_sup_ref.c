@@ -118,6 +118,11 @@ err_t bli_gemmtsup_ref
 	if ( bli_error_checking_is_enabled() )
 		bli_gemmt_check( alpha, a, b, beta, c, cntx );
 
+	// Don't use the small/unpacked implementation if one of the matrices
+	// uses general stride. (See the comment in bli_gemmsup_ref() above.)
+	const stor3_t stor_id = bli_obj_stor3_from_strides( c, a, b );
+	if ( stor_id == BLIS_XXX ) return BLIS_FAILURE;
+
 #if 0
 	// NOTE: This special case handling is done within the variants.
 
@@ -60,6 +60,8 @@ GENPROT( gemmsup_ref_var2 )
 GENPROT( gemmsup_ref_var1n )
 GENPROT( gemmsup_ref_var2m )
 
+GENPROT( gemmtsup_ref_var2m )
+
 
 //
 // Prototype BLAS-like interfaces with void pointer operands.
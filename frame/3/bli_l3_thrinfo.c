@@ -193,6 +193,344 @@ void bli_l3_sup_thrinfo_update
 
 // -----------------------------------------------------------------------------
 
+// A cache of the per-thread thrinfo_t trees built by bli_l3_thrinfo_create().
+// Each entry holds the trees for one launch of nt threads, keyed on the
+// threading implementation, nt, and a signature of the splits made while
+// growing the tree (which captures both the shape of the control tree and
+// the loop factorization in the rntm_t). Trees in the cache are allocated
+// outside of the sba (with a NULL pool) since they outlive the array_t
+// checked out for any single call.
+
+#define BLIS_L3_THRINFO_KEY_MAX 64
+
+struct l3_thrinfo_cache_entry_s
+{
+	bool        in_use;
+	bool        stale;
+
+	timpl_t     ti;
+	dim_t       nt;
+	dim_t       key_len;
+	dim_t       key[ BLIS_L3_THRINFO_KEY_MAX ];
+
+	thrinfo_t** roots;
+};
+
+#if BLIS_L3_THRINFO_CACHE_SIZE > 0
+static l3_thrinfo_cache_entry_t l3_thrinfo_cache[ BLIS_L3_THRINFO_CACHE_SIZE ];
+#endif
+
+static bli_pthread_mutex_t l3_thrinfo_cache_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
+// The number of checkouts that did and did not find a matching entry.
+static dim_t l3_thrinfo_cache_n_hits   = 0;
+static dim_t l3_thrinfo_cache_n_misses = 0;
+
+// Compute the signature of the thrinfo_t tree that bli_l3_thrinfo_grow()
+// would build for the given rntm_t and control tree. Each split contributes
+// its number of ways (0 for the leaf split) and each list of sub-nodes is
+// terminated by -1. Returns FALSE if the signature does not fit in key.
+static bool bli_l3_thrinfo_key
+     (
+       const rntm_t* rntm,
+       const cntl_t* cntl,
+             dim_t*  key,
+             dim_t*  key_len
+     )
+{
+	if ( bli_cntl_is_leaf( cntl ) )
+	{
+		if ( *key_len == BLIS_L3_THRINFO_KEY_MAX ) return FALSE;
+		key[ (*key_len)++ ] = 0;
+		return TRUE;
+	}
+
+	for ( dim_t i = 0; i < BLIS_MAX_SUB_NODES; i++ )
+	{
+		const cntl_t* sub_node = bli_cntl_sub_node( i, cntl );
+		if ( sub_node == NULL )
+			break;
+
+		if ( *key_len == BLIS_L3_THRINFO_KEY_MAX ) return FALSE;
+		key[ (*key_len)++ ] = bli_rntm_total_ways_for( bli_cntl_ways( i, cntl ), rntm );
+
+		if ( !bli_l3_thrinfo_key( rntm, sub_node, key, key_len ) ) return FALSE;
+	}
+
+	if ( *key_len == BLIS_L3_THRINFO_KEY_MAX ) return FALSE;
+	key[ (*key_len)++ ] = -1;
+	return TRUE;
+}
+
+// Free the thrinfo_t trees held by a cache entry and mark it as empty.
+static void bli_l3_thrinfo_cache_clear_entry
+     (
+       l3_thrinfo_cache_entry_t* entry
+     )
+{
+	if ( entry->roots != NULL )
+	{
+		for ( dim_t i = 0; i < entry->nt; ++i )
+			bli_thrinfo_free( entry->roots[ i ] );
+
+		bli_free_intl( entry->roots );
+	}
+
+	entry->roots   = NULL;
+	entry->in_use  = FALSE;
+	entry->stale   = FALSE;
+	entry->key_len = 0;
+}
+
+l3_thrinfo_cache_entry_t* bli_l3_thrinfo_cache_checkout
+     (
+             timpl_t ti,
+             dim_t   nt,
+       const rntm_t* rntm,
+       const cntl_t* cntl
+     )
+{
+#if BLIS_L3_THRINFO_CACHE_SIZE > 0
+	dim_t key[ BLIS_L3_THRINFO_KEY_MAX ];
+	dim_t key_len = 0;
+
+	// Trees whose signatures are too long to be keyed are never cached.
+	if ( !bli_l3_thrinfo_key( rntm, cntl, key, &key_len ) ) return NULL;
+
+	l3_thrinfo_cache_entry_t* entry = NULL;
+
+	// BEGIN CRITICAL SECTION
+	bli_pthread_mutex_lock( &l3_thrinfo_cache_mutex );
+	{
+		l3_thrinfo_cache_entry_t* empty = NULL;
+		l3_thrinfo_cache_entry_t* idle  = NULL;
+
+		for ( dim_t i = 0; i < BLIS_L3_THRINFO_CACHE_SIZE; ++i )
+		{
+			l3_thrinfo_cache_entry_t* e = &l3_thrinfo_cache[ i ];
+
+			if ( e->in_use ) continue;
+
+			if ( e->roots == NULL )
+			{
+				if ( empty == NULL ) empty = e;
+				continue;
+			}
+
+			if ( e->ti == ti && e->nt == nt && e->key_len == key_len &&
+			     memcmp( e->key, key, key_len * sizeof( dim_t ) ) == 0 )
+			{
+				entry = e;
+				break;
+			}
+
+			if ( idle == NULL ) idle = e;
+		}
+
+		if ( entry != NULL ) l3_thrinfo_cache_n_hits++;
+		else                 l3_thrinfo_cache_n_misses++;
+
+		// If there was no matching entry, claim an empty one or, failing
+		// that, evict an idle entry with a different key. If all entries
+		// are in use, the call proceeds without the cache.
+		if ( entry == NULL )
+		{
+			if      ( empty != NULL ) entry = empty;
+			else if ( idle  != NULL ) { bli_l3_thrinfo_cache_clear_entry( idle ); entry = idle; }
+
+			if ( entry != NULL )
+			{
+				err_t r_val;
+
+				entry->ti      = ti;
+				entry->nt      = nt;
+				entry->key_len = key_len;
+				memcpy( entry->key, key, key_len * sizeof( dim_t ) );
+
+				entry->roots = bli_calloc_intl( nt * sizeof( thrinfo_t* ), &r_val );
+			}
+		}
+
+		if ( entry != NULL ) entry->in_use = TRUE;
+	}
+	bli_pthread_mutex_unlock( &l3_thrinfo_cache_mutex );
+	// END CRITICAL SECTION
+
+	return entry;
+#else
+	return NULL;
+#endif
+}
+
+void bli_l3_thrinfo_cache_checkin
+     (
+       l3_thrinfo_cache_entry_t* entry
+     )
+{
+	if ( entry == NULL ) return;
+
+	// BEGIN CRITICAL SECTION
+	bli_pthread_mutex_lock( &l3_thrinfo_cache_mutex );
+	{
+		// If the cache was flushed while the entry was in use, free it now.
+		if ( entry->stale ) bli_l3_thrinfo_cache_clear_entry( entry );
+		else                entry->in_use = FALSE;
+	}
+	bli_pthread_mutex_unlock( &l3_thrinfo_cache_mutex );
+	// END CRITICAL SECTION
+}
+
+void bli_l3_thrinfo_cache_flush( void )
+{
+#if BLIS_L3_THRINFO_CACHE_SIZE > 0
+	// BEGIN CRITICAL SECTION
+	bli_pthread_mutex_lock( &l3_thrinfo_cache_mutex );
+	{
+		for ( dim_t i = 0; i < BLIS_L3_THRINFO_CACHE_SIZE; ++i )
+		{
+			l3_thrinfo_cache_entry_t* e = &l3_thrinfo_cache[ i ];
+
+			if ( e->in_use ) e->stale = TRUE;
+			else             bli_l3_thrinfo_cache_clear_entry( e );
+		}
+	}
+	bli_pthread_mutex_unlock( &l3_thrinfo_cache_mutex );
+	// END CRITICAL SECTION
+#endif
+}
+
+void bli_l3_thrinfo_cache_query
+     (
+       dim_t* n_hits,
+       dim_t* n_misses,
+       dim_t* n_entries
+     )
+{
+	dim_t n = 0;
+
+	// BEGIN CRITICAL SECTION
+	bli_pthread_mutex_lock( &l3_thrinfo_cache_mutex );
+	{
+#if BLIS_L3_THRINFO_CACHE_SIZE > 0
+		for ( dim_t i = 0; i < BLIS_L3_THRINFO_CACHE_SIZE; ++i )
+			if ( l3_thrinfo_cache[ i ].roots != NULL ) n++;
+#endif
+
+		if ( n_hits   != NULL ) *n_hits   = l3_thrinfo_cache_n_hits;
+		if ( n_misses != NULL ) *n_misses = l3_thrinfo_cache_n_misses;
+	}
+	bli_pthread_mutex_unlock( &l3_thrinfo_cache_mutex );
+	// END CRITICAL SECTION
+
+	if ( n_entries != NULL ) *n_entries = n;
+}
+
+// Replace every reference to the communicator old_comm in a thrinfo_t tree
+// with new_comm. This is used to detach a cached tree from the global
+// communicator of the launch that built it, and to attach it to the global
+// communicator of the launch that reuses it.
+static void bli_l3_thrinfo_replace_comm
+     (
+       thrcomm_t* old_comm,
+       thrcomm_t* new_comm,
+       thrinfo_t* thread
+     )
+{
+	if ( thread == NULL ) return;
+
+	if ( bli_thrinfo_comm( thread ) == old_comm )
+		bli_thrinfo_set_comm( new_comm, thread );
+
+	for ( dim_t i = 0; i < BLIS_MAX_SUB_NODES; i++ )
+		bli_l3_thrinfo_replace_comm( old_comm, new_comm, bli_thrinfo_sub_node( i, thread ) );
+}
+
+// Return a thrinfo_t tree to the state it was in just after it was grown:
+// release any packing memory, and reset (rather than free) the communicators
+// owned by the tree.
+static void bli_l3_thrinfo_reset
+     (
+       thrinfo_t* thread
+     )
+{
+	if ( thread == NULL ) return;
+
+	for ( dim_t i = 0; i < BLIS_MAX_SUB_NODES; i++ )
+		bli_l3_thrinfo_reset( bli_thrinfo_sub_node( i, thread ) );
+
+	mem_t* cntl_mem_p = bli_thrinfo_mem( thread );
+
+	if ( bli_thrinfo_am_chief( thread ) )
+	{
+		if ( bli_thrinfo_needs_free_comm( thread ) )
+		{
+			thrcomm_t* comm = bli_thrinfo_comm( thread );
+			timpl_t    ti   = bli_thrcomm_thread_impl( comm );
+			dim_t      nt   = bli_thrcomm_num_threads( comm );
+
+			bli_thrcomm_cleanup( comm );
+			bli_thrcomm_init( ti, nt, comm );
+		}
+
+		if ( bli_mem_is_alloc( cntl_mem_p ) )
+			bli_pba_release( bli_thrinfo_pba( thread ), cntl_mem_p );
+	}
+
+	// Every thread holds a copy of its chief's mem_t, so all of them must
+	// clear it so that the next packm allocation is performed collectively.
+	bli_mem_clear( cntl_mem_p );
+}
+
+thrinfo_t* bli_l3_thrinfo_cache_acquire
+     (
+             l3_thrinfo_cache_entry_t* entry,
+             dim_t                     id,
+             thrcomm_t*                gl_comm,
+             array_t*                  array,
+       const rntm_t*                   rntm,
+       const cntl_t*                   cntl
+     )
+{
+	// Fall back to an uncached tree if there is no entry or if the number
+	// of threads that actually arrived differs from that of the entry (see
+	// bli_l3_thread_decorator_thread_check()).
+	if ( entry == NULL || entry->nt != bli_thrcomm_num_threads( gl_comm ) )
+		return bli_l3_thrinfo_create( id, gl_comm, array, rntm, cntl );
+
+	thrinfo_t* root = entry->roots[ id ];
+
+	if ( root != NULL )
+	{
+		bli_l3_thrinfo_replace_comm( NULL, gl_comm, root );
+		return root;
+	}
+
+	// Grow a new tree outside of the sba so that it may be cached.
+	return bli_l3_thrinfo_create( id, gl_comm, NULL, rntm, cntl );
+}
+
+void bli_l3_thrinfo_cache_release
+     (
+       l3_thrinfo_cache_entry_t* entry,
+       thrinfo_t*                thread
+     )
+{
+	thrcomm_t* gl_comm = bli_thrinfo_comm( thread );
+
+	if ( entry == NULL || entry->nt != bli_thrcomm_num_threads( gl_comm ) )
+	{
+		bli_thrinfo_free( thread );
+		return;
+	}
+
+	bli_l3_thrinfo_reset( thread );
+	bli_l3_thrinfo_replace_comm( gl_comm, NULL, thread );
+
+	entry->roots[ bli_thrinfo_thread_id( thread ) ] = thread;
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_l3_thrinfo_print_gemm_paths
      (
        thrinfo_t** threads
@@ -100,6 +100,60 @@ void bli_l3_sup_thrinfo_update
              thrinfo_t* root
      );
 
+// -----------------------------------------------------------------------------
+
+// The maximum number of distinct thrinfo_t tree sets retained across level-3
+// calls. Setting this to 0 disables the cache.
+#ifndef BLIS_L3_THRINFO_CACHE_SIZE
+#define BLIS_L3_THRINFO_CACHE_SIZE 8
+#endif
+
+typedef struct l3_thrinfo_cache_entry_s l3_thrinfo_cache_entry_t;
+
+l3_thrinfo_cache_entry_t* bli_l3_thrinfo_cache_checkout
+     (
+             timpl_t ti,
+             dim_t   nt,
+       const rntm_t* rntm,
+       const cntl_t* cntl
+     );
+
+void bli_l3_thrinfo_cache_checkin
+     (
+       l3_thrinfo_cache_entry_t* entry
+     );
+
+void bli_l3_thrinfo_cache_flush( void );
+
+// Query the number of checkouts that reused cached trees (n_hits) and that
+// did not (n_misses) since the library was loaded, and the number of entries
+// currently holding trees. Checkouts whose trees are too deep to be keyed
+// are not counted. Any of the arguments may be NULL.
+BLIS_EXPORT_BLIS void bli_l3_thrinfo_cache_query
+     (
+       dim_t* n_hits,
+       dim_t* n_misses,
+       dim_t* n_entries
+     );
+
+thrinfo_t* bli_l3_thrinfo_cache_acquire
+     (
+             l3_thrinfo_cache_entry_t* entry,
+             dim_t                     id,
+             thrcomm_t*                gl_comm,
+             array_t*                  array,
+       const rntm_t*                   rntm,
+       const cntl_t*                   cntl
+     );
+
+void bli_l3_thrinfo_cache_release
+     (
+       l3_thrinfo_cache_entry_t* entry,
+       thrinfo_t*                thread
+     );
+
+// -----------------------------------------------------------------------------
+
 void bli_l3_thrinfo_print_gemm_paths
      (
        thrinfo_t** threads
@@ -0,0 +1,137 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The tiny gemm kernels of the native context, indexed by datatype. These
+// are looked up on first use.
+static gemmtiny_ker_ft gemm_tiny_ker[ BLIS_NUM_FP_TYPES ];
+
+static gemmtiny_ker_ft bli_gemm_tiny_query_ker( num_t dt )
+{
+	gemmtiny_ker_ft ker = __atomic_load_n( &gemm_tiny_ker[ dt ], __ATOMIC_RELAXED );
+
+	if ( ker == NULL )
+	{
+		ker = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_TINY_UKR, bli_gks_query_cntx() );
+
+		__atomic_store_n( &gemm_tiny_ker[ dt ], ker, __ATOMIC_RELAXED );
+	}
+
+	return ker;
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	if ( m > BLIS_GEMM_TINY_MAX || n > BLIS_GEMM_TINY_MAX || \
+	     k > BLIS_GEMM_TINY_MAX || ( rs_c != 1 && cs_c != 1 ) ) \
+	{ \
+		PASTEMAC(ch,gemm) \
+		( \
+		  transa, transb, m, n, k, \
+		  alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+		  beta, c, rs_c, cs_c \
+		); \
+		return; \
+	} \
+\
+	bli_init_once(); \
+\
+	if ( m == 0 || n == 0 ) return; \
+\
+	/* A and B are not referenced when alpha is zero. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) k = 0; \
+\
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b ); \
+\
+	conj_t conja = bli_extract_conj( transa ); \
+	conj_t conjb = bli_extract_conj( transb ); \
+\
+	/* The tiny gemm kernels require column-stored C. If C is row-stored,
+	   compute C^T = B^T A^T instead. */ \
+	if ( rs_c != 1 && cs_c == 1 ) \
+	{ \
+		bli_swap_incs( &rs_c, &cs_c ); \
+		bli_swap_dims( &m, &n ); \
+\
+		conj_t       conjt = conja; conja = conjb; conjb = conjt; \
+		const ctype* t     = a;     a     = b;     b     = t; \
+\
+		inc_t rs_t = rs_a; rs_a = cs_b; cs_b = rs_t; \
+		inc_t cs_t = cs_a; cs_a = rs_b; rs_b = cs_t; \
+	} \
+\
+	/* The tiny gemm kernels also require A to have unit row stride, so
+	   copy A to a local buffer if necessary. */ \
+	ctype a_l[ BLIS_GEMM_TINY_MAX * BLIS_GEMM_TINY_MAX ]; \
+\
+	if ( rs_a != 1 && k > 0 ) \
+	{ \
+		for ( dim_t p = 0; p < k; ++p ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,copys)( a[ i*rs_a + p*cs_a ], a_l[ i + p*m ] ); \
+\
+		a = a_l; rs_a = 1; cs_a = m; \
+	} \
+\
+	gemmtiny_ker_ft ker = bli_gemm_tiny_query_ker( PASTEMAC(ch,type) ); \
+\
+	ker \
+	( \
+	  conja, conjb, \
+	  m, n, k, \
+	  alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+	  beta, c, rs_c, cs_c, \
+	  NULL, NULL \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_tiny )
+
@@ -57,7 +57,8 @@ err_t bli_l3_return_early_if_trivial
 	     bli_obj_has_zero_dim( a ) ||
 	     bli_obj_has_zero_dim( b ) )
 	{
-		bli_scalm( beta, c );
+		if ( bli_obj_is_panel_packed( c ) ) bli_scalm_packed( beta, c );
+		else                                bli_scalm( beta, c );
 		return BLIS_SUCCESS;
 	}
 
@@ -0,0 +1,567 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The region of a matrix buffer accessed by an operation, in the storage
+// coordinates of the buffer (i.e. before any transposition is applied).
+typedef struct dag_region_s
+{
+	const void* buf;
+	      inc_t rs;
+	      inc_t cs;
+	      dim_t off_m;
+	      dim_t off_n;
+	      dim_t m;
+	      dim_t n;
+	      bool  write;
+} dag_region_t;
+
+typedef struct dag_task_s
+{
+	// The operation (or BLIS_NOID for a user-supplied task) and its operands.
+	opid_t       family;
+	side_t       side;
+	obj_t        alpha;
+	obj_t        a;
+	obj_t        b;
+	obj_t        beta;
+	obj_t        c;
+	dag_func_ft  func;
+	void*        params;
+
+	dim_t        n_regions;
+	dag_region_t regions[ BLIS_DAG_MAX_ACCESSES ];
+
+	// The number of predecessors and, during execution, the number of them
+	// that have not yet completed.
+	dim_t        n_preds;
+	dim_t        n_waiting;
+
+	// The tasks that depend on this one.
+	dim_t        n_succs;
+	dim_t        n_succs_alloc;
+	dim_t*       succs;
+} dag_task_t;
+
+struct dag_s
+{
+	const cntx_t*       cntx;
+	      rntm_t        rntm;
+	      dim_t         n_workers;
+
+	      dim_t         n_tasks;
+	      dim_t         n_tasks_alloc;
+	      dag_task_t*   tasks;
+
+	// State shared by the workers during bli_dag_execute(). Ready tasks are
+	// kept in a min-heap of task indices so that, among the tasks that may
+	// run, the one recorded first (typically on the critical path of a
+	// blocked algorithm) runs first.
+	bli_pthread_mutex_t mutex;
+	bli_pthread_cond_t  cond;
+	      dim_t*        ready;
+	      dim_t         n_ready;
+	      dim_t         n_done;
+};
+
+// -----------------------------------------------------------------------------
+
+static void* bli_dag_grow( void* buf, dim_t n_used, dim_t* n_alloc, size_t size )
+{
+	if ( n_used < *n_alloc ) return buf;
+
+	err_t r_val;
+	dim_t n_new   = bli_max( 2 * (*n_alloc), 16 );
+	void* buf_new = bli_malloc_intl( n_new * size, &r_val );
+
+	if ( buf != NULL )
+	{
+		memcpy( buf_new, buf, n_used * size );
+		bli_free_intl( buf );
+	}
+
+	*n_alloc = n_new;
+
+	return buf_new;
+}
+
+static void bli_dag_add_region( const obj_t* obj, bool write, dag_task_t* t )
+{
+	if ( obj == NULL ) return;
+
+	if ( t->n_regions == BLIS_DAG_MAX_ACCESSES )
+	{
+		fprintf( stderr, "\n" );
+		fprintf( stderr, "libblis: A task may access at most BLIS_DAG_MAX_ACCESSES (%d) objects.\n", ( int )BLIS_DAG_MAX_ACCESSES );
+		fprintf( stderr, "libblis: %s: line %d\n", __FILE__, ( int )__LINE__ );
+		bli_abort();
+	}
+
+	dag_region_t* r = &t->regions[ t->n_regions++ ];
+
+	r->buf   = bli_obj_buffer( obj );
+	r->rs    = bli_obj_row_stride( obj );
+	r->cs    = bli_obj_col_stride( obj );
+	r->off_m = bli_obj_row_off( obj );
+	r->off_n = bli_obj_col_off( obj );
+	r->m     = bli_obj_length( obj );
+	r->n     = bli_obj_width( obj );
+	r->write = write;
+}
+
+static bool bli_dag_regions_conflict( const dag_region_t* x, const dag_region_t* y )
+{
+	// Concurrent reads never conflict, and distinct buffers are assumed not
+	// to overlap.
+	if ( !x->write && !y->write ) return FALSE;
+	if ( x->buf != y->buf ) return FALSE;
+
+	// Views of one buffer with different strides may interleave, so we
+	// conservatively assume that they overlap.
+	if ( x->rs != y->rs || x->cs != y->cs ) return TRUE;
+
+	return x->off_m < y->off_m + y->m && y->off_m < x->off_m + x->m &&
+	       x->off_n < y->off_n + y->n && y->off_n < x->off_n + x->n;
+}
+
+static bool bli_dag_tasks_conflict( const dag_task_t* s, const dag_task_t* t )
+{
+	for ( dim_t i = 0; i < s->n_regions; ++i )
+	for ( dim_t j = 0; j < t->n_regions; ++j )
+	{
+		if ( bli_dag_regions_conflict( &s->regions[ i ], &t->regions[ j ] ) )
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
+static dag_task_t* bli_dag_push( dag_t* dag )
+{
+	dag->tasks = bli_dag_grow( dag->tasks, dag->n_tasks, &dag->n_tasks_alloc,
+	                           sizeof( dag_task_t ) );
+
+	dag_task_t* t = &dag->tasks[ dag->n_tasks ];
+
+	memset( t, 0, sizeof( dag_task_t ) );
+	t->family = BLIS_NOID;
+
+	return t;
+}
+
+static void bli_dag_link( dag_t* dag )
+{
+	// Make the newest task depend on every earlier task with which it
+	// conflicts.
+	const dim_t       id = dag->n_tasks;
+	      dag_task_t* t  = &dag->tasks[ id ];
+
+	for ( dim_t i = 0; i < id; ++i )
+	{
+		dag_task_t* s = &dag->tasks[ i ];
+
+		if ( !bli_dag_tasks_conflict( s, t ) ) continue;
+
+		s->succs = bli_dag_grow( s->succs, s->n_succs, &s->n_succs_alloc,
+		                         sizeof( dim_t ) );
+		s->succs[ s->n_succs++ ] = id;
+		t->n_preds++;
+	}
+
+	dag->n_tasks++;
+}
+
+static void bli_dag_record
+     (
+             opid_t  family,
+             side_t  side,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+             dag_t*  dag
+     )
+{
+	dag_task_t* t = bli_dag_push( dag );
+
+	t->family = family;
+	t->side   = side;
+
+	bli_l3_async_copy_scalar( alpha, &t->alpha );
+	bli_l3_async_copy_matrix( a, &t->a );
+	bli_l3_async_copy_matrix( b, &t->b );
+	bli_l3_async_copy_scalar( beta, &t->beta );
+	bli_l3_async_copy_matrix( c, &t->c );
+
+	// trmm and trsm overwrite B; all other operations overwrite C.
+	const bool b_written = ( family == BLIS_TRMM || family == BLIS_TRSM );
+
+	bli_dag_add_region( a, FALSE,     t );
+	bli_dag_add_region( b, b_written, t );
+	bli_dag_add_region( c, TRUE,      t );
+
+	bli_dag_link( dag );
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_dag_run( const dag_t* dag, dag_task_t* t )
+{
+	// Each operation runs on the worker that picked it up, with a copy of
+	// the per-task rntm_t (which the operation may modify).
+	      rntm_t  rntm = dag->rntm;
+	const cntx_t* cntx = dag->cntx;
+
+	switch ( t->family )
+	{
+		case BLIS_GEMM:  bli_gemm_ex( &t->alpha, &t->a, &t->b, &t->beta, &t->c, cntx, &rntm ); break;
+		case BLIS_GEMMT: bli_gemmt_ex( &t->alpha, &t->a, &t->b, &t->beta, &t->c, cntx, &rntm ); break;
+		case BLIS_HER2K: bli_her2k_ex( &t->alpha, &t->a, &t->b, &t->beta, &t->c, cntx, &rntm ); break;
+		case BLIS_SYR2K: bli_syr2k_ex( &t->alpha, &t->a, &t->b, &t->beta, &t->c, cntx, &rntm ); break;
+		case BLIS_HEMM:  bli_hemm_ex( t->side, &t->alpha, &t->a, &t->b, &t->beta, &t->c, cntx, &rntm ); break;
+		case BLIS_SYMM:  bli_symm_ex( t->side, &t->alpha, &t->a, &t->b, &t->beta, &t->c, cntx, &rntm ); break;
+		case BLIS_TRMM3: bli_trmm3_ex( t->side, &t->alpha, &t->a, &t->b, &t->beta, &t->c, cntx, &rntm ); break;
+		case BLIS_HERK:  bli_herk_ex( &t->alpha, &t->a, &t->beta, &t->c, cntx, &rntm ); break;
+		case BLIS_SYRK:  bli_syrk_ex( &t->alpha, &t->a, &t->beta, &t->c, cntx, &rntm ); break;
+		case BLIS_TRMM:  bli_trmm_ex( t->side, &t->alpha, &t->a, &t->b, cntx, &rntm ); break;
+		case BLIS_TRSM:  bli_trsm_ex( t->side, &t->alpha, &t->a, &t->b, cntx, &rntm ); break;
+		default:         t->func( t->params ); break;
+	}
+}
+
+static void bli_dag_ready_push( dag_t* dag, dim_t id )
+{
+	dim_t* heap = dag->ready;
+	dim_t  i    = dag->n_ready++;
+
+	while ( 0 < i && id < heap[ ( i - 1 ) / 2 ] )
+	{
+		heap[ i ] = heap[ ( i - 1 ) / 2 ];
+		i         = ( i - 1 ) / 2;
+	}
+
+	heap[ i ] = id;
+}
+
+static dim_t bli_dag_ready_pop( dag_t* dag )
+{
+	dim_t* heap = dag->ready;
+	dim_t  top  = heap[ 0 ];
+	dim_t  last = heap[ --dag->n_ready ];
+	dim_t  n    = dag->n_ready;
+	dim_t  i    = 0;
+
+	while ( 2 * i + 1 < n )
+	{
+		dim_t child = 2 * i + 1;
+
+		if ( child + 1 < n && heap[ child + 1 ] < heap[ child ] ) child += 1;
+		if ( last <= heap[ child ] ) break;
+
+		heap[ i ] = heap[ child ];
+		i         = child;
+	}
+
+	if ( 0 < n ) heap[ i ] = last;
+
+	return top;
+}
+
+static void* bli_dag_worker( void* data )
+{
+	dag_t* dag = data;
+
+	bli_pthread_mutex_lock( &dag->mutex );
+
+	while ( TRUE )
+	{
+		while ( dag->n_ready == 0 && dag->n_done < dag->n_tasks )
+			bli_pthread_cond_wait( &dag->cond, &dag->mutex );
+
+		// Nothing is ready only once every task has completed.
+		if ( dag->n_ready == 0 ) break;
+
+		dag_task_t* t = &dag->tasks[ bli_dag_ready_pop( dag ) ];
+
+		bli_pthread_mutex_unlock( &dag->mutex );
+
+		bli_dag_run( dag, t );
+
+		bli_pthread_mutex_lock( &dag->mutex );
+
+		dag->n_done += 1;
+
+		bool wake = ( dag->n_done == dag->n_tasks );
+
+		for ( dim_t i = 0; i < t->n_succs; ++i )
+		{
+			dag_task_t* s = &dag->tasks[ t->succs[ i ] ];
+
+			if ( --s->n_waiting == 0 )
+			{
+				bli_dag_ready_push( dag, t->succs[ i ] );
+				wake = TRUE;
+			}
+		}
+
+		if ( wake ) bli_pthread_cond_broadcast( &dag->cond );
+	}
+
+	bli_pthread_mutex_unlock( &dag->mutex );
+
+	return NULL;
+}
+
+static void bli_dag_clear( dag_t* dag )
+{
+	for ( dim_t i = 0; i < dag->n_tasks; ++i )
+		bli_free_intl( dag->tasks[ i ].succs );
+
+	dag->n_tasks = 0;
+}
+
+// -----------------------------------------------------------------------------
+
+dag_t* bli_dag_create( const cntx_t* cntx, const rntm_t* rntm )
+{
+	bli_init_once();
+
+	err_t  r_val;
+	dag_t* dag = bli_malloc_intl( sizeof( dag_t ), &r_val );
+
+	memset( dag, 0, sizeof( dag_t ) );
+
+	rntm_t rntm_l;
+	if ( rntm != NULL ) rntm_l = *rntm;
+	else bli_rntm_init_from_global( &rntm_l );
+
+	// The workers form one flat team, so only the total number of threads
+	// matters (however it was specified).
+	dim_t nt = bli_rntm_auto_factor( &rntm_l ) ? bli_rntm_num_threads( &rntm_l )
+	                                           : bli_rntm_calc_num_threads( &rntm_l );
+
+	if ( bli_rntm_thread_impl( &rntm_l ) == BLIS_SINGLE ) nt = 1;
+
+	dag->cntx      = cntx;
+	dag->n_workers = bli_max( nt, 1 );
+
+	// The tasks inherit the caller's remaining settings (sup, packing), but
+	// each one runs single-threaded on its worker.
+	dag->rntm = rntm_l;
+	bli_rntm_set_thread_impl_only( BLIS_SINGLE, &dag->rntm );
+	bli_rntm_clear_auto_factor( &dag->rntm );
+	bli_rntm_set_num_threads_only( 1, &dag->rntm );
+	bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &dag->rntm );
+	bli_rntm_set_budget_grant_only( 0, &dag->rntm );
+
+	bli_pthread_mutex_init( &dag->mutex, NULL );
+	bli_pthread_cond_init( &dag->cond, NULL );
+
+	return dag;
+}
+
+void bli_dag_free( dag_t* dag )
+{
+	if ( dag == NULL ) return;
+
+	bli_dag_clear( dag );
+
+	bli_pthread_cond_destroy( &dag->cond );
+	bli_pthread_mutex_destroy( &dag->mutex );
+
+	bli_free_intl( dag->tasks );
+	bli_free_intl( dag );
+}
+
+dim_t bli_dag_num_tasks( const dag_t* dag )
+{
+	return dag->n_tasks;
+}
+
+void bli_dag_execute( dag_t* dag )
+{
+	const dim_t n_tasks   = dag->n_tasks;
+	const dim_t n_workers = bli_min( dag->n_workers, n_tasks );
+
+	if ( n_workers <= 1 )
+	{
+		// The order in which tasks were recorded respects their dependencies.
+		for ( dim_t i = 0; i < n_tasks; ++i )
+			bli_dag_run( dag, &dag->tasks[ i ] );
+
+		bli_dag_clear( dag );
+		return;
+	}
+
+	err_t r_val;
+
+	dag->ready   = bli_malloc_intl( n_tasks * sizeof( dim_t ), &r_val );
+	dag->n_ready = 0;
+	dag->n_done  = 0;
+
+	for ( dim_t i = 0; i < n_tasks; ++i )
+	{
+		dag->tasks[ i ].n_waiting = dag->tasks[ i ].n_preds;
+
+		if ( dag->tasks[ i ].n_preds == 0 ) bli_dag_ready_push( dag, i );
+	}
+
+	// The calling thread serves as one of the workers.
+	bli_pthread_t* threads = bli_malloc_intl( n_workers * sizeof( bli_pthread_t ), &r_val );
+	bool*          started = bli_malloc_intl( n_workers * sizeof( bool ), &r_val );
+
+	for ( dim_t i = 1; i < n_workers; ++i )
+		started[ i ] = ( bli_pthread_create( &threads[ i ], NULL, bli_dag_worker, dag ) == 0 );
+
+	bli_dag_worker( dag );
+
+	for ( dim_t i = 1; i < n_workers; ++i )
+		if ( started[ i ] ) bli_pthread_join( threads[ i ], NULL );
+
+	bli_free_intl( started );
+	bli_free_intl( threads );
+	bli_free_intl( dag->ready );
+	dag->ready = NULL;
+
+	bli_dag_clear( dag );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_dag_func
+     (
+             dag_func_ft   func,
+             void*         params,
+             dim_t         n_read,
+       const obj_t**       reads,
+             dim_t         n_write,
+       const obj_t**       writes,
+             dag_t*        dag
+     )
+{
+	dag_task_t* t = bli_dag_push( dag );
+
+	t->func   = func;
+	t->params = params;
+
+	for ( dim_t i = 0; i < n_read;  ++i ) bli_dag_add_region( reads[ i ],  FALSE, t );
+	for ( dim_t i = 0; i < n_write; ++i ) bli_dag_add_region( writes[ i ], TRUE,  t );
+
+	bli_dag_link( dag );
+}
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, family ) \
+\
+void PASTEMAC(dag_,opname) \
+     ( \
+       const obj_t*  alpha, \
+       const obj_t*  a, \
+       const obj_t*  b, \
+       const obj_t*  beta, \
+       const obj_t*  c, \
+             dag_t*  dag  \
+     ) \
+{ \
+	bli_dag_record( family, BLIS_LEFT, alpha, a, b, beta, c, dag ); \
+}
+
+GENFRONT( gemm,  BLIS_GEMM )
+GENFRONT( gemmt, BLIS_GEMMT )
+GENFRONT( her2k, BLIS_HER2K )
+GENFRONT( syr2k, BLIS_SYR2K )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, family ) \
+\
+void PASTEMAC(dag_,opname) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a, \
+       const obj_t*  b, \
+       const obj_t*  beta, \
+       const obj_t*  c, \
+             dag_t*  dag  \
+     ) \
+{ \
+	bli_dag_record( family, side, alpha, a, b, beta, c, dag ); \
+}
+
+GENFRONT( hemm,  BLIS_HEMM )
+GENFRONT( symm,  BLIS_SYMM )
+GENFRONT( trmm3, BLIS_TRMM3 )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, family ) \
+\
+void PASTEMAC(dag_,opname) \
+     ( \
+       const obj_t*  alpha, \
+       const obj_t*  a, \
+       const obj_t*  beta, \
+       const obj_t*  c, \
+             dag_t*  dag  \
+     ) \
+{ \
+	bli_dag_record( family, BLIS_LEFT, alpha, a, NULL, beta, c, dag ); \
+}
+
+GENFRONT( herk, BLIS_HERK )
+GENFRONT( syrk, BLIS_SYRK )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, family ) \
+\
+void PASTEMAC(dag_,opname) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a, \
+       const obj_t*  b, \
+             dag_t*  dag  \
+     ) \
+{ \
+	bli_dag_record( family, side, alpha, a, b, NULL, NULL, dag ); \
+}
+
+GENFRONT( trmm, BLIS_TRMM )
+GENFRONT( trsm, BLIS_TRSM )
+
@@ -0,0 +1,155 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// A dag_t records a sequence of level-3 operations (and user-supplied tasks)
+// on submatrices ("tiles") without executing them. The dependencies between
+// the operations are inferred from the regions of the matrix buffers that
+// each one reads and writes: an operation waits for every earlier operation
+// that writes a region it accesses, or that reads a region it writes. When
+// the dag_t is executed, operations whose dependencies are satisfied run
+// concurrently on a pool of worker threads, each operation on one thread.
+//
+// Operand objects are copied when an operation is recorded, but the matrix
+// buffers (and the objects from which views were acquired) must remain valid
+// until bli_dag_execute() returns.
+//
+
+typedef struct dag_s dag_t;
+
+// A user-supplied task, for work that is not a level-3 operation (such as
+// factorizing a diagonal tile).
+typedef void (*dag_func_ft)( void* params );
+
+#ifndef BLIS_DAG_MAX_ACCESSES
+#define BLIS_DAG_MAX_ACCESSES 8
+#endif
+
+// Create a dag_t whose operations will run on the number of threads given by
+// rntm (or by the global settings if rntm is NULL). Each operation runs
+// single-threaded but otherwise honors the settings in rntm.
+BLIS_EXPORT_BLIS dag_t* bli_dag_create( const cntx_t* cntx, const rntm_t* rntm );
+BLIS_EXPORT_BLIS void   bli_dag_free( dag_t* dag );
+
+// Run every operation recorded so far and return once all have completed.
+// The dag_t is then empty and may be used to record new operations.
+BLIS_EXPORT_BLIS void   bli_dag_execute( dag_t* dag );
+
+// Return the number of operations recorded since the last execution.
+BLIS_EXPORT_BLIS dim_t  bli_dag_num_tasks( const dag_t* dag );
+
+// Record a call to func( params ) that reads the n_read objects in reads and
+// reads and writes the n_write objects in writes, where n_read + n_write may
+// not exceed BLIS_DAG_MAX_ACCESSES.
+BLIS_EXPORT_BLIS void   bli_dag_func
+     (
+             dag_func_ft   func,
+             void*         params,
+             dim_t         n_read,
+       const obj_t**       reads,
+             dim_t         n_write,
+       const obj_t**       writes,
+             dag_t*        dag
+     );
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(dag_,opname) \
+     ( \
+       const obj_t*  alpha, \
+       const obj_t*  a, \
+       const obj_t*  b, \
+       const obj_t*  beta, \
+       const obj_t*  c, \
+             dag_t*  dag  \
+     );
+
+GENPROT( gemm )
+GENPROT( gemmt )
+GENPROT( her2k )
+GENPROT( syr2k )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(dag_,opname) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a, \
+       const obj_t*  b, \
+       const obj_t*  beta, \
+       const obj_t*  c, \
+             dag_t*  dag  \
+     );
+
+GENPROT( hemm )
+GENPROT( symm )
+GENPROT( trmm3 )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(dag_,opname) \
+     ( \
+       const obj_t*  alpha, \
+       const obj_t*  a, \
+       const obj_t*  beta, \
+       const obj_t*  c, \
+             dag_t*  dag  \
+     );
+
+GENPROT( herk )
+GENPROT( syrk )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(dag_,opname) \
+     ( \
+             side_t  side, \
+       const obj_t*  alpha, \
+       const obj_t*  a, \
+       const obj_t*  b, \
+             dag_t*  dag  \
+     );
+
+GENPROT( trmm )
+GENPROT( trsm )
+
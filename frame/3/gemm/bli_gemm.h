@@ -35,3 +35,5 @@
 #include "bli_gemm_cntl.h"
 
 #include "bli_gemm_var.h"
+#include "bli_gemm_3m.h"
+#include "bli_gemm_batch.h"
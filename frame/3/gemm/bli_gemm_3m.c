@@ -0,0 +1,208 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// The 3m method computes a complex matrix product with three real matrix
+// products instead of the four implied by the definition. Writing
+// A = Ar + i Ai and B = Br + i Bi (where the imaginary parts already carry
+// the sign of any conjugation), we have
+//
+//   T1 = Ar Br
+//   T2 = Ai Bi
+//   T3 = ( Ar + Ai )( Br + Bi )
+//
+//   A B = ( T1 - T2 ) + i ( T3 - T1 - T2 )
+//       = ( 1 - i ) T1 + ( -1 - i ) T2 + i T3.
+//
+// Each T_p is computed by one pass of the conventional real-domain gemm
+// path on real-valued views of the (interleaved) complex operands, and is
+// accumulated into complex C via the existing "C_complex += A_real * B_real"
+// mixed-domain support, with alpha scaled by the complex coefficient above.
+// The sums of the real and imaginary parts required by T3 are formed while
+// packing, so no temporary matrices are needed.
+//
+// Relative to 1m or native execution, 3m saves 25% of the flops at the cost
+// of reading A and B and updating C three times, and its result is only
+// normwise (rather than componentwise) accurate in the imaginary part.
+//
+
+static const double gemm_3m_coef[ 3 ][ 2 ] =
+{
+	{  1.0, -1.0 },
+	{ -1.0, -1.0 },
+	{  0.0,  1.0 },
+};
+
+err_t bli_gemm_3m
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	// Only complex problems whose operands (and computation precision) all
+	// share the same datatype are handled.
+	const num_t dt = bli_obj_dt( c );
+
+	if ( bli_obj_is_real( c ) ||
+	     bli_obj_dt( a ) != dt ||
+	     bli_obj_dt( b ) != dt ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Alias A, B, and C so that any transposition is absorbed into the
+	// strides of the local objects.
+	obj_t a_local;
+	obj_t b_local;
+	obj_t c_local;
+	bli_obj_alias_submatrix( a, &a_local );
+	bli_obj_alias_submatrix( b, &b_local );
+	bli_obj_alias_submatrix( c, &c_local );
+
+	// Conjugation is folded into the sign of the imaginary parts.
+	const double sa = bli_obj_has_conj( &a_local ) ? -1.0 : 1.0;
+	const double sb = bli_obj_has_conj( &b_local ) ? -1.0 : 1.0;
+
+	// Create real-valued views of the real and imaginary parts of A and B.
+	obj_t ar, ai, br, bi;
+	bli_obj_real_part( &a_local, &ar );
+	bli_obj_imag_part( &a_local, &ai );
+	bli_obj_real_part( &b_local, &br );
+	bli_obj_imag_part( &b_local, &bi );
+	bli_obj_set_conj( BLIS_NO_CONJUGATE, &ar );
+	bli_obj_set_conj( BLIS_NO_CONJUGATE, &ai );
+	bli_obj_set_conj( BLIS_NO_CONJUGATE, &br );
+	bli_obj_set_conj( BLIS_NO_CONJUGATE, &bi );
+
+	// The imaginary part of each element immediately follows its real part.
+	const inc_t off_imag = bli_obj_elem_size( &ar );
+
+	func_t packm_ukr;
+	bli_packm_sum_ukr( bli_dt_proj_to_real( dt ), &packm_ukr );
+
+	for ( dim_t p = 0; p < 3; ++p )
+	{
+		obj_t a_p, b_p, c_p;
+		bli_obj_alias_to( p == 1 ? &ai : &ar, &a_p );
+		bli_obj_alias_to( p == 1 ? &bi : &br, &b_p );
+		bli_obj_alias_to( &c_local, &c_p );
+
+		// Scale alpha by the coefficient of the current product (and by the
+		// signs of the imaginary parts for T2). Beta is applied only by the
+		// first pass; subsequent passes accumulate.
+		const double s = ( p == 1 ? sa * sb : 1.0 );
+
+		obj_t coef, gamma;
+		bli_obj_scalar_init_detached( dt, &coef );
+		bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE, alpha, &gamma );
+		bli_setsc( s * gemm_3m_coef[ p ][ 0 ], s * gemm_3m_coef[ p ][ 1 ], &coef );
+		bli_mulsc( &coef, &gamma );
+
+		gemm_cntl_t cntl;
+		bool swapped = bli_gemm_cntl_init
+		(
+		  BLIS_NAT,
+		  BLIS_GEMM,
+		  &gamma,
+		  &a_p,
+		  &b_p,
+		  ( p == 0 ? beta : &BLIS_ONE ),
+		  &c_p,
+		  cntx,
+		  &cntl
+		);
+
+		// For T3, wrap the packing kernels so that the imaginary part of
+		// each operand is added to its real part while packing.
+		packm_sum_params_t params_a;
+		packm_sum_params_t params_b;
+
+		if ( p == 2 )
+		{
+			params_a.n_terms = 2;
+			params_a.off[ 0 ] = 0;        params_a.coef[ 0 ] = 1.0;
+			params_a.off[ 1 ] = off_imag; params_a.coef[ 1 ] = sa;
+
+			params_b.n_terms = 2;
+			params_b.off[ 0 ] = 0;        params_b.coef[ 0 ] = 1.0;
+			params_b.off[ 1 ] = off_imag; params_b.coef[ 1 ] = sb;
+
+			// If the operation was transposed, the left-hand operand that
+			// will be packed as "A" now refers to B, and vice versa.
+			packm_sum_params_t* params_pa = swapped ? &params_b : &params_a;
+			packm_sum_params_t* params_pb = swapped ? &params_a : &params_b;
+
+			params_pa->ukr    = bli_gemm_cntl_packa_ukr( &cntl );
+			params_pa->params = bli_gemm_cntl_packa_params( &cntl );
+			params_pb->ukr    = bli_gemm_cntl_packb_ukr( &cntl );
+			params_pb->params = bli_gemm_cntl_packb_params( &cntl );
+
+			bli_gemm_cntl_set_packa_ukr_simple( &packm_ukr, &cntl );
+			bli_gemm_cntl_set_packa_params( params_pa, &cntl );
+			bli_gemm_cntl_set_packb_ukr_simple( &packm_ukr, &cntl );
+			bli_gemm_cntl_set_packb_params( params_pb, &cntl );
+		}
+
+		bli_gemm_cntl_finalize
+		(
+		  BLIS_GEMM,
+		  &a_p,
+		  &b_p,
+		  &c_p,
+		  &cntl
+		);
+
+		// Invoke the internal back-end via the thread handler.
+		bli_l3_thread_decorator
+		(
+		  &a_p,
+		  &b_p,
+		  &c_p,
+		  cntx,
+		  ( cntl_t* )&cntl,
+		  rntm
+		);
+	}
+
+	return BLIS_SUCCESS;
+}
+
@@ -0,0 +1,448 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The scalars of a batch, which are passed to bli_gemm_batch_sup().
+typedef struct
+{
+	const obj_t* alpha;
+	const obj_t* beta;
+} gemm_batch_scalars_t;
+
+// Compute one problem of a batch via the sup path.
+static void bli_gemm_batch_sup
+     (
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  c,
+       const void*   params,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	const gemm_batch_scalars_t* scalars = params;
+
+	// The sup handler may enforce stricter thresholds than those checked in
+	// advance, in which case we fall back to gemm.
+	if ( bli_gemmsup( scalars->alpha, a, b, scalars->beta, c, cntx, rntm ) != BLIS_SUCCESS )
+		bli_gemm_ex( scalars->alpha, a, b, scalars->beta, c, cntx, rntm );
+}
+
+// Choose the number of groups g (a divisor of nt) that minimizes the
+// estimated time of the batch, in units of rank-1 updates of one microtile.
+static dim_t bli_gemm_batch_n_groups
+     (
+       dim_t batch,
+       dim_t nt,
+       dim_t m,
+       dim_t n,
+       dim_t k,
+       dim_t mr,
+       dim_t nr
+     )
+{
+	const dim_t n_tiles = ( ( m + mr - 1 ) / mr ) * ( ( n + nr - 1 ) / nr );
+
+	dim_t n_groups = 1;
+	dim_t t_min    = 0;
+
+	for ( dim_t g = 1; g <= bli_min( nt, batch ); ++g )
+	{
+		if ( nt % g != 0 ) continue;
+
+		const dim_t nt_g  = nt / g;
+		const dim_t t_one = ( ( n_tiles + nt_g - 1 ) / nt_g ) * bli_max( k, 1 ) +
+		                    ( nt_g > 1 ? BLIS_GEMM_BATCH_SYNC_COST : 0 );
+		const dim_t t     = ( ( batch + g - 1 ) / g ) * t_one;
+
+		if ( g == 1 || t < t_min ) { n_groups = g; t_min = t; }
+	}
+
+	return n_groups;
+}
+
+static bool bli_gemm_batch_is_sup
+     (
+       const obj_t*  a,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+#ifdef BLIS_DISABLE_SUP_HANDLING
+	return false;
+#else
+	const num_t dt = bli_obj_dt( c );
+	const dim_t m  = bli_obj_length( c );
+	const dim_t n  = bli_obj_width( c );
+	const dim_t k  = bli_obj_width_after_trans( a );
+
+	if ( !bli_rntm_l3_sup( rntm ) ) return false;
+
+	// Mirror the threshold test of bli_gemmsup(), which takes into account
+	// the transposition induced by the microkernel storage preference.
+	if ( bli_cntx_dislikes_storage_of( c, BLIS_GEMM_UKR, cntx ) )
+		return bli_cntx_l3_sup_thresh_is_met( dt, n, m, k, cntx );
+	else
+		return bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx );
+#endif
+}
+
+void bli_gemm_batch_strided
+     (
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+             dim_t   batch
+     )
+{
+	bli_gemm_batch_strided_ex
+	(
+	  alpha,
+	  a, stride_a,
+	  b, stride_b,
+	  beta,
+	  c, stride_c,
+	  batch,
+	  NULL,
+	  NULL
+	);
+}
+
+void bli_gemm_batch_strided_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+             dim_t   batch,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Check the operands.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_batch_strided_check( alpha, a, stride_a, b, stride_b,
+		                              beta, c, stride_c, batch, cntx );
+
+	if ( batch == 0 || bli_obj_has_zero_dim( c ) ) return;
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	rntm_t rntm_l;
+	if ( rntm != NULL ) rntm_l = *rntm;
+	else bli_rntm_init_from_global( &rntm_l );
+
+	const num_t dt = bli_obj_dt( c );
+	      ind_t im = BLIS_NAT;
+
+	if ( bli_obj_is_complex( c ) )
+	{
+		im = bli_gemmind_find_avail( dt );
+
+		// The 3m method is implemented by its own handler, so fall back
+		// to 1m (if enabled) or native execution.
+		if ( im == BLIS_3M )
+			im = bli_l3_ind_oper_get_enable( BLIS_GEMM, BLIS_1M, dt ) ? BLIS_1M
+			                                                          : BLIS_NAT;
+	}
+
+	// Problems that are trivial, have mixed datatypes, or have packed
+	// operands are computed one at a time by bli_gemm_ex().
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ||
+	     bli_obj_has_zero_dim( a ) ||
+	     bli_obj_dt( a ) != dt ||
+	     bli_obj_dt( b ) != dt ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ||
+	     bli_obj_is_panel_packed( a ) ||
+	     bli_obj_is_panel_packed( b ) ||
+	     bli_obj_is_panel_packed( c ) )
+	{
+		l3_batch_opnd_t a_opnd, b_opnd, c_opnd;
+
+		bli_l3_batch_opnd_init( a, a, stride_a, NULL, &a_opnd );
+		bli_l3_batch_opnd_init( b, b, stride_b, NULL, &b_opnd );
+		bli_l3_batch_opnd_init( c, c, stride_c, NULL, &c_opnd );
+
+		for ( dim_t i = 0; i < batch; ++i )
+		{
+			obj_t a_i, b_i, c_i;
+
+			bli_l3_batch_acquire( i, &a_opnd, &a_i );
+			bli_l3_batch_acquire( i, &b_opnd, &b_i );
+			bli_l3_batch_acquire( i, &c_opnd, &c_i );
+
+			bli_gemm_ex( alpha, &a_i, &b_i, beta, &c_i, cntx, rntm );
+		}
+
+		return;
+	}
+
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	bli_rntm_factorize( m, n, k, &rntm_l );
+
+	const dim_t budget_grant = bli_rntm_budget_grant( &rntm_l );
+
+	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
+	dim_t   nt = bli_rntm_num_threads( &rntm_l );
+
+	if ( bli_error_checking_is_enabled() )
+		bli_l3_thread_decorator_check( &rntm_l );
+
+	// As in bli_l3_thread_decorator(), favor a sequential threading
+	// implementation over the number of threads requested.
+	if ( 1 < nt && ti == BLIS_SINGLE )
+	{
+		nt = 1;
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_l );
+		bli_rntm_set_num_threads_only( 1, &rntm_l );
+	}
+
+	// Alias A, B, and C in case we need to apply transformations.
+	obj_t a_local, b_local, c_local;
+	inc_t stride_a_l = stride_a;
+	inc_t stride_b_l = stride_b;
+
+	bli_obj_alias_submatrix( a, &a_local );
+	bli_obj_alias_submatrix( b, &b_local );
+	bli_obj_alias_submatrix( c, &c_local );
+
+	// Small problems are computed by individual threads via the sup path
+	// (provided that every thread gets a problem). Otherwise, initialize one
+	// control tree that is shared by all problems, swapping the strides of
+	// A and B if the operation was transposed.
+	const bool  sup = nt <= batch && bli_gemm_batch_is_sup( a, c, cntx, &rntm_l );
+	gemm_cntl_t cntl;
+	dim_t       n_groups;
+	rntm_t      rntm_g = rntm_l;
+
+	if ( sup )
+	{
+		n_groups = nt;
+
+		bli_rntm_set_thread_impl_only( BLIS_SINGLE, &rntm_g );
+		bli_rntm_set_num_threads_only( 1, &rntm_g );
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_g );
+	}
+	else
+	{
+		if ( bli_gemm_cntl_init( im, BLIS_GEMM, alpha, &a_local, &b_local,
+		                         beta, &c_local, cntx, &cntl ) )
+		{
+			stride_a_l = stride_b;
+			stride_b_l = stride_a;
+		}
+
+		// Unless the ways of parallelism were set explicitly, divide the
+		// threads into groups and factorize the threads of each group for
+		// one problem.
+		n_groups = 1;
+
+		if ( bli_rntm_auto_factor( &rntm_l ) )
+		{
+			const dim_t mr = bli_gemm_var_cntl_mr( ( const cntl_t* )&cntl.ker );
+			const dim_t nr = bli_gemm_var_cntl_nr( ( const cntl_t* )&cntl.ker );
+
+			n_groups = bli_gemm_batch_n_groups( batch, nt,
+			                                    bli_obj_length( &c_local ),
+			                                    bli_obj_width( &c_local ),
+			                                    k, mr, nr );
+
+			bli_rntm_set_num_threads_only( nt / n_groups, &rntm_g );
+			bli_rntm_factorize_ways( bli_obj_length( &c_local ),
+			                         bli_obj_width( &c_local ), k, &rntm_g );
+
+			// The factorization may have reduced the number of threads.
+			nt = n_groups * bli_rntm_num_threads( &rntm_g );
+		}
+	}
+
+	// The sup path applies its own transformations to the original operands.
+	const obj_t* a_p = sup ? a : &a_local;
+	const obj_t* b_p = sup ? b : &b_local;
+	const obj_t* c_p = sup ? c : &c_local;
+
+	l3_batch_opnd_t      a_opnd, b_opnd, c_opnd;
+	gemm_batch_scalars_t scalars = { alpha, beta };
+
+	bli_l3_batch_opnd_init( a_p, a_p, sup ? stride_a : stride_a_l, NULL, &a_opnd );
+	bli_l3_batch_opnd_init( b_p, b_p, sup ? stride_b : stride_b_l, NULL, &b_opnd );
+	bli_l3_batch_opnd_init( c_p, c_p, stride_c, NULL, &c_opnd );
+
+	bli_l3_batch_thread_decorator
+	(
+	  sup ? bli_gemm_batch_sup : NULL,
+	  &scalars,
+	  &a_opnd,
+	  &b_opnd,
+	  &c_opnd,
+	  batch,
+	  n_groups,
+	  ti,
+	  nt,
+	  cntx,
+	  ( cntl_t* )&cntl,
+	  &rntm_g
+	);
+
+	bli_thread_budget_release( budget_grant );
+}
+
+void bli_gemm_batch_strided_check
+     (
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+             dim_t   batch,
+       const cntx_t* cntx
+     )
+{
+	( void )stride_a;
+	( void )stride_b;
+	( void )stride_c;
+
+	bli_gemm_check( alpha, a, b, beta, c, cntx );
+
+	if ( batch < 0 )
+		bli_check_error_code( BLIS_NEGATIVE_DIMENSION );
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c, inc_t stride_c, \
+             dim_t   batch, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       bo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       co     = BLIS_OBJECT_INITIALIZER; \
+\
+	dim_t       m_a, n_a; \
+	dim_t       m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	bli_obj_init_finish_1x1( dt, ( void* )alpha, &alphao ); \
+	bli_obj_init_finish_1x1( dt, ( void* )beta,  &betao  ); \
+\
+	bli_obj_init_finish( dt, m_a, n_a, ( void* )a, rs_a, cs_a, &ao ); \
+	bli_obj_init_finish( dt, m_b, n_b, ( void* )b, rs_b, cs_b, &bo ); \
+	bli_obj_init_finish( dt, m,   n,            c, rs_c, cs_c, &co ); \
+\
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	bli_gemm_batch_strided_ex \
+	( \
+	  &alphao, \
+	  &ao, stride_a, \
+	  &bo, stride_b, \
+	  &betao, \
+	  &co, stride_c, \
+	  batch, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_batch_strided )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c, inc_t stride_c, \
+             dim_t   batch  \
+     ) \
+{ \
+	PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+	( \
+	  transa, transb, m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, stride_a, \
+	  b, rs_b, cs_b, stride_b, \
+	  beta, \
+	  c, rs_c, cs_c, stride_c, \
+	  batch, \
+	  NULL, \
+	  NULL  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_batch_strided )
+
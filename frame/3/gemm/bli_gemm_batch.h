@@ -0,0 +1,139 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// A strided batch of gemm problems consists of batch problems of the same
+// shape, the i-th of which computes
+//
+//   C_i := beta * C_i + alpha * trans?(A_i) * trans?(B_i)
+//
+// where A_i, B_i and C_i are located stride_a, stride_b and stride_c elements
+// beyond A_{i-1}, B_{i-1} and C_{i-1}, respectively. (Any stride may be zero,
+// for example to multiply many matrices by the same matrix, except that
+// problems may not share C.)
+//
+// The problems are distributed across groups of threads, and the threads
+// of each group cooperate on one problem at a time. The number of groups is
+// chosen to minimize the estimated execution time, taking into account
+// both the load imbalance across groups and the overhead of synchronizing
+// the threads within a group. Problems small enough for the sup path are
+// instead computed by individual threads via that path.
+//
+
+// The estimated overhead of synchronizing the threads of a group over the
+// course of one problem, in units of rank-1 updates of one microtile.
+#ifndef BLIS_GEMM_BATCH_SYNC_COST
+#define BLIS_GEMM_BATCH_SYNC_COST 2048
+#endif
+
+
+//
+// Prototype object APIs (basic and expert).
+//
+
+BLIS_EXPORT_BLIS void bli_gemm_batch_strided
+     (
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+             dim_t   batch
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_batch_strided_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+             dim_t   batch,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+void bli_gemm_batch_strided_check
+     (
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+             dim_t   batch,
+       const cntx_t* cntx
+     );
+
+
+//
+// Prototype BLAS-like interfaces with typed operands (basic and expert).
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c, inc_t stride_c, \
+             dim_t   batch  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c, inc_t stride_c, \
+             dim_t   batch, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( gemm_batch_strided )
+
@@ -59,6 +59,7 @@ void bli_gemm_var_cntl_init_node
 	cntl->dt_out   = dt_out;
 	cntl->ukr      = ukr;
 	cntl->real_ukr = real_ukr;
+	cntl->edge_ukr = NULL;
 	cntl->row_pref = row_pref;
 	cntl->mr       = mr;
 	cntl->nr       = nr;
@@ -145,6 +146,13 @@ bool bli_gemm_cntl_init
 		needs_swap = row_pref;
 	}
 
+	// Operands stored as packed micro-panels (see bli_obj_create_packed()) are
+	// laid out for one particular orientation of the operation, which must
+	// therefore be left as-is.
+	if ( bli_obj_is_panel_packed( a ) ||
+	     bli_obj_is_panel_packed( b ) ||
+	     bli_obj_is_panel_packed( c ) ) needs_swap = false;
+
 	// Swap the A and B operands if required. This transforms the operation
 	// C = alpha A B + beta C into C^T = alpha B^T A^T + beta C^T.
 	if ( needs_swap )
@@ -415,6 +423,17 @@ bool bli_gemm_cntl_init
 	  nr_scale,
 	  &cntl->ker
 	);
+
+	// If the context provides a microkernel that updates partial microtiles
+	// of C directly (e.g. via masked loads and stores), use it for the edge
+	// cases. This only applies when the native microkernel is used as-is.
+	if ( !induced && dt_comp == dt_c &&
+	     bli_cntx_get_ukr_prefs_dt( dt_comp, BLIS_GEMM_EDGE_UKR_PREF, cntx ) )
+		bli_gemm_var_cntl_set_edge_ukr
+		(
+		  bli_cntx_get_ukr_dt( dt_comp, BLIS_GEMM_EDGE_UKR, cntx ),
+		  ( cntl_t* )&cntl->ker
+		);
 	bli_cntl_attach_sub_node
 	(
 	  BLIS_THREAD_NR,
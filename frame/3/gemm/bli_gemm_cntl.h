@@ -44,6 +44,7 @@ struct gemm_var_cntl_s
 	num_t       dt_out;
 	gemm_ukr_ft ukr;
 	gemm_ukr_ft real_ukr;
+	gemm_ukr_ft edge_ukr;
 	const void* params;
 	const void* real_params;
 	dim_t       mr;
@@ -66,6 +67,15 @@ BLIS_INLINE gemm_ukr_ft bli_gemm_var_cntl_real_ukr( const cntl_t* cntl )
 	return ( ( const gemm_var_cntl_t* ) cntl )->real_ukr;
 }
 
+// Return the microkernel to be used for microtiles smaller than MR x NR.
+// This is the edge-case microkernel, if one was set, and the regular
+// microkernel otherwise.
+BLIS_INLINE gemm_ukr_ft bli_gemm_var_cntl_edge_ukr( const cntl_t* cntl )
+{
+	gemm_ukr_ft edge_ukr = ( ( const gemm_var_cntl_t* ) cntl )->edge_ukr;
+	return edge_ukr ? edge_ukr : ( ( const gemm_var_cntl_t* ) cntl )->ukr;
+}
+
 BLIS_INLINE bool bli_gemm_var_cntl_row_pref( const cntl_t* cntl )
 {
 	return ( ( const gemm_var_cntl_t* ) cntl )->row_pref;
@@ -104,6 +114,7 @@ BLIS_INLINE void bli_gemm_var_cntl_set_ukr( const func2_t* ukr, cntl_t* cntl_ )
 	num_t dt_comp = cntl->dt_comp;
 	num_t dt_out = cntl->dt_out;
 	cntl->ukr = ( gemm_ukr_ft )bli_func2_get_dt( dt_comp, dt_out, ukr );
+	cntl->edge_ukr = NULL;
 }
 
 BLIS_INLINE void bli_gemm_var_cntl_set_real_ukr( const func2_t* ukr, cntl_t* cntl_ )
@@ -112,6 +123,7 @@ BLIS_INLINE void bli_gemm_var_cntl_set_real_ukr( const func2_t* ukr, cntl_t* cnt
 	num_t dt_comp = cntl->dt_comp;
 	num_t dt_out = cntl->dt_out;
 	cntl->real_ukr = ( gemm_ukr_ft )bli_func2_get_dt( dt_comp, dt_out, ukr );
+	cntl->edge_ukr = NULL;
 }
 
 BLIS_INLINE err_t bli_gemm_var_cntl_set_ukr_simple( const func_t* ukr, cntl_t* cntl_ )
@@ -122,6 +134,7 @@ BLIS_INLINE err_t bli_gemm_var_cntl_set_ukr_simple( const func_t* ukr, cntl_t* c
 	if ( dt_comp != dt_out )
 		return BLIS_INCONSISTENT_DATATYPES;
 	cntl->ukr = ( gemm_ukr_ft )bli_func_get_dt( dt_comp, ukr );
+	cntl->edge_ukr = NULL;
 	return BLIS_SUCCESS;
 }
 
@@ -133,9 +146,15 @@ BLIS_INLINE err_t bli_gemm_var_cntl_set_real_ukr_simple( const func_t* ukr, cntl
 	if ( dt_comp != dt_out )
 		return BLIS_INCONSISTENT_DATATYPES;
 	cntl->real_ukr = ( gemm_ukr_ft )bli_func_get_dt( dt_comp, ukr );
+	cntl->edge_ukr = NULL;
 	return BLIS_SUCCESS;
 }
 
+BLIS_INLINE void bli_gemm_var_cntl_set_edge_ukr( gemm_ukr_ft edge_ukr, cntl_t* cntl )
+{
+	( ( gemm_var_cntl_t* ) cntl )->edge_ukr = edge_ukr;
+}
+
 BLIS_INLINE void bli_gemm_var_cntl_set_row_pref( const mbool_t* row_pref, cntl_t* cntl_ )
 {
 	gemm_var_cntl_t* cntl = ( gemm_var_cntl_t* )cntl_;
@@ -104,6 +104,7 @@ void bli_gemm_ker_var2
 	// Query the context for the micro-kernel address and cast it to its
 	// function pointer type.
 	gemm_ukr_ft gemm_ukr = bli_gemm_var_cntl_ukr( cntl );
+	gemm_ukr_ft edge_ukr = bli_gemm_var_cntl_edge_ukr( cntl );
 	const void* params   = bli_gemm_var_cntl_params( cntl );
 
 	//
@@ -133,8 +134,12 @@ void bli_gemm_ker_var2
 
 	const inc_t cstep_b = ps_b * dt_b_size;
 
-	const inc_t rstep_c = rs_c * MR * dt_c_size;
-	const inc_t cstep_c = cs_c * NR * dt_c_size;
+	// If C is itself stored as packed micro-panels (see bli_obj_create_packed()),
+	// each MR x n (or m x NR) slice of C is a separate micro-panel.
+	const inc_t rstep_c = ( bli_obj_is_packed_along_m( c ) ? bli_obj_panel_stride( c )
+	                                                       : rs_c * MR ) * dt_c_size;
+	const inc_t cstep_c = ( bli_obj_is_packed_along_n( c ) ? bli_obj_panel_stride( c )
+	                                                       : cs_c * NR ) * dt_c_size;
 
 	auxinfo_t aux;
 
@@ -250,12 +255,13 @@ void bli_gemm_ker_var2
 
 			// Set the current offset into the C matrix in the auxinfo_t
 			// object.
-			bli_auxinfo_set_off_m( off_m + i, &aux );
-			bli_auxinfo_set_off_m( off_n + j, &aux );
+			bli_auxinfo_set_off_m( off_m + i * MR, &aux );
+			bli_auxinfo_set_off_n( off_n + j * NR, &aux );
 
-			// Edge case handling now occurs within the microkernel itself.
-			// Invoke the gemm micro-kernel.
-			gemm_ukr
+			// Edge case handling now occurs within the microkernel itself,
+			// or within the edge-case microkernel, if the context provides
+			// one. Invoke the gemm micro-kernel.
+			( m_cur == MR && n_cur == NR ? gemm_ukr : edge_ukr )
 			(
 			  m_cur,
 			  n_cur,
@@ -139,6 +139,7 @@ void bli_gemmt_l_ker_var2b
 	// Query the context for the micro-kernel address and cast it to its
 	// function pointer type.
 	gemm_ukr_ft    gemm_ukr        = bli_gemm_var_cntl_ukr( cntl );
+	gemm_ukr_ft    edge_ukr        = bli_gemm_var_cntl_edge_ukr( cntl );
 	const void*    params          = bli_gemm_var_cntl_params( cntl );
 	xpbys_mxn_l_ft xpbys_mxn_l_ukr = xpbys_mxn_l[ dt_c ];
 
@@ -360,7 +361,7 @@ void bli_gemmt_l_ker_var2b
 				bli_auxinfo_set_next_a( a2, &aux );
 
 				// Invoke the gemm micro-kernel.
-				gemm_ukr
+				( m_cur == MR && n_cur == NR ? gemm_ukr : edge_ukr )
 				(
 				  m_cur,
 				  n_cur,
@@ -0,0 +1,705 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+// A masked update of a microtile that intersects the diagonal: only the
+// elements of y that fall within the stored (uplo) region are updated with
+// x + beta * y. This is used both to store the diagonal microtiles of C
+// and to reduce the partial products of a k-parallel computation.
+typedef void (*xpbys_mxn_uplo_ft)
+    (
+            doff_t diagoff,
+            uplo_t uplo,
+            dim_t  m,
+            dim_t  n,
+      const void*  x, inc_t rs_x, inc_t cs_x,
+      const void*  b,
+            void*  y, inc_t rs_y, inc_t cs_y
+    );
+
+#undef  GENTFUNC
+#define GENTFUNC(ctype,ch,op) \
+\
+BLIS_INLINE void PASTEMAC(ch,op) \
+    ( \
+            doff_t diagoff, \
+            uplo_t uplo, \
+            dim_t  m, \
+            dim_t  n, \
+      const void*  x, inc_t rs_x, inc_t cs_x, \
+      const void*  b, \
+            void*  y, inc_t rs_y, inc_t cs_y \
+    ) \
+{ \
+	const ctype* restrict x_cast = x; \
+	const ctype* restrict b_cast = b; \
+	      ctype* restrict y_cast = y; \
+\
+	bli_txpbys_mxn_uplo \
+	( \
+	  ch,ch,ch,ch, \
+	  diagoff, \
+	  uplo, \
+	  m, \
+	  n, \
+	  x_cast, rs_x, cs_x, \
+	  b_cast, \
+	  y_cast, rs_y, cs_y \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC(xpbys_mxn_uplo_fn);
+
+static xpbys_mxn_uplo_ft GENARRAY(xpbys_mxn_uplo, xpbys_mxn_uplo_fn);
+
+// The plain (column-stored) packing variant is used to pack the shared
+// A/A^T slab of a rank-k update.
+typedef void (*packm_sup_var2_ft)
+     (
+       trans_t    transc,
+       pack_t     schema,
+       dim_t      m,
+       dim_t      n,
+       void*      kappa,
+       void*      c, inc_t rs_c, inc_t cs_c,
+       void*      p, inc_t rs_p, inc_t cs_p,
+       cntx_t*    cntx,
+       thrinfo_t* thread
+     );
+
+static packm_sup_var2_ft GENARRAY(packm_sup_var2,packm_sup_var2);
+
+// -----------------------------------------------------------------------------
+
+//
+// -- var2m --------------------------------------------------------------------
+//
+
+void bli_gemmtsup_ref_var2m
+     (
+             trans_t    trans,
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+             stor3_t    stor_id,
+       const cntx_t*    cntx,
+       const rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	const num_t  dt      = bli_obj_dt( c );
+	const dim_t  dt_size = bli_dt_size( dt );
+
+	      bool   packa   = bli_rntm_pack_a( rntm );
+	      bool   packb   = bli_rntm_pack_b( rntm );
+
+	      conj_t conja   = bli_obj_conj_status( a );
+	      conj_t conjb   = bli_obj_conj_status( b );
+
+	      dim_t  m       = bli_obj_length( c );
+	      dim_t  n       = bli_obj_width( c );
+	      dim_t  k;
+
+	      uplo_t uploc   = bli_obj_uplo( c );
+	      doff_t diagoffc = bli_obj_diag_offset( c );
+
+	const void*  buf_a   = bli_obj_buffer_at_off( a );
+	      inc_t  rs_a;
+	      inc_t  cs_a;
+
+	const void*  buf_b   = bli_obj_buffer_at_off( b );
+	      inc_t  rs_b;
+	      inc_t  cs_b;
+
+	if ( bli_obj_has_notrans( a ) )
+	{
+		k     = bli_obj_width( a );
+
+		rs_a  = bli_obj_row_stride( a );
+		cs_a  = bli_obj_col_stride( a );
+	}
+	else // if ( bli_obj_has_trans( a ) )
+	{
+		// Assign the variables with an implicit transposition.
+		k     = bli_obj_length( a );
+
+		rs_a  = bli_obj_col_stride( a );
+		cs_a  = bli_obj_row_stride( a );
+	}
+
+	if ( bli_obj_has_notrans( b ) )
+	{
+		rs_b  = bli_obj_row_stride( b );
+		cs_b  = bli_obj_col_stride( b );
+	}
+	else // if ( bli_obj_has_trans( b ) )
+	{
+		// Assign the variables with an implicit transposition.
+		rs_b  = bli_obj_col_stride( b );
+		cs_b  = bli_obj_row_stride( b );
+	}
+
+	      void* buf_c     = bli_obj_buffer_at_off( c );
+	      inc_t rs_c      = bli_obj_row_stride( c );
+	      inc_t cs_c      = bli_obj_col_stride( c );
+
+	const void* buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+	const void* buf_beta  = bli_obj_buffer_for_1x1( dt, beta );
+
+	// A rank-k update (syrk/herk) presents the same buffer as A and as
+	// B = A^T (or A^H). In that case, we pack a single slab of A that
+	// serves as both operands rather than packing A and A^T separately.
+	const bool is_rankk = ( buf_a == buf_b &&
+	                        rs_b  == cs_a  &&
+	                        cs_b  == rs_a  );
+	const bool packab   = ( is_rankk && ( packa || packb ) &&
+	                        bli_cntx_ukr_prefers_rows_dt( dt, bli_stor3_ukr( BLIS_RCR ), cntx ) );
+
+	if ( packab )
+	{
+		// The shared slab is read as a column-stored A and a row-stored B,
+		// so make sure C is row-stored (the rcr case) after any transposition.
+		// Since B = A^T, transposing the problem leaves the operands intact.
+		packa = FALSE;
+		packb = FALSE;
+		trans = ( bli_abs( cs_c ) == 1 ? BLIS_NO_TRANSPOSE : BLIS_TRANSPOSE );
+	}
+	else
+	{
+		// Optimize some storage/packing cases by transforming them into others.
+		// These optimizations are expressed by changing trans and/or stor_id.
+		bli_gemmsup_ref_var1n2m_opt_cases( dt, &trans, packa, packb, &stor_id, cntx );
+	}
+
+	// Note: This code explicitly performs the swaps that could be done
+	// implicitly in other BLIS contexts where a type-specific helper function
+	// was being called. Transposing C also reflects its stored region about
+	// the diagonal.
+	if ( bli_is_trans( trans ) )
+	{
+		      bool   packtmp = packa; packa = packb; packb = packtmp;
+		      conj_t conjtmp = conja; conja = conjb; conjb = conjtmp;
+		      dim_t  len_tmp =     m;     m =     n;     n = len_tmp;
+		const void*  buf_tmp = buf_a; buf_a = buf_b; buf_b = buf_tmp;
+		      inc_t  str_tmp =  rs_a;  rs_a =  cs_b;  cs_b = str_tmp;
+		             str_tmp =  cs_a;  cs_a =  rs_b;  rs_b = str_tmp;
+		             str_tmp =  rs_c;  rs_c =  cs_c;  cs_c = str_tmp;
+
+		bli_reflect_about_diag( &diagoffc, &uploc, &m, &n );
+
+		stor_id = bli_stor3_trans( stor_id );
+	}
+
+	// Query the context for various blocksizes.
+	const dim_t NR  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t MR  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t NC  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NC, cntx );
+	const dim_t MC  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MC, cntx );
+	const dim_t KC  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_KC, cntx );
+
+	// The shared slab is packed to column storage, which means A is read as
+	// a single column-stored panel and A^T as a row-stored panel. Pad the
+	// leading dimension to a multiple of NR so that rows of A^T start at
+	// vector-aligned offsets.
+	const inc_t ld_ab   = bli_align_dim_to_mult( m, NR, true );
+
+	if ( packab )
+		stor_id = bli_stor3_from_strides( rs_c, cs_c, 1, ld_ab, ld_ab, 1 );
+
+	// Compute partitioning step values for each matrix of each loop.
+	const inc_t jcstep_c = cs_c * dt_size;
+	const inc_t jcstep_b = cs_b * dt_size;
+
+	const inc_t pcstep_a = cs_a * dt_size;
+	const inc_t pcstep_b = rs_b * dt_size;
+
+	const inc_t icstep_c = rs_c * dt_size;
+	const inc_t icstep_a = rs_a * dt_size;
+
+	const inc_t jrstep_c = cs_c * NR * dt_size;
+
+	// Query the context for the sup microkernel address and cast it to its
+	// function pointer type.
+	gemmsup_ker_ft    gemmsup_ker = bli_cntx_get_l3_sup_ker_dt( dt, stor_id, cntx );
+	xpbys_mxn_uplo_ft xpbys_ukr   = xpbys_mxn_uplo[ dt ];
+
+	// Temporary C buffer for microtiles that intersect the diagonal. The
+	// strides of ct match the storage of C so that the same sup kernel can
+	// be used to compute into it.
+	      char  ct[ BLIS_STACK_BUF_MAX_SIZE ]
+	                __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+	const bool  c_row       = ( bli_abs( cs_c ) == 1 );
+	const inc_t rs_ct       = ( c_row ? NR : 1 );
+	const inc_t cs_ct       = ( c_row ? 1 : MR );
+
+	const char* one        = bli_obj_buffer_for_const( dt, &BLIS_ONE );
+	const char* zero       = bli_obj_buffer_for_const( dt, &BLIS_ZERO );
+
+	auxinfo_t aux;
+
+	thrinfo_t* thread_jc = bli_thrinfo_sub_node( 0, thread );
+	thrinfo_t* thread_pc = bli_thrinfo_sub_node( 0, thread_jc );
+	thrinfo_t* thread_pb = bli_thrinfo_sub_node( 0, thread_pc );
+	thrinfo_t* thread_ic = bli_thrinfo_sub_node( 0, thread_pb );
+	thrinfo_t* thread_pa = bli_thrinfo_sub_node( 0, thread_ic );
+	thrinfo_t* thread_jr = bli_thrinfo_sub_node( 0, thread_pa );
+
+	// When the k dimension is parallelized, each pc group beyond the first
+	// accumulates its partial product into a private workspace that is later
+	// reduced into C. The first group updates C directly (and applies beta).
+	const dim_t pc_nt  = bli_thrinfo_n_way( thread_pc );
+	const dim_t pc_tid = bli_thrinfo_work_id( thread_pc );
+
+	const inc_t rs_w   = ( c_row ? n : 1 );
+	const inc_t cs_w   = ( c_row ? 1 : m );
+	      char* buf_w  = NULL;
+
+	if ( 1 < pc_nt )
+	{
+		if ( bli_thrinfo_am_chief( thread ) )
+		{
+			err_t r_val;
+			buf_w = bli_malloc_intl( ( pc_nt - 1 ) * m * n * dt_size, &r_val );
+		}
+
+		buf_w = bli_thrinfo_broadcast( thread, buf_w );
+	}
+
+	// Compute the PC loop thread range for the current thread.
+	dim_t pc_start, pc_end;
+	bli_thread_range_sub( pc_tid, pc_nt, k, 1, FALSE, &pc_start, &pc_end );
+
+	      char* c_00       = buf_c;
+	const void* beta_00    = buf_beta;
+	      inc_t rs_c_use   = rs_c;
+	      inc_t cs_c_use   = cs_c;
+	      inc_t jcstep_c_use = jcstep_c;
+	      inc_t icstep_c_use = icstep_c;
+	      inc_t jrstep_c_use = jrstep_c;
+
+	if ( 0 < pc_tid )
+	{
+		c_00         = buf_w + ( pc_tid - 1 ) * m * n * dt_size;
+		beta_00      = zero;
+		rs_c_use     = rs_w;
+		cs_c_use     = cs_w;
+		jcstep_c_use = cs_w * dt_size;
+		icstep_c_use = rs_w * dt_size;
+		jrstep_c_use = cs_w * NR * dt_size;
+	}
+
+	const char* a_00       = buf_a;
+	const char* b_00       = buf_b;
+
+	// Compute the JC loop thread range for the current thread. When the
+	// diagonal intersects C, weight the partitioning by the area of the
+	// stored region rather than by the number of columns.
+	dim_t jc_start, jc_end;
+	if ( bli_intersects_diag_n( diagoffc, m, n ) )
+	{
+		bli_thread_range_weighted_sub( thread_jc, diagoffc, uploc, uploc,
+		                               m, n, NR, FALSE, &jc_start, &jc_end );
+	}
+	else
+	{
+		dim_t jc_tid = bli_thrinfo_work_id( thread_jc );
+		dim_t jc_nt  = bli_thrinfo_n_way( thread_jc );
+		bli_thread_range_sub( jc_tid, jc_nt, n, NR, FALSE, &jc_start, &jc_end );
+	}
+	const dim_t n_local = jc_end - jc_start;
+
+	// Compute number of primary and leftover components of the JC loop.
+	const dim_t jc_left =   n_local % NC;
+
+	// Loop over the n dimension (NC rows/columns at a time).
+	for ( dim_t jj = jc_start; jj < jc_end; jj += NC )
+	{
+		// Calculate the thread's current JC block dimension.
+		const dim_t nc_cur = ( NC <= jc_end - jj ? NC : jc_left );
+
+		const char* b_jc = b_00 + jj * jcstep_b;
+		      char* c_jc = c_00 + jj * jcstep_c_use;
+
+		// Determine the range of rows of C that contain stored elements
+		// within the current column block. Rows outside of this range need
+		// not be packed or computed. The lower bound is kept aligned to MR
+		// so that microtiles coincide with those of neighboring blocks.
+		dim_t i_lo = 0;
+		dim_t i_hi = m;
+		if ( bli_is_lower( uploc ) )
+		{
+			i_lo = bli_max( 0, ( doff_t )jj - diagoffc );
+			i_lo = bli_min( m, ( i_lo / MR ) * MR );
+		}
+		else if ( bli_is_upper( uploc ) )
+		{
+			i_hi = bli_max( 0, ( doff_t )( jj + nc_cur ) - diagoffc );
+			i_hi = bli_min( m, i_hi );
+		}
+
+		// Loop over the k dimension (KC rows/columns at a time).
+		for ( dim_t pp = pc_start; pp < pc_end; pp += KC )
+		{
+			// Calculate the thread's current PC block dimension.
+			const dim_t kc_cur = bli_min( KC, pc_end - pp );
+
+			const char* a_pc = a_00 + pp * pcstep_a;
+			const char* b_pc = b_jc + pp * pcstep_b;
+
+			// Only apply beta to the first iteration of the pc loop.
+			const void* beta_use = ( pp == pc_start ? beta_00 : one );
+
+			      char* b_use;
+			      inc_t rs_b_use, cs_b_use, ps_b_use;
+
+			      char* ab_use   = NULL;
+
+			if ( packab )
+			{
+				// Pack all m rows of the current k-slab of A once. The packed
+				// slab is then read directly as A and (transposed) as B by all
+				// threads that share this pc iteration.
+				ab_use = bli_packm_alloc_ex
+				(
+				  ld_ab * kc_cur * dt_size,
+				  BLIS_BUFFER_FOR_B_PANEL,
+				  thread_pb
+				);
+
+				// Barrier so that computation is done before packing.
+				bli_thrinfo_barrier( thread_pb );
+
+				packm_sup_var2[ dt ]
+				(
+				  BLIS_NO_TRANSPOSE,
+				  BLIS_PACKED_MATRIX,
+				  m,
+				  kc_cur,
+				  ( void* )one,
+				  ( void* )a_pc, rs_a,  cs_a,
+				           ab_use, 1,     ld_ab,
+				  ( cntx_t* )cntx,
+				  thread_pb
+				);
+
+				// Barrier so that packing is done before computation.
+				bli_thrinfo_barrier( thread_pb );
+
+				b_use    = ab_use + jj * dt_size;
+				rs_b_use = ld_ab;
+				cs_b_use = 1;
+				ps_b_use = NR;
+			}
+			else
+			{
+				// Determine the packing buffer and related parameters for
+				// matrix B. (If B will not be packed, then b_use will be set to
+				// point to b and the _b_use strides will be set accordingly.)
+				bli_packm_sup
+				(
+				  packb,
+				  BLIS_BUFFER_FOR_B_PANEL, // This algorithm packs matrix B to
+				  stor_id,                 // a "panel of B."
+				  dt,
+				  nc_cur, kc_cur, NR,
+				  one,
+				  b_pc,   cs_b,      rs_b,
+				  ( void** )&b_use, &cs_b_use, &rs_b_use,
+				                    &ps_b_use,
+				  cntx,
+				  thread_pb
+				);
+			}
+
+			// Alias b_use so that it's clear this is our current block of
+			// matrix B.
+			const char* b_pc_use = b_use;
+
+			// Compute the IC loop thread range for the current thread.
+			dim_t ic_start, ic_end;
+			dim_t ic_tid = bli_thrinfo_work_id( thread_ic );
+			dim_t ic_nt  = bli_thrinfo_n_way( thread_ic );
+			bli_thread_range_sub( ic_tid, ic_nt, i_hi - i_lo, MR, FALSE, &ic_start, &ic_end );
+			ic_start += i_lo;
+			ic_end   += i_lo;
+			const dim_t m_local = ic_end - ic_start;
+
+			// Compute number of primary and leftover components of the IC loop.
+			const dim_t ic_left =   m_local % MC;
+
+			// Loop over the m dimension (MC rows at a time).
+			for ( dim_t ii = ic_start; ii < ic_end; ii += MC )
+			{
+				// Calculate the thread's current IC block dimension.
+				const dim_t mc_cur = ( MC <= ic_end - ii ? MC : ic_left );
+
+				const char* a_ic = a_pc + ii * icstep_a;
+				      char* c_ic = c_jc + ii * icstep_c_use;
+
+				      char* a_use;
+				      inc_t rs_a_use, cs_a_use, ps_a_use;
+
+				if ( packab )
+				{
+					a_use    = ab_use + ii * dt_size;
+					rs_a_use = 1;
+					cs_a_use = ld_ab;
+					ps_a_use = MR;
+				}
+				else
+				{
+					// Determine the packing buffer and related parameters for
+					// matrix A. (If A will not be packed, then a_use will be set
+					// to point to a and the _a_use strides will be set
+					// accordingly.)
+					bli_packm_sup
+					(
+					  packa,
+					  BLIS_BUFFER_FOR_A_BLOCK, // This algorithm packs matrix A to
+					  stor_id,                 // a "block of A."
+					  dt,
+					  mc_cur, kc_cur, MR,
+					  one,
+					  a_ic,   rs_a,      cs_a,
+					  ( void** )&a_use, &rs_a_use, &cs_a_use,
+					                    &ps_a_use,
+					  cntx,
+					  thread_pa
+					);
+				}
+
+				// Alias a_use so that it's clear this is our current block of
+				// matrix A.
+				const char* a_ic_use = a_use;
+
+				// Embed the panel stride of A within the auxinfo_t object. The
+				// millikernel will query and use this to iterate through
+				// micropanels of A (if needed).
+				bli_auxinfo_set_ps_a( ps_a_use, &aux );
+
+				// Compute number of primary and leftover components of the JR loop.
+				const dim_t jr_iter = ( nc_cur + NR - 1 ) / NR;
+				const dim_t jr_left =   nc_cur % NR;
+
+				// Compute the JR loop thread range for the current thread.
+				dim_t jr_start, jr_end;
+				dim_t jr_tid = bli_thrinfo_work_id( thread_jr );
+				dim_t jr_nt  = bli_thrinfo_n_way( thread_jr );
+				bli_thread_range_sub( jr_tid, jr_nt, jr_iter, 1, FALSE, &jr_start, &jr_end );
+
+				// Loop over the n dimension (NR columns at a time).
+				for ( dim_t j = jr_start; j < jr_end; j += 1 )
+				{
+					const dim_t nr_cur = ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left );
+
+					const char* b_jr = b_pc_use + j * ps_b_use * dt_size;
+					      char* c_jr = c_ic     + j * jrstep_c_use;
+
+					// Compute the diagonal offset of the microtile at the top
+					// of the current column panel.
+					const doff_t diagoff_j = diagoffc + ( doff_t )ii
+					                                  - ( doff_t )( jj + j*NR );
+
+					// Loop over the m dimension (MR rows at a time). Microtiles
+					// that intersect the diagonal are computed one at a time
+					// into ct and then only their stored elements are written
+					// to C. Contiguous runs of microtiles that lie entirely in
+					// the stored region are handed to the millikernel in a
+					// single call, and microtiles in the unstored region are
+					// skipped.
+					dim_t i = 0;
+
+					if ( bli_is_upper( uploc ) )
+					{
+						// Find the extent of the leading run of microtiles that
+						// are strictly above the diagonal.
+						while ( i < mc_cur &&
+						        bli_is_strictly_above_diag_n( diagoff_j + ( doff_t )i,
+						                                      bli_min( MR, mc_cur - i ),
+						                                      nr_cur ) )
+							i += MR;
+
+						if ( 0 < i )
+						{
+							gemmsup_ker
+							(
+							  conja,
+							  conjb,
+							  bli_min( i, mc_cur ),
+							  nr_cur,
+							  kc_cur,
+							  ( void* )buf_alpha,
+							  ( void* )a_ic_use, rs_a_use, cs_a_use,
+							  ( void* )b_jr,     rs_b_use, cs_b_use,
+							  ( void* )beta_use,
+							  ( void* )c_jr,     rs_c_use, cs_c_use,
+							  &aux,
+							  ( cntx_t* )cntx
+							);
+						}
+					}
+
+					for ( ; i < mc_cur; i += MR )
+					{
+						const dim_t  mr_cur     = bli_min( MR, mc_cur - i );
+						const doff_t diagoff_ij = diagoff_j + ( doff_t )i;
+
+						const char* a_ir = a_ic_use + ( i / MR ) * ps_a_use * dt_size;
+						      char* c_ir = c_jr     + i * rs_c_use * dt_size;
+
+						if ( bli_intersects_diag_n( diagoff_ij, mr_cur, nr_cur ) )
+						{
+							gemmsup_ker
+							(
+							  conja,
+							  conjb,
+							  mr_cur,
+							  nr_cur,
+							  kc_cur,
+							  ( void* )buf_alpha,
+							  ( void* )a_ir, rs_a_use, cs_a_use,
+							  ( void* )b_jr, rs_b_use, cs_b_use,
+							  ( void* )zero,
+							  ct,            rs_ct,    cs_ct,
+							  &aux,
+							  ( cntx_t* )cntx
+							);
+
+							// Scale C and add the result to only the stored part.
+							xpbys_ukr
+							(
+							  diagoff_ij,
+							  uploc,
+							  mr_cur, nr_cur,
+							  ct,   rs_ct,    cs_ct,
+							  beta_use,
+							  c_ir, rs_c_use, cs_c_use
+							);
+						}
+						else if ( bli_is_lower( uploc ) &&
+						          bli_is_strictly_below_diag_n( diagoff_ij, mr_cur, nr_cur ) )
+						{
+							// All remaining microtiles in this column panel are
+							// strictly below the diagonal.
+							gemmsup_ker
+							(
+							  conja,
+							  conjb,
+							  mc_cur - i,
+							  nr_cur,
+							  kc_cur,
+							  ( void* )buf_alpha,
+							  ( void* )a_ir, rs_a_use, cs_a_use,
+							  ( void* )b_jr, rs_b_use, cs_b_use,
+							  ( void* )beta_use,
+							  ( void* )c_ir, rs_c_use, cs_c_use,
+							  &aux,
+							  ( cntx_t* )cntx
+							);
+							break;
+						}
+						else if ( bli_is_upper( uploc ) )
+						{
+							// The remaining microtiles in this column panel are
+							// strictly below the diagonal and thus not stored.
+							break;
+						}
+					}
+				}
+			}
+
+			// NOTE: This barrier is only needed if we are packing B (since
+			// that matrix is packed within the pc loop of this variant).
+			if ( packb ) bli_thrinfo_barrier( thread_pb );
+		}
+	}
+
+	// Release any memory that was acquired for packing matrices A and B.
+	bli_packm_sup_finalize_mem
+	(
+	  packa,
+	  thread_pa
+	);
+	bli_packm_sup_finalize_mem
+	(
+	  packb || packab,
+	  thread_pb
+	);
+
+	// If the k dimension was parallelized, reduce the partial products of
+	// the other pc groups into the stored region of C, with each thread
+	// handling a subset of the columns.
+	if ( 1 < pc_nt )
+	{
+		bli_thrinfo_barrier( thread );
+
+		const dim_t nt  = bli_thrinfo_num_threads( thread );
+		const dim_t tid = bli_thrinfo_thread_id( thread );
+
+		dim_t j_start, j_end;
+		bli_thread_range_sub( tid, nt, n, 1, FALSE, &j_start, &j_end );
+
+		for ( dim_t g = 1; g < pc_nt; ++g )
+		{
+			dim_t g_start, g_end;
+			bli_thread_range_sub( g, pc_nt, k, 1, FALSE, &g_start, &g_end );
+
+			// Groups with an empty k range never wrote their workspace.
+			if ( g_start == g_end || j_start == j_end ) continue;
+
+			const char* w_g = buf_w + ( g - 1 ) * m * n * dt_size;
+
+			xpbys_ukr
+			(
+			  diagoffc - ( doff_t )j_start,
+			  uploc,
+			  m, j_end - j_start,
+			  w_g          + j_start * cs_w * dt_size, rs_w, cs_w,
+			  one,
+			  ( char* )buf_c + j_start * cs_c * dt_size, rs_c, cs_c
+			);
+		}
+
+		bli_thrinfo_barrier( thread );
+
+		if ( bli_thrinfo_am_chief( thread ) )
+			bli_free_intl( buf_w );
+	}
+}
+
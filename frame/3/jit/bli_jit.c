@@ -0,0 +1,404 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// MAP_ANONYMOUS is not part of POSIX.1-2008.
+#if   defined(__linux__)
+#define _DEFAULT_SOURCE
+#elif defined(__APPLE__)
+#define _DARWIN_C_SOURCE
+#endif
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_JIT_X86_64
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+static bool jit_enabled = FALSE;
+
+void bli_jit_enable( void )
+{
+	bli_init_once();
+
+	__atomic_store_n( &jit_enabled, TRUE, __ATOMIC_RELAXED );
+}
+
+void bli_jit_disable( void )
+{
+	bli_init_once();
+
+	__atomic_store_n( &jit_enabled, FALSE, __ATOMIC_RELAXED );
+}
+
+bool bli_jit_is_enabled( void )
+{
+	return __atomic_load_n( &jit_enabled, __ATOMIC_RELAXED );
+}
+
+bool bli_jit_is_available( void )
+{
+#ifdef BLIS_ENABLE_JIT_X86_64
+	// The generated kernels use AVX2 and FMA3.
+	switch ( bli_arch_query_id() )
+	{
+		case BLIS_ARCH_SKX:
+		case BLIS_ARCH_KNL:
+		case BLIS_ARCH_HASWELL:
+		case BLIS_ARCH_ZEN5:
+		case BLIS_ARCH_ZEN4:
+		case BLIS_ARCH_ZEN3:
+		case BLIS_ARCH_ZEN2:
+		case BLIS_ARCH_ZEN:
+			return TRUE;
+		default:
+			return FALSE;
+	}
+#else
+	return FALSE;
+#endif
+}
+
+#ifdef BLIS_ENABLE_JIT_X86_64
+
+// -----------------------------------------------------------------------------
+
+//
+// The kernel cache is an open-addressing hash table of entries that are
+// never modified once inserted. Lookups read it without locking; insertions
+// (which include generating the kernel) are serialized by a mutex. Shapes
+// for which no kernel could be generated are cached with a NULL kernel so
+// that generation is not attempted again. Once the table is three-quarters
+// full, no more entries are inserted.
+//
+
+typedef struct jit_entry_s
+{
+	jit_gemm_key_t key;
+	jit_gemm_ft    ker;
+
+	void*          code;
+	siz_t          code_size;
+} jit_entry_t;
+
+static jit_entry_t*        jit_cache[ BLIS_JIT_CACHE_SIZE ];
+static dim_t               jit_cache_n    = 0;
+static bool                jit_cache_full = FALSE;
+static bli_pthread_mutex_t jit_cache_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
+static siz_t bli_jit_hash( const jit_gemm_key_t* key )
+{
+	// FNV-1a over the bytes of the key (which is zero-initialized, so its
+	// padding bytes are well-defined).
+	const uint8_t* p = ( const uint8_t* )key;
+	uint64_t       h = 14695981039346656037ULL;
+
+	for ( siz_t i = 0; i < sizeof( jit_gemm_key_t ); ++i )
+	{
+		h ^= p[ i ];
+		h *= 1099511628211ULL;
+	}
+
+	return ( siz_t )( h % BLIS_JIT_CACHE_SIZE );
+}
+
+// Return the entry for key, or NULL if there is none.
+static jit_entry_t* bli_jit_cache_find( const jit_gemm_key_t* key, siz_t h )
+{
+	for ( siz_t i = 0; i < BLIS_JIT_CACHE_SIZE; ++i )
+	{
+		jit_entry_t* e = __atomic_load_n( &jit_cache[ ( h + i ) % BLIS_JIT_CACHE_SIZE ],
+		                                  __ATOMIC_ACQUIRE );
+
+		if ( e == NULL ) return NULL;
+
+		if ( memcmp( &e->key, key, sizeof( jit_gemm_key_t ) ) == 0 ) return e;
+	}
+
+	return NULL;
+}
+
+// Generate the kernel for key into an executable mapping. Return NULL (and
+// leave code NULL) if the kernel could not be generated.
+static jit_gemm_ft bli_jit_generate
+     (
+       const jit_gemm_key_t* key,
+             void**          code,
+             siz_t*          code_size
+     )
+{
+	err_t    r_val;
+	uint8_t* buf = bli_malloc_intl( BLIS_JIT_MAX_CODE_SIZE, &r_val );
+	siz_t    len, entry;
+
+	*code      = NULL;
+	*code_size = 0;
+
+	bool ok = bli_jit_x86_64_gemm_gen( key, buf, BLIS_JIT_MAX_CODE_SIZE, &len, &entry );
+
+	if ( ok )
+	{
+		const siz_t page = sysconf( _SC_PAGESIZE );
+		const siz_t size = ( ( len + page - 1 ) / page ) * page;
+
+		void* mem = mmap( NULL, size, PROT_READ | PROT_WRITE,
+		                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+		if ( mem != MAP_FAILED )
+		{
+			memcpy( mem, buf, len );
+
+			if ( mprotect( mem, size, PROT_READ | PROT_EXEC ) == 0 )
+			{
+				*code      = mem;
+				*code_size = size;
+			}
+			else
+			{
+				munmap( mem, size );
+			}
+		}
+	}
+
+	bli_free_intl( buf );
+
+	if ( *code == NULL ) return NULL;
+
+	return ( jit_gemm_ft )( ( uint8_t* )*code + entry );
+}
+
+// Return the kernel for key, generating it if necessary, or NULL if there is
+// none.
+static jit_gemm_ft bli_jit_query_ker( const jit_gemm_key_t* key )
+{
+	const siz_t  h = bli_jit_hash( key );
+	jit_entry_t* e = bli_jit_cache_find( key, h );
+
+	if ( e != NULL ) return e->ker;
+
+	if ( __atomic_load_n( &jit_cache_full, __ATOMIC_RELAXED ) ) return NULL;
+
+	jit_gemm_ft ker = NULL;
+
+	// BEGIN CRITICAL SECTION
+	bli_pthread_mutex_lock( &jit_cache_mutex );
+	{
+		// Another thread may have inserted the entry in the meantime.
+		e = bli_jit_cache_find( key, h );
+
+		if ( e != NULL )
+		{
+			ker = e->ker;
+		}
+		else if ( 4 * ( jit_cache_n + 1 ) > 3 * BLIS_JIT_CACHE_SIZE )
+		{
+			__atomic_store_n( &jit_cache_full, TRUE, __ATOMIC_RELAXED );
+		}
+		else
+		{
+			err_t r_val;
+			e = bli_malloc_intl( sizeof( jit_entry_t ), &r_val );
+
+			e->key = *key;
+			e->ker = bli_jit_generate( key, &e->code, &e->code_size );
+			ker    = e->ker;
+
+			siz_t i = h;
+			while ( jit_cache[ i ] != NULL ) i = ( i + 1 ) % BLIS_JIT_CACHE_SIZE;
+
+			__atomic_store_n( &jit_cache[ i ], e, __ATOMIC_RELEASE );
+			jit_cache_n += 1;
+		}
+	}
+	bli_pthread_mutex_unlock( &jit_cache_mutex );
+	// END CRITICAL SECTION
+
+	return ker;
+}
+
+static jit_scalar_t bli_jit_scalar_kind( const obj_t* s )
+{
+	if ( bli_obj_equals( s, &BLIS_ZERO ) ) return BLIS_JIT_SCALAR_ZERO;
+	if ( bli_obj_equals( s, &BLIS_ONE  ) ) return BLIS_JIT_SCALAR_ONE;
+
+	return BLIS_JIT_SCALAR_GENERAL;
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+int bli_jit_init( void )
+{
+	__atomic_store_n( &jit_enabled, bli_env_get_var( "BLIS_JIT", 0 ) != 0,
+	                  __ATOMIC_RELAXED );
+
+	return 0;
+}
+
+int bli_jit_finalize( void )
+{
+#ifdef BLIS_ENABLE_JIT_X86_64
+	bli_pthread_mutex_lock( &jit_cache_mutex );
+
+	for ( dim_t i = 0; i < BLIS_JIT_CACHE_SIZE; ++i )
+	{
+		jit_entry_t* e = jit_cache[ i ];
+
+		if ( e == NULL ) continue;
+
+		if ( e->code != NULL ) munmap( e->code, e->code_size );
+
+		bli_free_intl( e );
+		jit_cache[ i ] = NULL;
+	}
+
+	jit_cache_n    = 0;
+	jit_cache_full = FALSE;
+
+	bli_pthread_mutex_unlock( &jit_cache_mutex );
+#endif
+
+	return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+err_t bli_jit_gemm
+     (
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* b,
+       const obj_t* beta,
+       const obj_t* c
+     )
+{
+#ifdef BLIS_ENABLE_JIT_X86_64
+	const num_t dt = bli_obj_dt( c );
+
+	if ( ( dt != BLIS_FLOAT && dt != BLIS_DOUBLE ) ||
+	     bli_obj_dt( a ) != dt || bli_obj_dt( b ) != dt ) return BLIS_FAILURE;
+
+	if ( !bli_jit_is_available() ) return BLIS_FAILURE;
+
+	dim_t m = bli_obj_length( c );
+	dim_t n = bli_obj_width( c );
+	dim_t k = bli_obj_width_after_trans( a );
+
+	if ( m == 0 || n == 0 || k == 0 ) return BLIS_FAILURE;
+
+	inc_t rs_a = bli_obj_row_stride( a );
+	inc_t cs_a = bli_obj_col_stride( a );
+	inc_t rs_b = bli_obj_row_stride( b );
+	inc_t cs_b = bli_obj_col_stride( b );
+	inc_t rs_c = bli_obj_row_stride( c );
+	inc_t cs_c = bli_obj_col_stride( c );
+
+	if ( bli_obj_has_trans( a ) ) bli_swap_incs( &rs_a, &cs_a );
+	if ( bli_obj_has_trans( b ) ) bli_swap_incs( &rs_b, &cs_b );
+
+	const void* buf_a = bli_obj_buffer_at_off( a );
+	const void* buf_b = bli_obj_buffer_at_off( b );
+	      void* buf_c = bli_obj_buffer_at_off( c );
+
+	// The kernels require C and A to have unit row stride. If instead C and
+	// B have unit column stride, compute C^T := beta * C^T + alpha * B^T A^T.
+	if ( !( rs_c == 1 && rs_a == 1 ) )
+	{
+		if ( !( cs_c == 1 && cs_b == 1 ) ) return BLIS_FAILURE;
+
+		bli_swap_dims( &m, &n );
+		bli_swap_incs( &rs_c, &cs_c );
+
+		const void* buf_t = buf_a; buf_a = buf_b; buf_b = buf_t;
+
+		inc_t rs_t = rs_a, cs_t = cs_a;
+		rs_a = cs_b; cs_a = rs_b;
+		rs_b = cs_t; cs_b = rs_t;
+	}
+
+	if ( m > BLIS_JIT_MAX_MN || n > BLIS_JIT_MAX_MN ) return BLIS_FAILURE;
+
+	// Every displacement in the kernel must fit in 32 bits.
+	const inc_t es     = bli_dt_size( dt );
+	const inc_t disp_a = ( m + bli_abs( cs_a ) * k ) * es;
+	const inc_t disp_b = ( bli_abs( rs_b ) * k + bli_abs( cs_b ) * n ) * es;
+	const inc_t disp_c = ( m + bli_abs( cs_c ) * n ) * es;
+
+	if ( disp_a > INT32_MAX / 2 || disp_b > INT32_MAX / 2 ||
+	     disp_c > INT32_MAX / 2 ) return BLIS_FAILURE;
+
+	obj_t alpha_cast, beta_cast;
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE, alpha, &alpha_cast );
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE, beta,  &beta_cast );
+
+	jit_gemm_key_t key;
+	memset( &key, 0, sizeof( key ) );
+
+	key.dt    = dt;
+	key.alpha = bli_jit_scalar_kind( &alpha_cast );
+	key.beta  = bli_jit_scalar_kind( &beta_cast );
+	key.m     = m;
+	key.n     = n;
+	key.k     = k;
+	key.cs_a  = cs_a;
+	key.rs_b  = rs_b;
+	key.cs_b  = cs_b;
+	key.cs_c  = cs_c;
+
+	// A and B are not referenced when alpha is zero.
+	if ( key.alpha == BLIS_JIT_SCALAR_ZERO ) return BLIS_FAILURE;
+
+	jit_gemm_ft ker = bli_jit_query_ker( &key );
+
+	if ( ker == NULL ) return BLIS_FAILURE;
+
+	ker
+	(
+	  buf_a,
+	  buf_b,
+	  buf_c,
+	  bli_obj_buffer_for_1x1( dt, &alpha_cast ),
+	  bli_obj_buffer_for_1x1( dt, &beta_cast )
+	);
+
+	return BLIS_SUCCESS;
+#else
+	return BLIS_FAILURE;
+#endif
+}
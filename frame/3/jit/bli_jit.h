@@ -0,0 +1,154 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// BLIS can generate gemm kernels at runtime that are specialized to one
+// problem shape: the dimensions, the operand strides, and whether alpha is
+// one and beta is zero or one are all fixed when the kernel is generated, so
+// the kernel consists of straight-line code with no edge case handling (the
+// k loop is fully unrolled unless that would make the kernel too large). The
+// kernels are cached by their shape, so repeated calls with the same shape
+// (the typical use case) pay the cost of generation only once.
+//
+// Kernels are only generated for x86-64 (non-Windows) builds running on a
+// hardware configuration that supports AVX2 and FMA3, and only for real
+// single- and double-precision problems whose m and n dimensions do not
+// exceed BLIS_JIT_MAX_MN. C must be column-stored with column-stored A, or
+// row-stored with row-stored B.
+//
+// Generated kernels are not used unless enabled, either by setting the
+// environment variable BLIS_JIT to a non-zero value or by calling
+// bli_jit_enable(). When enabled, they are used from the sup path of gemm.
+//
+
+#if defined(__x86_64__) && !defined(_WIN32) && !defined(BLIS_DISABLE_JIT)
+#define BLIS_ENABLE_JIT_X86_64
+#endif
+
+#ifndef BLIS_JIT_MAX_MN
+#define BLIS_JIT_MAX_MN        64
+#endif
+
+// The maximum number of kernels held in the cache. Problems whose shapes
+// do not fit in the cache are computed without generated kernels.
+#ifndef BLIS_JIT_CACHE_SIZE
+#define BLIS_JIT_CACHE_SIZE    1024
+#endif
+
+// The maximum size, in bytes, of a generated kernel.
+#ifndef BLIS_JIT_MAX_CODE_SIZE
+#define BLIS_JIT_MAX_CODE_SIZE ( 256 * 1024 )
+#endif
+
+// The k loop is fully unrolled if the number of microtiles times k does not
+// exceed BLIS_JIT_MAX_UNROLL. Otherwise, it is unrolled by BLIS_JIT_K_UNROLL.
+#ifndef BLIS_JIT_MAX_UNROLL
+#define BLIS_JIT_MAX_UNROLL    512
+#endif
+
+#ifndef BLIS_JIT_K_UNROLL
+#define BLIS_JIT_K_UNROLL      4
+#endif
+
+typedef enum
+{
+	BLIS_JIT_SCALAR_ZERO = 0,
+	BLIS_JIT_SCALAR_ONE,
+	BLIS_JIT_SCALAR_GENERAL,
+} jit_scalar_t;
+
+// The shape that a generated gemm kernel is specialized to. The kernel
+// computes C := beta * C + alpha * A * B where C is m x n with unit row
+// stride, A is m x k with unit row stride, and B is k x n.
+typedef struct jit_gemm_key_s
+{
+	num_t        dt;
+	jit_scalar_t alpha;
+	jit_scalar_t beta;
+
+	dim_t        m;
+	dim_t        n;
+	dim_t        k;
+
+	inc_t        cs_a;
+	inc_t        rs_b;
+	inc_t        cs_b;
+	inc_t        cs_c;
+} jit_gemm_key_t;
+
+typedef void (*jit_gemm_ft)
+     (
+       const void* a,
+       const void* b,
+             void* c,
+       const void* alpha,
+       const void* beta
+     );
+
+int  bli_jit_init( void );
+int  bli_jit_finalize( void );
+
+BLIS_EXPORT_BLIS void bli_jit_enable( void );
+BLIS_EXPORT_BLIS void bli_jit_disable( void );
+BLIS_EXPORT_BLIS bool bli_jit_is_enabled( void );
+
+// Return TRUE if kernels can be generated for the hardware configuration in
+// use.
+BLIS_EXPORT_BLIS bool bli_jit_is_available( void );
+
+// Compute C := beta * C + alpha * trans(A) * trans(B) with a generated kernel
+// (whether or not generated kernels are enabled). Return BLIS_FAILURE without
+// touching C if no kernel can be generated for the problem.
+BLIS_EXPORT_BLIS err_t bli_jit_gemm
+     (
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* b,
+       const obj_t* beta,
+       const obj_t* c
+     );
+
+// Write the code of a kernel for the given shape into buf (whose size is
+// cap bytes). Return FALSE if the kernel does not fit. Otherwise, return
+// TRUE and set len to the number of bytes written and entry to the offset
+// of the first instruction.
+bool bli_jit_x86_64_gemm_gen
+     (
+       const jit_gemm_key_t* key,
+             uint8_t*        buf,
+             siz_t           cap,
+             siz_t*          len,
+             siz_t*          entry
+     );
+
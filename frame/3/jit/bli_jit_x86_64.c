@@ -0,0 +1,468 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_JIT_X86_64
+
+//
+// A minimal x86-64 code emitter for the instructions used by the generated
+// gemm kernels (AVX, AVX2 and FMA3 on ymm registers, plus a handful of
+// general-purpose instructions for addressing and looping).
+//
+// Generated kernels follow the System V calling convention:
+//
+//   rdi = a, rsi = b, rdx = c, rcx = alpha, r8 = beta
+//
+// and only use the caller-saved registers rax, r9, r10, r11 and ymm0-ymm15,
+// so no stack frame is needed.
+//
+
+#define RAX   0
+#define RCX   1
+#define RDX   2
+#define RSI   6
+#define RDI   7
+#define R8    8
+#define R9    9
+#define R10  10
+#define R11  11
+#define RIP  -1
+
+// VEX opcode maps and implied prefixes.
+#define MAP_0F    1
+#define MAP_0F38  2
+#define PP_NONE   0
+#define PP_66     1
+
+typedef struct
+{
+	uint8_t* buf;
+	siz_t    len;
+	siz_t    cap;
+	bool     ok;
+} jit_buf_t;
+
+static void emit_u8( jit_buf_t* jb, uint8_t b )
+{
+	if ( jb->len < jb->cap ) jb->buf[ jb->len ] = b;
+	else                     jb->ok = FALSE;
+
+	jb->len += 1;
+}
+
+static void emit_u32( jit_buf_t* jb, int32_t v )
+{
+	uint32_t u = ( uint32_t )v;
+
+	for ( int i = 0; i < 4; ++i ) emit_u8( jb, ( u >> ( 8 * i ) ) & 0xff );
+}
+
+// Emit a ModRM byte (plus SIB byte and displacement) for a [base + disp]
+// memory operand. For RIP-relative operands, disp is the offset of the
+// target within the buffer; this must be the last field of the instruction.
+static void emit_mem( jit_buf_t* jb, int reg, int base, int32_t disp )
+{
+	if ( base == RIP )
+	{
+		emit_u8( jb, ( ( reg & 7 ) << 3 ) | 5 );
+		emit_u32( jb, disp - ( int32_t )( jb->len + 4 ) );
+		return;
+	}
+
+	int mod;
+	if      ( disp == 0 && ( base & 7 ) != 5 ) mod = 0;
+	else if ( -128 <= disp && disp <= 127 )    mod = 1;
+	else                                       mod = 2;
+
+	emit_u8( jb, ( mod << 6 ) | ( ( reg & 7 ) << 3 ) | ( base & 7 ) );
+
+	if ( ( base & 7 ) == 4 ) emit_u8( jb, 0x24 );
+
+	if      ( mod == 1 ) emit_u8( jb, ( uint8_t )disp );
+	else if ( mod == 2 ) emit_u32( jb, disp );
+}
+
+// Emit a three-byte VEX prefix (with L = 1, i.e. 256-bit) and an opcode.
+static void emit_vex( jit_buf_t* jb, int map, int pp, int w, int reg, int vvvv, int rm, uint8_t op )
+{
+	const int r = ( reg >> 3 ) & 1;
+	const int b = ( rm  >= 0 ? rm >> 3 : 0 ) & 1;
+
+	emit_u8( jb, 0xc4 );
+	emit_u8( jb, ( ( !r ) << 7 ) | ( 1 << 6 ) | ( ( !b ) << 5 ) | map );
+	emit_u8( jb, ( w << 7 ) | ( ( ~vvvv & 15 ) << 3 ) | ( 1 << 2 ) | pp );
+	emit_u8( jb, op );
+}
+
+// op ymm(reg), ymm(vvvv), ymm(rm)
+static void emit_vrrr( jit_buf_t* jb, int map, int pp, int w, uint8_t op, int reg, int vvvv, int rm )
+{
+	emit_vex( jb, map, pp, w, reg, vvvv, rm, op );
+	emit_u8( jb, 0xc0 | ( ( reg & 7 ) << 3 ) | ( rm & 7 ) );
+}
+
+// op ymm(reg), ymm(vvvv), [base + disp]
+static void emit_vrrm( jit_buf_t* jb, int map, int pp, int w, uint8_t op, int reg, int vvvv, int base, int32_t disp )
+{
+	emit_vex( jb, map, pp, w, reg, vvvv, base, op );
+	emit_mem( jb, reg, base, disp );
+}
+
+// lea r64(reg), [base + disp]
+static void emit_lea( jit_buf_t* jb, int reg, int base, int32_t disp )
+{
+	emit_u8( jb, 0x48 | ( ( ( reg >> 3 ) & 1 ) << 2 ) | ( ( base >> 3 ) & 1 ) );
+	emit_u8( jb, 0x8d );
+	emit_mem( jb, reg, base, disp );
+}
+
+// -----------------------------------------------------------------------------
+
+//
+// The kernel computes C one microtile at a time. A microtile spans up to
+// three vectors of rows and up to twelve columns, subject to the number of
+// ymm registers: the microtile's accumulators, one register per vector of A,
+// one register for broadcasting elements of B and (if the last vector of A
+// is partial) one register holding the load/store mask. The accumulators
+// must also leave ymm12-ymm14 free for the update of C, where they hold
+// alpha, beta and elements of C, respectively.
+//
+// If m is not a multiple of the vector length, the mask is stored at the
+// beginning of the buffer and the kernel's first instruction follows it.
+//
+
+#define REG_ALPHA 12
+#define REG_BETA  13
+#define REG_CTMP  14
+#define REG_MASK  15
+
+typedef struct
+{
+	jit_buf_t* jb;
+
+	bool       is_d;
+	int32_t    es;     // element size in bytes
+	dim_t      vl;     // vector length in elements
+
+	// Strides in bytes.
+	int32_t    cs_a;
+	int32_t    rs_b;
+	int32_t    cs_b;
+	int32_t    cs_c;
+
+	// The current microtile.
+	dim_t      nv;     // number of (possibly partial) vectors of rows
+	dim_t      nr;     // number of columns
+	bool       masked; // whether the last vector is partial
+} jit_gemm_gen_t;
+
+static int acc_reg( const jit_gemm_gen_t* g, dim_t v, dim_t j ) { return v * g->nr + j; }
+static int a_reg  ( const jit_gemm_gen_t* g, dim_t v )          { return g->nv * g->nr + v; }
+static int b_reg  ( const jit_gemm_gen_t* g )                   { return g->nv * g->nr + g->nv; }
+
+static bool is_partial( const jit_gemm_gen_t* g, dim_t v )
+{
+	return g->masked && v == g->nv - 1;
+}
+
+// Load (possibly partial) vector of reg from [base + disp].
+static void emit_load( const jit_gemm_gen_t* g, int reg, bool partial, int base, int32_t disp )
+{
+	// vmaskmovps/pd ymm, ymm(mask), m256 or vmovups ymm, m256
+	if ( partial ) emit_vrrm( g->jb, MAP_0F38, PP_66, 0, g->is_d ? 0x2d : 0x2c, reg, REG_MASK, base, disp );
+	else           emit_vrrm( g->jb, MAP_0F, PP_NONE, 0, 0x10, reg, 0, base, disp );
+}
+
+// Store (possibly partial) vector of reg to [base + disp].
+static void emit_store( const jit_gemm_gen_t* g, int reg, bool partial, int base, int32_t disp )
+{
+	// vmaskmovps/pd m256, ymm(mask), ymm or vmovups m256, ymm
+	if ( partial ) emit_vrrm( g->jb, MAP_0F38, PP_66, 0, g->is_d ? 0x2f : 0x2e, reg, REG_MASK, base, disp );
+	else           emit_vrrm( g->jb, MAP_0F, PP_NONE, 0, 0x11, reg, 0, base, disp );
+}
+
+// vbroadcastss/sd ymm, m32/m64
+static void emit_bcast( const jit_gemm_gen_t* g, int reg, int base, int32_t disp )
+{
+	emit_vrrm( g->jb, MAP_0F38, PP_66, 0, g->is_d ? 0x19 : 0x18, reg, 0, base, disp );
+}
+
+// vfmadd231ps/pd acc, x, y (acc += x * y)
+static void emit_fma( const jit_gemm_gen_t* g, int acc, int x, int y )
+{
+	emit_vrrr( g->jb, MAP_0F38, PP_66, g->is_d, 0xb8, acc, x, y );
+}
+
+// vfmadd231ps/pd acc, x, [base + disp]
+static void emit_fma_mem( const jit_gemm_gen_t* g, int acc, int x, int base, int32_t disp )
+{
+	emit_vrrm( g->jb, MAP_0F38, PP_66, g->is_d, 0xb8, acc, x, base, disp );
+}
+
+// vaddps/pd dst, x, y and vmulps/pd dst, x, y
+static void emit_add( const jit_gemm_gen_t* g, int dst, int x, int y )
+{
+	emit_vrrr( g->jb, MAP_0F, g->is_d ? PP_66 : PP_NONE, 0, 0x58, dst, x, y );
+}
+
+static void emit_add_mem( const jit_gemm_gen_t* g, int dst, int x, int base, int32_t disp )
+{
+	emit_vrrm( g->jb, MAP_0F, g->is_d ? PP_66 : PP_NONE, 0, 0x58, dst, x, base, disp );
+}
+
+static void emit_mul( const jit_gemm_gen_t* g, int dst, int x, int y )
+{
+	emit_vrrr( g->jb, MAP_0F, g->is_d ? PP_66 : PP_NONE, 0, 0x59, dst, x, y );
+}
+
+// Accumulate the rank-1 updates for k_iter consecutive columns of A (and rows
+// of B), starting at r10 and r11, respectively.
+static void gen_rank1s( const jit_gemm_gen_t* g, dim_t k_iter )
+{
+	for ( dim_t p = 0; p < k_iter; ++p )
+	{
+		for ( dim_t v = 0; v < g->nv; ++v )
+			emit_load( g, a_reg( g, v ), is_partial( g, v ), R10,
+			           p * g->cs_a + v * 32 );
+
+		for ( dim_t j = 0; j < g->nr; ++j )
+		{
+			emit_bcast( g, b_reg( g ), R11, p * g->rs_b + j * g->cs_b );
+
+			for ( dim_t v = 0; v < g->nv; ++v )
+				emit_fma( g, acc_reg( g, v, j ), a_reg( g, v ), b_reg( g ) );
+		}
+	}
+}
+
+static void gen_microtile
+     (
+             jit_gemm_gen_t* g,
+       const jit_gemm_key_t* key,
+             dim_t           i,
+             dim_t           j,
+             dim_t           mr,
+             dim_t           nr,
+             bool            unroll
+     )
+{
+	jit_buf_t* jb = g->jb;
+
+	g->nv     = ( mr + g->vl - 1 ) / g->vl;
+	g->nr     = nr;
+	g->masked = ( mr % g->vl != 0 );
+
+	// vmovups ymm(mask), [rip + 0]
+	if ( g->masked )
+		emit_vrrm( jb, MAP_0F, PP_NONE, 0, 0x10, REG_MASK, 0, RIP, 0 );
+
+	// vxorps acc, acc, acc
+	for ( dim_t v = 0; v < g->nv; ++v )
+	for ( dim_t jj = 0; jj < nr; ++jj )
+	{
+		const int acc = acc_reg( g, v, jj );
+		emit_vrrr( jb, MAP_0F, PP_NONE, 0, 0x57, acc, acc, acc );
+	}
+
+	// r10 = a + i * es, r11 = b + j * cs_b
+	emit_lea( jb, R10, RDI, i * g->es );
+	emit_lea( jb, R11, RSI, j * g->cs_b );
+
+	if ( unroll )
+	{
+		gen_rank1s( g, key->k );
+	}
+	else
+	{
+		const dim_t k_iter = key->k / BLIS_JIT_K_UNROLL;
+		const dim_t k_left = key->k % BLIS_JIT_K_UNROLL;
+
+		if ( k_iter > 0 )
+		{
+			// mov eax, k_iter
+			emit_u8( jb, 0xb8 );
+			emit_u32( jb, k_iter );
+
+			const siz_t loop = jb->len;
+
+			gen_rank1s( g, BLIS_JIT_K_UNROLL );
+
+			emit_lea( jb, R10, R10, BLIS_JIT_K_UNROLL * g->cs_a );
+			emit_lea( jb, R11, R11, BLIS_JIT_K_UNROLL * g->rs_b );
+
+			// dec rax; jnz loop
+			emit_u8( jb, 0x48 ); emit_u8( jb, 0xff ); emit_u8( jb, 0xc8 );
+			emit_u8( jb, 0x0f ); emit_u8( jb, 0x85 );
+			emit_u32( jb, ( int32_t )loop - ( int32_t )( jb->len + 4 ) );
+		}
+
+		gen_rank1s( g, k_left );
+	}
+
+	// Scale by alpha (unless alpha is one) and update the microtile of C at
+	// r9 = c + i * es + j * cs_c.
+	emit_lea( jb, R9, RDX, i * g->es + j * g->cs_c );
+
+	if ( key->alpha == BLIS_JIT_SCALAR_GENERAL )
+	{
+		emit_bcast( g, REG_ALPHA, RCX, 0 );
+
+		for ( dim_t v = 0; v < g->nv; ++v )
+		for ( dim_t jj = 0; jj < nr; ++jj )
+			emit_mul( g, acc_reg( g, v, jj ), acc_reg( g, v, jj ), REG_ALPHA );
+	}
+
+	if ( key->beta == BLIS_JIT_SCALAR_GENERAL )
+		emit_bcast( g, REG_BETA, R8, 0 );
+
+	for ( dim_t jj = 0; jj < nr; ++jj )
+	for ( dim_t v = 0; v < g->nv; ++v )
+	{
+		const int     acc     = acc_reg( g, v, jj );
+		const bool    partial = is_partial( g, v );
+		const int32_t disp    = jj * g->cs_c + v * 32;
+
+		if ( key->beta == BLIS_JIT_SCALAR_ONE )
+		{
+			if ( partial )
+			{
+				emit_load( g, REG_CTMP, TRUE, R9, disp );
+				emit_add( g, acc, acc, REG_CTMP );
+			}
+			else
+			{
+				emit_add_mem( g, acc, acc, R9, disp );
+			}
+		}
+		else if ( key->beta == BLIS_JIT_SCALAR_GENERAL )
+		{
+			if ( partial )
+			{
+				emit_load( g, REG_CTMP, TRUE, R9, disp );
+				emit_fma( g, acc, REG_BETA, REG_CTMP );
+			}
+			else
+			{
+				emit_fma_mem( g, acc, REG_BETA, R9, disp );
+			}
+		}
+
+		emit_store( g, acc, partial, R9, disp );
+	}
+}
+
+// Return the largest number of columns in a microtile with nv vectors of
+// rows (the last of which is partial if masked is TRUE).
+static dim_t max_nr( dim_t nv, bool masked )
+{
+	const dim_t n_free = 16 - nv - 1 - ( masked ? 1 : 0 );
+
+	return bli_min( n_free / nv, REG_ALPHA / nv );
+}
+
+bool bli_jit_x86_64_gemm_gen
+     (
+       const jit_gemm_key_t* key,
+             uint8_t*        buf,
+             siz_t           cap,
+             siz_t*          len,
+             siz_t*          entry
+     )
+{
+	jit_buf_t jb = { buf, 0, cap, TRUE };
+
+	jit_gemm_gen_t g;
+
+	g.jb   = &jb;
+	g.is_d = ( key->dt == BLIS_DOUBLE );
+	g.es   = g.is_d ? sizeof( double ) : sizeof( float );
+	g.vl   = 32 / g.es;
+	g.cs_a = key->cs_a * g.es;
+	g.rs_b = key->rs_b * g.es;
+	g.cs_b = key->cs_b * g.es;
+	g.cs_c = key->cs_c * g.es;
+
+	const dim_t m      = key->m;
+	const dim_t n      = key->n;
+	const dim_t mr_max = 3 * g.vl;
+	const dim_t m_left = m % g.vl;
+
+	// Store the mask for the last (partial) vector of rows, if any.
+	if ( m_left != 0 )
+	{
+		for ( dim_t l = 0; l < g.vl; ++l )
+		for ( dim_t b = 0; b < g.es; ++b )
+			emit_u8( &jb, l < m_left ? 0xff : 0x00 );
+	}
+
+	*entry = jb.len;
+
+	// Count the microtiles to decide whether the k loop is unrolled fully.
+	dim_t n_tiles = 0;
+	for ( dim_t i = 0; i < m; i += mr_max )
+	{
+		const dim_t mr = bli_min( mr_max, m - i );
+		const dim_t nr = max_nr( ( mr + g.vl - 1 ) / g.vl, mr % g.vl != 0 );
+
+		n_tiles += ( n + nr - 1 ) / nr;
+	}
+
+	const bool unroll = ( n_tiles * key->k <= BLIS_JIT_MAX_UNROLL );
+
+	for ( dim_t i = 0; i < m; i += mr_max )
+	{
+		const dim_t mr     = bli_min( mr_max, m - i );
+		const dim_t nr_max = max_nr( ( mr + g.vl - 1 ) / g.vl, mr % g.vl != 0 );
+
+		for ( dim_t j = 0; j < n; j += nr_max )
+		{
+			const dim_t nr = bli_min( nr_max, n - j );
+
+			gen_microtile( &g, key, i, j, mr, nr, unroll );
+
+			if ( !jb.ok ) return FALSE;
+		}
+	}
+
+	// vzeroupper; ret
+	emit_u8( &jb, 0xc5 ); emit_u8( &jb, 0xf8 ); emit_u8( &jb, 0x77 );
+	emit_u8( &jb, 0xc3 );
+
+	*len = jb.len;
+
+	return jb.ok;
+}
+
+#endif
@@ -0,0 +1,416 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// A group of modes (m, n, or k) along with the strides of the two tensors
+// that share it.
+//
+
+typedef struct tcontract_modes_s
+{
+	dim_t ndim;
+	dim_t len[ BLIS_TCONTRACT_MAX_NDIM ];
+	inc_t stride[ 2 ][ BLIS_TCONTRACT_MAX_NDIM ];
+} tcontract_modes_t;
+
+static void bli_tcontract_check_modes
+     (
+             dim_t  ndim,
+       const dim_t* len
+     )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	if ( ndim < 0 )
+		e_val = BLIS_NEGATIVE_DIMENSION;
+	else if ( ndim > BLIS_TCONTRACT_MAX_NDIM )
+		e_val = BLIS_OUT_OF_BOUNDS;
+	else
+		for ( dim_t d = 0; d < ndim; ++d )
+			if ( len[ d ] < 0 ) e_val = BLIS_NEGATIVE_DIMENSION;
+
+	bli_check_error_code( e_val );
+}
+
+static void bli_tcontract_init_modes
+     (
+             dim_t              ndim,
+       const dim_t*             len,
+       const inc_t*             stride0,
+       const inc_t*             stride1,
+             tcontract_modes_t* modes
+     )
+{
+	// Drop modes of unit length; they do not contribute to the index space.
+	dim_t nd = 0;
+
+	for ( dim_t d = 0; d < ndim; ++d )
+	{
+		if ( len[ d ] == 1 ) continue;
+
+		modes->len[ nd ]         = len[ d ];
+		modes->stride[ 0 ][ nd ] = stride0[ d ];
+		modes->stride[ 1 ][ nd ] = stride1[ d ];
+		nd++;
+	}
+
+	// Sort the modes by increasing stride in whichever tensor has the
+	// smallest stride (usually the tensor which is unit-stride along one of
+	// these modes), using the other tensor's strides to break ties.
+	inc_t min0 = 0, min1 = 0;
+	for ( dim_t d = 0; d < nd; ++d )
+	{
+		if ( d == 0 || bli_abs( modes->stride[ 0 ][ d ] ) < min0 ) min0 = bli_abs( modes->stride[ 0 ][ d ] );
+		if ( d == 0 || bli_abs( modes->stride[ 1 ][ d ] ) < min1 ) min1 = bli_abs( modes->stride[ 1 ][ d ] );
+	}
+
+	const dim_t s = ( min0 < min1 ? 0 : 1 );
+
+	for ( dim_t d = 1; d < nd; ++d )
+	{
+		const dim_t l  = modes->len[ d ];
+		const inc_t s0 = modes->stride[ 0 ][ d ];
+		const inc_t s1 = modes->stride[ 1 ][ d ];
+		const inc_t ks = bli_abs( modes->stride[ s     ][ d ] );
+		const inc_t kt = bli_abs( modes->stride[ 1 - s ][ d ] );
+
+		dim_t e = d;
+		for ( ; e > 0; --e )
+		{
+			const inc_t ps = bli_abs( modes->stride[ s     ][ e - 1 ] );
+			const inc_t pt = bli_abs( modes->stride[ 1 - s ][ e - 1 ] );
+
+			if ( ps < ks || ( ps == ks && pt <= kt ) ) break;
+
+			modes->len[ e ]         = modes->len[ e - 1 ];
+			modes->stride[ 0 ][ e ] = modes->stride[ 0 ][ e - 1 ];
+			modes->stride[ 1 ][ e ] = modes->stride[ 1 ][ e - 1 ];
+		}
+
+		modes->len[ e ]         = l;
+		modes->stride[ 0 ][ e ] = s0;
+		modes->stride[ 1 ][ e ] = s1;
+	}
+
+	// Merge adjacent modes that are contiguous with each other in both
+	// tensors.
+	dim_t nm = 0;
+
+	for ( dim_t d = 0; d < nd; ++d )
+	{
+		if ( nm > 0 &&
+		     modes->stride[ 0 ][ d ] == modes->stride[ 0 ][ nm - 1 ] * modes->len[ nm - 1 ] &&
+		     modes->stride[ 1 ][ d ] == modes->stride[ 1 ][ nm - 1 ] * modes->len[ nm - 1 ] )
+		{
+			modes->len[ nm - 1 ] *= modes->len[ d ];
+			continue;
+		}
+
+		modes->len[ nm ]         = modes->len[ d ];
+		modes->stride[ 0 ][ nm ] = modes->stride[ 0 ][ d ];
+		modes->stride[ 1 ][ nm ] = modes->stride[ 1 ][ d ];
+		nm++;
+	}
+
+	// Always keep at least one mode.
+	if ( nm == 0 )
+	{
+		modes->len[ 0 ]         = 1;
+		modes->stride[ 0 ][ 0 ] = 1;
+		modes->stride[ 1 ][ 0 ] = 1;
+		nm = 1;
+	}
+
+	modes->ndim = nm;
+}
+
+static dim_t bli_tcontract_modes_size
+     (
+       const tcontract_modes_t* modes
+     )
+{
+	dim_t size = 1;
+
+	for ( dim_t d = 0; d < modes->ndim; ++d )
+		size *= modes->len[ d ];
+
+	return size;
+}
+
+static void bli_tcontract_modes_copy
+     (
+       const tcontract_modes_t* modes,
+             dim_t              s,
+             dim_t*             ndim,
+             dim_t*             len,
+             inc_t*             stride
+     )
+{
+	*ndim = modes->ndim;
+
+	for ( dim_t d = 0; d < modes->ndim; ++d )
+	{
+		len[ d ]    = modes->len[ d ];
+		stride[ d ] = modes->stride[ s ][ d ];
+	}
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             conj_t  conja, \
+             conj_t  conjb, \
+             dim_t   ndim_m, const dim_t* len_m, \
+             dim_t   ndim_n, const dim_t* len_n, \
+             dim_t   ndim_k, const dim_t* len_k, \
+       const ctype*  alpha, \
+       const ctype*  a, const inc_t* rs_a, const inc_t* cs_a, \
+       const ctype*  b, const inc_t* rs_b, const inc_t* cs_b, \
+       const ctype*  beta, \
+             ctype*  c, const inc_t* rs_c, const inc_t* cs_c, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* The number of modes is always checked since it bounds the size of
+	   the local mode descriptions. */ \
+	bli_tcontract_check_modes( ndim_m, len_m ); \
+	bli_tcontract_check_modes( ndim_n, len_n ); \
+	bli_tcontract_check_modes( ndim_k, len_k ); \
+\
+	/* Normalize each group of modes. The strides of C take precedence in
+	   ordering the m and n modes (unless A or B has a smaller stride), and
+	   the strides of A and B in ordering the k modes. */ \
+	tcontract_modes_t modes_m, modes_n, modes_k; \
+	bli_tcontract_init_modes( ndim_m, len_m, rs_a, rs_c, &modes_m ); \
+	bli_tcontract_init_modes( ndim_n, len_n, cs_b, cs_c, &modes_n ); \
+	bli_tcontract_init_modes( ndim_k, len_k, cs_a, rs_b, &modes_k ); \
+\
+	const dim_t m = bli_tcontract_modes_size( &modes_m ); \
+	const dim_t n = bli_tcontract_modes_size( &modes_n ); \
+	const dim_t k = bli_tcontract_modes_size( &modes_k ); \
+\
+	if ( m == 0 || n == 0 ) return; \
+\
+	/* If there is no product to compute, only scale C by beta. */ \
+	if ( k == 0 || bli_teq0s( ch, *alpha ) ) \
+	{ \
+		if ( bli_teq1s( ch, *beta ) ) return; \
+\
+		const bool beta_zero = bli_teq0s( ch, *beta ); \
+		const inc_t sm       = modes_m.stride[ 1 ][ 0 ]; \
+		const inc_t sn       = modes_n.stride[ 1 ][ 0 ]; \
+\
+		dim_t idx_m[ BLIS_TCONTRACT_MAX_NDIM ]; \
+		dim_t idx_n[ BLIS_TCONTRACT_MAX_NDIM ]; \
+\
+		inc_t off_n = bli_tcontract_mode_off( modes_n.ndim, modes_n.len, modes_n.stride[ 1 ], 0, idx_n ); \
+\
+		for ( dim_t j = 0; j < n; j += modes_n.len[ 0 ] ) \
+		{ \
+			inc_t off_m = bli_tcontract_mode_off( modes_m.ndim, modes_m.len, modes_m.stride[ 1 ], 0, idx_m ); \
+\
+			for ( dim_t i = 0; i < m; i += modes_m.len[ 0 ] ) \
+			{ \
+				ctype* restrict c1 = c + off_m + off_n; \
+\
+				for ( dim_t jj = 0; jj < modes_n.len[ 0 ]; ++jj ) \
+				for ( dim_t ii = 0; ii < modes_m.len[ 0 ]; ++ii ) \
+				{ \
+					if ( beta_zero ) { bli_tset0s( ch, c1[ ii*sm + jj*sn ] ); } \
+					else             { bli_tscals( ch,ch,ch, *beta, c1[ ii*sm + jj*sn ] ); } \
+				} \
+\
+				off_m = bli_tcontract_mode_next_fiber( modes_m.ndim, modes_m.len, modes_m.stride[ 1 ], \
+				                                       idx_m, off_m ); \
+			} \
+\
+			off_n = bli_tcontract_mode_next_fiber( modes_n.ndim, modes_n.len, modes_n.stride[ 1 ], \
+			                                       idx_n, off_n ); \
+		} \
+\
+		return; \
+	} \
+\
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Create matrix objects describing the flattened operands. Their
+	   strides are placeholders (the packm kernel and microkernel wrapper
+	   locate elements via the mode descriptions), except that the storage
+	   of C is chosen to match the tensor's smallest stride so that the
+	   usual logic for matching the microkernel's storage preference (by
+	   transposing the operation) applies. */ \
+	obj_t alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t bo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t co     = BLIS_OBJECT_INITIALIZER; \
+\
+	const bool c_col = bli_abs( modes_m.stride[ 1 ][ 0 ] ) <= \
+	                   bli_abs( modes_n.stride[ 1 ][ 0 ] ); \
+\
+	bli_obj_init_finish_1x1( dt, ( void* )alpha, &alphao ); \
+	bli_obj_init_finish_1x1( dt, ( void* )beta,  &betao  ); \
+\
+	bli_obj_init_finish( dt, m, k, ( void* )a, 1, m, &ao ); \
+	bli_obj_init_finish( dt, k, n, ( void* )b, 1, k, &bo ); \
+	bli_obj_init_finish( dt, m, n,          c, \
+	                     ( c_col ? 1 : n ), ( c_col ? m : 1 ), &co ); \
+\
+	bli_obj_set_conj( conja, &ao ); \
+	bli_obj_set_conj( conjb, &bo ); \
+\
+	gemm_cntl_t cntl; \
+	bool swapped = bli_gemm_cntl_init \
+	( \
+	  BLIS_NAT, \
+	  BLIS_GEMM, \
+	  &alphao, \
+	  &ao, \
+	  &bo, \
+	  &betao, \
+	  &co, \
+	  cntx, \
+	  &cntl  \
+	); \
+\
+	/* Describe A (as m x k) and B (packed as its transpose, n x k). If the
+	   operation was transposed, the operand that will be packed as "A" is
+	   B, and vice versa. */ \
+	tcontract_params_t params_a, params_b, params_c; \
+\
+	params_a.buf = ( void* )a; \
+	bli_tcontract_modes_copy( &modes_m, 0, &params_a.ndim_r, params_a.len_r, params_a.stride_r ); \
+	bli_tcontract_modes_copy( &modes_k, 0, &params_a.ndim_c, params_a.len_c, params_a.stride_c ); \
+\
+	params_b.buf = ( void* )b; \
+	bli_tcontract_modes_copy( &modes_n, 0, &params_b.ndim_r, params_b.len_r, params_b.stride_r ); \
+	bli_tcontract_modes_copy( &modes_k, 1, &params_b.ndim_c, params_b.len_c, params_b.stride_c ); \
+\
+	/* Describe C, as m x n or, if the operation was transposed, n x m. */ \
+	params_c.buf = c; \
+	bli_tcontract_modes_copy( swapped ? &modes_n : &modes_m, 1, \
+	                          &params_c.ndim_r, params_c.len_r, params_c.stride_r ); \
+	bli_tcontract_modes_copy( swapped ? &modes_m : &modes_n, 1, \
+	                          &params_c.ndim_c, params_c.len_c, params_c.stride_c ); \
+\
+	/* Wrap the (virtual) microkernel that is called by the macrokernel. */ \
+	cntl_t* ker = ( cntl_t* )&cntl.ker; \
+\
+	params_c.row_pref = bli_gemm_var_cntl_row_pref( ker ); \
+	params_c.ukr      = bli_gemm_var_cntl_ukr( ker ); \
+	params_c.params   = bli_gemm_var_cntl_params( ker ); \
+\
+	func_t packm_ukr, gemm_ukr; \
+	bli_func_init_null( &packm_ukr ); \
+	bli_func_init_null( &gemm_ukr ); \
+	bli_func_set_dt( ( void_fp )PASTEMAC(ch,tcontract_packm), dt, &packm_ukr ); \
+	bli_func_set_dt( ( void_fp )PASTEMAC(ch,tcontract_gemm_ukr), dt, &gemm_ukr ); \
+\
+	bli_gemm_cntl_set_packa_ukr_simple( &packm_ukr, &cntl ); \
+	bli_gemm_cntl_set_packa_params( swapped ? &params_b : &params_a, &cntl ); \
+	bli_gemm_cntl_set_packb_ukr_simple( &packm_ukr, &cntl ); \
+	bli_gemm_cntl_set_packb_params( swapped ? &params_a : &params_b, &cntl ); \
+	bli_gemm_var_cntl_set_ukr_simple( &gemm_ukr, ker ); \
+	bli_gemm_var_cntl_set_params( &params_c, ker ); \
+\
+	bli_gemm_cntl_finalize \
+	( \
+	  BLIS_GEMM, \
+	  &ao, \
+	  &bo, \
+	  &co, \
+	  &cntl  \
+	); \
+\
+	/* Invoke the internal back-end via the thread handler. */ \
+	bli_l3_thread_decorator \
+	( \
+	  &ao, \
+	  &bo, \
+	  &co, \
+	  cntx, \
+	  ( cntl_t* )&cntl, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( tcontract )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t  conja, \
+             conj_t  conjb, \
+             dim_t   ndim_m, const dim_t* len_m, \
+             dim_t   ndim_n, const dim_t* len_n, \
+             dim_t   ndim_k, const dim_t* len_k, \
+       const ctype*  alpha, \
+       const ctype*  a, const inc_t* rs_a, const inc_t* cs_a, \
+       const ctype*  b, const inc_t* rs_b, const inc_t* cs_b, \
+       const ctype*  beta, \
+             ctype*  c, const inc_t* rs_c, const inc_t* cs_c  \
+     ) \
+{ \
+	PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+	( \
+	  conja, \
+	  conjb, \
+	  ndim_m, len_m, \
+	  ndim_n, len_n, \
+	  ndim_k, len_k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  NULL, \
+	  NULL  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( tcontract )
+
@@ -0,0 +1,218 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// A tensor contraction is described by three groups of modes (indices):
+// the m modes, shared by A and C; the n modes, shared by B and C; and the
+// k modes, shared by A and B, over which the contraction sums. Each group
+// is flattened into a single matrix dimension, so that
+//
+//   C( m, n ) := beta * C( m, n ) + alpha * conja( A( m, k ) ) conjb( B( k, n ) )
+//
+// but the operands are never copied into matrix form. Instead, the index
+// permutation is fused into the packing of A and B, and the microtiles
+// are written (or scattered) directly into C.
+//
+
+#ifndef BLIS_TCONTRACT_MAX_NDIM
+#define BLIS_TCONTRACT_MAX_NDIM 8
+#endif
+
+//
+// Parameter struct shared by the tcontract packm kernel and the tcontract
+// gemm microkernel wrapper. It describes a matrix view of a tensor: the
+// rows of the view run over the "r" modes and the columns over the "c"
+// modes, with the first mode of each group varying fastest.
+//
+
+typedef struct tcontract_params_s
+{
+	      void*  buf;
+
+	      dim_t  ndim_r;
+	      dim_t  len_r[ BLIS_TCONTRACT_MAX_NDIM ];
+	      inc_t  stride_r[ BLIS_TCONTRACT_MAX_NDIM ];
+
+	      dim_t  ndim_c;
+	      dim_t  len_c[ BLIS_TCONTRACT_MAX_NDIM ];
+	      inc_t  stride_c[ BLIS_TCONTRACT_MAX_NDIM ];
+
+	// The gemm microkernel (and its params) wrapped by the tcontract
+	// microkernel. These fields are unused by the packm kernel.
+	      bool   row_pref;
+	gemm_ukr_ft  ukr;
+	const void*  params;
+} tcontract_params_t;
+
+// Compute the multi-index idx of the linear index i within a group of
+// modes and return the corresponding offset.
+BLIS_INLINE inc_t bli_tcontract_mode_off
+     (
+             dim_t  ndim,
+       const dim_t* len,
+       const inc_t* stride,
+             dim_t  i,
+             dim_t* idx
+     )
+{
+	inc_t off = 0;
+
+	for ( dim_t d = 0; d < ndim; ++d )
+	{
+		idx[ d ] = i % len[ d ];
+		i        = i / len[ d ];
+		off     += idx[ d ] * stride[ d ];
+	}
+
+	return off;
+}
+
+// Advance the multi-index idx to the beginning of the next fiber along the
+// first mode and return the corresponding offset (given the offset off of
+// the current multi-index).
+BLIS_INLINE inc_t bli_tcontract_mode_next_fiber
+     (
+             dim_t  ndim,
+       const dim_t* len,
+       const inc_t* stride,
+             dim_t* idx,
+             inc_t  off
+     )
+{
+	off     -= idx[ 0 ] * stride[ 0 ];
+	idx[ 0 ] = 0;
+
+	for ( dim_t d = 1; d < ndim; ++d )
+	{
+		off += stride[ d ];
+		if ( ++idx[ d ] < len[ d ] ) return off;
+
+		off     -= len[ d ] * stride[ d ];
+		idx[ d ] = 0;
+	}
+
+	return off;
+}
+
+
+//
+// Prototype BLAS-like interfaces with typed operands.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+             conj_t  conja, \
+             conj_t  conjb, \
+             dim_t   ndim_m, const dim_t* len_m, \
+             dim_t   ndim_n, const dim_t* len_n, \
+             dim_t   ndim_k, const dim_t* len_k, \
+       const ctype*  alpha, \
+       const ctype*  a, const inc_t* rs_a, const inc_t* cs_a, \
+       const ctype*  b, const inc_t* rs_b, const inc_t* cs_b, \
+       const ctype*  beta, \
+             ctype*  c, const inc_t* rs_c, const inc_t* cs_c  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             conj_t  conja, \
+             conj_t  conjb, \
+             dim_t   ndim_m, const dim_t* len_m, \
+             dim_t   ndim_n, const dim_t* len_n, \
+             dim_t   ndim_k, const dim_t* len_k, \
+       const ctype*  alpha, \
+       const ctype*  a, const inc_t* rs_a, const inc_t* cs_a, \
+       const ctype*  b, const inc_t* rs_b, const inc_t* cs_b, \
+       const ctype*  beta, \
+             ctype*  c, const inc_t* rs_c, const inc_t* cs_c, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( tcontract )
+
+
+//
+// Prototype the tcontract packm kernel and gemm microkernel wrapper.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             struc_t strucc, \
+             diag_t  diagc, \
+             uplo_t  uploc, \
+             conj_t  conjc, \
+             pack_t  schema, \
+             bool    invdiag, \
+             dim_t   panel_dim, \
+             dim_t   panel_len, \
+             dim_t   panel_dim_max, \
+             dim_t   panel_len_max, \
+             dim_t   panel_dim_off, \
+             dim_t   panel_len_off, \
+             dim_t   panel_bcast, \
+       const void*   kappa, \
+       const void*   c, inc_t incc, inc_t ldc, \
+             void*   p,             inc_t ldp, \
+       const void*   params, \
+       const cntx_t* cntx \
+     );
+
+INSERT_GENTPROT_BASIC( tcontract_packm )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha, \
+       const void*      a, \
+       const void*      b, \
+       const void*      beta, \
+             void*      c, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( tcontract_gemm_ukr )
+
@@ -0,0 +1,259 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             struc_t strucc, \
+             diag_t  diagc, \
+             uplo_t  uploc, \
+             conj_t  conjc, \
+             pack_t  schema, \
+             bool    invdiag, \
+             dim_t   panel_dim, \
+             dim_t   panel_len, \
+             dim_t   panel_dim_max, \
+             dim_t   panel_len_max, \
+             dim_t   panel_dim_off, \
+             dim_t   panel_len_off, \
+             dim_t   panel_bcast, \
+       const void*   kappa, \
+       const void*   c, inc_t incc, inc_t ldc, \
+             void*   p,             inc_t ldp, \
+       const void*   params, \
+       const cntx_t* cntx \
+     ) \
+{ \
+	const num_t               dt     = PASTEMAC(ch,type); \
+	const tcontract_params_t* tp     = params; \
+	const ctype*              c_cast = tp->buf; \
+	      ctype*              p_cast = p; \
+\
+	packm_cxk_ker_ft f_cxk = bli_cntx_get_ukr_dt( dt, BLIS_PACKM_KER, cntx ); \
+\
+	/* The matrix view c (and its strides) is a placeholder; the elements
+	   of the micropanel are located via the mode descriptions in params
+	   and the absolute offsets of the micropanel. */ \
+	( void )c; ( void )incc; ( void )ldc; \
+\
+	dim_t idx_r[ BLIS_TCONTRACT_MAX_NDIM ]; \
+	dim_t idx_c[ BLIS_TCONTRACT_MAX_NDIM ]; \
+\
+	inc_t off_r = bli_tcontract_mode_off( tp->ndim_r, tp->len_r, tp->stride_r, \
+	                                      panel_dim_off, idx_r ); \
+\
+	/* Split the micropanel into blocks in which both the rows and the
+	   columns lie within a single fiber (and thus have a constant stride),
+	   and pack each block with the context's packm kernel. Usually the
+	   leading fibers are long enough that there is only one block of rows
+	   and a few blocks of columns. */ \
+	for ( dim_t i = 0; i < panel_dim; ) \
+	{ \
+		const dim_t m_seg = bli_min( tp->len_r[ 0 ] - idx_r[ 0 ], panel_dim - i ); \
+\
+		inc_t off_c = bli_tcontract_mode_off( tp->ndim_c, tp->len_c, tp->stride_c, \
+		                                      panel_len_off, idx_c ); \
+\
+		for ( dim_t j = 0; j < panel_len; ) \
+		{ \
+			const dim_t n_seg = bli_min( tp->len_c[ 0 ] - idx_c[ 0 ], panel_len - j ); \
+\
+			f_cxk \
+			( \
+			  conjc, \
+			  schema, \
+			  m_seg, \
+			  m_seg, \
+			  panel_bcast, \
+			  n_seg, \
+			  n_seg, \
+			  kappa, \
+			  c_cast + off_r + off_c, tp->stride_r[ 0 ], tp->stride_c[ 0 ], \
+			  p_cast + i*panel_bcast + j*ldp, ldp, \
+			  NULL, \
+			  cntx  \
+			); \
+\
+			j    += n_seg; \
+			off_c = bli_tcontract_mode_next_fiber( tp->ndim_c, tp->len_c, tp->stride_c, \
+			                                       idx_c, off_c ); \
+		} \
+\
+		i    += m_seg; \
+		off_r = bli_tcontract_mode_next_fiber( tp->ndim_r, tp->len_r, tp->stride_r, \
+		                                       idx_r, off_r ); \
+	} \
+\
+	bli_tset0s_edge \
+	( \
+	  ch, \
+	  panel_dim*panel_bcast, panel_dim_max*panel_bcast, \
+	  panel_len, panel_len_max, \
+	  p_cast, ldp \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( tcontract_packm )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha, \
+       const void*      a, \
+       const void*      b, \
+       const void*      beta, \
+             void*      c, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const num_t               dt        = PASTEMAC(ch,type); \
+	const tcontract_params_t* tp        = bli_auxinfo_params( data ); \
+	      ctype*              c_cast    = tp->buf; \
+	const ctype*              beta_cast = beta; \
+\
+	/* As with packing, the matrix view c is only a placeholder. */ \
+	( void )c; ( void )rs_c; ( void )cs_c; \
+\
+	/* Restore the params of the wrapped microkernel. */ \
+	auxinfo_t aux = *data; \
+	bli_auxinfo_set_params( tp->params, &aux ); \
+\
+	const dim_t off_m = bli_auxinfo_off_m( data ); \
+	const dim_t off_n = bli_auxinfo_off_n( data ); \
+\
+	dim_t idx_r[ BLIS_TCONTRACT_MAX_NDIM ]; \
+	dim_t idx_c[ BLIS_TCONTRACT_MAX_NDIM ]; \
+\
+	inc_t off_r = bli_tcontract_mode_off( tp->ndim_r, tp->len_r, tp->stride_r, off_m, idx_r ); \
+	inc_t off_c = bli_tcontract_mode_off( tp->ndim_c, tp->len_c, tp->stride_c, off_n, idx_c ); \
+\
+	/* If the microtile lies within a single fiber in both dimensions, it
+	   is an ordinary strided matrix, so the microkernel may update it in
+	   place. */ \
+	if ( idx_r[ 0 ] + m <= tp->len_r[ 0 ] && \
+	     idx_c[ 0 ] + n <= tp->len_c[ 0 ] ) \
+	{ \
+		tp->ukr \
+		( \
+		  m, \
+		  n, \
+		  k, \
+		  alpha, \
+		  a, \
+		  b, \
+		  beta, \
+		  c_cast + off_r + off_c, tp->stride_r[ 0 ], tp->stride_c[ 0 ], \
+		  &aux, \
+		  cntx  \
+		); \
+		return; \
+	} \
+\
+	/* Otherwise, compute the microtile into a temporary buffer and then
+	   scatter it into C. */ \
+	ctype ct[ BLIS_STACK_BUF_MAX_SIZE / sizeof( ctype ) ] \
+	         __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t rs_ct = ( tp->row_pref ? n : 1 ); \
+	const inc_t cs_ct = ( tp->row_pref ? 1 : m ); \
+\
+	tp->ukr \
+	( \
+	  m, \
+	  n, \
+	  k, \
+	  alpha, \
+	  a, \
+	  b, \
+	  bli_obj_buffer_for_const( dt, &BLIS_ZERO ), \
+	  ct, rs_ct, cs_ct, \
+	  &aux, \
+	  cntx  \
+	); \
+\
+	const bool  beta_zero = bli_teq0s( ch, *beta_cast ); \
+	const inc_t sr        = tp->stride_r[ 0 ]; \
+	const inc_t sc        = tp->stride_c[ 0 ]; \
+\
+	for ( dim_t j = 0; j < n; ) \
+	{ \
+		const dim_t n_seg = bli_min( tp->len_c[ 0 ] - idx_c[ 0 ], n - j ); \
+\
+		off_r = bli_tcontract_mode_off( tp->ndim_r, tp->len_r, tp->stride_r, off_m, idx_r ); \
+\
+		for ( dim_t i = 0; i < m; ) \
+		{ \
+			const dim_t m_seg = bli_min( tp->len_r[ 0 ] - idx_r[ 0 ], m - i ); \
+\
+			      ctype* restrict c1  = c_cast + off_r + off_c; \
+			const ctype* restrict ct1 = ct + i*rs_ct + j*cs_ct; \
+\
+			if ( beta_zero ) \
+			{ \
+				for ( dim_t jj = 0; jj < n_seg; ++jj ) \
+				for ( dim_t ii = 0; ii < m_seg; ++ii ) \
+					bli_tcopys( ch,ch, ct1[ ii*rs_ct + jj*cs_ct ], \
+					                   c1[ ii*sr + jj*sc ] ); \
+			} \
+			else \
+			{ \
+				for ( dim_t jj = 0; jj < n_seg; ++jj ) \
+				for ( dim_t ii = 0; ii < m_seg; ++ii ) \
+					bli_txpbys( ch,ch,ch,ch, ct1[ ii*rs_ct + jj*cs_ct ], *beta_cast, \
+					                         c1[ ii*sr + jj*sc ] ); \
+			} \
+\
+			i    += m_seg; \
+			off_r = bli_tcontract_mode_next_fiber( tp->ndim_r, tp->len_r, tp->stride_r, \
+			                                       idx_r, off_r ); \
+		} \
+\
+		j    += n_seg; \
+		off_c = bli_tcontract_mode_next_fiber( tp->ndim_c, tp->len_c, tp->stride_c, \
+		                                       idx_c, off_c ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( tcontract_gemm_ukr )
+
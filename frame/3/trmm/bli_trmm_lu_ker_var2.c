@@ -97,6 +97,7 @@ void bli_trmm_lu_ker_var2
 	// Query the context for the micro-kernel address and cast it to its
 	// function pointer type.
 	gemm_ukr_ft gemm_ukr   = bli_gemm_var_cntl_ukr( cntl );
+	gemm_ukr_ft edge_ukr   = bli_gemm_var_cntl_edge_ukr( cntl );
 	const void* params     = bli_gemm_var_cntl_params( cntl );
 
 	const void* one        = bli_obj_buffer_for_const( dt_comp, &BLIS_ONE );
@@ -263,7 +264,7 @@ void bli_trmm_lu_ker_var2
 				bli_auxinfo_set_next_b( b2, &aux );
 
 				// Invoke the gemm micro-kernel.
-				gemm_ukr
+				( m_cur == MR && n_cur == NR ? gemm_ukr : edge_ukr )
 				(
 				  m_cur,
 				  n_cur,
@@ -301,7 +302,7 @@ void bli_trmm_lu_ker_var2
 				bli_auxinfo_set_next_b( b2, &aux );
 
 				// Invoke the gemm micro-kernel.
-				gemm_ukr
+				( m_cur == MR && n_cur == NR ? gemm_ukr : edge_ukr )
 				(
 				  m_cur,
 				  n_cur,
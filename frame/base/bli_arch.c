@@ -229,6 +229,12 @@ arch_t bli_arch_query_id_impl( void )
 		#endif
 
 		// AMD microarchitectures.
+		#ifdef BLIS_FAMILY_ZEN5
+		id = BLIS_ARCH_ZEN5;
+		#endif
+		#ifdef BLIS_FAMILY_ZEN4
+		id = BLIS_ARCH_ZEN4;
+		#endif
 		#ifdef BLIS_FAMILY_ZEN3
 		id = BLIS_ARCH_ZEN3;
 		#endif
@@ -355,6 +361,8 @@ static const char* config_name[ BLIS_NUM_ARCHS ] =
     "sandybridge",
     "penryn",
 
+    "zen5",
+    "zen4",
     "zen3",
     "zen2",
     "zen",
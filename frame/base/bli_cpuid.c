@@ -132,6 +132,14 @@ arch_t bli_cpuid_query_id( void )
 
 		// Check for each AMD configuration that is enabled, check for that
 		// microarchitecture. We check from most recent to most dated.
+#ifdef BLIS_CONFIG_ZEN5
+		if ( bli_cpuid_is_zen5( family, model, features ) )
+			return BLIS_ARCH_ZEN5;
+#endif
+#ifdef BLIS_CONFIG_ZEN4
+		if ( bli_cpuid_is_zen4( family, model, features ) )
+			return BLIS_ARCH_ZEN4;
+#endif
 #ifdef BLIS_CONFIG_ZEN3
 		if ( bli_cpuid_is_zen3( family, model, features ) )
 			return BLIS_ARCH_ZEN3;
@@ -283,6 +291,76 @@ bool bli_cpuid_is_penryn
 
 // -----------------------------------------------------------------------------
 
+bool bli_cpuid_is_zen5
+     (
+       uint32_t family,
+       uint32_t model,
+       uint32_t features
+     )
+{
+	// Check for expected CPU features.
+	const uint32_t expected = FEATURE_AVX      |
+	                          FEATURE_FMA3     |
+	                          FEATURE_AVX2     |
+	                          FEATURE_AVX512F  |
+	                          FEATURE_AVX512DQ |
+	                          FEATURE_AVX512BW |
+	                          FEATURE_AVX512VL ;
+
+	if ( !bli_cpuid_has_features( features, expected ) ) return FALSE;
+
+	// All Zen5 cores have a family of 0x1a.
+	if ( family != 0x1a ) return FALSE;
+
+	// Finally, check for specific models:
+	// - 0x00 ~ 0xff
+	// NOTE: We accept any model because the family 26 (0x1a) is unique.
+	const bool is_arch
+	=
+	( 0x00 <= model && model <= 0xff );
+
+	if ( !is_arch ) return FALSE;
+
+	return TRUE;
+}
+
+bool bli_cpuid_is_zen4
+     (
+       uint32_t family,
+       uint32_t model,
+       uint32_t features
+     )
+{
+	// Check for expected CPU features.
+	const uint32_t expected = FEATURE_AVX      |
+	                          FEATURE_FMA3     |
+	                          FEATURE_AVX2     |
+	                          FEATURE_AVX512F  |
+	                          FEATURE_AVX512DQ |
+	                          FEATURE_AVX512BW |
+	                          FEATURE_AVX512VL ;
+
+	if ( !bli_cpuid_has_features( features, expected ) ) return FALSE;
+
+	// All Zen4 cores have a family of 0x19.
+	if ( family != 0x19 ) return FALSE;
+
+	// Finally, check for specific models:
+	// - 0x10 ~ 0x1f
+	// - 0x60 ~ 0xaf
+	// NOTE: We must check model because the family 25 (0x19) is shared with
+	// zen3. The AVX-512 check above also rules out zen3, which lacks it, and
+	// allows a zen4 part with AVX-512 disabled to fall back to zen3.
+	const bool is_arch
+	=
+	( 0x10 <= model && model <= 0x1f ) ||
+	( 0x60 <= model && model <= 0xaf );
+
+	if ( !is_arch ) return FALSE;
+
+	return TRUE;
+}
+
 bool bli_cpuid_is_zen3
      (
        uint32_t family,
@@ -302,7 +380,8 @@ bool bli_cpuid_is_zen3
 
 	// Finally, check for specific models:
 	// - 0x00 ~ 0xff
-	// NOTE: We accept any model because the family 25 (0x19) is unique.
+	// NOTE: We accept any model because zen4, which shares the family 25
+	// (0x19), is checked first (and falls back to zen3 if it is disabled).
 	const bool is_arch
 	=
 	( 0x00 <= model && model <= 0xff );
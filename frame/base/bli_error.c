@@ -93,6 +93,8 @@ static const char *bli_error_string[-BLIS_ERROR_CODE_MAX] =
 
 	[-BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_UNPACK] = "Pack schema not yet supported/implemented for use with unpacking.",
 	[-BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART]   = "Pack schema not yet supported/implemented for use with partitioning.",
+	[-BLIS_PACKED_PART_NOT_PANEL_ALIGNED]        = "Partition of packed object does not begin at a micro-panel boundary.",
+	[-BLIS_PACKED_OPERAND_MISMATCH]              = "Packed operand does not match the micro-panel format expected by the operation.",
 
 	[-BLIS_EXPECTED_NONNULL_OBJECT_BUFFER]       = "Encountered object with non-zero dimensions containing null buffer.",
 
@@ -105,6 +107,7 @@ static const char *bli_error_string[-BLIS_ERROR_CODE_MAX] =
 	[-BLIS_ALIGNMENT_NOT_MULT_OF_PTR_SIZE]       = "Encountered memory alignment value that is not a multiple of sizeof(void*).",
 
 	[-BLIS_EXPECTED_OBJECT_ALIAS]                = "Expected object to be alias.",
+	[-BLIS_INCONSISTENT_BATCH_OPERANDS]          = "Expected the operands of all problems in a batch to differ only in their buffers.",
 
 	[-BLIS_INVALID_ARCH_ID]                      = "Invalid architecture id value.",
 	[-BLIS_UNINITIALIZED_GKS_CNTX]               = "Accessed uninitialized context in gks; BLIS_ARCH_TYPE is probably set to an invalid architecture id.",
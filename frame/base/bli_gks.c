@@ -43,10 +43,18 @@ static cntx_t* gks[ BLIS_NUM_ARCHS ];
 // Define a function pointer type for context initialization functions.
 typedef void (*cntx_init_ft)( cntx_t* cntx );
 
+// The array of function pointers holding the registered context initialization
+// functions for native kernels. The native contexts themselves are only
+// allocated and initialized the first time they are looked up.
+static cntx_init_ft cntx_nat_init[ BLIS_NUM_ARCHS ];
+
 // The array of function pointers holding the registered context initialization
 // functions for reference kernels.
 static cntx_init_ft cntx_ref_init[ BLIS_NUM_ARCHS ];
 
+// A mutex to serialize the (lazy) initialization of native contexts.
+static bli_pthread_mutex_t gks_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
 // Cached copies of the pointers to the native context for the
 // active subconfiguration. When BLIS_ENABLE_GKS_CACHING is enabled, these
 // pointers will be set once and then reused to fulfill subsequent context
@@ -66,7 +74,10 @@ int bli_gks_init( void )
 	bli_gks_init_index();
 
 	// Register a context for each architecture that was #define'd in
-	// bli_config.h.
+	// bli_config.h. This only records the initialization functions; the
+	// context for a given architecture is not built until it is first
+	// queried, so that a library configured for many architectures only
+	// pays for the one that is actually used.
 
 	#undef GENTCONF
 	#define GENTCONF( CONFIG, config ) \
@@ -106,8 +117,8 @@ int bli_gks_finalize( void )
 		{
 			cntx_t* gks_id = gks[ id ];
 
-			// Only consider context arrays for architectures that were allocated
-			// in the first place.
+			// Only consider contexts for architectures that were actually
+			// queried (and thus allocated) since bli_gks_init().
 			if ( gks_id != NULL )
 			{
 				#ifdef BLIS_ENABLE_MEM_TRACING
@@ -143,6 +154,7 @@ void bli_gks_init_index( void )
 	// zero/NULL. This is done so that later on we know which ones were
 	// allocated.
 	memset( gks,           0, gks_size );
+	memset( cntx_nat_init, 0, fpa_size );
 	memset( cntx_ref_init, 0, fpa_size );
 }
 
@@ -153,10 +165,9 @@ const cntx_t* bli_gks_lookup_id
        arch_t id
      )
 {
-	// Return the address of the array of context pointers for a given
-	// architecture id. This function is only used for sanity check purposes
-	// to ensure that the underlying data structures for a particular id are
-	// initialized.
+	// Return the address of the native context for a given architecture id,
+	// initializing the context first if this is the first time it has been
+	// looked up. NULL is returned if no context was registered for the id.
 
 	// Sanity check: verify that the arch_t id is valid.
 	if ( bli_error_checking_is_enabled() )
@@ -166,7 +177,25 @@ const cntx_t* bli_gks_lookup_id
 	}
 
 	// Index into the array of context pointers for the given architecture id.
-	return gks[ id ];
+	cntx_t* cntx = __atomic_load_n( &gks[ id ], __ATOMIC_ACQUIRE );
+
+	if ( cntx == NULL && cntx_nat_init[ id ] != NULL )
+	{
+		// BEGIN CRITICAL SECTION
+		bli_pthread_mutex_lock( &gks_mutex );
+		{
+			// Check again in case another thread initialized the context
+			// while we were waiting for the lock.
+			if ( gks[ id ] == NULL )
+				bli_gks_init_cntx( id );
+
+			cntx = gks[ id ];
+		}
+		bli_pthread_mutex_unlock( &gks_mutex );
+		// END CRITICAL SECTION
+	}
+
+	return cntx;
 }
 
 // -----------------------------------------------------------------------------
@@ -178,8 +207,6 @@ void bli_gks_register_cntx
        void_fp ref_fp
      )
 {
-	err_t e_val;
-
 	// This function is called by bli_gks_init() for each architecture that
 	// will be supported by BLIS. It takes an architecture id and two
 	// function pointers, one to a function that initializes a native context
@@ -190,40 +217,42 @@ void bli_gks_register_cntx
 	// ever store reference contexts. For this reason, we
 	// can get away with only storing the pointers to the initialization
 	// functions for this type of context, which we can then
-	// call at a later time when the reference context is needed.
+	// call at a later time when the reference context is needed. The native
+	// context is likewise not initialized here, but rather by
+	// bli_gks_init_cntx() the first time it is looked up.
 
 	// Sanity check: verify that the arch_t id is valid.
 	if ( bli_error_checking_is_enabled() )
 	{
-		e_val = bli_check_valid_arch_id( id );
+		err_t e_val = bli_check_valid_arch_id( id );
 		bli_check_error_code( e_val );
 	}
 
-	cntx_init_ft f = nat_fp;
-
-	// First, store the function pointer to the context initialization
-	// function for reference kernels. This
-	// will be used whenever we need to obtain reference kernels.
+	cntx_nat_init[ id ] = nat_fp;
 	cntx_ref_init[ id ] = ref_fp;
+}
 
-	// If the the context array pointer isn't NULL, then it means the given
-	// architecture id has already registered (and the underlying memory
-	// allocations and context initializations have already been performed).
-	// This is really just a safety feature to prevent memory leaks; this
-	// early return should never occur, because the caller should never try
-	// to register with an architecture id that has already been registered.
-	if ( gks[ id ] != NULL ) return;
+// -----------------------------------------------------------------------------
+
+void bli_gks_init_cntx
+     (
+       arch_t id
+     )
+{
+	err_t e_val;
+
+	// This function is called by bli_gks_lookup_id() (with gks_mutex held)
+	// the first time the native context for the given architecture id is
+	// needed.
+
+	cntx_init_ft f = cntx_nat_init[ id ];
 
 	#ifdef BLIS_ENABLE_MEM_TRACING
-	printf( "bli_gks_register_cntx(): " );
+	printf( "bli_gks_init_cntx(): " );
 	#endif
 
-	// Allocate memory for a single context and store the address at
-	// the element in the gks[ id ] array that is reserved for native
-	// execution.
+	// Allocate memory for a single context.
 	cntx_t* gks_id = bli_calloc_intl( sizeof( cntx_t ), &e_val );
-	gks[ id ] = gks_id;
-
 	// The context structure is initialied in bli_cntx_init_<config>_ref
 
 	// Call the context initialization function on the element of the newly
@@ -269,6 +298,9 @@ void bli_gks_register_cntx
 	// relative to the maximum stack buffer size defined at configure-time.
 	e_val = bli_check_sufficient_stack_buf_size( gks_id );
 	bli_check_error_code( e_val );
+
+	// Publish the fully initialized context.
+	__atomic_store_n( &gks[ id ], gks_id, __ATOMIC_RELEASE );
 }
 
 // -----------------------------------------------------------------------------
@@ -43,6 +43,7 @@ void                           bli_gks_init_index( void );
 
 BLIS_EXPORT_BLIS const cntx_t* bli_gks_lookup_id( arch_t id );
 void                           bli_gks_register_cntx( arch_t id, void_fp nat_fp, void_fp ref_fp );
+void                           bli_gks_init_cntx( arch_t id );
 
 BLIS_EXPORT_BLIS const cntx_t* bli_gks_query_cntx( void );
 const cntx_t*                  bli_gks_query_cntx_noinit( void );
@@ -38,6 +38,7 @@ static const char* bli_ind_impl_str[BLIS_NUM_IND_METHODS] =
 {
 /* 1m   */ "1m",
 /* nat  */ "native",
+/* 3m   */ "3m",
 };
 
 // -----------------------------------------------------------------------------
@@ -83,6 +83,7 @@ static bli_pthread_switch_t thread_g_state = BLIS_PTHREAD_SWITCH_INIT;
 static BLIS_THREAD_LOCAL
        bli_pthread_switch_t rntm_l_state   = BLIS_PTHREAD_SWITCH_INIT;
 static bli_pthread_switch_t memsys_g_state = BLIS_PTHREAD_SWITCH_INIT;
+static bli_pthread_switch_t jit_g_state    = BLIS_PTHREAD_SWITCH_INIT;
 
 int bli_init_apis( void )
 {
@@ -92,6 +93,7 @@ int bli_init_apis( void )
 	bli_pthread_switch_on( &thread_g_state, bli_thread_init );
 	bli_pthread_switch_on( &rntm_l_state,   bli_rntm_init );
 	bli_pthread_switch_on( &memsys_g_state, bli_memsys_init );
+	bli_pthread_switch_on( &jit_g_state,    bli_jit_init );
 
 	return 0;
 }
@@ -99,6 +101,7 @@ int bli_init_apis( void )
 int bli_finalize_apis( void )
 {
 	// Finalize various sub-APIs.
+	bli_pthread_switch_off( &jit_g_state,    bli_jit_finalize );
 	bli_pthread_switch_off( &memsys_g_state, bli_memsys_finalize );
 	bli_pthread_switch_off( &rntm_l_state,   bli_rntm_finalize );
 	bli_pthread_switch_off( &thread_g_state, bli_thread_finalize );
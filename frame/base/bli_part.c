@@ -38,6 +38,41 @@
 // -- Matrix partitioning ------------------------------------------------------
 
 
+static void bli_acquire_mpart_fold_panels
+     (
+       obj_t* sub_obj
+     )
+{
+	const dim_t m_part = bli_obj_length( sub_obj );
+	const dim_t n_part = bli_obj_width( sub_obj );
+	const dim_t pd     = bli_obj_panel_dim( sub_obj );
+	const inc_t ps     = bli_obj_panel_stride( sub_obj );
+	      dim_t off_m  = bli_obj_row_off( sub_obj );
+	      dim_t off_n  = bli_obj_col_off( sub_obj );
+	      dim_t off_p;
+
+	// Identify the offset along the dimension in which the micro-panels are
+	// laid out. The offset along the other dimension indexes within each
+	// micro-panel and is handled through the strides, as usual.
+	if      ( bli_obj_is_packed_along_m( sub_obj ) ) { off_p = off_m; off_m = 0; }
+	else if ( bli_obj_is_packed_along_n( sub_obj ) ) { off_p = off_n; off_n = 0; }
+	else return;
+
+	// Empty partitions (e.g. the remainder beyond the last micro-panel) are
+	// never referenced, so there is nothing to fold.
+	if ( off_p == 0 || m_part == 0 || n_part == 0 ) return;
+
+	if ( off_p % pd != 0 )
+		bli_check_error_code( BLIS_PACKED_PART_NOT_PANEL_ALIGNED );
+
+	char* buf = bli_obj_buffer( sub_obj );
+	buf += ( off_p / pd ) * ps * bli_obj_elem_size( sub_obj );
+
+	bli_obj_set_buffer( buf, sub_obj );
+	bli_obj_set_offs( off_m, off_n, sub_obj );
+}
+
+
 void bli_acquire_mpart
      (
              dim_t  i,
@@ -125,13 +160,6 @@ void bli_acquire_mpart_mdim
 	inc_t  offn_inc = 0;
 
 
-	// Call a special function for partitioning packed objects. (By only
-	// catching those objects packed to panels, we omit cases where the
-	// object is packed to row or column storage, as such objects can be
-	// partitioned through normally.) Note that the function called below
-	// assumes forward partitioning.
-	if ( bli_obj_is_panel_packed( obj ) )
-		bli_check_error_code( BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART );
 
 
 	// Check parameters.
@@ -257,6 +285,14 @@ void bli_acquire_mpart_mdim
 	}
 
 
+	// Objects packed to micro-panels (such as the packed matrices of
+	// bli_obj_create_packed()) may be partitioned along the dimension
+	// in which their micro-panels are laid out only at micro-panel
+	// boundaries, which we fold into the buffer address.
+	if ( bli_obj_is_panel_packed( sub_obj ) )
+		bli_acquire_mpart_fold_panels( sub_obj );
+
+
 	// If the root matrix is not general (ie: has structure defined by the
 	// diagonal), and the subpartition does not intersect the root matrix's
 	// diagonal, then set the subpartition structure to "general"; otherwise
@@ -345,13 +381,6 @@ void bli_acquire_mpart_ndim
 	inc_t  offn_inc = 0;
 
 
-	// Call a special function for partitioning packed objects. (By only
-	// catching those objects packed to panels, we omit cases where the
-	// object is packed to row or column storage, as such objects can be
-	// partitioned through normally.) Note that the function called below
-	// assumes forward partitioning.
-	if ( bli_obj_is_panel_packed( obj ) )
-		bli_check_error_code( BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART );
 
 
 	// Check parameters.
@@ -477,6 +506,14 @@ void bli_acquire_mpart_ndim
 	}
 
 
+	// Objects packed to micro-panels (such as the packed matrices of
+	// bli_obj_create_packed()) may be partitioned along the dimension
+	// in which their micro-panels are laid out only at micro-panel
+	// boundaries, which we fold into the buffer address.
+	if ( bli_obj_is_panel_packed( sub_obj ) )
+		bli_acquire_mpart_fold_panels( sub_obj );
+
+
 	// If the root matrix is not general (ie: has structure defined by the
 	// diagonal), and the subpartition does not intersect the root matrix's
 	// diagonal, then we might need to modify some of the subpartition's
@@ -110,6 +110,7 @@ void bli_rntm_init_from_env
 		else if ( !strncmp( ti_env, "pthread",  7 ) ) ti = BLIS_POSIX;
 		else if ( !strncmp( ti_env, "posix",    5 ) ) ti = BLIS_POSIX;
 		else if ( !strncmp( ti_env, "hpx",      3 ) ) ti = BLIS_HPX;
+		else if ( !strncmp( ti_env, "custom",   6 ) ) ti = BLIS_CUSTOM;
 		else                                          ti = BLIS_SINGLE;
 
 		#ifdef PRINT_IMPL
@@ -421,6 +422,57 @@ void bli_rntm_sanitize
 #endif
 }
 
+// -----------------------------------------------------------------------------
+
+#ifdef BLIS_ENABLE_MULTITHREADING
+static dim_t bli_rntm_num_l3
+     (
+             dim_t   nt,
+       const rntm_t* rntm
+     )
+{
+	// Only the pthreads implementation pins its threads (see
+	// bli_thread_affinity.h).
+	if ( bli_rntm_thread_impl( rntm ) != BLIS_POSIX ) return 1;
+
+	return bli_thread_affinity_num_l3( nt );
+}
+
+static void bli_rntm_govern
+     (
+       rntm_t* rntm
+     )
+{
+	// Reserve threads for the upcoming level-3 call from the process-wide
+	// budget (see bli_thread_set_budget()). The number of threads implied by
+	// the rntm_t is the number requested: either the total, which is yet to
+	// be factorized, or the product of the ways that were set explicitly.
+	dim_t nt_req = bli_rntm_num_threads( rntm );
+
+	if ( !bli_rntm_auto_factor( rntm ) )
+		nt_req = bli_rntm_jc_ways( rntm ) * bli_rntm_pc_ways( rntm ) *
+		         bli_rntm_ic_ways( rntm ) * bli_rntm_jr_ways( rntm ) *
+		         bli_rntm_ir_ways( rntm );
+
+	// A grant of zero means that no budget is in effect; otherwise, the grant
+	// must be returned by the thread decorator once the call completes.
+	dim_t grant = bli_thread_budget_acquire( nt_req );
+
+	bli_rntm_set_budget_grant_only( grant, rntm );
+
+	if ( 0 < grant && grant < nt_req )
+	{
+		// Other callers already occupy part of the budget, so we shrink this
+		// call to the threads that were granted. Any explicit ways no longer
+		// multiply out correctly, so we fall back to an automatic
+		// factorization of the granted threads.
+		bli_rntm_set_num_threads_only( grant, rntm );
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, rntm );
+		bli_rntm_set_auto_factor_only( 1 < grant, rntm );
+	}
+}
+#endif
+
 void bli_rntm_factorize
      (
        dim_t   m,
@@ -429,6 +481,24 @@ void bli_rntm_factorize
        rntm_t* rntm
      )
 {
+#ifdef BLIS_ENABLE_MULTITHREADING
+
+	// Shrink the request, if needed, to stay within the thread budget.
+	bli_rntm_govern( rntm );
+
+#endif
+
+	bli_rntm_factorize_ways( m, n, k, rntm );
+}
+
+void bli_rntm_factorize_ways
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       rntm_t* rntm
+     )
+{
 #ifdef BLIS_ENABLE_MULTITHREADING
 
 	// The .auto_factor field would have been set either at initialization or
@@ -454,12 +524,19 @@ void bli_rntm_factorize
 			if ( bli_is_prime( nt ) && BLIS_NT_MAX_PRIME < nt ) nt -= 1;
 			#endif
 
+			// If the threads are pinned to CPUs spanning several L3 caches, we
+			// factorize the threads of one cache and then let the jc loop span
+			// the caches, so that the threads sharing a packed block of B also
+			// share an L3 cache.
+			dim_t n_l3 = bli_rntm_num_l3( nt, rntm );
+
 			//printf( "m n = %d %d  BLIS_THREAD_RATIO_M _N = %d %d\n",
 			//         (int)m, (int)n, (int)BLIS_THREAD_RATIO_M,
 			//                         (int)BLIS_THREAD_RATIO_N );
 
-			bli_thread_partition_2x2( nt, m*BLIS_THREAD_RATIO_M,
-			                              n*BLIS_THREAD_RATIO_N, &ic, &jc );
+			bli_thread_partition_2x2( nt / n_l3, m*BLIS_THREAD_RATIO_M,
+			                              bli_max( n / n_l3, 1 )*BLIS_THREAD_RATIO_N,
+			                              &ic, &jc );
 
 			//printf( "jc ic = %d %d\n", (int)jc, (int)ic );
 
@@ -472,6 +549,8 @@ void bli_rntm_factorize
 			{
 				if ( jc % jr == 0 ) { jc /= jr; break; }
 			}
+
+			jc *= n_l3;
 		}
 
 		// Save the results back in the rntm_t object.
@@ -498,6 +577,9 @@ void bli_rntm_factorize_sup
 {
 #ifdef BLIS_ENABLE_MULTITHREADING
 
+	// Shrink the request, if needed, to stay within the thread budget.
+	bli_rntm_govern( rntm );
+
 	// The .auto_factor field would have been set either at initialization or
 	// when the rntm_t was sanitized after being updated by the user.
 	if ( bli_rntm_auto_factor( rntm ) )
@@ -521,8 +603,13 @@ void bli_rntm_factorize_sup
 			if ( bli_is_prime( nt ) && BLIS_NT_MAX_PRIME < nt ) nt -= 1;
 			#endif
 
-			bli_thread_partition_2x2( nt, m,
-										  n, &ic, &jc );
+			// Align the jc loop with the L3 caches of pinned threads, as in
+			// bli_rntm_factorize().
+			dim_t n_l3 = bli_rntm_num_l3( nt, rntm );
+
+			bli_thread_partition_2x2( nt / n_l3, m,
+										  bli_max( n / n_l3, 1 ), &ic, &jc );
+			jc *= n_l3;
 			ir = 1; jr = 1;
 		}
 
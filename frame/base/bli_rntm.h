@@ -52,6 +52,8 @@ typedef struct rntm_s
 	bool      pack_a;
 	bool      pack_b;
 	bool      l3_sup;
+
+	dim_t     budget_grant;
 } rntm_t;
 */
 
@@ -129,6 +131,15 @@ BLIS_INLINE bool bli_rntm_l3_sup( const rntm_t* rntm )
 	return rntm->l3_sup;
 }
 
+//
+// -- rntm_t query (internal use only) -----------------------------------------
+//
+
+BLIS_INLINE dim_t bli_rntm_budget_grant( const rntm_t* rntm )
+{
+	return rntm->budget_grant;
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -148,6 +159,11 @@ BLIS_INLINE void bli_rntm_set_num_threads_only( dim_t nt, rntm_t* rntm )
 	rntm->num_threads = nt;
 }
 
+BLIS_INLINE void bli_rntm_set_budget_grant_only( dim_t grant, rntm_t* rntm )
+{
+	rntm->budget_grant = grant;
+}
+
 BLIS_INLINE void bli_rntm_set_ways_for_only( bszid_t loop, dim_t n_ways, rntm_t* rntm )
 {
 	rntm->thrloop[ loop ] = n_ways;
@@ -278,6 +294,8 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
           /* .pack_a      = */ FALSE, \
           /* .pack_b      = */ FALSE, \
           /* .l3_sup      = */ TRUE, \
+\
+          /* .budget_grant = */ 0, \
         }  \
 
 #if 0
@@ -359,6 +377,16 @@ BLIS_EXPORT_BLIS void bli_rntm_factorize
        rntm_t* rntm
      );
 
+// Factorize the threads of rntm into ways of parallelism, as with
+// bli_rntm_factorize(), but without reserving them from the thread budget.
+void bli_rntm_factorize_ways
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       rntm_t* rntm
+     );
+
 void bli_rntm_factorize_sup
      (
        dim_t   m,
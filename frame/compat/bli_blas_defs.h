@@ -135,6 +135,13 @@
 #include "bla_tpmv.h"
 #include "bla_tpsv.h"
 
+#include "bla_hpmv_check.h"
+#include "bla_hpr_check.h"
+#include "bla_spmv_check.h"
+#include "bla_spr_check.h"
+#include "bla_tpmv_check.h"
+#include "bla_tpsv_check.h"
+
 // banded
 
 #include "bla_gbmv.h"
@@ -143,6 +150,12 @@
 #include "bla_tbmv.h"
 #include "bla_tbsv.h"
 
+#include "bla_gbmv_check.h"
+#include "bla_hbmv_check.h"
+#include "bla_sbmv_check.h"
+#include "bla_tbmv_check.h"
+#include "bla_tbsv_check.h"
+
 
 // -- Level-3 BLAS prototypes --
 
@@ -181,6 +194,7 @@
 // batch
 
 #include "bla_gemm_batch.h"
+#include "bla_gemm_batch_strided.h"
 
 // 3m
 
@@ -217,17 +217,20 @@ void PASTEF77(ch,blasname) \
 	bli_obj_set_conjtrans( blis_transa, &ao ); \
 	bli_obj_set_conjtrans( blis_transb, &bo ); \
 \
-	/* As a placeholder, invoke bli_gemm_ex(). */ \
-	PASTEMAC(blisname,BLIS_OAPI_EX_SUF) \
-	( \
-	  &alphao, \
-	  &ao, \
-	  &bo, \
-	  &betao, \
-	  &co, \
-	  NULL, \
-	  NULL \
-	); \
+	/* Invoke the 3m handler directly (unless the operation is trivial),
+	   bypassing sup and the induced method enablement status that governs
+	   bli_gemm_ex(). */ \
+	if ( bli_l3_return_early_if_trivial( &alphao, &ao, &bo, &betao, &co ) != BLIS_SUCCESS ) \
+		bli_gemm_3m \
+		( \
+		  &alphao, \
+		  &ao, \
+		  &bo, \
+		  &betao, \
+		  &co, \
+		  NULL, \
+		  NULL \
+		); \
 \
 	/* Finalize BLIS. */ \
 	bli_finalize_auto(); \
@@ -78,6 +78,16 @@
 
 // -- AMD architectures --------------------------------------------------------
 
+#ifdef BLIS_CONFIG_ZEN5
+#define INSERT_GENTCONF_ZEN5 GENTCONF( ZEN5, zen5 )
+#else
+#define INSERT_GENTCONF_ZEN5
+#endif
+#ifdef BLIS_CONFIG_ZEN4
+#define INSERT_GENTCONF_ZEN4 GENTCONF( ZEN4, zen4 )
+#else
+#define INSERT_GENTCONF_ZEN4
+#endif
 #ifdef BLIS_CONFIG_ZEN3
 #define INSERT_GENTCONF_ZEN3 GENTCONF( ZEN3, zen3 )
 #else
@@ -253,6 +263,8 @@ INSERT_GENTCONF_HASWELL \
 INSERT_GENTCONF_SANDYBRIDGE \
 INSERT_GENTCONF_PENRYN \
 \
+INSERT_GENTCONF_ZEN5 \
+INSERT_GENTCONF_ZEN4 \
 INSERT_GENTCONF_ZEN3 \
 INSERT_GENTCONF_ZEN2 \
 INSERT_GENTCONF_ZEN \
@@ -807,6 +807,25 @@ BLIS_INLINE bool bli_obj_is_col_tilted( const obj_t* obj )
 	       ( bli_obj_row_stride_mag( obj ) < bli_obj_col_stride_mag( obj ) );
 }
 
+// Panel-packed objects store their micro-panels one after another along
+// either the m dimension (as with a packed A, whose micro-panels are
+// column-tilted) or the n dimension (as with a packed B, whose micro-panels
+// are row-tilted).
+
+BLIS_INLINE bool bli_obj_is_packed_along_m( const obj_t* obj )
+{
+	return ( bool )
+	       ( bli_obj_is_panel_packed( obj ) &&
+	         bli_obj_is_col_tilted( obj ) );
+}
+
+BLIS_INLINE bool bli_obj_is_packed_along_n( const obj_t* obj )
+{
+	return ( bool )
+	       ( bli_obj_is_panel_packed( obj ) &&
+	         bli_obj_is_row_tilted( obj ) );
+}
+
 // Stride/increment modification
 
 BLIS_INLINE void bli_obj_set_row_stride( inc_t rs, obj_t* obj )
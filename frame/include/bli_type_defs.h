@@ -582,9 +582,13 @@ typedef enum ind_e
 {
 	BLIS_1M        = 0,
 	BLIS_NAT,
+	// New methods are appended so that existing values remain unchanged.
+	// The order in which methods are searched for is defined separately
+	// (see bli_l3_ind.c).
+	BLIS_3M,
 
 	BLIS_IND_FIRST = 0,
-	BLIS_IND_LAST  = BLIS_NAT,
+	BLIS_IND_LAST  = BLIS_3M,
 
 	// BLIS_NUM_IND_METHODS must be last!
 	BLIS_NUM_IND_METHODS
@@ -594,6 +598,7 @@ typedef enum ind_e
 // the induced method substrings that go into function names.
 #define bli_1m   BLIS_1M
 #define bli_nat  BLIS_NAT
+#define bli_3m   BLIS_3M
 
 
 // -- Threading implementation type --
@@ -604,6 +609,7 @@ typedef enum timpl_e
 	BLIS_OPENMP,
 	BLIS_POSIX,
 	BLIS_HPX,
+	BLIS_CUSTOM,
 
 	// BLIS_NUM_THREAD_IMPLS must be last!
 	BLIS_NUM_THREAD_IMPLS
@@ -684,6 +690,12 @@ typedef enum ukr_e
 	BLIS_GEMMSUP_CCC_UKR,
 	BLIS_GEMMSUP_XXX_UKR,
 
+	// tiny gemm kernels
+	BLIS_GEMM_TINY_UKR,
+
+	// l3 edge-case kernels
+	BLIS_GEMM_EDGE_UKR,
+
 	// BLIS_NUM_UKRS must after all 1-type kernels and before 2-type kernels!
 	BLIS_NUM_UKRS_, BLIS_NUM_UKRS = bli_ker_idx( BLIS_NUM_UKRS_ ),
 
@@ -739,6 +751,9 @@ typedef enum ukr_pref_e
 	BLIS_GEMMSUP_CCC_UKR_ROW_PREF,
 	BLIS_GEMMSUP_XXX_UKR_ROW_PREF,
 
+	// l3 edge-case kernel flags
+	BLIS_GEMM_EDGE_UKR_PREF,
+
     // BLIS_NUM_UKR_PREFS must be last!
     BLIS_NUM_UKR_PREFS,
 
@@ -968,6 +983,8 @@ typedef enum arch_e
 	BLIS_ARCH_PENRYN,
 
 	// AMD
+	BLIS_ARCH_ZEN5,
+	BLIS_ARCH_ZEN4,
 	BLIS_ARCH_ZEN3,
 	BLIS_ARCH_ZEN2,
 	BLIS_ARCH_ZEN,
@@ -1485,6 +1502,9 @@ typedef struct rntm_s
 	bool      pack_a; // enable/disable packing of left-hand matrix A.
 	bool      pack_b; // enable/disable packing of right-hand matrix B.
 	bool      l3_sup; // enable/disable small matrix handling in level-3 ops.
+
+	// "Internal" fields: these should not be used by the end-user.
+	dim_t     budget_grant; // threads reserved from the process-wide budget.
 } rntm_t;
 
 
@@ -1570,6 +1590,8 @@ typedef enum err_e
 	// Packing-specific errors
 	BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_UNPACK  = (-100),
 	BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART    = (-101),
+	BLIS_PACKED_PART_NOT_PANEL_ALIGNED         = (-102),
+	BLIS_PACKED_OPERAND_MISMATCH               = (-103),
 
 	// Buffer-specific errors
 	BLIS_EXPECTED_NONNULL_OBJECT_BUFFER        = (-110),
@@ -1586,6 +1608,7 @@ typedef enum err_e
 
 	// Object-related errors
 	BLIS_EXPECTED_OBJECT_ALIAS                 = (-140),
+	BLIS_INCONSISTENT_BATCH_OPERANDS           = (-141),
 
 	// Architecture-related errors
 	BLIS_INVALID_ARCH_ID                       = (-150),
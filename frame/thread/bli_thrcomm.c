@@ -89,6 +89,7 @@ static thrcomm_init_ft init_fpa[ BLIS_NUM_THREAD_IMPLS ] =
 #else
 	                NULL,
 #endif
+	[BLIS_CUSTOM] = bli_thrcomm_init_custom,
 };
 static thrcomm_cleanup_ft cleanup_fpa[ BLIS_NUM_THREAD_IMPLS ] =
 {
@@ -111,6 +112,7 @@ static thrcomm_cleanup_ft cleanup_fpa[ BLIS_NUM_THREAD_IMPLS ] =
 #else
 	                NULL,
 #endif
+	[BLIS_CUSTOM] = bli_thrcomm_cleanup_custom,
 };
 static thrcomm_barrier_ft barrier_fpa[ BLIS_NUM_THREAD_IMPLS ] =
 {
@@ -133,6 +135,7 @@ static thrcomm_barrier_ft barrier_fpa[ BLIS_NUM_THREAD_IMPLS ] =
 #else
 	                NULL,
 #endif
+	[BLIS_CUSTOM] = bli_thrcomm_barrier_custom,
 };
 
 // Define dispatchers that choose a threading-specific function from each
@@ -138,6 +138,12 @@ typedef struct thrcomm_s
 	hpx_barrier_t barrier;
 	#endif
 
+	// -- Fields specific to custom (application-provided) threading --
+
+	// The barrier created by the application's barrier_create callback, or
+	// NULL if BLIS's own barrier is used.
+	void* custom_barrier;
+
 } thrcomm_t;
 
 
@@ -150,6 +156,7 @@ typedef struct thrcomm_s
 #include "bli_thrcomm_openmp.h"
 #include "bli_thrcomm_pthreads.h"
 #include "bli_thrcomm_hpx.h"
+#include "bli_thrcomm_custom.h"
 
 // Define a function pointer type for each of the functions that are
 // "overloaded" by each method of multithreading.
@@ -0,0 +1,82 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+void bli_thrcomm_init_custom( dim_t n_threads, thrcomm_t* comm )
+{
+	if ( comm == NULL ) return;
+
+	const thread_custom_t* custom = bli_thread_custom_query();
+
+	comm->sent_object             = NULL;
+	comm->n_threads               = n_threads;
+	comm->ti                      = BLIS_CUSTOM;
+	comm->barrier_sense           = 0;
+	comm->barrier_threads_arrived = 0;
+	comm->custom_barrier          = NULL;
+
+	// Only create an application barrier if one will ever be waited on.
+	if ( custom->barrier_wait != NULL && n_threads > 1 )
+		comm->custom_barrier = custom->barrier_create( n_threads, custom->user_data );
+}
+
+void bli_thrcomm_cleanup_custom( thrcomm_t* comm )
+{
+	if ( comm == NULL ) return;
+
+	const thread_custom_t* custom = bli_thread_custom_query();
+
+	if ( comm->custom_barrier != NULL && custom->barrier_free != NULL )
+		custom->barrier_free( comm->custom_barrier, custom->user_data );
+
+	comm->custom_barrier = NULL;
+}
+
+void bli_thrcomm_barrier_custom( dim_t t_id, thrcomm_t* comm )
+{
+	if ( comm == NULL || comm->n_threads == 1 ) return;
+
+	if ( comm->custom_barrier != NULL )
+	{
+		const thread_custom_t* custom = bli_thread_custom_query();
+
+		custom->barrier_wait( comm->custom_barrier, t_id, custom->user_data );
+	}
+	else
+	{
+		bli_thrcomm_barrier_atomic( t_id, comm );
+	}
+}
+
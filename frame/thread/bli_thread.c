@@ -38,6 +38,16 @@
 // A global communicator that is hard-coded for single-threaded execution.
 thrcomm_t BLIS_SINGLE_COMM = {};
 
+// The process-wide thread budget (zero means unlimited) and the number of
+// threads currently reserved against it by level-3 calls that are in flight.
+static dim_t thread_budget        = 0;
+static dim_t thread_budget_active = 0;
+
+// The rntm_t with which the last level-3 call by this application thread was
+// executed, as reported by bli_thread_get_last_rntm().
+static BLIS_THREAD_LOCAL
+rntm_t       thread_last_rntm     = BLIS_RNTM_INITIALIZER;
+
 // -----------------------------------------------------------------------------
 
 typedef void (*thread_launch_t)
@@ -68,6 +78,7 @@ static thread_launch_t thread_launch_fpa[ BLIS_NUM_THREAD_IMPLS ] =
 #else
 	                NULL,
 #endif
+	[BLIS_CUSTOM] = bli_thread_launch_custom,
 };
 
 // -----------------------------------------------------------------------------
@@ -80,11 +91,23 @@ int bli_thread_init( void )
 
 	bli_thrcomm_init( BLIS_SINGLE, 1, &BLIS_SINGLE_COMM );
 
+	// Read the thread budget, if any, from the environment.
+	dim_t budget = bli_env_get_var( "BLIS_THREAD_BUDGET", 0 );
+
+	__atomic_store_n( &thread_budget, bli_max( budget, 0 ), __ATOMIC_RELAXED );
+
+	// Read the thread-to-CPU placement, if any, from the environment.
+	bli_thread_affinity_init();
+
 	return 0;
 }
 
 int bli_thread_finalize( void )
 {
+	bli_thread_affinity_finalize();
+
+	bli_l3_thrinfo_cache_flush();
+
 	bli_thrcomm_cleanup( &BLIS_SINGLE_COMM );
 
 	return 0;
@@ -105,6 +128,43 @@ void bli_thread_launch
 
 // -----------------------------------------------------------------------------
 
+dim_t bli_thread_budget_acquire( dim_t nt )
+{
+	const dim_t budget = __atomic_load_n( &thread_budget, __ATOMIC_RELAXED );
+
+	// Nothing is reserved when no budget is in effect.
+	if ( budget <= 0 ) return 0;
+
+	dim_t active = __atomic_load_n( &thread_budget_active, __ATOMIC_RELAXED );
+	dim_t grant;
+
+	// Grant whatever remains of the budget, up to the number of threads
+	// requested. A caller always gets at least one thread (its own), even if
+	// that briefly takes the total above the budget.
+	do
+	{
+		grant = bli_min( nt, bli_max( budget - active, 1 ) );
+	}
+	while ( !__atomic_compare_exchange_n( &thread_budget_active, &active,
+	                                      active + grant, true,
+	                                      __ATOMIC_ACQ_REL, __ATOMIC_RELAXED ) );
+
+	return grant;
+}
+
+void bli_thread_budget_release( dim_t grant )
+{
+	if ( grant > 0 )
+		__atomic_fetch_sub( &thread_budget_active, grant, __ATOMIC_ACQ_REL );
+}
+
+void bli_thread_set_last_rntm( const rntm_t* rntm )
+{
+	thread_last_rntm = *rntm;
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_prime_factorization( dim_t n, bli_prime_factors_t* factors )
 {
 	factors->n = n;
@@ -701,12 +761,34 @@ timpl_t bli_thread_get_thread_impl( void )
 	return bli_rntm_thread_impl( bli_global_rntm() );
 }
 
+dim_t bli_thread_get_budget( void )
+{
+	// We must ensure that the budget has been read from the environment.
+	bli_init_once();
+
+	return __atomic_load_n( &thread_budget, __ATOMIC_RELAXED );
+}
+
+dim_t bli_thread_get_budget_active( void )
+{
+	return __atomic_load_n( &thread_budget_active, __ATOMIC_RELAXED );
+}
+
+void bli_thread_get_last_rntm( rntm_t* rntm )
+{
+	*rntm = thread_last_rntm;
+
+	// The grant was returned to the budget when the call completed.
+	bli_rntm_set_budget_grant_only( 0, rntm );
+}
+
 static const char* bli_timpl_string[BLIS_NUM_THREAD_IMPLS] =
 {
 	[BLIS_SINGLE] = "single",
 	[BLIS_OPENMP] = "openmp",
 	[BLIS_POSIX]  = "pthreads",
 	[BLIS_HPX]    = "hpx",
+	[BLIS_CUSTOM] = "custom",
 };
 
 const char* bli_thread_get_thread_impl_str( timpl_t ti )
@@ -738,6 +820,9 @@ void bli_thread_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir )
 	bli_pthread_mutex_unlock( bli_global_rntm_mutex() );
 	#endif
 
+	// Evict the thrinfo_t trees cached for the previous factorization.
+	bli_l3_thrinfo_cache_flush();
+
 #else
 
 	// When multithreading is disabled at compile time, ignore the user's
@@ -768,6 +853,9 @@ void bli_thread_set_num_threads( dim_t n_threads )
 	bli_pthread_mutex_unlock( bli_global_rntm_mutex() );
 	#endif
 
+	// Evict the thrinfo_t trees cached for the previous number of threads.
+	bli_l3_thrinfo_cache_flush();
+
 #else
 
 	// When multithreading is disabled at compile time, ignore the user's
@@ -794,6 +882,17 @@ void bli_thread_set_thread_impl( timpl_t ti )
 	#endif
 }
 
+void bli_thread_set_budget( dim_t budget )
+{
+	// We must ensure that the budget has been read from the environment so
+	// that it does not later overwrite the value set here.
+	bli_init_once();
+
+	// Threads reserved by calls that are already in flight remain reserved
+	// until those calls complete; only new calls observe the new budget.
+	__atomic_store_n( &thread_budget, bli_max( budget, 0 ), __ATOMIC_RELAXED );
+}
+
 void bli_thread_reset( void )
 {
 	// We must ensure that global_rntm_at_init has been initialized.
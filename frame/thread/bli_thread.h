@@ -51,6 +51,8 @@ typedef void (*thread_func_t)( thrcomm_t* gl_comm, dim_t tid, const void* params
 #include "bli_thread_pthreads.h"
 #include "bli_thread_hpx.h"
 #include "bli_thread_single.h"
+#include "bli_thread_custom.h"
+#include "bli_thread_affinity.h"
 
 // Initialization-related prototypes.
 int bli_thread_init( void );
@@ -66,6 +68,13 @@ BLIS_EXPORT_BLIS void bli_thread_launch
        const void*         params
      );
 
+// Reserve threads from (and return them to) the process-wide thread budget.
+dim_t bli_thread_budget_acquire( dim_t nt );
+void  bli_thread_budget_release( dim_t grant );
+
+// Record the rntm_t with which a level-3 call was executed.
+void  bli_thread_set_last_rntm( const rntm_t* rntm );
+
 // -----------------------------------------------------------------------------
 
 // Factorization and partitioning prototypes
@@ -122,10 +131,14 @@ BLIS_EXPORT_BLIS dim_t   bli_thread_get_ir_nt( void );
 BLIS_EXPORT_BLIS dim_t   bli_thread_get_num_threads( void );
 BLIS_EXPORT_BLIS timpl_t bli_thread_get_thread_impl( void );
 BLIS_EXPORT_BLIS const char* bli_thread_get_thread_impl_str( timpl_t ti );
+BLIS_EXPORT_BLIS dim_t   bli_thread_get_budget( void );
+BLIS_EXPORT_BLIS dim_t   bli_thread_get_budget_active( void );
+BLIS_EXPORT_BLIS void    bli_thread_get_last_rntm( rntm_t* rntm );
 
 BLIS_EXPORT_BLIS void    bli_thread_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir );
 BLIS_EXPORT_BLIS void    bli_thread_set_num_threads( dim_t value );
 BLIS_EXPORT_BLIS void    bli_thread_set_thread_impl( timpl_t ti );
+BLIS_EXPORT_BLIS void    bli_thread_set_budget( dim_t budget );
 BLIS_EXPORT_BLIS void    bli_thread_reset( void );
 
 
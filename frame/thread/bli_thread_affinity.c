@@ -0,0 +1,518 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#include "blis.h"
+
+#ifdef __linux__
+#include <sched.h>
+#include <pthread.h>
+#endif
+
+typedef enum
+{
+	BLIS_AFFINITY_NONE = 0,
+	BLIS_AFFINITY_COMPACT,
+	BLIS_AFFINITY_SCATTER,
+	BLIS_AFFINITY_LIST,
+} affinity_kind_t;
+
+// The current placement: the CPUs in the order in which thread ids are
+// assigned to them, and the L3 cache of each (numbered from zero).
+static affinity_kind_t affinity_kind = BLIS_AFFINITY_NONE;
+static dim_t           affinity_n    = 0;
+static dim_t           affinity_n_l3 = 0;
+static int             affinity_cpu[ BLIS_AFFINITY_MAX_CPUS ];
+static int             affinity_l3[ BLIS_AFFINITY_MAX_CPUS ];
+
+// The placement is rebuilt by bli_thread_set_affinity() while other
+// application threads may be launching BLIS threads, so it is only accessed
+// with this mutex held.
+static bli_pthread_mutex_t affinity_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
+// -----------------------------------------------------------------------------
+
+// Parse a list of CPUs such as "0-3,8 10" into cpus, returning the number of
+// CPUs found or -1 if the list is malformed.
+static dim_t bli_affinity_parse_list( const char* s, int* cpus, dim_t n_max )
+{
+	dim_t n = 0;
+
+	while ( *s != '\0' )
+	{
+		if ( *s == ',' || isspace( ( unsigned char )*s ) ) { ++s; continue; }
+		if ( !isdigit( ( unsigned char )*s ) ) return -1;
+
+		char* end;
+		long  first = strtol( s, &end, 10 );
+		long  last  = first;
+		s = end;
+
+		if ( *s == '-' )
+		{
+			++s;
+			if ( !isdigit( ( unsigned char )*s ) ) return -1;
+			last = strtol( s, &end, 10 );
+			s = end;
+		}
+
+		if ( last < first || BLIS_AFFINITY_MAX_CPUS <= last ) return -1;
+
+		for ( long c = first; c <= last && n < n_max; ++c )
+			cpus[ n++ ] = ( int )c;
+	}
+
+	return n;
+}
+
+#ifdef __linux__
+
+// Return whether the first len characters of s are exactly the given name.
+static bool bli_affinity_is_name( const char* s, size_t len, const char* name )
+{
+	return strlen( name ) == len && !strncmp( s, name, len );
+}
+
+// Read a CPU list from a sysfs file, returning the number of CPUs found.
+static dim_t bli_affinity_read_list( const char* path, int* cpus, dim_t n_max )
+{
+	char  buf[ 4096 ];
+	FILE* f = fopen( path, "r" );
+
+	if ( f == NULL ) return 0;
+
+	char* line = fgets( buf, sizeof( buf ), f );
+	fclose( f );
+
+	if ( line == NULL ) return 0;
+
+	dim_t n = bli_affinity_parse_list( line, cpus, n_max );
+
+	return bli_max( n, 0 );
+}
+
+// Identify the L3 cache of a CPU by the lowest-numbered CPU sharing it, or by
+// the CPU's package if the L3 cache cannot be found.
+static int bli_affinity_l3_of( int cpu )
+{
+	char path[ 128 ];
+	int  list[ BLIS_AFFINITY_MAX_CPUS ];
+
+	for ( int index = 0; index < 8; ++index )
+	{
+		snprintf( path, sizeof( path ),
+		          "/sys/devices/system/cpu/cpu%d/cache/index%d/level", cpu, index );
+
+		FILE* f = fopen( path, "r" );
+		if ( f == NULL ) break;
+
+		int level = 0;
+		if ( fscanf( f, "%d", &level ) != 1 ) level = 0;
+		fclose( f );
+
+		if ( level != 3 ) continue;
+
+		snprintf( path, sizeof( path ),
+		          "/sys/devices/system/cpu/cpu%d/cache/index%d/shared_cpu_list", cpu, index );
+
+		if ( 0 < bli_affinity_read_list( path, list, BLIS_AFFINITY_MAX_CPUS ) )
+			return list[ 0 ];
+	}
+
+	snprintf( path, sizeof( path ),
+	          "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu );
+
+	int   package = 0;
+	FILE* f       = fopen( path, "r" );
+
+	if ( f != NULL )
+	{
+		if ( fscanf( f, "%d", &package ) != 1 ) package = 0;
+		fclose( f );
+	}
+
+	return BLIS_AFFINITY_MAX_CPUS + package;
+}
+
+// Return the rank of a CPU among the hardware threads of its core, so that
+// rank 0 identifies one hardware thread per core.
+static int bli_affinity_smt_rank_of( int cpu )
+{
+	char path[ 128 ];
+	int  list[ BLIS_AFFINITY_MAX_CPUS ];
+
+	snprintf( path, sizeof( path ),
+	          "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu );
+
+	dim_t n    = bli_affinity_read_list( path, list, BLIS_AFFINITY_MAX_CPUS );
+	int   rank = 0;
+
+	for ( dim_t i = 0; i < n; ++i )
+		if ( list[ i ] < cpu ) ++rank;
+
+	return rank;
+}
+
+typedef struct affinity_entry_s
+{
+	int cpu;
+	int l3;
+	int key[ 4 ];
+} affinity_entry_t;
+
+static int bli_affinity_entry_cmp( const void* a_void, const void* b_void )
+{
+	const affinity_entry_t* a = a_void;
+	const affinity_entry_t* b = b_void;
+
+	for ( int i = 0; i < 4; ++i )
+		if ( a->key[ i ] != b->key[ i ] ) return a->key[ i ] < b->key[ i ] ? -1 : 1;
+
+	return 0;
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+static err_t bli_affinity_build( const char* spec )
+{
+	affinity_kind = BLIS_AFFINITY_NONE;
+	affinity_n    = 0;
+	affinity_n_l3 = 0;
+
+	if ( spec == NULL ) return BLIS_SUCCESS;
+
+	while ( isspace( ( unsigned char )*spec ) ) ++spec;
+
+	if ( *spec == '\0' ) return BLIS_SUCCESS;
+
+#ifdef __linux__
+
+	affinity_kind_t kind;
+	int             cpus[ BLIS_AFFINITY_MAX_CPUS ];
+	dim_t           n = 0;
+
+	// A policy name must make up the whole (trimmed) spec. Anything else,
+	// e.g. "closest", is parsed as a CPU list and so is rejected.
+	size_t len = strlen( spec );
+	while ( isspace( ( unsigned char )spec[ len - 1 ] ) ) --len;
+
+	if      ( bli_affinity_is_name( spec, len, "compact" ) ) kind = BLIS_AFFINITY_COMPACT;
+	else if ( bli_affinity_is_name( spec, len, "close"   ) ) kind = BLIS_AFFINITY_COMPACT;
+	else if ( bli_affinity_is_name( spec, len, "scatter" ) ) kind = BLIS_AFFINITY_SCATTER;
+	else if ( bli_affinity_is_name( spec, len, "spread"  ) ) kind = BLIS_AFFINITY_SCATTER;
+	else                                                     kind = BLIS_AFFINITY_LIST;
+
+	if ( kind == BLIS_AFFINITY_LIST )
+	{
+		n = bli_affinity_parse_list( spec, cpus, BLIS_AFFINITY_MAX_CPUS );
+	}
+	else
+	{
+		// Use the CPUs on which the process is allowed to run.
+		cpu_set_t set;
+
+		if ( sched_getaffinity( 0, sizeof( set ), &set ) != 0 ) return BLIS_FAILURE;
+
+		for ( int c = 0; c < CPU_SETSIZE && c < BLIS_AFFINITY_MAX_CPUS; ++c )
+			if ( CPU_ISSET( c, &set ) ) cpus[ n++ ] = c;
+	}
+
+	if ( n <= 0 ) return BLIS_FAILURE;
+
+	err_t             r_val;
+	affinity_entry_t* entries = bli_malloc_intl( n * sizeof( affinity_entry_t ), &r_val );
+
+	// Number the L3 caches from zero in the order in which they are found.
+	int   l3_ids[ BLIS_AFFINITY_MAX_CPUS ];
+	dim_t n_l3 = 0;
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		int   id = bli_affinity_l3_of( cpus[ i ] );
+		dim_t l3 = 0;
+
+		while ( l3 < n_l3 && l3_ids[ l3 ] != id ) ++l3;
+		if ( l3 == n_l3 ) l3_ids[ n_l3++ ] = id;
+
+		entries[ i ].cpu = cpus[ i ];
+		entries[ i ].l3  = ( int )l3;
+	}
+
+	if ( kind != BLIS_AFFINITY_LIST )
+	{
+		// Use one hardware thread per core before using the remaining ones.
+		// For compact, fill each L3 cache in turn; for scatter, take one CPU
+		// from each L3 cache in turn.
+		int n_in_l3[ BLIS_AFFINITY_MAX_CPUS ][ 2 ];
+		memset( n_in_l3, 0, sizeof( int ) * 2 * n_l3 );
+
+		for ( dim_t i = 0; i < n; ++i )
+		{
+			int smt = bli_min( bli_affinity_smt_rank_of( entries[ i ].cpu ), 1 );
+			int l3  = entries[ i ].l3;
+			int pos = n_in_l3[ l3 ][ smt ]++;
+
+			entries[ i ].key[ 0 ] = smt;
+			entries[ i ].key[ 1 ] = ( kind == BLIS_AFFINITY_COMPACT ? l3 : pos );
+			entries[ i ].key[ 2 ] = ( kind == BLIS_AFFINITY_COMPACT ? pos : l3 );
+			entries[ i ].key[ 3 ] = entries[ i ].cpu;
+		}
+
+		qsort( entries, n, sizeof( affinity_entry_t ), bli_affinity_entry_cmp );
+	}
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		affinity_cpu[ i ] = entries[ i ].cpu;
+		affinity_l3[ i ]  = entries[ i ].l3;
+	}
+
+	bli_free_intl( entries );
+
+	affinity_kind = kind;
+	affinity_n    = n;
+	affinity_n_l3 = n_l3;
+
+	return BLIS_SUCCESS;
+
+#else
+
+	// Pinning threads is not supported on this platform.
+	return BLIS_FAILURE;
+
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+static err_t bli_affinity_set( const char* spec )
+{
+	// BEGIN CRITICAL SECTION
+	bli_pthread_mutex_lock( &affinity_mutex );
+
+	err_t r_val = bli_affinity_build( spec );
+
+	bli_pthread_mutex_unlock( &affinity_mutex );
+	// END CRITICAL SECTION
+
+	return r_val;
+}
+
+static dim_t bli_affinity_layout( dim_t nt, int* cpus, int* l3s )
+{
+	const dim_t n = bli_min( nt, affinity_n );
+
+	if ( affinity_kind == BLIS_AFFINITY_SCATTER )
+	{
+		// Scatter chooses CPUs across the L3 caches, but the ids of threads
+		// on the same cache are kept adjacent (by a stable counting sort) so
+		// that they can share a jc loop iteration.
+		dim_t offset[ BLIS_AFFINITY_MAX_CPUS + 1 ];
+
+		for ( dim_t l = 0; l <= affinity_n_l3; ++l ) offset[ l ] = 0;
+		for ( dim_t i = 0; i < n; ++i ) offset[ affinity_l3[ i ] + 1 ]++;
+		for ( dim_t l = 0; l < affinity_n_l3; ++l ) offset[ l + 1 ] += offset[ l ];
+
+		for ( dim_t i = 0; i < n; ++i )
+		{
+			dim_t j = offset[ affinity_l3[ i ] ]++;
+
+			cpus[ j ] = affinity_cpu[ i ];
+			if ( l3s != NULL ) l3s[ j ] = affinity_l3[ i ];
+		}
+	}
+	else
+	{
+		for ( dim_t i = 0; i < n; ++i )
+		{
+			cpus[ i ] = affinity_cpu[ i ];
+			if ( l3s != NULL ) l3s[ i ] = affinity_l3[ i ];
+		}
+	}
+
+	return n;
+}
+
+static dim_t bli_affinity_num_l3( dim_t nt )
+{
+	// Threads that wrap around the placement share CPUs, so their caches
+	// cannot be aligned with the jc loop.
+	if ( affinity_n < nt || nt < 2 ) return 1;
+
+	int   cpus[ BLIS_AFFINITY_MAX_CPUS ];
+	int   l3s[ BLIS_AFFINITY_MAX_CPUS ];
+	bool  seen[ BLIS_AFFINITY_MAX_CPUS ];
+
+	for ( dim_t l = 0; l < affinity_n_l3; ++l ) seen[ l ] = FALSE;
+
+	bli_affinity_layout( nt, cpus, l3s );
+
+	dim_t n_runs  = 0;
+	dim_t run_len = 0;
+
+	for ( dim_t i = 0; i < nt; )
+	{
+		dim_t j = i;
+		while ( j < nt && l3s[ j ] == l3s[ i ] ) ++j;
+
+		// Each cache must hold a single run of the same length.
+		if ( seen[ l3s[ i ] ] ) return 1;
+		if ( n_runs > 0 && j - i != run_len ) return 1;
+
+		seen[ l3s[ i ] ] = TRUE;
+		run_len          = j - i;
+		n_runs          += 1;
+		i                = j;
+	}
+
+	return n_runs;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_thread_affinity_init( void )
+{
+	// Read the placement, if any, from the environment. A malformed value
+	// leaves threads unpinned.
+	bli_affinity_set( bli_env_get_str( "BLIS_AFFINITY" ) );
+}
+
+void bli_thread_affinity_finalize( void )
+{
+	bli_affinity_set( NULL );
+}
+
+err_t bli_thread_set_affinity( const char* spec )
+{
+	// We must ensure that the placement has been read from the environment
+	// so that it does not later overwrite the value set here.
+	bli_init_once();
+
+	return bli_affinity_set( spec );
+}
+
+dim_t bli_thread_get_affinity( dim_t n_max, int* cpus )
+{
+	bli_init_once();
+
+	// BEGIN CRITICAL SECTION
+	bli_pthread_mutex_lock( &affinity_mutex );
+
+	const dim_t n = affinity_n;
+
+	for ( dim_t i = 0; i < bli_min( n_max, n ); ++i )
+		cpus[ i ] = affinity_cpu[ i ];
+
+	bli_pthread_mutex_unlock( &affinity_mutex );
+	// END CRITICAL SECTION
+
+	return n;
+}
+
+dim_t bli_thread_affinity_layout( dim_t nt, int* cpus, int* l3s )
+{
+	// BEGIN CRITICAL SECTION
+	bli_pthread_mutex_lock( &affinity_mutex );
+
+	const dim_t n = bli_affinity_layout( nt, cpus, l3s );
+
+	bli_pthread_mutex_unlock( &affinity_mutex );
+	// END CRITICAL SECTION
+
+	return n;
+}
+
+dim_t bli_thread_affinity_num_l3( dim_t nt )
+{
+	// BEGIN CRITICAL SECTION
+	bli_pthread_mutex_lock( &affinity_mutex );
+
+	const dim_t n_l3 = bli_affinity_num_l3( nt );
+
+	bli_pthread_mutex_unlock( &affinity_mutex );
+	// END CRITICAL SECTION
+
+	return n_l3;
+}
+
+void bli_thread_affinity_get_self( affinity_mask_t* mask )
+{
+	memset( mask, 0, sizeof( *mask ) );
+
+#ifdef __linux__
+	cpu_set_t set;
+
+	if ( pthread_getaffinity_np( pthread_self(), sizeof( set ), &set ) == 0 )
+		memcpy( mask->bits, &set, bli_min( sizeof( set ), sizeof( mask->bits ) ) );
+#endif
+}
+
+bool bli_thread_affinity_pin_self( int cpu, const affinity_mask_t* current )
+{
+#ifdef __linux__
+	cpu_set_t set;
+
+	CPU_ZERO( &set );
+	memcpy( &set, current->bits, bli_min( sizeof( set ), sizeof( current->bits ) ) );
+
+	// Skip the system call if the thread is already pinned to the CPU.
+	if ( CPU_COUNT( &set ) == 1 && CPU_ISSET( cpu, &set ) ) return FALSE;
+
+	CPU_ZERO( &set );
+	CPU_SET( cpu, &set );
+
+	return pthread_setaffinity_np( pthread_self(), sizeof( set ), &set ) == 0;
+#else
+	return FALSE;
+#endif
+}
+
+void bli_thread_affinity_restore_self( const affinity_mask_t* saved )
+{
+#ifdef __linux__
+	cpu_set_t set;
+
+	CPU_ZERO( &set );
+	memcpy( &set, saved->bits, bli_min( sizeof( set ), sizeof( saved->bits ) ) );
+
+	// An empty mask means the original could not be queried.
+	if ( CPU_COUNT( &set ) > 0 )
+		pthread_setaffinity_np( pthread_self(), sizeof( set ), &set );
+#endif
+}
@@ -0,0 +1,94 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_THREAD_AFFINITY_H
+#define BLIS_THREAD_AFFINITY_H
+
+//
+// Thread-to-CPU affinity for the pthreads implementation. The placement is
+// given by BLIS_AFFINITY (or bli_thread_set_affinity()) as one of:
+//
+//   compact  fill the CPUs sharing one L3 cache before moving to the next,
+//   scatter  spread the threads round-robin across L3 caches,
+//   a list   an explicit list of CPUs, e.g. "0-3,8,10", used in that order.
+//
+// Only one hardware thread per core is used by compact and scatter until all
+// cores are occupied. When the threads of a call span several L3 caches and
+// threads on the same cache have adjacent ids, the automatic factorization
+// aligns the jc loop with the caches (see bli_rntm_factorize()).
+//
+
+#ifndef BLIS_AFFINITY_MAX_CPUS
+#define BLIS_AFFINITY_MAX_CPUS 1024
+#endif
+
+// An opaque copy of a thread's CPU mask, large enough for a cpu_set_t.
+typedef struct affinity_mask_s
+{
+	uint64_t bits[ BLIS_AFFINITY_MAX_CPUS / 64 ];
+} affinity_mask_t;
+
+// Initialization-related prototypes.
+void bli_thread_affinity_init( void );
+void bli_thread_affinity_finalize( void );
+
+// Set (or, given NULL, clear) the placement. Returns BLIS_SUCCESS, or
+// BLIS_FAILURE if the spec could not be parsed, in which case threads are
+// left unpinned.
+BLIS_EXPORT_BLIS err_t bli_thread_set_affinity( const char* spec );
+
+// Copy up to n_max CPUs of the placement into cpus and return the number of
+// CPUs in the placement (zero when threads are not pinned).
+BLIS_EXPORT_BLIS dim_t bli_thread_get_affinity( dim_t n_max, int* cpus );
+
+// Compute the CPUs on which thread ids [0, nt) are placed, and the L3 cache
+// (numbered from zero) of each. Returns the number of distinct placements,
+// min( nt, n ), with thread tid using entry tid % min( nt, n ).
+dim_t bli_thread_affinity_layout( dim_t nt, int* cpus, int* l3s );
+
+// Return the number of L3 caches spanned by nt threads if the threads on each
+// cache have adjacent ids and every cache holds the same number of threads;
+// otherwise (or when threads are not pinned) return 1.
+dim_t bli_thread_affinity_num_l3( dim_t nt );
+
+// Query the calling thread's mask (left empty if it cannot be queried).
+void  bli_thread_affinity_get_self( affinity_mask_t* mask );
+
+// Pin the calling thread, whose mask is current, to a CPU. Returns FALSE
+// without changing the mask if the thread is already pinned to the CPU.
+bool  bli_thread_affinity_pin_self( int cpu, const affinity_mask_t* current );
+void  bli_thread_affinity_restore_self( const affinity_mask_t* saved );
+
+#endif
+
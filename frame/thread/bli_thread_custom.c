@@ -0,0 +1,122 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The registered custom threading implementation. A NULL launch callback
+// means that none has been registered.
+static thread_custom_t thread_custom = { NULL, NULL, NULL, NULL, NULL };
+
+void bli_thread_set_custom( const thread_custom_t* custom )
+{
+	// Communicators retained by the thrinfo_t cache may hold barriers that
+	// were created by the previous callbacks, so evict them while those
+	// callbacks are still registered.
+	bli_l3_thrinfo_cache_flush();
+
+	if ( custom == NULL )
+	{
+		thread_custom = ( thread_custom_t ){ NULL, NULL, NULL, NULL, NULL };
+		return;
+	}
+
+	// A barrier_wait callback cannot be used without barrier_create, since
+	// there would be no barrier on which to wait.
+	if ( custom->barrier_wait != NULL && custom->barrier_create == NULL )
+	{
+		bli_print_msg( "A custom barrier_wait callback was given without a "
+		               "barrier_create callback.", __FILE__, __LINE__ );
+		bli_abort();
+	}
+
+	thread_custom = *custom;
+}
+
+bool bli_thread_custom_is_set( void )
+{
+	return thread_custom.launch != NULL;
+}
+
+const thread_custom_t* bli_thread_custom_query( void )
+{
+	return &thread_custom;
+}
+
+// -----------------------------------------------------------------------------
+
+// A data structure to assist in passing operands to the custom task.
+typedef struct thread_custom_data_s
+{
+	      thrcomm_t*    gl_comm;
+	      thread_func_t func;
+	const void*         params;
+} thread_custom_data_t;
+
+// Entry point for the application's threads.
+static void bli_thread_custom_entry( dim_t tid, void* data_void )
+{
+	const thread_custom_data_t* data = data_void;
+
+	// Call the thread entry point, passing the global communicator, the
+	// thread id, and the params struct as arguments.
+	data->func( data->gl_comm, tid, data->params );
+}
+
+void bli_thread_launch_custom( dim_t n_threads, thread_func_t func, const void* params )
+{
+	const timpl_t          ti     = BLIS_CUSTOM;
+	const thread_custom_t* custom = bli_thread_custom_query();
+
+	// Sanity check: bli_l3_thread_decorator_check() should have caught the
+	// case where no custom implementation was registered.
+	if ( custom->launch == NULL ) bli_abort();
+
+	// Allocate a global communicator for the root thrinfo_t structures.
+	pool_t*    gl_comm_pool = NULL;
+	thrcomm_t* gl_comm      = bli_thrcomm_create( ti, gl_comm_pool, n_threads );
+
+	thread_custom_data_t data;
+	data.gl_comm = gl_comm;
+	data.func    = func;
+	data.params  = params;
+
+	// Hand the nt tasks to the application's launcher, which returns once
+	// all of them have completed.
+	custom->launch( n_threads, bli_thread_custom_entry, &data, custom->user_data );
+
+	// Free the global communicator, because the root thrinfo_t node
+	// never frees its communicator.
+	bli_thrcomm_free( gl_comm_pool, gl_comm );
+}
+
@@ -0,0 +1,97 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_THREAD_CUSTOM_H
+#define BLIS_THREAD_CUSTOM_H
+
+//
+// A custom threading implementation lets the application run the parallel
+// regions of BLIS on threads that it owns (e.g. an existing thread pool)
+// rather than on threads created by OpenMP or pthreads. It is selected like
+// any other implementation (BLIS_THREAD_IMPL=custom, or BLIS_CUSTOM via
+// bli_thread_set_thread_impl() or bli_rntm_set_thread_impl()) once the
+// callbacks below have been registered with bli_thread_set_custom().
+//
+
+// The task that BLIS asks the launcher to run: task( tid, task_data ) must be
+// called exactly once for each tid in [0, nt).
+typedef void (*thread_custom_task_ft)( dim_t tid, void* task_data );
+
+// Run nt instances of task on nt application threads and return once all of
+// them have returned. The instances synchronize with one another through
+// barriers, so all nt of them must be able to make progress concurrently;
+// the calling thread may run one of the instances itself.
+typedef void (*thread_custom_launch_ft)
+     (
+       dim_t                 nt,
+       thread_custom_task_ft task,
+       void*                 task_data,
+       void*                 user_data
+     );
+
+// Optional barrier callbacks. BLIS creates one barrier for each communicator
+// (group of nt threads) that it forms and waits on it with the thread's id
+// within that group. If barrier_wait is NULL, BLIS uses its own spin barrier.
+typedef void* (*thread_custom_barrier_create_ft)( dim_t nt, void* user_data );
+typedef void  (*thread_custom_barrier_wait_ft)( void* barrier, dim_t tid, void* user_data );
+typedef void  (*thread_custom_barrier_free_ft)( void* barrier, void* user_data );
+
+typedef struct thread_custom_s
+{
+	thread_custom_launch_ft         launch;
+
+	thread_custom_barrier_create_ft barrier_create;
+	thread_custom_barrier_wait_ft   barrier_wait;
+	thread_custom_barrier_free_ft   barrier_free;
+
+	void*                           user_data;
+} thread_custom_t;
+
+// Register (or, given NULL, unregister) the custom threading implementation.
+// The callbacks are copied. They must not be changed while any BLIS
+// operation is in progress.
+BLIS_EXPORT_BLIS void bli_thread_set_custom( const thread_custom_t* custom );
+BLIS_EXPORT_BLIS bool bli_thread_custom_is_set( void );
+
+const thread_custom_t* bli_thread_custom_query( void );
+
+void bli_thread_launch_custom
+     (
+             dim_t         nt,
+             thread_func_t func,
+       const void*         params
+     );
+
+#endif
+
@@ -39,10 +39,12 @@
 // A data structure to assist in passing operands to additional threads.
 typedef struct thread_data
 {
-	      dim_t         tid;
-	      thrcomm_t*    gl_comm;
-	      thread_func_t func;
-	const void*         params;
+	      dim_t            tid;
+	      thrcomm_t*       gl_comm;
+	      thread_func_t    func;
+	const void*            params;
+	      int              cpu;
+	const affinity_mask_t* mask;
 } thread_data_t;
 
 // Entry point for additional threads
@@ -54,11 +56,20 @@ static void* bli_posix_thread_entry( void* data_void )
 	      thrcomm_t*     gl_comm  = data->gl_comm;
 	      thread_func_t  func     = data->func;
 	const void*          params   = data->params;
+	const int            cpu      = data->cpu;
+
+	// Pin the thread to its CPU, if a placement was requested. Every thread
+	// starts out with the mask of the application's thread (thread 0), so
+	// the mask is only changed if that is not already the single CPU. Thread
+	// 0's original mask is restored afterwards.
+	const bool pinned = ( 0 <= cpu && bli_thread_affinity_pin_self( cpu, data->mask ) );
 
 	// Call the thread entry point, passing the global communicator, the
 	// thread id, and the params struct as arguments.
 	func( gl_comm, tid, params );
 
+	if ( pinned && tid == 0 ) bli_thread_affinity_restore_self( data->mask );
+
 	return NULL;
 }
 
@@ -85,6 +96,16 @@ void bli_thread_launch_pthreads( dim_t n_threads, thread_func_t func, const void
 	#endif
 	thread_data_t* datas    = bli_malloc_intl( sizeof( thread_data_t ) * n_threads, &r_val );
 
+	// Look up the CPUs to which the threads are pinned, if any.
+	int   cpus[ BLIS_AFFINITY_MAX_CPUS ];
+	dim_t n_cpus = bli_thread_affinity_layout( n_threads, cpus, NULL );
+
+	// The additional threads inherit the mask of thread 0, which is spawning
+	// them, so it is queried once here.
+	affinity_mask_t mask;
+
+	if ( 0 < n_cpus ) bli_thread_affinity_get_self( &mask );
+
 	// NOTE: We must iterate backwards so that the chief thread (thread id 0)
 	// can spawn all other threads before proceeding with its own computation.
 	for ( dim_t tid = n_threads - 1; 0 <= tid; tid-- )
@@ -94,6 +115,8 @@ void bli_thread_launch_pthreads( dim_t n_threads, thread_func_t func, const void
 		datas[tid].gl_comm  = gl_comm;
 		datas[tid].func     = func;
 		datas[tid].params   = params;
+		datas[tid].cpu      = ( 0 < n_cpus ? cpus[ tid % n_cpus ] : -1 );
+		datas[tid].mask     = &mask;
 
 		// Spawn additional threads for ids greater than 1.
 		if ( tid != 0 )
@@ -590,7 +590,7 @@ void bli_cpackm_haswell_asm_3x8
 	}
 	else
 	{
-		bli_cscal2bbs_mxn
+		bli_cpackm_haswell_int_mxn
 		(
 		  conja,
 		  cdim0,
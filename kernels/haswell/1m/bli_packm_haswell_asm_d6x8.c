@@ -588,7 +588,7 @@ void bli_dpackm_haswell_asm_6x8
 	}
 	else
 	{
-		bli_dscal2bbs_mxn
+		bli_dpackm_haswell_int_mxn
 		(
 		  conja,
 		  cdim0,
@@ -789,7 +789,7 @@ void bli_spackm_haswell_asm_6x16
 	}
 	else
 	{
-		bli_sscal2bbs_mxn
+		bli_spackm_haswell_int_mxn
 		(
 		  conja,
 		  cdim0,
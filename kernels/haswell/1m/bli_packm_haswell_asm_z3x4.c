@@ -592,7 +592,7 @@ void bli_zpackm_haswell_asm_3x4
 	}
 	else
 	{
-		bli_zscal2bbs_mxn
+		bli_zpackm_haswell_int_mxn
 		(
 		  conja,
 		  cdim0,
@@ -0,0 +1,527 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Mixed-precision packm kernels. These kernels typecast the elements of A
+// to the precision of the packed micropanel P as they are packed, which is
+// what the mixed-precision gemm path needs when the storage precision of A
+// or B differs from the computation precision. Each kernel handles two
+// layouts of the source micropanel with AVX2:
+//
+// - inca == 1: each column of the micropanel is contiguous, so we convert
+//   and store one column at a time.
+// - lda == 1: each row of the micropanel is contiguous (e.g. a micropanel
+//   of a column-stored B), so we load short rows, convert, and transpose
+//   in registers before storing.
+//
+// As with the same-precision haswell packm kernels, we read inca and lda
+// as rs_a and cs_a, and ldp as cs_p (with rs_p implicitly unit). Complex
+// kernels are vectorized only for real-valued kappa; conjugation of A is
+// applied by flipping the sign bit of the imaginary parts. Everything
+// else (general stride, broadcast factors other than one, or complex
+// kappa) is handled by the scalar bli_tscal2bbs_mxn() loop.
+//
+
+// -- Contiguous column helpers ------------------------------------------------
+
+// Convert n floats at a to doubles at p, applying the sign mask sgn (used to
+// conjugate interleaved complex data) and scaling by kv. n is in units of
+// real elements.
+BLIS_INLINE void bli_packm_haswell_cvt_s2d
+     (
+       dim_t         n,
+       const float*  restrict a,
+       double*       restrict p,
+       __m256d       kv,
+       __m256d       sgn
+     )
+{
+	dim_t i = 0;
+
+	for ( ; i + 4 <= n; i += 4 )
+	{
+		__m256d v = _mm256_cvtps_pd( _mm_loadu_ps( a + i ) );
+		v = _mm256_mul_pd( _mm256_xor_pd( v, sgn ), kv );
+		_mm256_storeu_pd( p + i, v );
+	}
+
+	for ( ; i + 2 <= n; i += 2 )
+	{
+		__m128  f = _mm_loadl_pi( _mm_setzero_ps(), ( const __m64* )( a + i ) );
+		__m128d v = _mm_cvtps_pd( f );
+		v = _mm_mul_pd( _mm_xor_pd( v, _mm256_castpd256_pd128( sgn ) ),
+		                _mm256_castpd256_pd128( kv ) );
+		_mm_storeu_pd( p + i, v );
+	}
+
+	// Only reachable for real data, where sgn is zero.
+	for ( ; i < n; ++i )
+		p[ i ] = _mm256_cvtsd_f64( kv ) * ( double )a[ i ];
+}
+
+// Convert n doubles at a to floats at p, applying the sign mask sgn and then
+// scaling by kv (in single precision, as the reference kernel does).
+BLIS_INLINE void bli_packm_haswell_cvt_d2s
+     (
+       dim_t         n,
+       const double* restrict a,
+       float*        restrict p,
+       __m128        kv,
+       __m128        sgn
+     )
+{
+	dim_t i = 0;
+
+	for ( ; i + 4 <= n; i += 4 )
+	{
+		__m128 v = _mm256_cvtpd_ps( _mm256_loadu_pd( a + i ) );
+		v = _mm_mul_ps( _mm_xor_ps( v, sgn ), kv );
+		_mm_storeu_ps( p + i, v );
+	}
+
+	for ( ; i + 2 <= n; i += 2 )
+	{
+		__m128 v = _mm_cvtpd_ps( _mm_loadu_pd( a + i ) );
+		v = _mm_mul_ps( _mm_xor_ps( v, sgn ), kv );
+		_mm_storel_pi( ( __m64* )( p + i ), v );
+	}
+
+	for ( ; i < n; ++i )
+		p[ i ] = _mm_cvtss_f32( kv ) * ( float )a[ i ];
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_sdpackm_haswell_int_6x8
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   cdim,
+             dim_t   cdim_max,
+             dim_t   cdim_bcast,
+             dim_t   n,
+             dim_t   n_max,
+       const void*   kappa,
+       const void*   a, inc_t inca, inc_t lda,
+             void*   p,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	const float*  restrict a_s = a;
+	      double* restrict p_d = p;
+
+	const double  kappa_r = *( const double* )kappa;
+	const __m256d kv      = _mm256_set1_pd( kappa_r );
+	const __m256d sgn     = _mm256_setzero_pd();
+
+	if ( cdim_bcast == 1 && inca == 1 )
+	{
+		// Branch on the common panel dimensions so that the column loop
+		// is fully unrolled.
+		if      ( cdim == 6 ) for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_s2d( 6,    a_s + k*lda, p_d + k*ldp, kv, sgn );
+		else if ( cdim == 8 ) for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_s2d( 8,    a_s + k*lda, p_d + k*ldp, kv, sgn );
+		else                  for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_s2d( cdim, a_s + k*lda, p_d + k*ldp, kv, sgn );
+	}
+	else if ( cdim_bcast == 1 && lda == 1 )
+	{
+		dim_t k = 0;
+
+		for ( ; k + 4 <= n; k += 4 )
+		{
+			dim_t i = 0;
+
+			for ( ; i + 4 <= cdim; i += 4 )
+			{
+				const float* restrict ai = a_s + i*inca + k;
+				      double* restrict pk = p_d + k*ldp + i;
+
+				__m256d r0 = _mm256_cvtps_pd( _mm_loadu_ps( ai + 0*inca ) );
+				__m256d r1 = _mm256_cvtps_pd( _mm_loadu_ps( ai + 1*inca ) );
+				__m256d r2 = _mm256_cvtps_pd( _mm_loadu_ps( ai + 2*inca ) );
+				__m256d r3 = _mm256_cvtps_pd( _mm_loadu_ps( ai + 3*inca ) );
+
+				__m256d t0 = _mm256_unpacklo_pd( r0, r1 );
+				__m256d t1 = _mm256_unpackhi_pd( r0, r1 );
+				__m256d t2 = _mm256_unpacklo_pd( r2, r3 );
+				__m256d t3 = _mm256_unpackhi_pd( r2, r3 );
+
+				_mm256_storeu_pd( pk + 0*ldp, _mm256_mul_pd( kv, _mm256_permute2f128_pd( t0, t2, 0x20 ) ) );
+				_mm256_storeu_pd( pk + 1*ldp, _mm256_mul_pd( kv, _mm256_permute2f128_pd( t1, t3, 0x20 ) ) );
+				_mm256_storeu_pd( pk + 2*ldp, _mm256_mul_pd( kv, _mm256_permute2f128_pd( t0, t2, 0x31 ) ) );
+				_mm256_storeu_pd( pk + 3*ldp, _mm256_mul_pd( kv, _mm256_permute2f128_pd( t1, t3, 0x31 ) ) );
+			}
+
+			for ( ; i < cdim; ++i )
+			for ( dim_t j = 0; j < 4; ++j )
+				p_d[ (k+j)*ldp + i ] = kappa_r * ( double )a_s[ i*inca + k + j ];
+		}
+
+		for ( ; k < n; ++k )
+		for ( dim_t i = 0; i < cdim; ++i )
+			p_d[ k*ldp + i ] = kappa_r * ( double )a_s[ i*inca + k ];
+	}
+	else
+	{
+		bli_tscal2bbs_mxn
+		(
+		  d,s,d,d,
+		  conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p, cdim_bcast, ldp
+		);
+	}
+
+	bli_tset0s_edge
+	(
+	  d,
+	  cdim*cdim_bcast, cdim_max*cdim_bcast,
+	  n, n_max,
+	  p_d, ldp
+	);
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_dspackm_haswell_int_6x16
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   cdim,
+             dim_t   cdim_max,
+             dim_t   cdim_bcast,
+             dim_t   n,
+             dim_t   n_max,
+       const void*   kappa,
+       const void*   a, inc_t inca, inc_t lda,
+             void*   p,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	const double* restrict a_d = a;
+	      float*  restrict p_s = p;
+
+	const float   kappa_r = *( const float* )kappa;
+	const __m128  kv      = _mm_set1_ps( kappa_r );
+	const __m128  sgn     = _mm_setzero_ps();
+
+	if ( cdim_bcast == 1 && inca == 1 )
+	{
+		if      ( cdim ==  6 ) for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_d2s(  6,   a_d + k*lda, p_s + k*ldp, kv, sgn );
+		else if ( cdim == 16 ) for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_d2s( 16,   a_d + k*lda, p_s + k*ldp, kv, sgn );
+		else                   for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_d2s( cdim, a_d + k*lda, p_s + k*ldp, kv, sgn );
+	}
+	else if ( cdim_bcast == 1 && lda == 1 )
+	{
+		dim_t k = 0;
+
+		for ( ; k + 4 <= n; k += 4 )
+		{
+			dim_t i = 0;
+
+			for ( ; i + 4 <= cdim; i += 4 )
+			{
+				const double* restrict ai = a_d + i*inca + k;
+				      float*  restrict pk = p_s + k*ldp + i;
+
+				__m256d r0 = _mm256_loadu_pd( ai + 0*inca );
+				__m256d r1 = _mm256_loadu_pd( ai + 1*inca );
+				__m256d r2 = _mm256_loadu_pd( ai + 2*inca );
+				__m256d r3 = _mm256_loadu_pd( ai + 3*inca );
+
+				__m256d t0 = _mm256_unpacklo_pd( r0, r1 );
+				__m256d t1 = _mm256_unpackhi_pd( r0, r1 );
+				__m256d t2 = _mm256_unpacklo_pd( r2, r3 );
+				__m256d t3 = _mm256_unpackhi_pd( r2, r3 );
+
+				_mm_storeu_ps( pk + 0*ldp, _mm_mul_ps( kv, _mm256_cvtpd_ps( _mm256_permute2f128_pd( t0, t2, 0x20 ) ) ) );
+				_mm_storeu_ps( pk + 1*ldp, _mm_mul_ps( kv, _mm256_cvtpd_ps( _mm256_permute2f128_pd( t1, t3, 0x20 ) ) ) );
+				_mm_storeu_ps( pk + 2*ldp, _mm_mul_ps( kv, _mm256_cvtpd_ps( _mm256_permute2f128_pd( t0, t2, 0x31 ) ) ) );
+				_mm_storeu_ps( pk + 3*ldp, _mm_mul_ps( kv, _mm256_cvtpd_ps( _mm256_permute2f128_pd( t1, t3, 0x31 ) ) ) );
+			}
+
+			for ( ; i < cdim; ++i )
+			for ( dim_t j = 0; j < 4; ++j )
+				p_s[ (k+j)*ldp + i ] = kappa_r * ( float )a_d[ i*inca + k + j ];
+		}
+
+		for ( ; k < n; ++k )
+		for ( dim_t i = 0; i < cdim; ++i )
+			p_s[ k*ldp + i ] = kappa_r * ( float )a_d[ i*inca + k ];
+	}
+	else
+	{
+		bli_tscal2bbs_mxn
+		(
+		  s,d,s,s,
+		  conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p, cdim_bcast, ldp
+		);
+	}
+
+	bli_tset0s_edge
+	(
+	  s,
+	  cdim*cdim_bcast, cdim_max*cdim_bcast,
+	  n, n_max,
+	  p_s, ldp
+	);
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_czpackm_haswell_int_3x4
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   cdim,
+             dim_t   cdim_max,
+             dim_t   cdim_bcast,
+             dim_t   n,
+             dim_t   n_max,
+       const void*   kappa,
+       const void*   a, inc_t inca, inc_t lda,
+             void*   p,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	const scomplex* restrict a_c = a;
+	      dcomplex* restrict p_z = p;
+
+	const dcomplex kappa_z = *( const dcomplex* )kappa;
+	const __m256d  kv      = _mm256_set1_pd( bli_zreal( kappa_z ) );
+	const __m256d  sgn     = bli_is_conj( conja ) ? _mm256_set_pd( -0.0, 0.0, -0.0, 0.0 )
+	                                              : _mm256_setzero_pd();
+	const bool     kappa_r = bli_zimag( kappa_z ) == 0.0;
+
+	if ( cdim_bcast == 1 && inca == 1 && kappa_r )
+	{
+		if      ( cdim == 3 ) for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_s2d( 6,      ( const float* )( a_c + k*lda ),
+			                                   ( double*      )( p_z + k*ldp ), kv, sgn );
+		else if ( cdim == 4 ) for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_s2d( 8,      ( const float* )( a_c + k*lda ),
+			                                   ( double*      )( p_z + k*ldp ), kv, sgn );
+		else                  for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_s2d( 2*cdim, ( const float* )( a_c + k*lda ),
+			                                   ( double*      )( p_z + k*ldp ), kv, sgn );
+	}
+	else if ( cdim_bcast == 1 && lda == 1 && kappa_r )
+	{
+		dim_t k = 0;
+
+		// Each 128-bit load picks up two consecutive complex elements from
+		// one row; two rows are then recombined into two columns of P.
+		for ( ; k + 2 <= n; k += 2 )
+		{
+			dim_t i = 0;
+
+			for ( ; i + 2 <= cdim; i += 2 )
+			{
+				const float*  restrict ai = ( const float* )( a_c + i*inca + k );
+				      double* restrict pk = ( double* )( p_z + k*ldp + i );
+
+				__m256d r0 = _mm256_cvtps_pd( _mm_loadu_ps( ai ) );
+				__m256d r1 = _mm256_cvtps_pd( _mm_loadu_ps( ai + 2*inca ) );
+
+				r0 = _mm256_mul_pd( _mm256_xor_pd( r0, sgn ), kv );
+				r1 = _mm256_mul_pd( _mm256_xor_pd( r1, sgn ), kv );
+
+				_mm256_storeu_pd( pk,         _mm256_permute2f128_pd( r0, r1, 0x20 ) );
+				_mm256_storeu_pd( pk + 2*ldp, _mm256_permute2f128_pd( r0, r1, 0x31 ) );
+			}
+
+			for ( ; i < cdim; ++i )
+			{
+				const float*  restrict ai = ( const float* )( a_c + i*inca + k );
+				      double* restrict pk = ( double* )( p_z + k*ldp + i );
+
+				__m256d r0 = _mm256_cvtps_pd( _mm_loadu_ps( ai ) );
+
+				r0 = _mm256_mul_pd( _mm256_xor_pd( r0, sgn ), kv );
+
+				_mm_storeu_pd( pk,         _mm256_castpd256_pd128( r0 ) );
+				_mm_storeu_pd( pk + 2*ldp, _mm256_extractf128_pd( r0, 1 ) );
+			}
+		}
+
+		for ( ; k < n; ++k )
+			bli_tscal2s_mxn( z,c,z,z, conja, cdim, 1, &kappa_z,
+			                 a_c + k, inca, 1, p_z + k*ldp, 1, ldp );
+	}
+	else
+	{
+		bli_tscal2bbs_mxn
+		(
+		  z,c,z,z,
+		  conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p, cdim_bcast, ldp
+		);
+	}
+
+	bli_tset0s_edge
+	(
+	  z,
+	  cdim*cdim_bcast, cdim_max*cdim_bcast,
+	  n, n_max,
+	  p_z, ldp
+	);
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zcpackm_haswell_int_3x8
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   cdim,
+             dim_t   cdim_max,
+             dim_t   cdim_bcast,
+             dim_t   n,
+             dim_t   n_max,
+       const void*   kappa,
+       const void*   a, inc_t inca, inc_t lda,
+             void*   p,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	const dcomplex* restrict a_z = a;
+	      scomplex* restrict p_c = p;
+
+	const scomplex kappa_c = *( const scomplex* )kappa;
+	const __m128   kv      = _mm_set1_ps( bli_creal( kappa_c ) );
+	const __m128   sgn     = bli_is_conj( conja ) ? _mm_set_ps( -0.0f, 0.0f, -0.0f, 0.0f )
+	                                              : _mm_setzero_ps();
+	const bool     kappa_r = bli_cimag( kappa_c ) == 0.0f;
+
+	if ( cdim_bcast == 1 && inca == 1 && kappa_r )
+	{
+		if      ( cdim == 3 ) for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_d2s(  6,     ( const double* )( a_z + k*lda ),
+			                                   ( float*        )( p_c + k*ldp ), kv, sgn );
+		else if ( cdim == 8 ) for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_d2s( 16,     ( const double* )( a_z + k*lda ),
+			                                   ( float*        )( p_c + k*ldp ), kv, sgn );
+		else                  for ( dim_t k = 0; k < n; ++k )
+			bli_packm_haswell_cvt_d2s( 2*cdim, ( const double* )( a_z + k*lda ),
+			                                   ( float*        )( p_c + k*ldp ), kv, sgn );
+	}
+	else if ( cdim_bcast == 1 && lda == 1 && kappa_r )
+	{
+		dim_t k = 0;
+
+		// Each 256-bit load picks up two consecutive complex elements from
+		// one row; two rows are then recombined into two columns of P.
+		for ( ; k + 2 <= n; k += 2 )
+		{
+			dim_t i = 0;
+
+			for ( ; i + 2 <= cdim; i += 2 )
+			{
+				const double* restrict ai = ( const double* )( a_z + i*inca + k );
+				      float*  restrict pk = ( float* )( p_c + k*ldp + i );
+
+				__m128 r0 = _mm256_cvtpd_ps( _mm256_loadu_pd( ai ) );
+				__m128 r1 = _mm256_cvtpd_ps( _mm256_loadu_pd( ai + 2*inca ) );
+
+				r0 = _mm_mul_ps( _mm_xor_ps( r0, sgn ), kv );
+				r1 = _mm_mul_ps( _mm_xor_ps( r1, sgn ), kv );
+
+				_mm_storeu_ps( pk,         _mm_movelh_ps( r0, r1 ) );
+				_mm_storeu_ps( pk + 2*ldp, _mm_movehl_ps( r1, r0 ) );
+			}
+
+			for ( ; i < cdim; ++i )
+			{
+				const double* restrict ai = ( const double* )( a_z + i*inca + k );
+				      float*  restrict pk = ( float* )( p_c + k*ldp + i );
+
+				__m128 r0 = _mm256_cvtpd_ps( _mm256_loadu_pd( ai ) );
+
+				r0 = _mm_mul_ps( _mm_xor_ps( r0, sgn ), kv );
+
+				_mm_storel_pi( ( __m64* )( pk ),         r0 );
+				_mm_storeh_pi( ( __m64* )( pk + 2*ldp ), r0 );
+			}
+		}
+
+		for ( ; k < n; ++k )
+			bli_tscal2s_mxn( c,z,c,c, conja, cdim, 1, &kappa_c,
+			                 a_z + k, inca, 1, p_c + k*ldp, 1, ldp );
+	}
+	else
+	{
+		bli_tscal2bbs_mxn
+		(
+		  c,z,c,c,
+		  conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p, cdim_bcast, ldp
+		);
+	}
+
+	bli_tset0s_edge
+	(
+	  c,
+	  cdim*cdim_bcast, cdim_max*cdim_bcast,
+	  n, n_max,
+	  p_c, ldp
+	);
+}
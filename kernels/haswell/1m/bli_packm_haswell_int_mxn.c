@@ -0,0 +1,172 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Vectorized fallbacks for the haswell packm kernels. The assembly packm
+// kernels handle only full micropanels with unit kappa, no conjugation, and
+// either unit row or unit column stride. Everything else (edge micropanels,
+// non-unit kappa, conjugation, and general stride, as arises for 'g' storage
+// in the testsuite or for sliced tensor views) is passed to the functions
+// below, which have the same interface as bli_?scal2bbs_mxn().
+//
+// Each column of the m x n micropanel is read as at most two AVX2 vectors of
+// real elements (complex elements are read as interleaved real/imaginary
+// pairs). When inca == 1 the column is read with masked loads; otherwise it
+// is read with masked gathers, whose indices are computed once from inca.
+// Columns are then scaled by (the real part of) kappa, conjugated by
+// flipping the sign of the imaginary parts, and written with masked stores.
+// Broadcast factors other than one, complex kappa, columns longer than two
+// vectors, and (for single precision) strides too large for 32-bit gather
+// indices are passed to bli_?scal2bbs_mxn().
+//
+
+#define s_vec        __m256
+#define s_idx_t      int32_t
+#define s_set1       _mm256_set1_ps
+#define s_setsgn     _mm256_setr_ps( 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f )
+#define s_mul        _mm256_mul_ps
+#define s_xor        _mm256_xor_ps
+#define s_maskload   _mm256_maskload_ps
+#define s_maskstore  _mm256_maskstore_ps
+#define s_loadidx( i )    _mm256_loadu_si256( ( const __m256i* )( i ) )
+#define s_gather( a, i, k ) _mm256_mask_i32gather_ps( _mm256_setzero_ps(), a, i, _mm256_castsi256_ps( k ), 4 )
+#define s_mask( r )  _mm256_cmpgt_epi32( _mm256_set1_epi32( r ), \
+                                         _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) )
+#define s_vl         8
+#define s_idx_max    INT32_MAX
+
+#define d_vec        __m256d
+#define d_idx_t      int64_t
+#define d_set1       _mm256_set1_pd
+#define d_setsgn     _mm256_setr_pd( 0.0, -0.0, 0.0, -0.0 )
+#define d_mul        _mm256_mul_pd
+#define d_xor        _mm256_xor_pd
+#define d_maskload   _mm256_maskload_pd
+#define d_maskstore  _mm256_maskstore_pd
+#define d_loadidx( i )    _mm256_loadu_si256( ( const __m256i* )( i ) )
+#define d_gather( a, i, k ) _mm256_mask_i64gather_pd( _mm256_setzero_pd(), a, i, _mm256_castsi256_pd( k ), 8 )
+#define d_mask( r )  _mm256_cmpgt_epi64( _mm256_set1_epi64x( r ), \
+                                         _mm256_setr_epi64x( 0, 1, 2, 3 ) )
+#define d_vl         4
+#define d_idx_max    INT64_MAX
+
+#define PACKM_INT_MXN( ctype, ctype_r, ch, chr, dfac ) \
+\
+void PASTEMAC(ch,packm_haswell_int_mxn) \
+     ( \
+             conj_t conja, \
+             dim_t  m, \
+             dim_t  n, \
+       const void*  kappa, \
+       const void*  a, inc_t inca, inc_t lda, \
+             void*  p, inc_t incp, inc_t ldp  \
+     ) \
+{ \
+	const ctype_r* kappa_r = kappa; \
+\
+	/* The number of real elements in each column of the micropanel. */ \
+	const dim_t m_r = m * dfac; \
+\
+	if ( incp != 1 || m_r > 2*chr##_vl || \
+	     ( dfac == 2 && kappa_r[ dfac - 1 ] != 0 ) || \
+	     bli_abs( inca ) * dfac > chr##_idx_max / ( 2*chr##_vl ) ) \
+	{ \
+		PASTEMAC(ch,scal2bbs_mxn) \
+		( \
+		  conja, m, n, kappa, \
+		  a, inca, lda, \
+		  p, incp, ldp \
+		); \
+		return; \
+	} \
+\
+	const ctype_r* restrict a_r   = a; \
+	      ctype_r* restrict p_r   = p; \
+	const inc_t             lda_r = lda * dfac; \
+	const inc_t             ldp_r = ldp * dfac; \
+\
+	const __m256i mask_0 = chr##_mask( m_r ); \
+	const __m256i mask_1 = chr##_mask( m_r - chr##_vl ); \
+\
+	const chr##_vec kv  = chr##_set1( kappa_r[ 0 ] ); \
+	const chr##_vec sgn = ( dfac == 2 && bli_is_conj( conja ) ) \
+	                      ? chr##_setsgn : chr##_set1( 0 ); \
+	chr##_vec       v_0, v_1; \
+\
+	if ( inca == 1 ) \
+	{ \
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			v_0 = chr##_maskload( a_r,             mask_0 ); \
+			v_1 = chr##_maskload( a_r + chr##_vl, mask_1 ); \
+\
+			chr##_maskstore( p_r,             mask_0, chr##_mul( chr##_xor( v_0, sgn ), kv ) ); \
+			chr##_maskstore( p_r + chr##_vl, mask_1, chr##_mul( chr##_xor( v_1, sgn ), kv ) ); \
+\
+			a_r += lda_r; \
+			p_r += ldp_r; \
+		} \
+	} \
+	else \
+	{ \
+		/* Real element l of a column is at offset (l/dfac)*inca*dfac + l%dfac. */ \
+		chr##_idx_t idx[ 2*chr##_vl ]; \
+\
+		for ( dim_t l = 0; l < 2*chr##_vl; ++l ) \
+			idx[ l ] = ( chr##_idx_t )( ( l / dfac ) * inca * dfac + l % dfac ); \
+\
+		const __m256i idx_0 = chr##_loadidx( idx ); \
+		const __m256i idx_1 = chr##_loadidx( idx + chr##_vl ); \
+\
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			v_0 = chr##_gather( a_r, idx_0, mask_0 ); \
+			v_1 = chr##_gather( a_r, idx_1, mask_1 ); \
+\
+			chr##_maskstore( p_r,             mask_0, chr##_mul( chr##_xor( v_0, sgn ), kv ) ); \
+			chr##_maskstore( p_r + chr##_vl, mask_1, chr##_mul( chr##_xor( v_1, sgn ), kv ) ); \
+\
+			a_r += lda_r; \
+			p_r += ldp_r; \
+		} \
+	} \
+}
+
+PACKM_INT_MXN( float,    float,  s, s, 1 )
+PACKM_INT_MXN( double,   double, d, d, 1 )
+PACKM_INT_MXN( scomplex, float,  c, s, 2 )
+PACKM_INT_MXN( dcomplex, double, z, d, 2 )
+
@@ -2525,6 +2525,18 @@ void bli_zgemm_haswell_asm_3x4
 	lea(mem(, rsi, 2), rsi)
 	lea(mem(, rsi, 2), rdx) // rdx = 2*cs_c;
 
+
+
+	 // now avoid loading C if beta == 0
+	vxorpd(ymm0, ymm0, ymm0) // set ymm0 to zero.
+	vucomisd(xmm0, xmm1) // set ZF if beta_r == 0.
+	sete(r8b) // r8b = ( ZF == 1 ? 1 : 0 );
+	vucomisd(xmm0, xmm2) // set ZF if beta_i == 0.
+	sete(r9b) // r9b = ( ZF == 1 ? 1 : 0 );
+	and(r8b, r9b) // set ZF if r8b & r9b == 1.
+	jne(.ZBETAZERO) // if ZF = 1, jump to beta == 0 case
+
+
 	cmp(imm(16), rsi) // set ZF if (16*cs_c) == 16.
 	jz(.ZROWSTORED) // jump to row storage case
 
@@ -2615,6 +2627,68 @@ void bli_zgemm_haswell_asm_3x4
 
 	jmp(.ZDONE) // jump to end.
 
+
+
+	label(.ZBETAZERO)
+
+	cmp(imm(16), rsi) // set ZF if (16*cs_c) == 16.
+	jz(.ZROWSTORBZ) // jump to row storage case
+
+
+
+	label(.ZGENSTORBZ)
+
+
+	vmovapd(ymm4, ymm0)
+	ZGEMM_OUTPUT_GS
+	add(rdx, rcx) // c += 2*cs_c;
+
+
+	vmovapd(ymm5, ymm0)
+	ZGEMM_OUTPUT_GS
+	mov(r11, rcx) // rcx = c + 1*rs_c
+
+
+
+	vmovapd(ymm8, ymm0)
+	ZGEMM_OUTPUT_GS
+	add(rdx, rcx) // c += 2*cs_c;
+
+
+	vmovapd(ymm9, ymm0)
+	ZGEMM_OUTPUT_GS
+	mov(r12, rcx) // rcx = c + 2*rs_c
+
+
+
+	vmovapd(ymm12, ymm0)
+	ZGEMM_OUTPUT_GS
+	add(rdx, rcx) // c += 2*cs_c;
+
+
+	vmovapd(ymm13, ymm0)
+	ZGEMM_OUTPUT_GS
+
+
+
+	jmp(.ZDONE) // jump to end.
+
+
+
+	label(.ZROWSTORBZ)
+
+
+	vmovupd(ymm4, mem(rcx))
+	vmovupd(ymm5, mem(rcx, rdx, 1))
+
+	vmovupd(ymm8, mem(r11))
+	vmovupd(ymm9, mem(r11, rdx, 1))
+
+	vmovupd(ymm12, mem(r12))
+	vmovupd(ymm13, mem(r12, rdx, 1))
+
+
+
 	label(.ZDONE)
 
 
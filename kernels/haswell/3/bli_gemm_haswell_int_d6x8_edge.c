@@ -0,0 +1,255 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Edge-case gemm microkernels for the 6x16 (s) and 6x8 (d) haswell
+// microkernels. These are registered as BLIS_GEMM_EDGE_UKR and are called by
+// the macrokernels only for microtiles with m < MR or n < NR. The regular
+// microkernels handle such microtiles by computing a full MR x NR product
+// into a temporary buffer and then accumulating the valid part into C; here,
+// the valid part of each row of C is instead read and written directly with
+// AVX2 masked loads and stores.
+//
+// The packed micropanels have the same format as for the regular
+// microkernels, so the full MR x NR product is still computed (the rows of
+// a1 and columns of b1 beyond m and n are zero-padded by packm). Only
+// row-stored C (cs_c == 1) is updated directly, since the regular microkernels
+// are row-preferential and the framework arranges for C to be row-stored
+// whenever it can. Other storage falls back to accumulating from a
+// temporary microtile.
+//
+// The accumulators are named explicitly, rather than kept in an array, so
+// that they stay in registers for the duration of the loop over k.
+//
+
+#define s_broadcast _mm256_broadcast_ss
+#define s_fmadd     _mm256_fmadd_ps
+#define s_mul       _mm256_mul_ps
+#define s_maskload  _mm256_maskload_ps
+#define s_maskstore _mm256_maskstore_ps
+#define s_storeu    _mm256_storeu_ps
+#define s_vl        8
+
+#define d_broadcast _mm256_broadcast_sd
+#define d_fmadd     _mm256_fmadd_pd
+#define d_mul       _mm256_mul_pd
+#define d_maskload  _mm256_maskload_pd
+#define d_maskstore _mm256_maskstore_pd
+#define d_storeu    _mm256_storeu_pd
+#define d_vl        4
+
+#define EDGE_FMA( ch, i ) \
+	a_i = ch##_broadcast( a + i ); \
+	ab##i##_0 = ch##_fmadd( a_i, b_0, ab##i##_0 ); \
+	ab##i##_1 = ch##_fmadd( a_i, b_1, ab##i##_1 );
+
+#define EDGE_UPDATE_ROW( ch, i ) \
+	if ( i < m ) \
+	{ \
+		c_0 = ch##_mul( alphav, ab##i##_0 ); \
+		c_1 = ch##_mul( alphav, ab##i##_1 ); \
+		if ( !beta0z ) \
+		{ \
+			c_0 = ch##_fmadd( betav, ch##_maskload( c + i*rs_c,            mask_0 ), c_0 ); \
+			c_1 = ch##_fmadd( betav, ch##_maskload( c + i*rs_c + ch##_vl, mask_1 ), c_1 ); \
+		} \
+		ch##_maskstore( c + i*rs_c,            mask_0, c_0 ); \
+		ch##_maskstore( c + i*rs_c + ch##_vl, mask_1, c_1 ); \
+	}
+
+#define EDGE_STORE_ROW( ch, i ) \
+	ch##_storeu( ct + i*2*ch##_vl,            ch##_mul( alphav, ab##i##_0 ) ); \
+	ch##_storeu( ct + i*2*ch##_vl + ch##_vl, ch##_mul( alphav, ab##i##_1 ) );
+
+void bli_sgemm_haswell_int_6x16_edge
+     (
+             dim_t      m,
+             dim_t      n,
+             dim_t      k,
+       const void*      alpha0,
+       const void*      a0,
+       const void*      b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const float* restrict alpha = alpha0;
+	const float* restrict a     = a0;
+	const float* restrict b     = b0;
+	const float* restrict beta  = beta0;
+	      float* restrict c     = c0;
+
+	__m256 ab0_0 = _mm256_setzero_ps(), ab0_1 = _mm256_setzero_ps();
+	__m256 ab1_0 = _mm256_setzero_ps(), ab1_1 = _mm256_setzero_ps();
+	__m256 ab2_0 = _mm256_setzero_ps(), ab2_1 = _mm256_setzero_ps();
+	__m256 ab3_0 = _mm256_setzero_ps(), ab3_1 = _mm256_setzero_ps();
+	__m256 ab4_0 = _mm256_setzero_ps(), ab4_1 = _mm256_setzero_ps();
+	__m256 ab5_0 = _mm256_setzero_ps(), ab5_1 = _mm256_setzero_ps();
+	__m256 b_0, b_1, a_i;
+
+	// Accumulate the 6 x 16 product.
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		b_0 = _mm256_loadu_ps( b + 0 );
+		b_1 = _mm256_loadu_ps( b + 8 );
+
+		EDGE_FMA( s, 0 )
+		EDGE_FMA( s, 1 )
+		EDGE_FMA( s, 2 )
+		EDGE_FMA( s, 3 )
+		EDGE_FMA( s, 4 )
+		EDGE_FMA( s, 5 )
+
+		a += 6;
+		b += 16;
+	}
+
+	const __m256  alphav = _mm256_broadcast_ss( alpha );
+	const __m256  betav  = _mm256_broadcast_ss( beta );
+	const bool    beta0z = bli_seq0( *beta );
+
+	if ( cs_c == 1 )
+	{
+		// Mask the columns j < n of each row.
+		const __m256i nv     = _mm256_set1_epi32( ( int )n );
+		const __m256i mask_0 = _mm256_cmpgt_epi32( nv, _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) );
+		const __m256i mask_1 = _mm256_cmpgt_epi32( nv, _mm256_setr_epi32( 8, 9, 10, 11, 12, 13, 14, 15 ) );
+		__m256 c_0, c_1;
+
+		EDGE_UPDATE_ROW( s, 0 )
+		EDGE_UPDATE_ROW( s, 1 )
+		EDGE_UPDATE_ROW( s, 2 )
+		EDGE_UPDATE_ROW( s, 3 )
+		EDGE_UPDATE_ROW( s, 4 )
+		EDGE_UPDATE_ROW( s, 5 )
+	}
+	else
+	{
+		float ct[ 6 * 16 ];
+
+		EDGE_STORE_ROW( s, 0 )
+		EDGE_STORE_ROW( s, 1 )
+		EDGE_STORE_ROW( s, 2 )
+		EDGE_STORE_ROW( s, 3 )
+		EDGE_STORE_ROW( s, 4 )
+		EDGE_STORE_ROW( s, 5 )
+
+		bli_txpbys_mxn( s,s,s,s, m, n, ct, 16, 1, beta, c, rs_c, cs_c );
+	}
+}
+
+void bli_dgemm_haswell_int_6x8_edge
+     (
+             dim_t      m,
+             dim_t      n,
+             dim_t      k,
+       const void*      alpha0,
+       const void*      a0,
+       const void*      b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const double* restrict alpha = alpha0;
+	const double* restrict a     = a0;
+	const double* restrict b     = b0;
+	const double* restrict beta  = beta0;
+	      double* restrict c     = c0;
+
+	__m256d ab0_0 = _mm256_setzero_pd(), ab0_1 = _mm256_setzero_pd();
+	__m256d ab1_0 = _mm256_setzero_pd(), ab1_1 = _mm256_setzero_pd();
+	__m256d ab2_0 = _mm256_setzero_pd(), ab2_1 = _mm256_setzero_pd();
+	__m256d ab3_0 = _mm256_setzero_pd(), ab3_1 = _mm256_setzero_pd();
+	__m256d ab4_0 = _mm256_setzero_pd(), ab4_1 = _mm256_setzero_pd();
+	__m256d ab5_0 = _mm256_setzero_pd(), ab5_1 = _mm256_setzero_pd();
+	__m256d b_0, b_1, a_i;
+
+	// Accumulate the 6 x 8 product.
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		b_0 = _mm256_loadu_pd( b + 0 );
+		b_1 = _mm256_loadu_pd( b + 4 );
+
+		EDGE_FMA( d, 0 )
+		EDGE_FMA( d, 1 )
+		EDGE_FMA( d, 2 )
+		EDGE_FMA( d, 3 )
+		EDGE_FMA( d, 4 )
+		EDGE_FMA( d, 5 )
+
+		a += 6;
+		b += 8;
+	}
+
+	const __m256d alphav = _mm256_broadcast_sd( alpha );
+	const __m256d betav  = _mm256_broadcast_sd( beta );
+	const bool    beta0z = bli_deq0( *beta );
+
+	if ( cs_c == 1 )
+	{
+		// Mask the columns j < n of each row.
+		const __m256i nv     = _mm256_set1_epi64x( n );
+		const __m256i mask_0 = _mm256_cmpgt_epi64( nv, _mm256_setr_epi64x( 0, 1, 2, 3 ) );
+		const __m256i mask_1 = _mm256_cmpgt_epi64( nv, _mm256_setr_epi64x( 4, 5, 6, 7 ) );
+		__m256d c_0, c_1;
+
+		EDGE_UPDATE_ROW( d, 0 )
+		EDGE_UPDATE_ROW( d, 1 )
+		EDGE_UPDATE_ROW( d, 2 )
+		EDGE_UPDATE_ROW( d, 3 )
+		EDGE_UPDATE_ROW( d, 4 )
+		EDGE_UPDATE_ROW( d, 5 )
+	}
+	else
+	{
+		double ct[ 6 * 8 ];
+
+		EDGE_STORE_ROW( d, 0 )
+		EDGE_STORE_ROW( d, 1 )
+		EDGE_STORE_ROW( d, 2 )
+		EDGE_STORE_ROW( d, 3 )
+		EDGE_STORE_ROW( d, 4 )
+		EDGE_STORE_ROW( d, 5 )
+
+		bli_txpbys_mxn( d,d,d,d, m, n, ct, 8, 1, beta, c, rs_c, cs_c );
+	}
+}
+
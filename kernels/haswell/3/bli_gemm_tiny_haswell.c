@@ -0,0 +1,252 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Tiny gemm kernels for haswell. These are registered as BLIS_GEMM_TINY_UKR
+// and are called by bli_?gemm_tiny(), which guarantees that C and A have unit
+// row stride and that m <= BLIS_GEMM_TINY_MAX. Nothing is packed: each column
+// of A is loaded once per k iteration as one to four AVX2 vectors (the last
+// of which is loaded and stored with a mask if m is not a multiple of the
+// vector length), and each element of B is broadcast directly from memory.
+//
+// A separate kernel is generated for every m, so that the number of vectors
+// per column of C, the mask, and the number of columns of C computed at a
+// time are all compile-time constants. The accumulators are named explicitly
+// so that they stay in registers for the duration of the loop over k.
+//
+
+#define s_vec        __m256
+#define s_setzero    _mm256_setzero_ps
+#define s_broadcast  _mm256_broadcast_ss
+#define s_fmadd      _mm256_fmadd_ps
+#define s_mul        _mm256_mul_ps
+#define s_loadu      _mm256_loadu_ps
+#define s_storeu     _mm256_storeu_ps
+#define s_maskload   _mm256_maskload_ps
+#define s_maskstore  _mm256_maskstore_ps
+#define s_mask( r )  _mm256_cmpgt_epi32( _mm256_set1_epi32( r ), \
+                                         _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) )
+#define s_vl         8
+
+#define d_vec        __m256d
+#define d_setzero    _mm256_setzero_pd
+#define d_broadcast  _mm256_broadcast_sd
+#define d_fmadd      _mm256_fmadd_pd
+#define d_mul        _mm256_mul_pd
+#define d_loadu      _mm256_loadu_pd
+#define d_storeu     _mm256_storeu_pd
+#define d_maskload   _mm256_maskload_pd
+#define d_maskstore  _mm256_maskstore_pd
+#define d_mask( r )  _mm256_cmpgt_epi64( _mm256_set1_epi64x( r ), \
+                                         _mm256_setr_epi64x( 0, 1, 2, 3 ) )
+#define d_vl         4
+
+// Load vector v of the current column of A.
+#define TINY_LOAD_A( ch, v ) \
+	( v == NV - 1 && MR != 0 ? ch##_maskload( ap + v*ch##_vl, mask ) \
+	                         : ch##_loadu( ap + v*ch##_vl ) )
+
+// Accumulate the contribution of vector v of the current column of A.
+#define TINY_FMA( ch, v, nb ) \
+	if ( v < NV ) \
+	{ \
+		a_v = TINY_LOAD_A( ch, v ); \
+		              c##v##_0 = ch##_fmadd( a_v, b_0, c##v##_0 ); \
+		if ( nb > 1 ) c##v##_1 = ch##_fmadd( a_v, b_1, c##v##_1 ); \
+		if ( nb > 2 ) c##v##_2 = ch##_fmadd( a_v, b_2, c##v##_2 ); \
+		if ( nb > 3 ) c##v##_3 = ch##_fmadd( a_v, b_3, c##v##_3 ); \
+	}
+
+// Update vector v of column jj of the current block of C.
+#define TINY_UPDATE( ch, v, jj, nb ) \
+	if ( v < NV && jj < nb ) \
+	{ \
+		ch##_vec ct = ch##_mul( alphav, c##v##_##jj ); \
+\
+		if ( v == NV - 1 && MR != 0 ) \
+		{ \
+			if ( !beta0z ) \
+				ct = ch##_fmadd( betav, ch##_maskload( cj + v*ch##_vl + jj*cs_c, mask ), ct ); \
+			ch##_maskstore( cj + v*ch##_vl + jj*cs_c, mask, ct ); \
+		} \
+		else \
+		{ \
+			if ( !beta0z ) \
+				ct = ch##_fmadd( betav, ch##_loadu( cj + v*ch##_vl + jj*cs_c ), ct ); \
+			ch##_storeu( cj + v*ch##_vl + jj*cs_c, ct ); \
+		} \
+	}
+
+#define TINY_UPDATE_COL( ch, jj, nb ) \
+	TINY_UPDATE( ch, 0, jj, nb ) \
+	TINY_UPDATE( ch, 1, jj, nb ) \
+	TINY_UPDATE( ch, 2, jj, nb ) \
+	TINY_UPDATE( ch, 3, jj, nb )
+
+// Compute columns j through j+nb-1 of C.
+#define TINY_BLOCK( ctype, ch, nb ) \
+{ \
+	ch##_vec c0_0 = ch##_setzero(), c0_1 = ch##_setzero(), c0_2 = ch##_setzero(), c0_3 = ch##_setzero(); \
+	ch##_vec c1_0 = ch##_setzero(), c1_1 = ch##_setzero(), c1_2 = ch##_setzero(), c1_3 = ch##_setzero(); \
+	ch##_vec c2_0 = ch##_setzero(), c2_1 = ch##_setzero(), c2_2 = ch##_setzero(), c2_3 = ch##_setzero(); \
+	ch##_vec c3_0 = ch##_setzero(), c3_1 = ch##_setzero(), c3_2 = ch##_setzero(), c3_3 = ch##_setzero(); \
+	ch##_vec b_0, b_1, b_2, b_3, a_v; \
+\
+	const ctype* restrict ap = a; \
+	const ctype* restrict bp = b + j*cs_b; \
+\
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		              b_0 = ch##_broadcast( bp + 0*cs_b ); \
+		if ( nb > 1 ) b_1 = ch##_broadcast( bp + 1*cs_b ); \
+		if ( nb > 2 ) b_2 = ch##_broadcast( bp + 2*cs_b ); \
+		if ( nb > 3 ) b_3 = ch##_broadcast( bp + 3*cs_b ); \
+\
+		TINY_FMA( ch, 0, nb ) \
+		TINY_FMA( ch, 1, nb ) \
+		TINY_FMA( ch, 2, nb ) \
+		TINY_FMA( ch, 3, nb ) \
+\
+		ap += cs_a; \
+		bp += rs_b; \
+	} \
+\
+	ctype* restrict cj = c + j*cs_c; \
+\
+	TINY_UPDATE_COL( ch, 0, nb ) \
+	TINY_UPDATE_COL( ch, 1, nb ) \
+	TINY_UPDATE_COL( ch, 2, nb ) \
+	TINY_UPDATE_COL( ch, 3, nb ) \
+}
+
+// Define the kernel for m = M. Up to four columns of C are computed at a
+// time, with fewer when the accumulators, the broadcast elements of B, and
+// the current vector of A would otherwise not fit in the 16 ymm registers.
+#define TINY_KER_M( ctype, ch, M ) \
+\
+static void PASTEMAC(ch,gemm_tiny_haswell_m,M) \
+     ( \
+             dim_t           n, \
+             dim_t           k, \
+       const ctype* restrict alpha, \
+       const ctype* restrict a, inc_t cs_a, \
+       const ctype* restrict b, inc_t rs_b, inc_t cs_b, \
+       const ctype* restrict beta, \
+             ctype* restrict c, inc_t cs_c  \
+     ) \
+{ \
+	enum \
+	{ \
+		NV = ( M + ch##_vl - 1 ) / ch##_vl, \
+		MR = M % ch##_vl, \
+		NB = ( NV <= 2 ? 4 : 3 ) \
+	}; \
+\
+	const __m256i  mask   = ch##_mask( MR ); \
+	const ch##_vec alphav = ch##_broadcast( alpha ); \
+	const ch##_vec betav  = ch##_broadcast( beta ); \
+	const bool     beta0z = PASTEMAC(ch,eq0)( *beta ); \
+\
+	dim_t j = 0; \
+\
+	for ( ; j + NB <= n; j += NB ) \
+		TINY_BLOCK( ctype, ch, NB ) \
+\
+	for ( ; j < n; ++j ) \
+		TINY_BLOCK( ctype, ch, 1 ) \
+}
+
+#define TINY_KER_ENTRY( ctype, ch, M ) PASTEMAC(ch,gemm_tiny_haswell_m,M),
+
+#define TINY_INSERT_M( macro, ctype, ch ) \
+\
+macro( ctype, ch,  1 ) macro( ctype, ch,  2 ) macro( ctype, ch,  3 ) macro( ctype, ch,  4 ) \
+macro( ctype, ch,  5 ) macro( ctype, ch,  6 ) macro( ctype, ch,  7 ) macro( ctype, ch,  8 ) \
+macro( ctype, ch,  9 ) macro( ctype, ch, 10 ) macro( ctype, ch, 11 ) macro( ctype, ch, 12 ) \
+macro( ctype, ch, 13 ) macro( ctype, ch, 14 ) macro( ctype, ch, 15 ) macro( ctype, ch, 16 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+TINY_INSERT_M( TINY_KER_M, ctype, ch ) \
+\
+typedef void (*PASTECH(ch,gemm_tiny_haswell_ft)) \
+     ( \
+             dim_t           n, \
+             dim_t           k, \
+       const ctype* restrict alpha, \
+       const ctype* restrict a, inc_t cs_a, \
+       const ctype* restrict b, inc_t rs_b, inc_t cs_b, \
+       const ctype* restrict beta, \
+             ctype* restrict c, inc_t cs_c  \
+     ); \
+\
+static PASTECH(ch,gemm_tiny_haswell_ft) PASTECH(ch,gemm_tiny_haswell_table)[ BLIS_GEMM_TINY_MAX ] = \
+{ \
+	TINY_INSERT_M( TINY_KER_ENTRY, ctype, ch ) \
+}; \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t     conja, \
+             conj_t     conjb, \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha, \
+       const void*      a, inc_t rs_a, inc_t cs_a, \
+       const void*      b, inc_t rs_b, inc_t cs_b, \
+       const void*      beta, \
+             void*      c, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	PASTECH(ch,gemm_tiny_haswell_table)[ m - 1 ] \
+	( \
+	  n, k, \
+	  alpha, \
+	  a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, cs_c \
+	); \
+}
+
+GENTFUNC( float,  s, gemm_tiny_haswell )
+GENTFUNC( double, d, gemm_tiny_haswell )
+
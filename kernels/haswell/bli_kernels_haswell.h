@@ -41,6 +41,28 @@ PACKM_KER_PROT( double,   d, packm_haswell_asm_6x8 )
 PACKM_KER_PROT( scomplex, c, packm_haswell_asm_3x8 )
 PACKM_KER_PROT( dcomplex, z, packm_haswell_asm_3x4 )
 
+// packm (intrinsics, fallback for the asm kernels)
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t conja, \
+             dim_t  m, \
+             dim_t  n, \
+       const void*  kappa, \
+       const void*  a, inc_t inca, inc_t lda, \
+             void*  p, inc_t incp, inc_t ldp  \
+     );
+
+INSERT_GENTPROT_BASIC( packm_haswell_int_mxn )
+
+// packm (intrinsics, mixed precision)
+PACKM_KER_PROT2( float,    double,   s, d, packm_haswell_int_6x8 )
+PACKM_KER_PROT2( double,   float,    d, s, packm_haswell_int_6x16 )
+PACKM_KER_PROT2( scomplex, dcomplex, c, z, packm_haswell_int_3x4 )
+PACKM_KER_PROT2( dcomplex, scomplex, z, c, packm_haswell_int_3x8 )
+
 
 // -- level-3 ------------------------------------------------------------------
 
@@ -50,6 +72,14 @@ GEMM_UKR_PROT( double,   d, gemm_haswell_asm_6x8 )
 GEMM_UKR_PROT( scomplex, c, gemm_haswell_asm_3x8 )
 GEMM_UKR_PROT( dcomplex, z, gemm_haswell_asm_3x4 )
 
+// gemm (int d6x8, edge cases)
+GEMM_UKR_PROT( float,    s, gemm_haswell_int_6x16_edge )
+GEMM_UKR_PROT( double,   d, gemm_haswell_int_6x8_edge )
+
+// gemm (int, tiny)
+GEMMTINY_KER_PROT( float,    s, gemm_tiny_haswell )
+GEMMTINY_KER_PROT( double,   d, gemm_tiny_haswell )
+
 // gemm (asm d8x6)
 GEMM_UKR_PROT( float,    s, gemm_haswell_asm_16x6 )
 GEMM_UKR_PROT( double,   d, gemm_haswell_asm_8x6 )
@@ -0,0 +1,190 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// AVX-512 packm kernels for the skx microkernels: 32x12 (s), 16x14 (d),
+// 6x16 (c), and 6x8 (z). A column of any of these micropanels (MR or NR
+// elements, with complex elements counted as interleaved real/imaginary
+// pairs) fits in at most two AVX-512 vectors, so all eight micropanel shapes
+// are handled by the same code: each column is read with masked loads when
+// inca == 1 and with masked gathers otherwise, scaled by kappa, conjugated
+// (for complex types) by flipping the sign of the imaginary parts, and
+// written with masked stores.
+//
+// As with the other packm kernels, inca and lda are read as rs_a and cs_a,
+// and ldp as cs_p (with rs_p implicitly unit). Broadcast factors other than
+// one, complex kappa with a nonzero imaginary part, and (for single
+// precision) strides too large for 32-bit gather indices are handled by
+// bli_?scal2bbs_mxn().
+//
+
+#define s_vec        __m512
+#define s_mask_t     __mmask16
+#define s_idx_t      int32_t
+#define s_set1       _mm512_set1_ps
+#define s_setsgn     _mm512_castsi512_ps( _mm512_set1_epi64( ( int64_t )0x8000000000000000ULL ) )
+#define s_mul        _mm512_mul_ps
+#define s_xor        _mm512_xor_ps
+#define s_maskload   _mm512_maskz_loadu_ps
+#define s_maskstore  _mm512_mask_storeu_ps
+#define s_loadidx( i )      _mm512_loadu_si512( i )
+#define s_gather( k, i, a ) _mm512_mask_i32gather_ps( _mm512_setzero_ps(), k, i, a, 4 )
+#define s_mask( r )  ( s_mask_t )( ( r ) <= 0 ? 0 : ( r ) >= 16 ? 0xFFFF : ( 1u << ( r ) ) - 1 )
+#define s_vl         16
+#define s_idx_max    INT32_MAX
+
+#define d_vec        __m512d
+#define d_mask_t     __mmask8
+#define d_idx_t      int64_t
+#define d_set1       _mm512_set1_pd
+#define d_setsgn     _mm512_castsi512_pd( _mm512_setr_epi64( 0, ( int64_t )0x8000000000000000ULL, \
+                                                              0, ( int64_t )0x8000000000000000ULL, \
+                                                              0, ( int64_t )0x8000000000000000ULL, \
+                                                              0, ( int64_t )0x8000000000000000ULL ) )
+#define d_mul        _mm512_mul_pd
+#define d_xor        _mm512_xor_pd
+#define d_maskload   _mm512_maskz_loadu_pd
+#define d_maskstore  _mm512_mask_storeu_pd
+#define d_loadidx( i )      _mm512_loadu_si512( i )
+#define d_gather( k, i, a ) _mm512_mask_i64gather_pd( _mm512_setzero_pd(), k, i, a, 8 )
+#define d_mask( r )  ( d_mask_t )( ( r ) <= 0 ? 0 : ( r ) >= 8 ? 0xFF : ( 1u << ( r ) ) - 1 )
+#define d_vl         8
+#define d_idx_max    INT64_MAX
+
+#define PACKM_SKX_INT( ctype, ctype_r, ch, chr, dfac, mr, nr ) \
+\
+void PASTEMAC(ch,packm_skx_int_,mr,x,nr) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   cdim, \
+             dim_t   cdim_max, \
+             dim_t   cdim_bcast, \
+             dim_t   n, \
+             dim_t   n_max, \
+       const void*   kappa, \
+       const void*   a, inc_t inca, inc_t lda, \
+             void*   p,             inc_t ldp, \
+       const void*   params, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype_r* kappa_r = kappa; \
+\
+	/* The number of real elements in each column of the micropanel. */ \
+	const dim_t cdim_r = cdim * dfac; \
+\
+	if ( cdim_bcast != 1 || cdim_r > 2*chr##_vl || \
+	     ( dfac == 2 && kappa_r[ dfac - 1 ] != 0 ) || \
+	     bli_abs( inca ) * dfac > chr##_idx_max / ( 2*chr##_vl ) ) \
+	{ \
+		PASTEMAC(ch,scal2bbs_mxn) \
+		( \
+		  conja, \
+		  cdim, \
+		  n, \
+		  kappa, \
+		  a, inca, lda, \
+		  p, cdim_bcast, ldp \
+		); \
+	} \
+	else \
+	{ \
+		const ctype_r* restrict a_r   = a; \
+		      ctype_r* restrict p_r   = p; \
+		const inc_t             lda_r = lda * dfac; \
+		const inc_t             ldp_r = ldp * dfac; \
+\
+		const chr##_mask_t mask_0 = chr##_mask( cdim_r ); \
+		const chr##_mask_t mask_1 = chr##_mask( cdim_r - chr##_vl ); \
+\
+		const chr##_vec kv  = chr##_set1( kappa_r[ 0 ] ); \
+		const chr##_vec sgn = ( dfac == 2 && bli_is_conj( conja ) ) \
+		                      ? chr##_setsgn : chr##_set1( 0 ); \
+		chr##_vec       v_0, v_1; \
+\
+		if ( inca == 1 ) \
+		{ \
+			for ( dim_t k = 0; k < n; ++k ) \
+			{ \
+				v_0 = chr##_maskload( mask_0, a_r             ); \
+				v_1 = chr##_maskload( mask_1, a_r + chr##_vl ); \
+\
+				chr##_maskstore( p_r,             mask_0, chr##_mul( chr##_xor( v_0, sgn ), kv ) ); \
+				chr##_maskstore( p_r + chr##_vl, mask_1, chr##_mul( chr##_xor( v_1, sgn ), kv ) ); \
+\
+				a_r += lda_r; \
+				p_r += ldp_r; \
+			} \
+		} \
+		else \
+		{ \
+			/* Real element l of a column is at offset (l/dfac)*inca*dfac + l%dfac. */ \
+			chr##_idx_t idx[ 2*chr##_vl ]; \
+\
+			for ( dim_t l = 0; l < 2*chr##_vl; ++l ) \
+				idx[ l ] = ( chr##_idx_t )( ( l / dfac ) * inca * dfac + l % dfac ); \
+\
+			const __m512i idx_0 = chr##_loadidx( idx ); \
+			const __m512i idx_1 = chr##_loadidx( idx + chr##_vl ); \
+\
+			for ( dim_t k = 0; k < n; ++k ) \
+			{ \
+				v_0 = chr##_gather( mask_0, idx_0, a_r ); \
+				v_1 = chr##_gather( mask_1, idx_1, a_r ); \
+\
+				chr##_maskstore( p_r,             mask_0, chr##_mul( chr##_xor( v_0, sgn ), kv ) ); \
+				chr##_maskstore( p_r + chr##_vl, mask_1, chr##_mul( chr##_xor( v_1, sgn ), kv ) ); \
+\
+				a_r += lda_r; \
+				p_r += ldp_r; \
+			} \
+		} \
+	} \
+\
+	PASTEMAC(ch,set0s_edge) \
+	( \
+	  cdim*cdim_bcast, cdim_max*cdim_bcast, \
+	  n, n_max, \
+	  p, ldp  \
+	); \
+}
+
+PACKM_SKX_INT( float,    float,  s, s, 1, 32, 12 )
+PACKM_SKX_INT( double,   double, d, d, 1, 16, 14 )
+PACKM_SKX_INT( scomplex, float,  c, s, 2, 6,  16 )
+PACKM_SKX_INT( dcomplex, double, z, d, 2, 6,  8 )
+
@@ -0,0 +1,171 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Native complex gemm microkernels for skx: 6x16 (c) and 6x8 (z). These are
+// row-preferential: each row of the microtile is held in two AVX-512 vectors
+// (8 scomplex or 4 dcomplex elements each) and is updated with the columns
+// of the packed micropanel of B, while the real and imaginary parts of each
+// element of the packed micropanel of A are broadcast separately. The
+// products with the real and imaginary parts of A are kept in separate
+// accumulators, which are combined (with one permute and one fmaddsub per
+// vector) only once, after the loop over k.
+//
+// The accumulators are named explicitly so that all 24 of them stay in
+// registers for the duration of the loop over k. Edge cases and C with
+// non-unit column stride use a temporary microtile.
+//
+
+#define c_vec        __m512
+#define c_setzero    _mm512_setzero_ps
+#define c_set1       _mm512_set1_ps
+#define c_fmadd      _mm512_fmadd_ps
+#define c_fmaddsub   _mm512_fmaddsub_ps
+#define c_mul        _mm512_mul_ps
+#define c_loadu      _mm512_loadu_ps
+#define c_storeu     _mm512_storeu_ps
+#define c_swap( v )  _mm512_permute_ps( v, 0xB1 )
+#define c_vl         16
+
+#define z_vec        __m512d
+#define z_setzero    _mm512_setzero_pd
+#define z_set1       _mm512_set1_pd
+#define z_fmadd      _mm512_fmadd_pd
+#define z_fmaddsub   _mm512_fmaddsub_pd
+#define z_mul        _mm512_mul_pd
+#define z_loadu      _mm512_loadu_pd
+#define z_storeu     _mm512_storeu_pd
+#define z_swap( v )  _mm512_permute_pd( v, 0x55 )
+#define z_vl         8
+
+// Multiply the interleaved complex elements of x by the complex scalar
+// whose real and imaginary parts are broadcast in sr and si.
+#define CMPLX_SCAL( ch, sr, si, x ) \
+	ch##_fmaddsub( x, sr, ch##_mul( ch##_swap( x ), si ) )
+
+#define CMPLX_FMA( ch, i ) \
+	a_r = ch##_set1( a[ 2*i + 0 ] ); \
+	a_i = ch##_set1( a[ 2*i + 1 ] ); \
+	abr##i##_0 = ch##_fmadd( a_r, b_0, abr##i##_0 ); \
+	abr##i##_1 = ch##_fmadd( a_r, b_1, abr##i##_1 ); \
+	abi##i##_0 = ch##_fmadd( a_i, b_0, abi##i##_0 ); \
+	abi##i##_1 = ch##_fmadd( a_i, b_1, abi##i##_1 );
+
+#define CMPLX_UPDATE_VEC( ch, i, v ) \
+	ab = ch##_fmaddsub( abr##i##_##v, one, ch##_swap( abi##i##_##v ) ); \
+	ab = CMPLX_SCAL( ch, alpha_r, alpha_i, ab ); \
+	if ( !beta0z ) \
+	{ \
+		cv = ch##_loadu( c_r + 2*i*rs_c + v*ch##_vl ); \
+		ab = ch##_fmadd( one, CMPLX_SCAL( ch, beta_r, beta_i, cv ), ab ); \
+	} \
+	ch##_storeu( c_r + 2*i*rs_c + v*ch##_vl, ab );
+
+#define CMPLX_UPDATE_ROW( ch, i ) \
+	CMPLX_UPDATE_VEC( ch, i, 0 ) \
+	CMPLX_UPDATE_VEC( ch, i, 1 )
+
+#define CMPLX_UKR( ctype, ctype_r, ch, mr, nr ) \
+\
+void PASTEMAC(ch,gemm_skx_int_,mr,x,nr) \
+     ( \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha0, \
+       const void*      a0, \
+       const void*      b0, \
+       const void*      beta0, \
+             void*      c0, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const ctype*          alpha = alpha0; \
+	const ctype*          beta  = beta0; \
+	      ctype*          c     = c0; \
+\
+	GEMM_UKR_SETUP_CT( ch, mr, nr, true ); \
+\
+	const ctype_r* restrict a   = a0; \
+	const ctype_r* restrict b   = b0; \
+	      ctype_r* restrict c_r = ( ctype_r* )c; \
+\
+	ch##_vec abr0_0 = ch##_setzero(), abr0_1 = ch##_setzero(), abi0_0 = ch##_setzero(), abi0_1 = ch##_setzero(); \
+	ch##_vec abr1_0 = ch##_setzero(), abr1_1 = ch##_setzero(), abi1_0 = ch##_setzero(), abi1_1 = ch##_setzero(); \
+	ch##_vec abr2_0 = ch##_setzero(), abr2_1 = ch##_setzero(), abi2_0 = ch##_setzero(), abi2_1 = ch##_setzero(); \
+	ch##_vec abr3_0 = ch##_setzero(), abr3_1 = ch##_setzero(), abi3_0 = ch##_setzero(), abi3_1 = ch##_setzero(); \
+	ch##_vec abr4_0 = ch##_setzero(), abr4_1 = ch##_setzero(), abi4_0 = ch##_setzero(), abi4_1 = ch##_setzero(); \
+	ch##_vec abr5_0 = ch##_setzero(), abr5_1 = ch##_setzero(), abi5_0 = ch##_setzero(), abi5_1 = ch##_setzero(); \
+	ch##_vec b_0, b_1, a_r, a_i; \
+\
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		b_0 = ch##_loadu( b ); \
+		b_1 = ch##_loadu( b + ch##_vl ); \
+\
+		CMPLX_FMA( ch, 0 ) \
+		CMPLX_FMA( ch, 1 ) \
+		CMPLX_FMA( ch, 2 ) \
+		CMPLX_FMA( ch, 3 ) \
+		CMPLX_FMA( ch, 4 ) \
+		CMPLX_FMA( ch, 5 ) \
+\
+		a += 2*mr; \
+		b += 2*nr; \
+	} \
+\
+	const ch##_vec one     = ch##_set1( 1 ); \
+	const ch##_vec alpha_r = ch##_set1( PASTEMAC(ch,real)( *alpha ) ); \
+	const ch##_vec alpha_i = ch##_set1( PASTEMAC(ch,imag)( *alpha ) ); \
+	const ch##_vec beta_r  = ch##_set1( PASTEMAC(ch,real)( *beta ) ); \
+	const ch##_vec beta_i  = ch##_set1( PASTEMAC(ch,imag)( *beta ) ); \
+	const bool     beta0z  = PASTEMAC(ch,eq0)( *beta ); \
+	ch##_vec       ab, cv; \
+\
+	CMPLX_UPDATE_ROW( ch, 0 ) \
+	CMPLX_UPDATE_ROW( ch, 1 ) \
+	CMPLX_UPDATE_ROW( ch, 2 ) \
+	CMPLX_UPDATE_ROW( ch, 3 ) \
+	CMPLX_UPDATE_ROW( ch, 4 ) \
+	CMPLX_UPDATE_ROW( ch, 5 ) \
+\
+	GEMM_UKR_FLUSH_CT( ch ); \
+}
+
+CMPLX_UKR( scomplex, float,  c, 6, 16 )
+CMPLX_UKR( dcomplex, double, z, 6, 8 )
+
@@ -0,0 +1,304 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Edge-case gemm microkernels for the 32x12 (s) and 16x14 (d) skx
+// microkernels. These are registered as BLIS_GEMM_EDGE_UKR and are called by
+// the macrokernels only for microtiles with m < MR or n < NR. Rather than
+// computing into a temporary microtile and accumulating its valid part into
+// C, the valid part of each column of C is read and written directly with
+// AVX-512 masked loads and stores.
+//
+// The full MR x NR product is computed from the (zero-padded) packed
+// micropanels. Only column-stored C (rs_c == 1), which is the storage
+// preference of the regular microkernels, is updated directly; other
+// storage falls back to accumulating from a temporary microtile. As in the
+// haswell edge-case microkernels, the accumulators are named explicitly so
+// that they stay in registers for the duration of the loop over k.
+//
+
+#define s_set1      _mm512_set1_ps
+#define s_fmadd     _mm512_fmadd_ps
+#define s_mul       _mm512_mul_ps
+#define s_maskload  _mm512_maskz_loadu_ps
+#define s_maskstore _mm512_mask_storeu_ps
+#define s_storeu    _mm512_storeu_ps
+#define s_vl        16
+
+#define d_set1      _mm512_set1_pd
+#define d_fmadd     _mm512_fmadd_pd
+#define d_mul       _mm512_mul_pd
+#define d_maskload  _mm512_maskz_loadu_pd
+#define d_maskstore _mm512_mask_storeu_pd
+#define d_storeu    _mm512_storeu_pd
+#define d_vl        8
+
+#define EDGE_FMA( ch, j ) \
+	b_j = ch##_set1( b[ j ] ); \
+	ab##j##_0 = ch##_fmadd( a_0, b_j, ab##j##_0 ); \
+	ab##j##_1 = ch##_fmadd( a_1, b_j, ab##j##_1 );
+
+#define EDGE_UPDATE_COL( ch, j ) \
+	if ( j < n ) \
+	{ \
+		c_0 = ch##_mul( alphav, ab##j##_0 ); \
+		c_1 = ch##_mul( alphav, ab##j##_1 ); \
+		if ( !beta0z ) \
+		{ \
+			c_0 = ch##_fmadd( betav, ch##_maskload( mask_0, c + j*cs_c            ), c_0 ); \
+			c_1 = ch##_fmadd( betav, ch##_maskload( mask_1, c + j*cs_c + ch##_vl ), c_1 ); \
+		} \
+		ch##_maskstore( c + j*cs_c,            mask_0, c_0 ); \
+		ch##_maskstore( c + j*cs_c + ch##_vl, mask_1, c_1 ); \
+	}
+
+#define EDGE_STORE_COL( ch, j ) \
+	ch##_storeu( ct + j*2*ch##_vl,            ch##_mul( alphav, ab##j##_0 ) ); \
+	ch##_storeu( ct + j*2*ch##_vl + ch##_vl, ch##_mul( alphav, ab##j##_1 ) );
+
+void bli_sgemm_skx_int_32x12_edge
+     (
+             dim_t      m,
+             dim_t      n,
+             dim_t      k,
+       const void*      alpha0,
+       const void*      a0,
+       const void*      b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const float* restrict alpha = alpha0;
+	const float* restrict a     = a0;
+	const float* restrict b     = b0;
+	const float* restrict beta  = beta0;
+	      float* restrict c     = c0;
+
+	__m512 ab0_0 = _mm512_setzero_ps(), ab0_1 = _mm512_setzero_ps();
+	__m512 ab1_0 = _mm512_setzero_ps(), ab1_1 = _mm512_setzero_ps();
+	__m512 ab2_0 = _mm512_setzero_ps(), ab2_1 = _mm512_setzero_ps();
+	__m512 ab3_0 = _mm512_setzero_ps(), ab3_1 = _mm512_setzero_ps();
+	__m512 ab4_0 = _mm512_setzero_ps(), ab4_1 = _mm512_setzero_ps();
+	__m512 ab5_0 = _mm512_setzero_ps(), ab5_1 = _mm512_setzero_ps();
+	__m512 ab6_0 = _mm512_setzero_ps(), ab6_1 = _mm512_setzero_ps();
+	__m512 ab7_0 = _mm512_setzero_ps(), ab7_1 = _mm512_setzero_ps();
+	__m512 ab8_0 = _mm512_setzero_ps(), ab8_1 = _mm512_setzero_ps();
+	__m512 ab9_0 = _mm512_setzero_ps(), ab9_1 = _mm512_setzero_ps();
+	__m512 ab10_0 = _mm512_setzero_ps(), ab10_1 = _mm512_setzero_ps();
+	__m512 ab11_0 = _mm512_setzero_ps(), ab11_1 = _mm512_setzero_ps();
+	__m512 a_0, a_1, b_j;
+
+	// Accumulate the 32 x 12 product.
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		a_0 = _mm512_loadu_ps( a + 0 );
+		a_1 = _mm512_loadu_ps( a + 16 );
+
+		EDGE_FMA( s, 0 )
+		EDGE_FMA( s, 1 )
+		EDGE_FMA( s, 2 )
+		EDGE_FMA( s, 3 )
+		EDGE_FMA( s, 4 )
+		EDGE_FMA( s, 5 )
+		EDGE_FMA( s, 6 )
+		EDGE_FMA( s, 7 )
+		EDGE_FMA( s, 8 )
+		EDGE_FMA( s, 9 )
+		EDGE_FMA( s, 10 )
+		EDGE_FMA( s, 11 )
+
+		a += 32;
+		b += 12;
+	}
+
+	const __m512  alphav = _mm512_set1_ps( *alpha );
+	const __m512  betav  = _mm512_set1_ps( *beta );
+	const bool    beta0z = bli_seq0( *beta );
+
+	if ( rs_c == 1 )
+	{
+		// Mask the rows i < m of each column.
+		const __mmask16 mask_0 = ( __mmask16 )( ( 1ULL << bli_min( m, 16 ) ) - 1 );
+		const __mmask16 mask_1 = ( __mmask16 )( ( 1ULL << bli_max( m - 16, 0 ) ) - 1 );
+		__m512 c_0, c_1;
+
+		EDGE_UPDATE_COL( s, 0 )
+		EDGE_UPDATE_COL( s, 1 )
+		EDGE_UPDATE_COL( s, 2 )
+		EDGE_UPDATE_COL( s, 3 )
+		EDGE_UPDATE_COL( s, 4 )
+		EDGE_UPDATE_COL( s, 5 )
+		EDGE_UPDATE_COL( s, 6 )
+		EDGE_UPDATE_COL( s, 7 )
+		EDGE_UPDATE_COL( s, 8 )
+		EDGE_UPDATE_COL( s, 9 )
+		EDGE_UPDATE_COL( s, 10 )
+		EDGE_UPDATE_COL( s, 11 )
+	}
+	else
+	{
+		float ct[ 32 * 12 ];
+
+		EDGE_STORE_COL( s, 0 )
+		EDGE_STORE_COL( s, 1 )
+		EDGE_STORE_COL( s, 2 )
+		EDGE_STORE_COL( s, 3 )
+		EDGE_STORE_COL( s, 4 )
+		EDGE_STORE_COL( s, 5 )
+		EDGE_STORE_COL( s, 6 )
+		EDGE_STORE_COL( s, 7 )
+		EDGE_STORE_COL( s, 8 )
+		EDGE_STORE_COL( s, 9 )
+		EDGE_STORE_COL( s, 10 )
+		EDGE_STORE_COL( s, 11 )
+
+		bli_txpbys_mxn( s,s,s,s, m, n, ct, 1, 32, beta, c, rs_c, cs_c );
+	}
+}
+
+void bli_dgemm_skx_int_16x14_edge
+     (
+             dim_t      m,
+             dim_t      n,
+             dim_t      k,
+       const void*      alpha0,
+       const void*      a0,
+       const void*      b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const double* restrict alpha = alpha0;
+	const double* restrict a     = a0;
+	const double* restrict b     = b0;
+	const double* restrict beta  = beta0;
+	      double* restrict c     = c0;
+
+	__m512d ab0_0 = _mm512_setzero_pd(), ab0_1 = _mm512_setzero_pd();
+	__m512d ab1_0 = _mm512_setzero_pd(), ab1_1 = _mm512_setzero_pd();
+	__m512d ab2_0 = _mm512_setzero_pd(), ab2_1 = _mm512_setzero_pd();
+	__m512d ab3_0 = _mm512_setzero_pd(), ab3_1 = _mm512_setzero_pd();
+	__m512d ab4_0 = _mm512_setzero_pd(), ab4_1 = _mm512_setzero_pd();
+	__m512d ab5_0 = _mm512_setzero_pd(), ab5_1 = _mm512_setzero_pd();
+	__m512d ab6_0 = _mm512_setzero_pd(), ab6_1 = _mm512_setzero_pd();
+	__m512d ab7_0 = _mm512_setzero_pd(), ab7_1 = _mm512_setzero_pd();
+	__m512d ab8_0 = _mm512_setzero_pd(), ab8_1 = _mm512_setzero_pd();
+	__m512d ab9_0 = _mm512_setzero_pd(), ab9_1 = _mm512_setzero_pd();
+	__m512d ab10_0 = _mm512_setzero_pd(), ab10_1 = _mm512_setzero_pd();
+	__m512d ab11_0 = _mm512_setzero_pd(), ab11_1 = _mm512_setzero_pd();
+	__m512d ab12_0 = _mm512_setzero_pd(), ab12_1 = _mm512_setzero_pd();
+	__m512d ab13_0 = _mm512_setzero_pd(), ab13_1 = _mm512_setzero_pd();
+	__m512d a_0, a_1, b_j;
+
+	// Accumulate the 16 x 14 product.
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		a_0 = _mm512_loadu_pd( a + 0 );
+		a_1 = _mm512_loadu_pd( a + 8 );
+
+		EDGE_FMA( d, 0 )
+		EDGE_FMA( d, 1 )
+		EDGE_FMA( d, 2 )
+		EDGE_FMA( d, 3 )
+		EDGE_FMA( d, 4 )
+		EDGE_FMA( d, 5 )
+		EDGE_FMA( d, 6 )
+		EDGE_FMA( d, 7 )
+		EDGE_FMA( d, 8 )
+		EDGE_FMA( d, 9 )
+		EDGE_FMA( d, 10 )
+		EDGE_FMA( d, 11 )
+		EDGE_FMA( d, 12 )
+		EDGE_FMA( d, 13 )
+
+		a += 16;
+		b += 14;
+	}
+
+	const __m512d alphav = _mm512_set1_pd( *alpha );
+	const __m512d betav  = _mm512_set1_pd( *beta );
+	const bool    beta0z = bli_deq0( *beta );
+
+	if ( rs_c == 1 )
+	{
+		// Mask the rows i < m of each column.
+		const __mmask8  mask_0 = ( __mmask8 )( ( 1U << bli_min( m, 8 ) ) - 1 );
+		const __mmask8  mask_1 = ( __mmask8 )( ( 1U << bli_max( m - 8, 0 ) ) - 1 );
+		__m512d c_0, c_1;
+
+		EDGE_UPDATE_COL( d, 0 )
+		EDGE_UPDATE_COL( d, 1 )
+		EDGE_UPDATE_COL( d, 2 )
+		EDGE_UPDATE_COL( d, 3 )
+		EDGE_UPDATE_COL( d, 4 )
+		EDGE_UPDATE_COL( d, 5 )
+		EDGE_UPDATE_COL( d, 6 )
+		EDGE_UPDATE_COL( d, 7 )
+		EDGE_UPDATE_COL( d, 8 )
+		EDGE_UPDATE_COL( d, 9 )
+		EDGE_UPDATE_COL( d, 10 )
+		EDGE_UPDATE_COL( d, 11 )
+		EDGE_UPDATE_COL( d, 12 )
+		EDGE_UPDATE_COL( d, 13 )
+	}
+	else
+	{
+		double ct[ 16 * 14 ];
+
+		EDGE_STORE_COL( d, 0 )
+		EDGE_STORE_COL( d, 1 )
+		EDGE_STORE_COL( d, 2 )
+		EDGE_STORE_COL( d, 3 )
+		EDGE_STORE_COL( d, 4 )
+		EDGE_STORE_COL( d, 5 )
+		EDGE_STORE_COL( d, 6 )
+		EDGE_STORE_COL( d, 7 )
+		EDGE_STORE_COL( d, 8 )
+		EDGE_STORE_COL( d, 9 )
+		EDGE_STORE_COL( d, 10 )
+		EDGE_STORE_COL( d, 11 )
+		EDGE_STORE_COL( d, 12 )
+		EDGE_STORE_COL( d, 13 )
+
+		bli_txpbys_mxn( d,d,d,d, m, n, ct, 1, 16, beta, c, rs_c, cs_c );
+	}
+}
+
@@ -0,0 +1,279 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// AVX-512 gemmsup "rd" kernels for skx: 12x32 (s) and 12x16 (d). These
+// kernels compute each element of C as a dot product of a row of A and a
+// column of B, and thus require that A be row-stored (cs_a == 1) and B be
+// column-stored (rs_b == 1). Otherwise, the rv kernels are called instead.
+//
+// The block of C is computed in 4x4 subblocks, each of which is held in 16
+// vector registers whose elements are summed once the loop over k finishes.
+// The k edge case is handled with AVX-512 masked loads, and the m and n edge
+// cases by repeating the last valid row of A or column of B and discarding
+// the corresponding results.
+//
+
+#define s_vec        __m512
+#define s_mask_t     __mmask16
+#define s_setzero    _mm512_setzero_ps
+#define s_fmadd      _mm512_fmadd_ps
+#define s_loadu      _mm512_loadu_ps
+#define s_maskload_k( p ) _mm512_maskz_loadu_ps( mask_k, p )
+#define s_reduce     _mm512_reduce_add_ps
+#define s_mask( r )  ( s_mask_t )( ( r ) <= 0 ? 0 : ( r ) >= 16 ? 0xFFFF : ( 1u << ( r ) ) - 1 )
+#define s_vl         16
+
+#define d_vec        __m512d
+#define d_mask_t     __mmask8
+#define d_setzero    _mm512_setzero_pd
+#define d_fmadd      _mm512_fmadd_pd
+#define d_loadu      _mm512_loadu_pd
+#define d_maskload_k( p ) _mm512_maskz_loadu_pd( mask_k, p )
+#define d_reduce     _mm512_reduce_add_pd
+#define d_mask( r )  ( d_mask_t )( ( r ) <= 0 ? 0 : ( r ) >= 8 ? 0xFF : ( 1u << ( r ) ) - 1 )
+#define d_vl         8
+
+#define RD_FMA_COL( ch, j, load ) \
+	b_j = load( b##j + l ); \
+	c0##j = ch##_fmadd( a_0, b_j, c0##j ); \
+	c1##j = ch##_fmadd( a_1, b_j, c1##j ); \
+	c2##j = ch##_fmadd( a_2, b_j, c2##j ); \
+	c3##j = ch##_fmadd( a_3, b_j, c3##j );
+
+#define RD_ITER( ch, load ) \
+	a_0 = load( a0 + l ); \
+	a_1 = load( a1 + l ); \
+	a_2 = load( a2 + l ); \
+	a_3 = load( a3 + l ); \
+	RD_FMA_COL( ch, 0, load ) \
+	RD_FMA_COL( ch, 1, load ) \
+	RD_FMA_COL( ch, 2, load ) \
+	RD_FMA_COL( ch, 3, load )
+
+#define RD_KERNELS( ctype, ch, nr ) \
+\
+/* Compute an mb x nb (mb, nb <= 4) subblock of C. */ \
+static void PASTEMAC(ch,gemmsup_rd_skx_int_4x4) \
+     ( \
+             dim_t  mb, \
+             dim_t  nb, \
+             dim_t  k, \
+       const ctype* alpha, \
+       const ctype* a, inc_t rs_a, \
+       const ctype* b, inc_t cs_b, \
+       const ctype* beta, \
+             ctype* c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	const ctype* restrict a0 = a; \
+	const ctype* restrict a1 = a + bli_min( 1, mb - 1 )*rs_a; \
+	const ctype* restrict a2 = a + bli_min( 2, mb - 1 )*rs_a; \
+	const ctype* restrict a3 = a + bli_min( 3, mb - 1 )*rs_a; \
+	const ctype* restrict b0 = b; \
+	const ctype* restrict b1 = b + bli_min( 1, nb - 1 )*cs_b; \
+	const ctype* restrict b2 = b + bli_min( 2, nb - 1 )*cs_b; \
+	const ctype* restrict b3 = b + bli_min( 3, nb - 1 )*cs_b; \
+\
+	ch##_vec c00 = ch##_setzero(), c01 = ch##_setzero(), c02 = ch##_setzero(), c03 = ch##_setzero(); \
+	ch##_vec c10 = ch##_setzero(), c11 = ch##_setzero(), c12 = ch##_setzero(), c13 = ch##_setzero(); \
+	ch##_vec c20 = ch##_setzero(), c21 = ch##_setzero(), c22 = ch##_setzero(), c23 = ch##_setzero(); \
+	ch##_vec c30 = ch##_setzero(), c31 = ch##_setzero(), c32 = ch##_setzero(), c33 = ch##_setzero(); \
+	ch##_vec a_0, a_1, a_2, a_3, b_j; \
+\
+	dim_t l = 0; \
+\
+	for ( ; l + ch##_vl <= k; l += ch##_vl ) \
+	{ \
+		RD_ITER( ch, ch##_loadu ) \
+	} \
+\
+	if ( l < k ) \
+	{ \
+		const ch##_mask_t mask_k = ch##_mask( k - l ); \
+\
+		RD_ITER( ch, ch##_maskload_k ) \
+	} \
+\
+	ctype ab[ 4 ][ 4 ] = \
+	{ \
+	  { ch##_reduce( c00 ), ch##_reduce( c01 ), ch##_reduce( c02 ), ch##_reduce( c03 ) }, \
+	  { ch##_reduce( c10 ), ch##_reduce( c11 ), ch##_reduce( c12 ), ch##_reduce( c13 ) }, \
+	  { ch##_reduce( c20 ), ch##_reduce( c21 ), ch##_reduce( c22 ), ch##_reduce( c23 ) }, \
+	  { ch##_reduce( c30 ), ch##_reduce( c31 ), ch##_reduce( c32 ), ch##_reduce( c33 ) }, \
+	}; \
+\
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		for ( dim_t i = 0; i < mb; ++i ) \
+		for ( dim_t j = 0; j < nb; ++j ) \
+			c[ i*rs_c + j*cs_c ] = *alpha * ab[ i ][ j ]; \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < mb; ++i ) \
+		for ( dim_t j = 0; j < nb; ++j ) \
+			c[ i*rs_c + j*cs_c ] = *beta * c[ i*rs_c + j*cs_c ] + *alpha * ab[ i ][ j ]; \
+	} \
+} \
+\
+/* Compute an m x n (m <= 12, n <= nr) block of C. */ \
+static void PASTEMAC(ch,gemmsup_rd_skx_int_block) \
+     ( \
+             dim_t  m, \
+             dim_t  n, \
+             dim_t  k, \
+       const ctype* alpha, \
+       const ctype* a, inc_t rs_a, \
+       const ctype* b, inc_t cs_b, \
+       const ctype* beta, \
+             ctype* c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	for ( dim_t j = 0; j < n; j += 4 ) \
+	for ( dim_t i = 0; i < m; i += 4 ) \
+		PASTEMAC(ch,gemmsup_rd_skx_int_4x4) \
+		( \
+		  bli_min( 4, m - i ), bli_min( 4, n - j ), k, \
+		  alpha, \
+		  a + i*rs_a, rs_a, \
+		  b + j*cs_b, cs_b, \
+		  beta, \
+		  c + i*rs_c + j*cs_c, rs_c, cs_c \
+		); \
+} \
+\
+void PASTEMAC(ch,gemmsup_rd_skx_int_12x,nr,m) \
+     ( \
+             conj_t     conja, \
+             conj_t     conjb, \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha, \
+       const void*      a, inc_t rs_a, inc_t cs_a, \
+       const void*      b, inc_t rs_b, inc_t cs_b, \
+       const void*      beta, \
+             void*      c, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	if ( cs_a != 1 || rs_b != 1 ) \
+	{ \
+		PASTEMAC(ch,gemmsup_rv_skx_int_12x,nr,m) \
+		( \
+		  conja, conjb, m, n, k, \
+		  alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+		  beta, c, rs_c, cs_c, data, cntx \
+		); \
+		return; \
+	} \
+\
+	const inc_t ps_a = bli_auxinfo_ps_a( data ); \
+\
+	const ctype* restrict ai = a; \
+	      ctype* restrict ci = c; \
+\
+	for ( dim_t i = 0; i < m; i += 12 ) \
+	{ \
+		PASTEMAC(ch,gemmsup_rd_skx_int_block) \
+		( \
+		  bli_min( 12, m - i ), n, k, \
+		  alpha, \
+		  ai, rs_a, \
+		  b,  cs_b, \
+		  beta, \
+		  ci, rs_c, cs_c \
+		); \
+\
+		ai += ps_a; \
+		ci += 12*rs_c; \
+	} \
+} \
+\
+void PASTEMAC(ch,gemmsup_rd_skx_int_12x,nr,n) \
+     ( \
+             conj_t     conja, \
+             conj_t     conjb, \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha, \
+       const void*      a, inc_t rs_a, inc_t cs_a, \
+       const void*      b, inc_t rs_b, inc_t cs_b, \
+       const void*      beta, \
+             void*      c, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	if ( cs_a != 1 || rs_b != 1 ) \
+	{ \
+		PASTEMAC(ch,gemmsup_rv_skx_int_12x,nr,n) \
+		( \
+		  conja, conjb, m, n, k, \
+		  alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+		  beta, c, rs_c, cs_c, data, cntx \
+		); \
+		return; \
+	} \
+\
+	const inc_t ps_b = bli_auxinfo_ps_b( data ); \
+\
+	const ctype* restrict bj = b; \
+	      ctype* restrict cj = c; \
+\
+	for ( dim_t j = 0; j < n; j += nr ) \
+	{ \
+		PASTEMAC(ch,gemmsup_rd_skx_int_block) \
+		( \
+		  m, bli_min( nr, n - j ), k, \
+		  alpha, \
+		  a,  rs_a, \
+		  bj, cs_b, \
+		  beta, \
+		  cj, rs_c, cs_c \
+		); \
+\
+		bj += ps_b; \
+		cj += nr*cs_c; \
+	} \
+}
+
+RD_KERNELS( float,  s, 32 )
+RD_KERNELS( double, d, 16 )
+
@@ -0,0 +1,335 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// AVX-512 gemmsup "rv" kernels for skx: 12x32 (s) and 12x16 (d). As with the
+// haswell rv kernels, each row of a 12 x NR block of C is held in two vector
+// registers, which are updated with a row of B and a broadcast element of A
+// for each iteration of the loop over k. The "m" kernels iterate over the
+// m dimension in units of 12 rows (stepping through A by its panel stride),
+// and the "n" kernels iterate over the n dimension in units of NR columns
+// (stepping through B by its panel stride).
+//
+// Instead of the separate assembly kernels for each m edge case that the
+// haswell kernels use, a separate block kernel is generated (by the macros
+// below) for each number of rows from 1 to 12, and the n edge case is handled
+// with AVX-512 masks. The elements of A may have any strides. Rows of B are
+// read with masked loads if cs_b == 1 and with masked gathers otherwise, and
+// C is updated directly if cs_c == 1 and through a temporary block otherwise.
+//
+
+#define s_vec        __m512
+#define s_mask_t     __mmask16
+#define s_idx_t      int32_t
+#define s_setzero    _mm512_setzero_ps
+#define s_set1       _mm512_set1_ps
+#define s_fmadd      _mm512_fmadd_ps
+#define s_mul        _mm512_mul_ps
+#define s_storeu     _mm512_storeu_ps
+#define s_maskload   _mm512_maskz_loadu_ps
+#define s_maskstore  _mm512_mask_storeu_ps
+#define s_loadidx( i )      _mm512_loadu_si512( i )
+#define s_gather( k, i, a ) _mm512_mask_i32gather_ps( _mm512_setzero_ps(), k, i, a, 4 )
+#define s_mask( r )  ( s_mask_t )( ( r ) <= 0 ? 0 : ( r ) >= 16 ? 0xFFFF : ( 1u << ( r ) ) - 1 )
+#define s_vl         16
+#define s_idx_max    INT32_MAX
+
+#define d_vec        __m512d
+#define d_mask_t     __mmask8
+#define d_idx_t      int64_t
+#define d_setzero    _mm512_setzero_pd
+#define d_set1       _mm512_set1_pd
+#define d_fmadd      _mm512_fmadd_pd
+#define d_mul        _mm512_mul_pd
+#define d_storeu     _mm512_storeu_pd
+#define d_maskload   _mm512_maskz_loadu_pd
+#define d_maskstore  _mm512_mask_storeu_pd
+#define d_loadidx( i )      _mm512_loadu_si512( i )
+#define d_gather( k, i, a ) _mm512_mask_i64gather_pd( _mm512_setzero_pd(), k, i, a, 8 )
+#define d_mask( r )  ( d_mask_t )( ( r ) <= 0 ? 0 : ( r ) >= 8 ? 0xFF : ( 1u << ( r ) ) - 1 )
+#define d_vl         8
+#define d_idx_max    INT64_MAX
+
+// Load the current row of B.
+#define RV_LOAD_B_UNIT( ch ) \
+	b_0 = ch##_maskload( mask_0, bp ); \
+	b_1 = ch##_maskload( mask_1, bp + ch##_vl );
+
+#define RV_LOAD_B_GATHER( ch ) \
+	b_0 = ch##_gather( mask_0, idx_0, bp ); \
+	b_1 = ch##_gather( mask_1, idx_1, bp );
+
+#define RV_LOAD_B_COPY( ch ) \
+	for ( dim_t j = 0; j < n; ++j ) bt[ j ] = bp[ j*cs_b ]; \
+	b_0 = ch##_maskload( mask_0, bt ); \
+	b_1 = ch##_maskload( mask_1, bt + ch##_vl );
+
+#define RV_FMA( ch, i ) \
+	if ( i < R ) \
+	{ \
+		a_i = ch##_set1( ap[ i*rs_a ] ); \
+		c##i##_0 = ch##_fmadd( a_i, b_0, c##i##_0 ); \
+		c##i##_1 = ch##_fmadd( a_i, b_1, c##i##_1 ); \
+	}
+
+#define RV_KLOOP( ch, load_b ) \
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		load_b( ch ) \
+\
+		RV_FMA( ch, 0 ) RV_FMA( ch, 1 ) RV_FMA( ch,  2 ) RV_FMA( ch,  3 ) \
+		RV_FMA( ch, 4 ) RV_FMA( ch, 5 ) RV_FMA( ch,  6 ) RV_FMA( ch,  7 ) \
+		RV_FMA( ch, 8 ) RV_FMA( ch, 9 ) RV_FMA( ch, 10 ) RV_FMA( ch, 11 ) \
+\
+		ap += cs_a; \
+		bp += rs_b; \
+	}
+
+// Update row i of C directly (cs_c == 1).
+#define RV_UPDATE_ROW( ch, i ) \
+	if ( i < R ) \
+	{ \
+		t_0 = ch##_mul( alphav, c##i##_0 ); \
+		t_1 = ch##_mul( alphav, c##i##_1 ); \
+		if ( !beta0z ) \
+		{ \
+			t_0 = ch##_fmadd( betav, ch##_maskload( mask_0, c + i*rs_c            ), t_0 ); \
+			t_1 = ch##_fmadd( betav, ch##_maskload( mask_1, c + i*rs_c + ch##_vl ), t_1 ); \
+		} \
+		ch##_maskstore( c + i*rs_c,            mask_0, t_0 ); \
+		ch##_maskstore( c + i*rs_c + ch##_vl, mask_1, t_1 ); \
+	}
+
+// Store row i of the (scaled) block to the temporary block ct.
+#define RV_STORE_ROW( ch, i ) \
+	if ( i < R ) \
+	{ \
+		ch##_storeu( ct + i*2*ch##_vl,            ch##_mul( alphav, c##i##_0 ) ); \
+		ch##_storeu( ct + i*2*ch##_vl + ch##_vl, ch##_mul( alphav, c##i##_1 ) ); \
+	}
+
+#define RV_FOR_ROWS( macro, ch ) \
+	macro( ch, 0 ) macro( ch, 1 ) macro( ch,  2 ) macro( ch,  3 ) \
+	macro( ch, 4 ) macro( ch, 5 ) macro( ch,  6 ) macro( ch,  7 ) \
+	macro( ch, 8 ) macro( ch, 9 ) macro( ch, 10 ) macro( ch, 11 )
+
+// Define the kernel for an R x n block of C, where n <= 2*vl.
+#define RV_BLOCK( ctype, ch, R_ ) \
+\
+static void PASTEMAC(ch,gemmsup_rv_skx_int_,R_,xn) \
+     ( \
+             dim_t  n, \
+             dim_t  k, \
+       const ctype* alpha, \
+       const ctype* a, inc_t rs_a, inc_t cs_a, \
+       const ctype* b, inc_t rs_b, inc_t cs_b, \
+       const ctype* beta, \
+             ctype* c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	enum { R = R_ }; \
+\
+	ch##_vec c0_0  = ch##_setzero(), c0_1  = ch##_setzero(); \
+	ch##_vec c1_0  = ch##_setzero(), c1_1  = ch##_setzero(); \
+	ch##_vec c2_0  = ch##_setzero(), c2_1  = ch##_setzero(); \
+	ch##_vec c3_0  = ch##_setzero(), c3_1  = ch##_setzero(); \
+	ch##_vec c4_0  = ch##_setzero(), c4_1  = ch##_setzero(); \
+	ch##_vec c5_0  = ch##_setzero(), c5_1  = ch##_setzero(); \
+	ch##_vec c6_0  = ch##_setzero(), c6_1  = ch##_setzero(); \
+	ch##_vec c7_0  = ch##_setzero(), c7_1  = ch##_setzero(); \
+	ch##_vec c8_0  = ch##_setzero(), c8_1  = ch##_setzero(); \
+	ch##_vec c9_0  = ch##_setzero(), c9_1  = ch##_setzero(); \
+	ch##_vec c10_0 = ch##_setzero(), c10_1 = ch##_setzero(); \
+	ch##_vec c11_0 = ch##_setzero(), c11_1 = ch##_setzero(); \
+	ch##_vec b_0, b_1, a_i; \
+\
+	const ch##_mask_t mask_0 = ch##_mask( n ); \
+	const ch##_mask_t mask_1 = ch##_mask( n - ch##_vl ); \
+\
+	const ctype* restrict ap = a; \
+	const ctype* restrict bp = b; \
+\
+	if ( cs_b == 1 ) \
+	{ \
+		RV_KLOOP( ch, RV_LOAD_B_UNIT ) \
+	} \
+	else if ( bli_abs( cs_b ) <= ch##_idx_max / ( 2*ch##_vl ) ) \
+	{ \
+		ch##_idx_t idx[ 2*ch##_vl ]; \
+\
+		for ( dim_t j = 0; j < 2*ch##_vl; ++j ) idx[ j ] = ( ch##_idx_t )( j*cs_b ); \
+\
+		const __m512i idx_0 = ch##_loadidx( idx ); \
+		const __m512i idx_1 = ch##_loadidx( idx + ch##_vl ); \
+\
+		RV_KLOOP( ch, RV_LOAD_B_GATHER ) \
+	} \
+	else \
+	{ \
+		ctype bt[ 2*ch##_vl ]; \
+\
+		RV_KLOOP( ch, RV_LOAD_B_COPY ) \
+	} \
+\
+	const ch##_vec alphav = ch##_set1( *alpha ); \
+	const ch##_vec betav  = ch##_set1( *beta ); \
+	const bool     beta0z = PASTEMAC(ch,eq0)( *beta ); \
+\
+	if ( cs_c == 1 ) \
+	{ \
+		ch##_vec t_0, t_1; \
+\
+		RV_FOR_ROWS( RV_UPDATE_ROW, ch ) \
+	} \
+	else \
+	{ \
+		ctype ct[ R * 2*ch##_vl ]; \
+\
+		RV_FOR_ROWS( RV_STORE_ROW, ch ) \
+\
+		bli_txpbys_mxn( ch,ch,ch,ch, R, n, ct, 2*ch##_vl, 1, beta, c, rs_c, cs_c ); \
+	} \
+}
+
+#define RV_BLOCK_ENTRY( ctype, ch, R_ ) PASTEMAC(ch,gemmsup_rv_skx_int_,R_,xn),
+
+#define RV_INSERT_R( macro, ctype, ch ) \
+\
+macro( ctype, ch, 1 ) macro( ctype, ch,  2 ) macro( ctype, ch,  3 ) macro( ctype, ch,  4 ) \
+macro( ctype, ch, 5 ) macro( ctype, ch,  6 ) macro( ctype, ch,  7 ) macro( ctype, ch,  8 ) \
+macro( ctype, ch, 9 ) macro( ctype, ch, 10 ) macro( ctype, ch, 11 ) macro( ctype, ch, 12 )
+
+#define RV_KERNELS( ctype, ch, nr ) \
+\
+RV_INSERT_R( RV_BLOCK, ctype, ch ) \
+\
+typedef void (*PASTECH(ch,gemmsup_rv_skx_int_ft)) \
+     ( \
+             dim_t  n, \
+             dim_t  k, \
+       const ctype* alpha, \
+       const ctype* a, inc_t rs_a, inc_t cs_a, \
+       const ctype* b, inc_t rs_b, inc_t cs_b, \
+       const ctype* beta, \
+             ctype* c, inc_t rs_c, inc_t cs_c  \
+     ); \
+\
+static PASTECH(ch,gemmsup_rv_skx_int_ft) PASTECH(ch,gemmsup_rv_skx_int_table)[ 12 ] = \
+{ \
+	RV_INSERT_R( RV_BLOCK_ENTRY, ctype, ch ) \
+}; \
+\
+void PASTEMAC(ch,gemmsup_rv_skx_int_12x,nr,m) \
+     ( \
+             conj_t     conja, \
+             conj_t     conjb, \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha, \
+       const void*      a, inc_t rs_a, inc_t cs_a, \
+       const void*      b, inc_t rs_b, inc_t cs_b, \
+       const void*      beta, \
+             void*      c, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const inc_t ps_a = bli_auxinfo_ps_a( data ); \
+\
+	const ctype* restrict ai = a; \
+	      ctype* restrict ci = c; \
+\
+	for ( dim_t i = 0; i < m; i += 12 ) \
+	{ \
+		PASTECH(ch,gemmsup_rv_skx_int_table)[ bli_min( 12, m - i ) - 1 ] \
+		( \
+		  n, k, \
+		  alpha, \
+		  ai, rs_a, cs_a, \
+		  b,  rs_b, cs_b, \
+		  beta, \
+		  ci, rs_c, cs_c \
+		); \
+\
+		ai += ps_a; \
+		ci += 12*rs_c; \
+	} \
+} \
+\
+void PASTEMAC(ch,gemmsup_rv_skx_int_12x,nr,n) \
+     ( \
+             conj_t     conja, \
+             conj_t     conjb, \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha, \
+       const void*      a, inc_t rs_a, inc_t cs_a, \
+       const void*      b, inc_t rs_b, inc_t cs_b, \
+       const void*      beta, \
+             void*      c, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const inc_t ps_b = bli_auxinfo_ps_b( data ); \
+\
+	const ctype* restrict bj = b; \
+	      ctype* restrict cj = c; \
+\
+	if ( m == 0 ) return; \
+\
+	for ( dim_t j = 0; j < n; j += nr ) \
+	{ \
+		PASTECH(ch,gemmsup_rv_skx_int_table)[ m - 1 ] \
+		( \
+		  bli_min( nr, n - j ), k, \
+		  alpha, \
+		  a,  rs_a, cs_a, \
+		  bj, rs_b, cs_b, \
+		  beta, \
+		  cj, rs_c, cs_c \
+		); \
+\
+		bj += ps_b; \
+		cj += nr*cs_c; \
+	} \
+}
+
+RV_KERNELS( float,  s, 32 )
+RV_KERNELS( double, d, 16 )
+
@@ -38,4 +38,29 @@ GEMM_UKR_PROT( float ,   s, gemm_skx_asm_12x32_l2 )
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x12_l2 )
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x14 )
 
+GEMM_UKR_PROT( float ,   s, gemm_skx_int_32x12_edge )
+GEMM_UKR_PROT( double,   d, gemm_skx_int_16x14_edge )
+
+GEMM_UKR_PROT( scomplex, c, gemm_skx_int_6x16 )
+GEMM_UKR_PROT( dcomplex, z, gemm_skx_int_6x8 )
+
+// -- packm --
+
+PACKM_KER_PROT( float ,   s, packm_skx_int_32x12 )
+PACKM_KER_PROT( double,   d, packm_skx_int_16x14 )
+PACKM_KER_PROT( scomplex, c, packm_skx_int_6x16 )
+PACKM_KER_PROT( dcomplex, z, packm_skx_int_6x8 )
+
+// -- gemmsup --
+
+GEMMSUP_KER_PROT( float ,   s, gemmsup_rv_skx_int_12x32m )
+GEMMSUP_KER_PROT( float ,   s, gemmsup_rv_skx_int_12x32n )
+GEMMSUP_KER_PROT( float ,   s, gemmsup_rd_skx_int_12x32m )
+GEMMSUP_KER_PROT( float ,   s, gemmsup_rd_skx_int_12x32n )
+
+GEMMSUP_KER_PROT( double,   d, gemmsup_rv_skx_int_12x16m )
+GEMMSUP_KER_PROT( double,   d, gemmsup_rv_skx_int_12x16n )
+GEMMSUP_KER_PROT( double,   d, gemmsup_rd_skx_int_12x16m )
+GEMMSUP_KER_PROT( double,   d, gemmsup_rd_skx_int_12x16n )
+
 
@@ -0,0 +1,141 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// AVX-512 scalv kernels for zen4: x := conjalpha(alpha) * x. If alpha is
+// zero, x is overwritten with zeros by the setv kernel instead (in case x
+// contains NaN or Inf).
+//
+
+#define s_vec        __m512
+#define s_mask_t     __mmask16
+#define s_setzero    _mm512_setzero_ps
+#define s_set1       _mm512_set1_ps
+#define s_loadu      _mm512_loadu_ps
+#define s_storeu     _mm512_storeu_ps
+#define s_maskload   _mm512_maskz_loadu_ps
+#define s_maskstore  _mm512_mask_storeu_ps
+#define s_add        _mm512_add_ps
+#define s_mul        _mm512_mul_ps
+#define s_fmadd      _mm512_fmadd_ps
+#define s_reduce     _mm512_reduce_add_ps
+#define s_mask( r )  ( s_mask_t )( ( r ) >= 16 ? 0xFFFF : ( 1u << ( r ) ) - 1 )
+#define s_vl         16
+
+#define d_vec        __m512d
+#define d_mask_t     __mmask8
+#define d_setzero    _mm512_setzero_pd
+#define d_set1       _mm512_set1_pd
+#define d_loadu      _mm512_loadu_pd
+#define d_storeu     _mm512_storeu_pd
+#define d_maskload   _mm512_maskz_loadu_pd
+#define d_maskstore  _mm512_mask_storeu_pd
+#define d_add        _mm512_add_pd
+#define d_mul        _mm512_mul_pd
+#define d_fmadd      _mm512_fmadd_pd
+#define d_reduce     _mm512_reduce_add_pd
+#define d_mask( r )  ( d_mask_t )( ( r ) >= 8 ? 0xFF : ( 1u << ( r ) ) - 1 )
+#define d_vl         8
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t  conjalpha, \
+             dim_t   n, \
+       const void*   alpha0, \
+             void*   x0, inc_t incx, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype* restrict alpha = alpha0; \
+	      ctype* restrict x     = x0; \
+\
+	/* If the vector dimension is zero, or if alpha is unit, return early. */ \
+	if ( bli_zero_dim1( n ) || PASTEMAC(ch,eq1)( *alpha ) ) return; \
+\
+	/* If alpha is zero, use setv. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+		setv_ker_ft f = bli_cntx_get_ukr_dt( PASTEMAC(ch,type), BLIS_SETV_KER, cntx ); \
+\
+		f \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  n, \
+		  PASTEMAC(ch,0), \
+		  x, incx, \
+		  cntx \
+		); \
+		return; \
+	} \
+\
+	if ( incx == 1 ) \
+	{ \
+		const ch##_vec alphav = ch##_set1( *alpha ); \
+		dim_t          i      = 0; \
+\
+		for ( ; i + 4*ch##_vl <= n; i += 4*ch##_vl ) \
+		{ \
+			ch##_storeu( x + i + 0*ch##_vl, ch##_mul( alphav, ch##_loadu( x + i + 0*ch##_vl ) ) ); \
+			ch##_storeu( x + i + 1*ch##_vl, ch##_mul( alphav, ch##_loadu( x + i + 1*ch##_vl ) ) ); \
+			ch##_storeu( x + i + 2*ch##_vl, ch##_mul( alphav, ch##_loadu( x + i + 2*ch##_vl ) ) ); \
+			ch##_storeu( x + i + 3*ch##_vl, ch##_mul( alphav, ch##_loadu( x + i + 3*ch##_vl ) ) ); \
+		} \
+\
+		for ( ; i + ch##_vl <= n; i += ch##_vl ) \
+			ch##_storeu( x + i, ch##_mul( alphav, ch##_loadu( x + i ) ) ); \
+\
+		if ( i < n ) \
+		{ \
+			const ch##_mask_t mask = ch##_mask( n - i ); \
+\
+			ch##_maskstore( x + i, mask, ch##_mul( alphav, ch##_maskload( mask, x + i ) ) ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < n; ++i ) \
+			PASTEMAC(ch,scals)( *alpha, x[ i*incx ] ); \
+	} \
+}
+
+GENTFUNC( float,  s, scalv_zen4_int )
+GENTFUNC( double, d, scalv_zen4_int )
+
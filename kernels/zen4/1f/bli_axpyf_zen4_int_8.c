@@ -0,0 +1,189 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// AVX-512 axpyf kernels for zen4 with a fusing factor of 8:
+//
+//   y := y + alpha * conja(A) * conjx(x)
+//
+// where A is m x 8. Each vector of y is updated with the corresponding
+// vectors of the eight columns of A, split across two accumulators so that
+// the FMAs do not form a single dependency chain. If b_n is not 8, or if A
+// or y has non-unit stride, the operation is computed as a loop over the
+// axpyv kernel.
+//
+
+#define s_vec        __m512
+#define s_mask_t     __mmask16
+#define s_setzero    _mm512_setzero_ps
+#define s_set1       _mm512_set1_ps
+#define s_loadu      _mm512_loadu_ps
+#define s_storeu     _mm512_storeu_ps
+#define s_maskload   _mm512_maskz_loadu_ps
+#define s_maskstore  _mm512_mask_storeu_ps
+#define s_add        _mm512_add_ps
+#define s_mul        _mm512_mul_ps
+#define s_fmadd      _mm512_fmadd_ps
+#define s_reduce     _mm512_reduce_add_ps
+#define s_mask( r )  ( s_mask_t )( ( r ) >= 16 ? 0xFFFF : ( 1u << ( r ) ) - 1 )
+#define s_vl         16
+
+#define d_vec        __m512d
+#define d_mask_t     __mmask8
+#define d_setzero    _mm512_setzero_pd
+#define d_set1       _mm512_set1_pd
+#define d_loadu      _mm512_loadu_pd
+#define d_storeu     _mm512_storeu_pd
+#define d_maskload   _mm512_maskz_loadu_pd
+#define d_maskstore  _mm512_mask_storeu_pd
+#define d_add        _mm512_add_pd
+#define d_mul        _mm512_mul_pd
+#define d_fmadd      _mm512_fmadd_pd
+#define d_reduce     _mm512_reduce_add_pd
+#define d_mask( r )  ( d_mask_t )( ( r ) >= 8 ? 0xFF : ( 1u << ( r ) ) - 1 )
+#define d_vl         8
+
+// Masked loads and stores with the mask in scope.
+#define s_maskload_m( p )     _mm512_maskz_loadu_ps( mask, p )
+#define s_maskstore_m( p, v ) _mm512_mask_storeu_ps( p, mask, v )
+#define d_maskload_m( p )     _mm512_maskz_loadu_pd( mask, p )
+#define d_maskstore_m( p, v ) _mm512_mask_storeu_pd( p, mask, v )
+
+// Update the vector of y at offset i (loaded with load( p ) and stored with
+// store( p, v )) with the eight columns of A.
+#define AXPYF_UPDATE( ch, i, load, store ) \
+{ \
+	ch##_vec yev = load( y + i ); \
+	ch##_vec yov = ch##_mul( chi1v, load( a + i + 1*lda ) ); \
+\
+	yev = ch##_fmadd( chi0v, load( a + i + 0*lda ), yev ); \
+	yov = ch##_fmadd( chi3v, load( a + i + 3*lda ), yov ); \
+	yev = ch##_fmadd( chi2v, load( a + i + 2*lda ), yev ); \
+	yov = ch##_fmadd( chi5v, load( a + i + 5*lda ), yov ); \
+	yev = ch##_fmadd( chi4v, load( a + i + 4*lda ), yev ); \
+	yov = ch##_fmadd( chi7v, load( a + i + 7*lda ), yov ); \
+	yev = ch##_fmadd( chi6v, load( a + i + 6*lda ), yev ); \
+\
+	store( y + i, ch##_add( yev, yov ) ); \
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t  conja, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   b_n, \
+       const void*   alpha0, \
+       const void*   a0, inc_t inca, inc_t lda, \
+       const void*   x0, inc_t incx, \
+             void*   y0, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype* restrict alpha = alpha0; \
+	const ctype* restrict a     = a0; \
+	const ctype* restrict x     = x0; \
+	      ctype* restrict y     = y0; \
+\
+	const dim_t fuse_fac = 8; \
+\
+	/* If either dimension is zero, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim2( m, b_n ) || PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	/* If b_n is not equal to the fusing factor, or if the vectors are not
+	   contiguous, then perform the entire operation as a loop over axpyv. */ \
+	if ( b_n != fuse_fac || inca != 1 || incy != 1 ) \
+	{ \
+		if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+		axpyv_ker_ft f = bli_cntx_get_ukr_dt( PASTEMAC(ch,type), BLIS_AXPYV_KER, cntx ); \
+\
+		for ( dim_t j = 0; j < b_n; ++j ) \
+		{ \
+			ctype alpha_chi1; \
+\
+			PASTEMAC(ch,copycjs)( conjx, x[ j*incx ], alpha_chi1 ); \
+			PASTEMAC(ch,scals)( *alpha, alpha_chi1 ); \
+\
+			f \
+			( \
+			  conja, \
+			  m, \
+			  &alpha_chi1, \
+			  a + j*lda, inca, \
+			  y, incy, \
+			  cntx \
+			); \
+		} \
+		return; \
+	} \
+\
+	const ch##_vec chi0v = ch##_set1( *alpha * x[ 0*incx ] ); \
+	const ch##_vec chi1v = ch##_set1( *alpha * x[ 1*incx ] ); \
+	const ch##_vec chi2v = ch##_set1( *alpha * x[ 2*incx ] ); \
+	const ch##_vec chi3v = ch##_set1( *alpha * x[ 3*incx ] ); \
+	const ch##_vec chi4v = ch##_set1( *alpha * x[ 4*incx ] ); \
+	const ch##_vec chi5v = ch##_set1( *alpha * x[ 5*incx ] ); \
+	const ch##_vec chi6v = ch##_set1( *alpha * x[ 6*incx ] ); \
+	const ch##_vec chi7v = ch##_set1( *alpha * x[ 7*incx ] ); \
+\
+	dim_t i = 0; \
+\
+	for ( ; i + 2*ch##_vl <= m; i += 2*ch##_vl ) \
+	{ \
+		AXPYF_UPDATE( ch, i,            ch##_loadu, ch##_storeu ) \
+		AXPYF_UPDATE( ch, i + ch##_vl, ch##_loadu, ch##_storeu ) \
+	} \
+\
+	for ( ; i + ch##_vl <= m; i += ch##_vl ) \
+	{ \
+		AXPYF_UPDATE( ch, i, ch##_loadu, ch##_storeu ) \
+	} \
+\
+	if ( i < m ) \
+	{ \
+		const ch##_mask_t mask = ch##_mask( m - i ); \
+\
+		AXPYF_UPDATE( ch, i, ch##_maskload_m, ch##_maskstore_m ) \
+	} \
+}
+
+GENTFUNC( float,  s, axpyf_zen4_int_8 )
+GENTFUNC( double, d, axpyf_zen4_int_8 )
+
@@ -0,0 +1,218 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// AVX-512 dotxf kernels for zen4 with a fusing factor of 8:
+//
+//   y := beta * y + alpha * conjat(A)^T * conjx(x)
+//
+// where A is m x 8. The eight dot products are accumulated in separate
+// vector registers and reduced at the end. If b_n is not 8, or if A or x
+// has non-unit stride, the operation is computed as a loop over the dotxv
+// kernel.
+//
+
+#define s_vec        __m512
+#define s_mask_t     __mmask16
+#define s_setzero    _mm512_setzero_ps
+#define s_set1       _mm512_set1_ps
+#define s_loadu      _mm512_loadu_ps
+#define s_storeu     _mm512_storeu_ps
+#define s_maskload   _mm512_maskz_loadu_ps
+#define s_maskstore  _mm512_mask_storeu_ps
+#define s_add        _mm512_add_ps
+#define s_mul        _mm512_mul_ps
+#define s_fmadd      _mm512_fmadd_ps
+#define s_reduce     _mm512_reduce_add_ps
+#define s_mask( r )  ( s_mask_t )( ( r ) >= 16 ? 0xFFFF : ( 1u << ( r ) ) - 1 )
+#define s_vl         16
+
+#define d_vec        __m512d
+#define d_mask_t     __mmask8
+#define d_setzero    _mm512_setzero_pd
+#define d_set1       _mm512_set1_pd
+#define d_loadu      _mm512_loadu_pd
+#define d_storeu     _mm512_storeu_pd
+#define d_maskload   _mm512_maskz_loadu_pd
+#define d_maskstore  _mm512_mask_storeu_pd
+#define d_add        _mm512_add_pd
+#define d_mul        _mm512_mul_pd
+#define d_fmadd      _mm512_fmadd_pd
+#define d_reduce     _mm512_reduce_add_pd
+#define d_mask( r )  ( d_mask_t )( ( r ) >= 8 ? 0xFF : ( 1u << ( r ) ) - 1 )
+#define d_vl         8
+
+// Accumulate the products of the vector of x at offset i with the eight
+// columns of A.
+#define DOTXF_UPDATE( ch, i, load ) \
+{ \
+	const ch##_vec xv = load( x + i ); \
+\
+	rho0v = ch##_fmadd( load( a + i + 0*lda ), xv, rho0v ); \
+	rho1v = ch##_fmadd( load( a + i + 1*lda ), xv, rho1v ); \
+	rho2v = ch##_fmadd( load( a + i + 2*lda ), xv, rho2v ); \
+	rho3v = ch##_fmadd( load( a + i + 3*lda ), xv, rho3v ); \
+	rho4v = ch##_fmadd( load( a + i + 4*lda ), xv, rho4v ); \
+	rho5v = ch##_fmadd( load( a + i + 5*lda ), xv, rho5v ); \
+	rho6v = ch##_fmadd( load( a + i + 6*lda ), xv, rho6v ); \
+	rho7v = ch##_fmadd( load( a + i + 7*lda ), xv, rho7v ); \
+}
+
+// Masked load with the mask in scope.
+#define s_maskload_m( p ) _mm512_maskz_loadu_ps( mask, p )
+#define d_maskload_m( p ) _mm512_maskz_loadu_pd( mask, p )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t  conjat, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   b_n, \
+       const void*   alpha0, \
+       const void*   a0, inc_t inca, inc_t lda, \
+       const void*   x0, inc_t incx, \
+       const void*   beta0, \
+             void*   y0, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype* restrict alpha = alpha0; \
+	const ctype* restrict a     = a0; \
+	const ctype* restrict x     = x0; \
+	const ctype* restrict beta  = beta0; \
+	      ctype* restrict y     = y0; \
+\
+	const dim_t fuse_fac = 8; \
+\
+	/* If the b_n dimension is zero, y is empty and there is no computation. */ \
+	if ( bli_zero_dim1( b_n ) ) return; \
+\
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If the m dimension is zero, or if alpha is zero, the computation
+	   simplifies to updating y. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		scalv_ker_ft f = bli_cntx_get_ukr_dt( PASTEMAC(ch,type), BLIS_SCALV_KER, cntx ); \
+\
+		f \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  b_n, \
+		  beta, \
+		  y, incy, \
+		  cntx \
+		); \
+		return; \
+	} \
+\
+	/* If b_n is not equal to the fusing factor, or if the vectors are not
+	   contiguous, then perform the entire operation as a loop over dotxv. */ \
+	if ( b_n != fuse_fac || inca != 1 || incx != 1 ) \
+	{ \
+		dotxv_ker_ft f = bli_cntx_get_ukr_dt( PASTEMAC(ch,type), BLIS_DOTXV_KER, cntx ); \
+\
+		for ( dim_t j = 0; j < b_n; ++j ) \
+		{ \
+			f \
+			( \
+			  conjat, \
+			  conjx, \
+			  m, \
+			  alpha, \
+			  a + j*lda, inca, \
+			  x, incx, \
+			  beta, \
+			  y + j*incy, \
+			  cntx \
+			); \
+		} \
+		return; \
+	} \
+\
+	ch##_vec rho0v = ch##_setzero(); \
+	ch##_vec rho1v = ch##_setzero(); \
+	ch##_vec rho2v = ch##_setzero(); \
+	ch##_vec rho3v = ch##_setzero(); \
+	ch##_vec rho4v = ch##_setzero(); \
+	ch##_vec rho5v = ch##_setzero(); \
+	ch##_vec rho6v = ch##_setzero(); \
+	ch##_vec rho7v = ch##_setzero(); \
+\
+	dim_t i = 0; \
+\
+	for ( ; i + ch##_vl <= m; i += ch##_vl ) \
+	{ \
+		DOTXF_UPDATE( ch, i, ch##_loadu ) \
+	} \
+\
+	if ( i < m ) \
+	{ \
+		const ch##_mask_t mask = ch##_mask( m - i ); \
+\
+		DOTXF_UPDATE( ch, i, ch##_maskload_m ) \
+	} \
+\
+	ctype rho[ 8 ]; \
+\
+	rho[ 0 ] = ch##_reduce( rho0v ); \
+	rho[ 1 ] = ch##_reduce( rho1v ); \
+	rho[ 2 ] = ch##_reduce( rho2v ); \
+	rho[ 3 ] = ch##_reduce( rho3v ); \
+	rho[ 4 ] = ch##_reduce( rho4v ); \
+	rho[ 5 ] = ch##_reduce( rho5v ); \
+	rho[ 6 ] = ch##_reduce( rho6v ); \
+	rho[ 7 ] = ch##_reduce( rho7v ); \
+\
+	/* Accumulate the final result into y, overwriting y if beta is zero. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		for ( dim_t j = 0; j < fuse_fac; ++j ) \
+			y[ j*incy ] = *alpha * rho[ j ]; \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < fuse_fac; ++j ) \
+			y[ j*incy ] = *beta * y[ j*incy ] + *alpha * rho[ j ]; \
+	} \
+}
+
+GENTFUNC( float,  s, dotxf_zen4_int_8 )
+GENTFUNC( double, d, dotxf_zen4_int_8 )
+
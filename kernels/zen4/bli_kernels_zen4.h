@@ -0,0 +1,63 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// -- level-1v --
+
+// axpyv (intrinsics)
+AXPYV_KER_PROT( float,    s, axpyv_zen4_int )
+AXPYV_KER_PROT( double,   d, axpyv_zen4_int )
+
+// dotv (intrinsics)
+DOTV_KER_PROT( float,    s, dotv_zen4_int )
+DOTV_KER_PROT( double,   d, dotv_zen4_int )
+
+// dotxv (intrinsics)
+DOTXV_KER_PROT( float,    s, dotxv_zen4_int )
+DOTXV_KER_PROT( double,   d, dotxv_zen4_int )
+
+// scalv (intrinsics)
+SCALV_KER_PROT( float,    s, scalv_zen4_int )
+SCALV_KER_PROT( double,   d, scalv_zen4_int )
+
+
+// -- level-1f --
+
+// axpyf (intrinsics)
+AXPYF_KER_PROT( float,    s, axpyf_zen4_int_8 )
+AXPYF_KER_PROT( double,   d, axpyf_zen4_int_8 )
+
+// dotxf (intrinsics)
+DOTXF_KER_PROT( float,    s, dotxf_zen4_int_8 )
+DOTXF_KER_PROT( double,   d, dotxf_zen4_int_8 )
+
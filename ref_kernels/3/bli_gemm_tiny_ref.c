@@ -0,0 +1,191 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Reference tiny gemm kernels. By the time a tiny gemm kernel is called,
+// bli_?gemm_tiny() has arranged for C and A to have unit row stride and m
+// to be no larger than BLIS_GEMM_TINY_MAX. The real-domain kernels dispatch
+// on m to a table of kernels in which the loops over the rows of C are fully
+// unrolled (and left to the compiler to vectorize with the flags of the
+// configuration). The complex-domain kernels use the reference gemmsup
+// kernel.
+//
+
+// The number of columns of C computed at a time.
+#define GEMMTINY_NB( ctype, M ) ( ( M ) * sizeof( ctype ) <= 96 ? 4 : 3 )
+
+// Compute columns j through j+NB-1 of C, where C is M x n.
+#define GEMMTINY_BLOCK( ctype, M, NB ) \
+{ \
+	ctype ab[ NB ][ M ]; \
+\
+	for ( dim_t jj = 0; jj < NB; ++jj ) \
+	for ( dim_t i = 0; i < M; ++i ) ab[ jj ][ i ] = 0; \
+\
+	for ( dim_t p = 0; p < k; ++p ) \
+	{ \
+		const ctype* restrict ap = a + p*cs_a; \
+		const ctype* restrict bp = b + p*rs_b + j*cs_b; \
+\
+		for ( dim_t jj = 0; jj < NB; ++jj ) \
+		{ \
+			const ctype bpj = bp[ jj*cs_b ]; \
+\
+			for ( dim_t i = 0; i < M; ++i ) ab[ jj ][ i ] += ap[ i ] * bpj; \
+		} \
+	} \
+\
+	ctype* restrict cj = c + j*cs_c; \
+\
+	if ( beta == 0 ) \
+	{ \
+		for ( dim_t jj = 0; jj < NB; ++jj ) \
+		for ( dim_t i = 0; i < M; ++i ) \
+			cj[ i + jj*cs_c ] = alpha * ab[ jj ][ i ]; \
+	} \
+	else \
+	{ \
+		for ( dim_t jj = 0; jj < NB; ++jj ) \
+		for ( dim_t i = 0; i < M; ++i ) \
+			cj[ i + jj*cs_c ] = beta * cj[ i + jj*cs_c ] + alpha * ab[ jj ][ i ]; \
+	} \
+}
+
+#define GEMMTINY_M_KER( ctype, ch, M ) \
+\
+static void PASTEMAC(ch,gemm_tiny_m,M) \
+     ( \
+             dim_t           n, \
+             dim_t           k, \
+             ctype           alpha, \
+       const ctype* restrict a, inc_t cs_a, \
+       const ctype* restrict b, inc_t rs_b, inc_t cs_b, \
+             ctype           beta, \
+             ctype* restrict c, inc_t cs_c  \
+     ) \
+{ \
+	dim_t j = 0; \
+\
+	for ( ; j + GEMMTINY_NB( ctype, M ) <= n; j += GEMMTINY_NB( ctype, M ) ) \
+		GEMMTINY_BLOCK( ctype, M, GEMMTINY_NB( ctype, M ) ) \
+\
+	for ( ; j < n; ++j ) \
+		GEMMTINY_BLOCK( ctype, M, 1 ) \
+}
+
+#define GEMMTINY_M_ENTRY( ctype, ch, M ) PASTEMAC(ch,gemm_tiny_m,M),
+
+#define GEMMTINY_INSERT_M( macro, ctype, ch ) \
+\
+macro( ctype, ch,  1 ) macro( ctype, ch,  2 ) macro( ctype, ch,  3 ) macro( ctype, ch,  4 ) \
+macro( ctype, ch,  5 ) macro( ctype, ch,  6 ) macro( ctype, ch,  7 ) macro( ctype, ch,  8 ) \
+macro( ctype, ch,  9 ) macro( ctype, ch, 10 ) macro( ctype, ch, 11 ) macro( ctype, ch, 12 ) \
+macro( ctype, ch, 13 ) macro( ctype, ch, 14 ) macro( ctype, ch, 15 ) macro( ctype, ch, 16 )
+
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname, arch, suf ) \
+\
+GEMMTINY_INSERT_M( GEMMTINY_M_KER, ctype, ch ) \
+\
+typedef void (*PASTECH(ch,gemm_tiny_m_ft)) \
+     ( \
+             dim_t           n, \
+             dim_t           k, \
+             ctype           alpha, \
+       const ctype* restrict a, inc_t cs_a, \
+       const ctype* restrict b, inc_t rs_b, inc_t cs_b, \
+             ctype           beta, \
+             ctype* restrict c, inc_t cs_c  \
+     ); \
+\
+static PASTECH(ch,gemm_tiny_m_ft) PASTECH(ch,gemm_tiny_m_table)[ BLIS_GEMM_TINY_MAX ] = \
+{ \
+	GEMMTINY_INSERT_M( GEMMTINY_M_ENTRY, ctype, ch ) \
+}; \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+       gemmtiny_params, \
+       BLIS_AUXINFO_PARAM, \
+       BLIS_CNTX_PARAM  \
+     ) \
+{ \
+	PASTECH(ch,gemm_tiny_m_table)[ m - 1 ] \
+	( \
+	  n, k, \
+	  *( const ctype* )alpha, \
+	  a, cs_a, \
+	  b, rs_b, cs_b, \
+	  *( const ctype* )beta, \
+	  c, cs_c \
+	); \
+}
+
+INSERT_GENTFUNCRO_BASIC( gemm_tiny, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
+
+// Prototype the reference gemmsup kernel used by the complex-domain kernels.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+GEMMSUP_KER_PROT( ctype, ch, PASTECH(opname,arch,suf) )
+
+INSERT_GENTFUNC_BASIC( gemmsup_r, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+       gemmtiny_params, \
+       BLIS_AUXINFO_PARAM, \
+       BLIS_CNTX_PARAM  \
+     ) \
+{ \
+	PASTEMAC(ch,gemmsup_r,arch,suf) \
+	( \
+	  conja, conjb, m, n, k, \
+	  alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+	  beta, c, rs_c, cs_c, \
+	  data, cntx \
+	); \
+}
+
+INSERT_GENTFUNCCO_BASIC( gemm_tiny, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -34,6 +34,48 @@
 
 #include "blis.h"
 
+// The sup variants invoke gemmsup kernels as millikernels: when A (or B)
+// was packed, m (or n) may span several sup MR x k (k x NR) micropanels
+// that are ps_a (ps_b) elements apart, which need not equal MR*rs_a
+// (NR*cs_b). The loops in the kernels below only handle a single
+// micropanel of each operand, so split larger problems into micropanels
+// and recurse.
+
+#define GEMMSUP_REF_SPLIT_MKER( ctype, ch, opname, arch, suf ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+	const dim_t mr = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t nr = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx ); \
+\
+	if ( m > mr || n > nr ) \
+	{ \
+		const inc_t ps_a = ( m > mr ? bli_auxinfo_ps_a( data ) : 0 ); \
+		const inc_t ps_b = ( n > nr ? bli_auxinfo_ps_b( data ) : 0 ); \
+\
+		for ( dim_t i = 0; i < m; i += mr ) \
+		for ( dim_t j = 0; j < n; j += nr ) \
+		{ \
+			PASTEMAC(ch,opname,arch,suf) \
+			( \
+			  conja, \
+			  conjb, \
+			  bli_min( mr, m - i ), \
+			  bli_min( nr, n - j ), \
+			  k, \
+			  alpha0, \
+			  ( const ctype* )a0 + ( i / mr ) * ps_a, rs_a, cs_a, \
+			  ( const ctype* )b0 + ( j / nr ) * ps_b, rs_b, cs_b, \
+			  beta0, \
+			  ( ctype* )c0 + i * rs_c + j * cs_c, rs_c, cs_c, \
+			  data, \
+			  cntx  \
+			); \
+		} \
+\
+		return; \
+	} \
+}
+
 //
 // -- Row storage case ---------------------------------------------------------
 //
@@ -57,14 +99,16 @@ void PASTEMAC(ch,opname,arch,suf) \
        const cntx_t*    cntx  \
      ) \
 { \
+	GEMMSUP_REF_SPLIT_MKER( ctype, ch, opname, arch, suf ) \
+\
 	const ctype* restrict alpha = alpha0; \
 	const ctype* restrict a     = a0; \
 	const ctype* restrict b     = b0; \
 	const ctype* restrict beta  = beta0; \
 	      ctype* restrict c     = c0; \
 \
-	/* NOTE: This microkernel can actually handle arbitrarily large
-	   values of m, n, and k. */ \
+	/* NOTE: Beyond the micropanel split above, this microkernel can handle
+	   arbitrarily large values of m, n, and k. */ \
 \
 	if ( bli_is_noconj( conja ) && bli_is_noconj( conjb ) ) \
 	{ \
@@ -268,14 +312,16 @@ void PASTEMAC(ch,opname,arch,suf) \
        const cntx_t*    cntx  \
      ) \
 { \
+	GEMMSUP_REF_SPLIT_MKER( ctype, ch, opname, arch, suf ) \
+\
 	const ctype* restrict alpha = alpha0; \
 	const ctype* restrict a     = a0; \
 	const ctype* restrict b     = b0; \
 	const ctype* restrict beta  = beta0; \
 	      ctype* restrict c     = c0; \
 \
-	/* NOTE: This microkernel can actually handle arbitrarily large
-	   values of m, n, and k. */ \
+	/* NOTE: Beyond the micropanel split above, this microkernel can handle
+	   arbitrarily large values of m, n, and k. */ \
 \
 	if ( bli_is_noconj( conja ) && bli_is_noconj( conjb ) ) \
 	{ \
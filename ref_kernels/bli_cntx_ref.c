@@ -179,6 +179,12 @@ INSERT_PROTMAC_BASIC( GEMMSUP_KER_PROT, gemmsup_cv_ukr_name )
 INSERT_PROTMAC_BASIC( GEMMSUP_KER_PROT, gemmsup_cg_ukr_name )
 INSERT_PROTMAC_BASIC( GEMMSUP_KER_PROT, gemmsup_gx_ukr_name )
 
+// -- Construct arch-specific names for reference tiny gemm kernels --
+
+#define gemm_tiny_ukr_name   GENARNAME(gemm_tiny)
+
+INSERT_PROTMAC_BASIC( GEMMTINY_KER_PROT, gemm_tiny_ukr_name )
+
 
 // -- Level-1m (packm/unpackm) kernel prototype redefinitions ------------------
 
@@ -498,6 +504,11 @@ void GENBARNAME(cntx_init)
 	bli_mbool_init( &mbools[ BLIS_GEMMSUP_XXX_UKR_ROW_PREF ],  TRUE,  TRUE,  TRUE,  TRUE );
 
 
+	// -- Set tiny gemm kernels ------------------------------------------------
+
+	gen_func_init( &funcs[ bli_ker_idx( BLIS_GEMM_TINY_UKR ) ], gemm_tiny_ukr_name );
+
+
 	// -- Set level-1f kernels -------------------------------------------------
 
 	gen_func_init( &funcs[ bli_ker_idx( BLIS_AXPY2V_KER ) ],    axpy2v_ker_name    );
@@ -616,6 +616,11 @@ void proc_params( params_t* params )
 		params->im         = BLIS_NAT;
 		params->im_is_auto = FALSE;
 	}
+	else if ( strncmp( params->im_str, "3m",     2 ) == 0 )
+	{
+		params->im         = BLIS_3M;
+		params->im_is_auto = FALSE;
+	}
 	else if ( strncmp( params->im_str, "1m",     2 ) == 0 )
 	{
 		params->im         = BLIS_1M;
@@ -0,0 +1,318 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#include <pthread.h>
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Checks the placement of the threads launched by the pthreads
+// implementation: with an explicit CPU list, thread tid must be pinned to
+// (and run on) the (tid % n)-th CPU of the list; with compact and scatter,
+// each thread must be pinned to a distinct CPU the process may use; and the
+// mask of the application's thread must be the same after a launch as
+// before it. The placement is also changed concurrently with launches.
+// Usage:
+//
+//   ./test_affinity.x
+//
+
+#ifdef __linux__
+
+#define MAX_THREADS 16
+
+typedef struct
+{
+	int pinned[ MAX_THREADS ];
+	int ran_on[ MAX_THREADS ];
+} placement_t;
+
+static int n_fail = 0;
+
+// Return the only CPU in the calling thread's mask, or -1 if the mask holds
+// several CPUs.
+static int pinned_cpu( void )
+{
+	cpu_set_t set;
+
+	if ( pthread_getaffinity_np( pthread_self(), sizeof( set ), &set ) != 0 ||
+	     CPU_COUNT( &set ) != 1 ) return -1;
+
+	for ( int c = 0; c < CPU_SETSIZE; ++c )
+		if ( CPU_ISSET( c, &set ) ) return c;
+
+	return -1;
+}
+
+static void record( thrcomm_t* gl_comm, dim_t tid, const void* params )
+{
+	placement_t* p = ( placement_t* )params;
+
+	( void )gl_comm;
+
+	p->pinned[ tid ] = pinned_cpu();
+	p->ran_on[ tid ] = sched_getcpu();
+}
+
+static void launch( dim_t nt, placement_t* p )
+{
+	for ( dim_t i = 0; i < nt; ++i ) p->pinned[ i ] = p->ran_on[ i ] = -2;
+
+	bli_thread_launch( BLIS_POSIX, nt, record, p );
+}
+
+static bool same_mask( const cpu_set_t* x, const cpu_set_t* y )
+{
+	return CPU_EQUAL( x, y );
+}
+
+static void check_main( const char* what, const cpu_set_t* expected )
+{
+	cpu_set_t set;
+
+	pthread_getaffinity_np( pthread_self(), sizeof( set ), &set );
+
+	if ( !same_mask( &set, expected ) )
+	{
+		printf( "FAIL: %s: the mask of the application's thread changed\n", what );
+		n_fail++;
+	}
+}
+
+// Check a launch with an explicit list of CPUs.
+static void check_list( const char* what, const int* cpus, dim_t n, dim_t nt )
+{
+	placement_t p;
+
+	launch( nt, &p );
+
+	for ( dim_t tid = 0; tid < nt; ++tid )
+	{
+		const int cpu = cpus[ tid % n ];
+
+		if ( p.pinned[ tid ] != cpu || p.ran_on[ tid ] != cpu )
+		{
+			printf( "FAIL: %s: thread %ld pinned to %d and ran on %d, "
+			        "expected %d\n", what, ( long )tid, p.pinned[ tid ],
+			        p.ran_on[ tid ], cpu );
+			n_fail++;
+		}
+	}
+}
+
+// Check a launch with compact or scatter placement.
+static void check_spread( const char* what, const cpu_set_t* allowed, dim_t nt )
+{
+	placement_t p;
+
+	launch( nt, &p );
+
+	for ( dim_t tid = 0; tid < nt; ++tid )
+	{
+		bool ok = ( 0 <= p.pinned[ tid ] && CPU_ISSET( p.pinned[ tid ], allowed ) &&
+		            p.ran_on[ tid ] == p.pinned[ tid ] );
+
+		for ( dim_t j = 0; j < tid; ++j )
+			if ( p.pinned[ j ] == p.pinned[ tid ] ) ok = FALSE;
+
+		if ( !ok )
+		{
+			printf( "FAIL: %s: thread %ld pinned to %d and ran on %d\n",
+			        what, ( long )tid, p.pinned[ tid ], p.ran_on[ tid ] );
+			n_fail++;
+		}
+	}
+}
+
+static volatile bool toggling;
+
+static void* toggle_affinity( void* spec )
+{
+	while ( toggling )
+	{
+		bli_thread_set_affinity( spec );
+		bli_thread_set_affinity( "compact" );
+	}
+
+	return NULL;
+}
+
+int main( void )
+{
+	if ( !bli_info_get_enable_pthreads() )
+	{
+		printf( "SKIP (requires pthreads)\n" );
+		return 0;
+	}
+
+	cpu_set_t original, allowed;
+	int       cpus[ MAX_THREADS ];
+	dim_t     n = 0;
+	char      spec[ 16 * MAX_THREADS ] = "";
+
+	pthread_getaffinity_np( pthread_self(), sizeof( original ), &original );
+	sched_getaffinity( 0, sizeof( allowed ), &allowed );
+
+	// List the usable CPUs in reverse order so that the placement differs
+	// from the default.
+	for ( int c = CPU_SETSIZE - 1; 0 <= c && n < MAX_THREADS / 2; --c )
+	{
+		if ( !CPU_ISSET( c, &allowed ) ) continue;
+
+		cpus[ n++ ] = c;
+		snprintf( spec + strlen( spec ), sizeof( spec ) - strlen( spec ),
+		          "%s%d", n > 1 ? "," : "", c );
+	}
+
+	// An explicit list, with as many threads as CPUs and with threads
+	// wrapping around the list.
+	if ( bli_thread_set_affinity( spec ) != BLIS_SUCCESS )
+	{
+		printf( "FAIL: could not set the placement \"%s\"\n", spec );
+		return 1;
+	}
+
+	check_list( "list", cpus, n, n );
+	check_main( "list", &original );
+	check_list( "list, wrapped", cpus, n, 2 * n );
+	check_main( "list, wrapped", &original );
+
+	// An application thread already pinned to its CPU keeps its mask.
+	cpu_set_t pinned;
+	CPU_ZERO( &pinned );
+	CPU_SET( cpus[ 0 ], &pinned );
+	pthread_setaffinity_np( pthread_self(), sizeof( pinned ), &pinned );
+
+	check_list( "pinned application thread", cpus, n, n );
+	check_main( "pinned application thread", &pinned );
+	check_list( "pinned application thread again", cpus, n, n );
+	check_main( "pinned application thread again", &pinned );
+
+	pthread_setaffinity_np( pthread_self(), sizeof( original ), &original );
+
+	// compact and scatter.
+	bli_thread_set_affinity( "compact" );
+	check_spread( "compact", &allowed, n );
+	check_main( "compact", &original );
+
+	bli_thread_set_affinity( "scatter" );
+	check_spread( "scatter", &allowed, n );
+	check_main( "scatter", &original );
+
+	// A policy name is only recognized as a whole word (surrounding
+	// whitespace aside); anything else is a malformed CPU list, which leaves
+	// threads unpinned.
+	const char* bad[] = { "compactXYZ", "closest", "spreadsheet", "scatter 0" };
+
+	for ( int i = 0; i < 4; ++i )
+	{
+		if ( bli_thread_set_affinity( bad[ i ] ) != BLIS_FAILURE ||
+		     bli_thread_get_affinity( 0, NULL ) != 0 )
+		{
+			printf( "FAIL: the placement \"%s\" was accepted\n", bad[ i ] );
+			n_fail++;
+		}
+	}
+
+	if ( bli_thread_set_affinity( " compact\n" ) != BLIS_SUCCESS )
+	{
+		printf( "FAIL: the placement \" compact\\n\" was rejected\n" );
+		n_fail++;
+	}
+
+	check_spread( "compact, padded", &allowed, n );
+	check_main( "compact, padded", &original );
+
+	// Launch while the placement is being changed by another thread. Every
+	// thread must end up pinned to a CPU the process may use.
+	pthread_t toggler;
+	toggling = TRUE;
+	pthread_create( &toggler, NULL, toggle_affinity, spec );
+
+	for ( int rep = 0; rep < 200; ++rep )
+	{
+		placement_t p;
+
+		launch( n, &p );
+
+		for ( dim_t tid = 0; tid < n; ++tid )
+			if ( p.pinned[ tid ] < 0 || !CPU_ISSET( p.pinned[ tid ], &allowed ) )
+			{
+				printf( "FAIL: concurrent: thread %ld pinned to %d\n",
+				        ( long )tid, p.pinned[ tid ] );
+				n_fail++;
+			}
+	}
+
+	toggling = FALSE;
+	pthread_join( toggler, NULL );
+	check_main( "concurrent", &original );
+
+	// Without a placement, threads inherit the application's mask.
+	bli_thread_set_affinity( NULL );
+	{
+		placement_t p;
+
+		launch( 2, &p );
+
+		if ( CPU_COUNT( &original ) > 1 && ( p.pinned[ 0 ] != -1 || p.pinned[ 1 ] != -1 ) )
+		{
+			printf( "FAIL: unpinned: threads pinned to %d and %d\n",
+			        p.pinned[ 0 ], p.pinned[ 1 ] );
+			n_fail++;
+		}
+	}
+
+	printf( "%s (%ld CPUs)\n", n_fail == 0 ? "PASS" : "FAIL", ( long )n );
+
+	return n_fail == 0 ? 0 : 1;
+}
+
+#else
+
+int main( void )
+{
+	printf( "SKIP (thread placement is only supported on Linux)\n" );
+	return 0;
+}
+
+#endif
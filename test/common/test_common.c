@@ -0,0 +1,135 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+#include "test_common.h"
+
+double test_rel_diff( const obj_t* x, const obj_t* y )
+{
+	obj_t  d, norm;
+	double nd, ny, im;
+
+	bli_obj_create_conf_to( y, &d );
+	bli_copym( y, &d );
+	bli_subm( x, &d );
+
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( bli_obj_dt( y ) ), &norm );
+	bli_normfm( &d, &norm ); bli_getsc( &norm, &nd, &im );
+	bli_normfm( y,  &norm ); bli_getsc( &norm, &ny, &im );
+
+	bli_obj_free( &d );
+
+	return ( ny == 0.0 ? nd : nd / ny );
+}
+
+double test_max_diff( const obj_t* x, const obj_t* y )
+{
+	double d = 0.0;
+
+	for ( dim_t j = 0; j < bli_obj_width( x ); ++j )
+	for ( dim_t i = 0; i < bli_obj_length( x ); ++i )
+	{
+		double x_r, x_i, y_r, y_i;
+
+		bli_getijm( i, j, x, &x_r, &x_i );
+		bli_getijm( i, j, y, &y_r, &y_i );
+
+		const double t = hypot( x_r - y_r, x_i - y_i );
+
+		// NaN compares unequal to everything, including itself.
+		if ( !( t <= d ) ) d = ( isnan( t ) ? INFINITY : t );
+	}
+
+	return d;
+}
+
+void test_create_op
+     (
+       num_t   dt,
+       bool    row_major,
+       trans_t trans,
+       dim_t   m,
+       dim_t   n,
+       inc_t   pad,
+       obj_t*  x
+     )
+{
+	if ( bli_does_trans( trans ) ) bli_swap_dims( &m, &n );
+
+	if ( row_major ) bli_obj_create( dt, m, n, n + pad, 1, x );
+	else             bli_obj_create( dt, m, n, 1, m + pad, x );
+}
+
+void test_create_batch
+     (
+       num_t  dt,
+       dim_t  m,
+       dim_t  n,
+       bool   row_major,
+       inc_t  ld,
+       inc_t  stride,
+       dim_t  batch,
+       obj_t* x
+     )
+{
+	const siz_t elem_size = bli_dt_size( dt );
+	const dim_t n_elem    = bli_max( ( batch - 1 ) * stride + ( row_major ? m : n ) * ld, 1 );
+	err_t       r_val;
+
+	void* buf = bli_malloc_user( n_elem * elem_size, &r_val );
+
+	if ( row_major ) bli_obj_create_with_attached_buffer( dt, m, n, buf, ld, 1, x );
+	else             bli_obj_create_with_attached_buffer( dt, m, n, buf, 1, ld, x );
+
+	// Randomize the whole buffer through a vector view.
+	obj_t v;
+	bli_obj_create_with_attached_buffer( dt, n_elem, 1, buf, 1, n_elem, &v );
+	bli_randm( &v );
+}
+
+void test_free_batch( obj_t* x )
+{
+	bli_free_user( bli_obj_buffer( x ) );
+}
+
+void test_acquire_batch( dim_t i, inc_t stride, const obj_t* x, obj_t* x_i )
+{
+	char* buf = bli_obj_buffer( x );
+
+	bli_obj_alias_to( x, x_i );
+	bli_obj_set_buffer( buf + i * stride * ( inc_t )bli_obj_elem_size( x ), x_i );
+}
+
@@ -0,0 +1,100 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+// Allow C++ users to include this header file in their source code. However,
+// we make the extern "C" conditional on whether we're using a C++ compiler,
+// since regular C compilers don't understand the extern "C" construct.
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//
+// Helpers shared by the standalone test drivers in the subdirectories of
+// test/ (see driver.mk).
+//
+
+// Return || y - x ||_F / || y ||_F, or || y - x ||_F if y is zero.
+double test_rel_diff( const obj_t* x, const obj_t* y );
+
+// Return the largest magnitude of the elements of x - y.
+double test_max_diff( const obj_t* x, const obj_t* y );
+
+// Create an object for the m x n operand trans(x), stored by rows if row_major
+// and with a leading dimension pad elements larger than necessary (so that
+// mistakes in the handling of strides are caught). The transposition is not
+// recorded in the object.
+void test_create_op
+     (
+       num_t   dt,
+       bool    row_major,
+       trans_t trans,
+       dim_t   m,
+       dim_t   n,
+       inc_t   pad,
+       obj_t*  x
+     );
+
+// Create an object for a batch of m x n matrices, each stored with a
+// leading dimension of ld (by rows if row_major) and located stride
+// elements beyond the previous one, and randomize the whole buffer. The
+// buffer is released with test_free_batch().
+void test_create_batch
+     (
+       num_t  dt,
+       dim_t  m,
+       dim_t  n,
+       bool   row_major,
+       inc_t  ld,
+       inc_t  stride,
+       dim_t  batch,
+       obj_t* x
+     );
+
+void test_free_batch( obj_t* x );
+
+// Alias the i-th matrix of a batch created by test_create_batch().
+void test_acquire_batch( dim_t i, inc_t stride, const obj_t* x, obj_t* x_i );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
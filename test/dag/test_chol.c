@@ -0,0 +1,261 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "blis.h"
+
+//
+// Compares a tiled Cholesky factorization executed by the dag_t runtime
+// against the conventional blocked right-looking algorithm, in which each
+// trsm and syrk of the trailing matrix is parallelized by fork-join. Both
+// use nt threads. Usage:
+//
+//   ./test_chol.x [n] [b] [nt] [nrepeats]
+//
+
+static void chol_unb( void* params )
+{
+	obj_t*  a  = params;
+	dim_t   n  = bli_obj_length( a );
+	double* p  = bli_obj_buffer_at_off( a );
+	inc_t   rs = bli_obj_row_stride( a );
+	inc_t   cs = bli_obj_col_stride( a );
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		double ajj = p[ j*rs + j*cs ];
+
+		for ( dim_t k = 0; k < j; ++k )
+			ajj -= p[ j*rs + k*cs ] * p[ j*rs + k*cs ];
+
+		ajj = sqrt( ajj );
+		p[ j*rs + j*cs ] = ajj;
+
+		for ( dim_t i = j + 1; i < n; ++i )
+		{
+			double aij = p[ i*rs + j*cs ];
+
+			for ( dim_t k = 0; k < j; ++k )
+				aij -= p[ i*rs + k*cs ] * p[ j*rs + k*cs ];
+
+			p[ i*rs + j*cs ] = aij / ajj;
+		}
+	}
+}
+
+static void chol_forkjoin( obj_t* a, dim_t b, const rntm_t* rntm )
+{
+	dim_t n = bli_obj_length( a );
+	obj_t a11, a21, a22;
+
+	for ( dim_t k = 0; k < n; k += b )
+	{
+		dim_t bk = bli_min( b, n - k );
+		dim_t nr = n - k - bk;
+
+		bli_acquire_mpart( k, k, bk, bk, a, &a11 );
+		chol_unb( &a11 );
+
+		if ( nr == 0 ) break;
+
+		bli_acquire_mpart( k + bk, k,      nr, bk, a, &a21 );
+		bli_acquire_mpart( k + bk, k + bk, nr, nr, a, &a22 );
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, &a11 );
+		bli_obj_set_uplo( BLIS_LOWER, &a11 );
+		bli_obj_set_onlytrans( BLIS_TRANSPOSE, &a11 );
+		bli_trsm_ex( BLIS_RIGHT, &BLIS_ONE, &a11, &a21, NULL, rntm );
+
+		bli_obj_set_struc( BLIS_SYMMETRIC, &a22 );
+		bli_obj_set_uplo( BLIS_LOWER, &a22 );
+		bli_syrk_ex( &BLIS_MINUS_ONE, &a21, &BLIS_ONE, &a22, NULL, rntm );
+	}
+}
+
+static void chol_dag( obj_t* a, dim_t b, const rntm_t* rntm, obj_t* akk )
+{
+	dim_t  n   = bli_obj_length( a );
+	dim_t  nb  = ( n + b - 1 ) / b;
+	dag_t* dag = bli_dag_create( NULL, rntm );
+
+	for ( dim_t k = 0; k < nb; ++k )
+	{
+		dim_t bk = bli_min( b, n - k*b );
+
+		bli_acquire_mpart( k*b, k*b, bk, bk, a, &akk[ k ] );
+
+		const obj_t* w[] = { &akk[ k ] };
+		bli_dag_func( chol_unb, &akk[ k ], 0, NULL, 1, w, dag );
+
+		obj_t lkk = akk[ k ];
+		bli_obj_set_struc( BLIS_TRIANGULAR, &lkk );
+		bli_obj_set_uplo( BLIS_LOWER, &lkk );
+		bli_obj_set_onlytrans( BLIS_TRANSPOSE, &lkk );
+
+		for ( dim_t i = k + 1; i < nb; ++i )
+		{
+			obj_t aik;
+			bli_acquire_mpart( i*b, k*b, bli_min( b, n - i*b ), bk, a, &aik );
+			bli_dag_trsm( BLIS_RIGHT, &BLIS_ONE, &lkk, &aik, dag );
+		}
+
+		for ( dim_t i = k + 1; i < nb; ++i )
+		{
+			dim_t bi = bli_min( b, n - i*b );
+			obj_t aik, aii;
+
+			bli_acquire_mpart( i*b, k*b, bi, bk, a, &aik );
+			bli_acquire_mpart( i*b, i*b, bi, bi, a, &aii );
+			bli_obj_set_struc( BLIS_SYMMETRIC, &aii );
+			bli_obj_set_uplo( BLIS_LOWER, &aii );
+			bli_dag_syrk( &BLIS_MINUS_ONE, &aik, &BLIS_ONE, &aii, dag );
+
+			for ( dim_t j = k + 1; j < i; ++j )
+			{
+				obj_t ajk, aij;
+				bli_acquire_mpart( j*b, k*b, b,  bk, a, &ajk );
+				bli_acquire_mpart( i*b, j*b, bi, b,  a, &aij );
+				bli_obj_set_onlytrans( BLIS_TRANSPOSE, &ajk );
+				bli_dag_gemm( &BLIS_MINUS_ONE, &aik, &ajk, &BLIS_ONE, &aij, dag );
+			}
+		}
+	}
+
+	bli_dag_execute( dag );
+	bli_dag_free( dag );
+}
+
+// Return || a0 - tril( a ) tril( a )^T ||_F / || a0 ||_F.
+static double resid( obj_t* a0, obj_t* a )
+{
+	dim_t  n = bli_obj_length( a );
+	obj_t  l, lt, r, norm;
+	double nr, na, dummy;
+
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &l );
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &r );
+	bli_copym( a, &l );
+	bli_obj_set_diag_offset( 1, &l );
+	bli_obj_set_uplo( BLIS_UPPER, &l );
+	bli_setm( &BLIS_ZERO, &l );
+	bli_obj_set_diag_offset( 0, &l );
+	bli_obj_set_uplo( BLIS_DENSE, &l );
+
+	bli_copym( a0, &r );
+	bli_obj_alias_with_trans( BLIS_TRANSPOSE, &l, &lt );
+	bli_gemm( &BLIS_MINUS_ONE, &l, &lt, &BLIS_ONE, &r );
+
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &norm );
+	bli_normfm( &r, &norm );
+	bli_getsc( &norm, &nr, &dummy );
+	bli_normfm( a0, &norm );
+	bli_getsc( &norm, &na, &dummy );
+
+	bli_obj_free( &l );
+	bli_obj_free( &r );
+
+	return nr / na;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t n        = argc > 1 ? atoi( argv[ 1 ] ) : 480;
+	dim_t b        = argc > 2 ? atoi( argv[ 2 ] ) : 96;
+	dim_t nt       = argc > 3 ? atoi( argv[ 3 ] ) : 2;
+	dim_t nrepeats = argc > 4 ? atoi( argv[ 4 ] ) : 3;
+
+	obj_t a0, a, shift;
+
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &a0 );
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &a );
+
+	bli_randm( &a0 );
+	bli_obj_set_struc( BLIS_SYMMETRIC, &a0 );
+	bli_obj_set_uplo( BLIS_LOWER, &a0 );
+	bli_mksymm( &a0 );
+	bli_obj_set_struc( BLIS_GENERAL, &a0 );
+	bli_obj_set_uplo( BLIS_DENSE, &a0 );
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &shift );
+	bli_setsc( ( double )n, 0.0, &shift );
+	bli_shiftd( &shift, &a0 );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	obj_t* akk = malloc( ( ( n + b - 1 ) / b ) * sizeof( obj_t ) );
+
+	printf( "%% n = %d, b = %d, nt = %d\n", ( int )n, ( int )b, ( int )nt );
+	printf( "%% %-10s %10s %10s %12s\n", "variant", "time", "gflops", "resid" );
+
+	for ( int v = 0; v < 2; ++v )
+	{
+		double dtime_save = DBL_MAX;
+		double res        = 0.0;
+
+		for ( dim_t r = 0; r < nrepeats; ++r )
+		{
+			bli_copym( &a0, &a );
+
+			double dtime = bli_clock();
+
+			if ( v == 0 ) chol_forkjoin( &a, b, &rntm );
+			else          chol_dag( &a, b, &rntm, akk );
+
+			dtime_save = bli_clock_min_diff( dtime_save, dtime );
+
+			res = bli_max( res, resid( &a0, &a ) );
+		}
+
+		double gflops = ( ( double )n * n * n / 3.0 ) / ( dtime_save * 1.0e9 );
+
+		printf( "  %-10s %10.4f %10.2f %12.3e\n",
+		        v == 0 ? "forkjoin" : "dag", dtime_save, gflops, res );
+
+		if ( res > 1.0e-12 )
+		{
+			printf( "FAIL: residual too large\n" );
+			return 1;
+		}
+	}
+
+	free( akk );
+	bli_obj_free( &a0 );
+	bli_obj_free( &a );
+
+	return 0;
+}
+
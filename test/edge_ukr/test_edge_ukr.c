@@ -0,0 +1,188 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <stdio.h>
+#include <math.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Checks the edge-case gemm microkernel (BLIS_GEMM_EDGE_UKR) of the current
+// context against the regular microkernel applied to the full microtile:
+// for every m <= MR and n <= NR, the m x n corner of C must match the full
+// tile, the rest of the microtile must not be touched, and C must not be
+// read when beta is zero. Usage:
+//
+//   ./test_edge_ukr.x
+//
+
+static void gemm_ukr( gemm_ukr_ft ukr, dim_t m, dim_t n, obj_t* alpha,
+                      obj_t* a, obj_t* b, obj_t* beta, obj_t* c,
+                      const cntx_t* cntx )
+{
+	auxinfo_t aux;
+
+	bli_auxinfo_set_next_ab( bli_obj_buffer( a ), bli_obj_buffer( b ), &aux );
+	bli_auxinfo_set_is_a( 1, &aux );
+	bli_auxinfo_set_is_b( 1, &aux );
+
+	ukr( m, n, bli_obj_width( a ), bli_obj_buffer( alpha ),
+	     bli_obj_buffer( a ), bli_obj_buffer( b ), bli_obj_buffer( beta ),
+	     bli_obj_buffer( c ), bli_obj_row_stride( c ), bli_obj_col_stride( c ),
+	     &aux, ( cntx_t* )cntx );
+}
+
+// Return the largest difference between x and y outside of their leading
+// m x n corner.
+static double diff_outside( dim_t m, dim_t n, obj_t* x, obj_t* y )
+{
+	const dim_t mr = bli_obj_length( x );
+	const dim_t nr = bli_obj_width( x );
+	obj_t       x1, y1, x2, y2;
+
+	bli_acquire_mpart( m, 0, mr - m, nr, x, &x1 );
+	bli_acquire_mpart( m, 0, mr - m, nr, y, &y1 );
+	bli_acquire_mpart( 0, n, m, nr - n, x, &x2 );
+	bli_acquire_mpart( 0, n, m, nr - n, y, &y2 );
+
+	return bli_max( test_max_diff( &x1, &y1 ), test_max_diff( &x2, &y2 ) );
+}
+
+int main( void )
+{
+	const num_t   dts[]    = { BLIS_FLOAT, BLIS_DOUBLE };
+	const dim_t   ks[]     = { 1, 4, 17 };
+	const double  alphas[] = { 1.0, -0.5 };
+	const double  betas[]  = { 0.0, 1.0, 0.7 };
+
+	const cntx_t* cntx = bli_gks_query_cntx();
+
+	dim_t n_cases = 0, n_fail = 0;
+
+	for ( int idt = 0; idt < 2; ++idt )
+	{
+		const num_t dt = dts[ idt ];
+
+		if ( !bli_cntx_get_ukr_prefs_dt( dt, BLIS_GEMM_EDGE_UKR_PREF, cntx ) )
+		{
+			printf( "%s: no edge-case microkernel in this configuration\n",
+			        bli_dt_string( dt ) );
+			continue;
+		}
+
+		const dim_t mr     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+		const dim_t nr     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+		const dim_t packmr = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+		const dim_t packnr = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+		const double tol   = bli_dt_prec_is_single( dt ) ? 1e-5 : 1e-13;
+
+		gemm_ukr_ft full = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx );
+		gemm_ukr_ft edge = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_EDGE_UKR, cntx );
+
+		for ( int ik = 0; ik < 3; ++ik )
+		for ( int sto = 0; sto < 3; ++sto )
+		for ( int ia = 0; ia < 2; ++ia )
+		for ( int ib = 0; ib < 3; ++ib )
+		{
+			const dim_t k = ks[ ik ];
+
+			obj_t a, b, c0, c_full, c_edge, alpha, beta;
+
+			// A and B are stored as packed micropanels.
+			bli_obj_create( dt, packmr, k, 1, packmr, &a );
+			bli_obj_create( dt, k, packnr, packnr, 1, &b );
+			bli_randm( &a );
+			bli_randm( &b );
+
+			// C is column-stored, row-stored or general-stored.
+			switch ( sto )
+			{
+				case 0:  bli_obj_create( dt, mr, nr, 1, mr + 3, &c0 ); break;
+				case 1:  bli_obj_create( dt, mr, nr, nr + 3, 1, &c0 ); break;
+				default: bli_obj_create( dt, mr, nr, 2, 2 * mr + 1, &c0 ); break;
+			}
+			bli_obj_create_conf_to( &c0, &c_full );
+			bli_obj_create_conf_to( &c0, &c_edge );
+			bli_randm( &c0 );
+
+			bli_obj_scalar_init_detached( dt, &alpha );
+			bli_obj_scalar_init_detached( dt, &beta );
+			bli_setsc( alphas[ ia ], 0.0, &alpha );
+			bli_setsc( betas[ ib ], 0.0, &beta );
+
+			bli_copym( &c0, &c_full );
+			gemm_ukr( full, mr, nr, &alpha, &a, &b, &beta, &c_full, cntx );
+
+			for ( dim_t m = 1; m <= mr; ++m )
+			for ( dim_t n = 1; n <= nr; ++n )
+			{
+				obj_t c_full1, c_edge1;
+
+				bli_copym( &c0, &c_edge );
+				bli_acquire_mpart( 0, 0, m, n, &c_full, &c_full1 );
+				bli_acquire_mpart( 0, 0, m, n, &c_edge, &c_edge1 );
+
+				if ( betas[ ib ] == 0.0 ) bli_setm( &BLIS_NAN, &c_edge1 );
+
+				gemm_ukr( edge, m, n, &alpha, &a, &b, &beta, &c_edge, cntx );
+
+				const double d_in  = test_max_diff( &c_edge1, &c_full1 );
+				const double d_out = diff_outside( m, n, &c_edge, &c0 );
+
+				n_cases += 1;
+
+				if ( d_in > tol * k || d_out != 0.0 )
+				{
+					n_fail += 1;
+					printf( "FAIL: %s m = %ld n = %ld k = %ld storage %d "
+					        "alpha = %g beta = %g (diff %g, outside %g)\n",
+					        bli_dt_string( dt ), ( long )m, ( long )n,
+					        ( long )k, sto, alphas[ ia ], betas[ ib ],
+					        d_in, d_out );
+				}
+			}
+
+			bli_obj_free( &a );
+			bli_obj_free( &b );
+			bli_obj_free( &c0 );
+			bli_obj_free( &c_full );
+			bli_obj_free( &c_edge );
+		}
+	}
+
+	printf( "%ld cases, %ld failed\n", ( long )n_cases, ( long )n_fail );
+
+	return n_fail == 0 ? 0 : 1;
+}
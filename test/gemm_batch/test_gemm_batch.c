@@ -0,0 +1,235 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Checks bli_gemm_batch_strided_ex() against a loop of bli_gemm_ex() over
+// the problems of the batch, for a range of datatypes, shapes, storage
+// formats and numbers of threads, and then compares the time taken by both
+// for batches of double-precision problems of various sizes. Usage:
+//
+//   ./test_gemm_batch.x [nthreads] [nrepeats]
+//
+
+static double check_batch( num_t dt, dim_t m, dim_t n, dim_t k, dim_t batch,
+                           trans_t transa, trans_t transb, bool row_major,
+                           bool share_b, dim_t nt )
+{
+	obj_t alpha, beta;
+	obj_t a, b, c, c_ref;
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_obj_scalar_init_detached( dt, &beta );
+	bli_setsc(  1.5, 0.5, &alpha );
+	bli_setsc( -0.5, 0.0, &beta );
+
+	dim_t m_a, n_a, m_b, n_b;
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a );
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b );
+
+	// Pad the leading dimensions and the strides between problems.
+	const inc_t ld_a = ( row_major ? n_a : m_a ) + 3;
+	const inc_t ld_b = ( row_major ? n_b : m_b ) + 1;
+	const inc_t ld_c = ( row_major ? n   : m   ) + 2;
+
+	const inc_t stride_a = ld_a * ( row_major ? m_a : n_a ) + 5;
+	const inc_t stride_b = share_b ? 0 : ld_b * ( row_major ? m_b : n_b ) + 7;
+	const inc_t stride_c = ld_c * ( row_major ? m : n ) + 1;
+
+	test_create_batch( dt, m_a, n_a, row_major, ld_a, stride_a, batch, &a );
+	test_create_batch( dt, m_b, n_b, row_major, ld_b, stride_b, batch, &b );
+	test_create_batch( dt, m,   n,   row_major, ld_c, stride_c, batch, &c );
+	test_create_batch( dt, m,   n,   row_major, ld_c, stride_c, batch, &c_ref );
+
+	bli_obj_set_conjtrans( transa, &a );
+	bli_obj_set_conjtrans( transb, &b );
+
+	double diff = 0.0;
+
+	for ( dim_t i = 0; i < batch; ++i )
+	{
+		obj_t c_i, c_ref_i;
+		test_acquire_batch( i, stride_c, &c, &c_i );
+		test_acquire_batch( i, stride_c, &c_ref, &c_ref_i );
+		bli_copym( &c_i, &c_ref_i );
+	}
+
+	bli_gemm_batch_strided_ex( &alpha, &a, stride_a, &b, stride_b,
+	                           &beta, &c, stride_c, batch, NULL, &rntm );
+
+	for ( dim_t i = 0; i < batch; ++i )
+	{
+		obj_t a_i, b_i, c_i, c_ref_i;
+		test_acquire_batch( i, stride_a, &a, &a_i );
+		test_acquire_batch( i, stride_b, &b, &b_i );
+		test_acquire_batch( i, stride_c, &c, &c_i );
+		test_acquire_batch( i, stride_c, &c_ref, &c_ref_i );
+
+		bli_gemm_ex( &alpha, &a_i, &b_i, &beta, &c_ref_i, NULL, &rntm );
+
+		diff = bli_max( diff, test_rel_diff( &c_i, &c_ref_i ) );
+	}
+
+	test_free_batch( &a );
+	test_free_batch( &b );
+	test_free_batch( &c );
+	test_free_batch( &c_ref );
+
+	return diff;
+}
+
+static int check( void )
+{
+	const num_t dts[]     = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t sizes[][ 3 ] =
+	{
+		{   1,   1,   1 },
+		{   7,   5,   9 },
+		{  64,  48,  32 },
+		{ 201, 150, 301 },
+		{ 520, 410, 300 },
+	};
+	const dim_t n_sizes   = sizeof( sizes ) / sizeof( sizes[ 0 ] );
+	const dim_t batches[] = { 1, 3, 8 };
+
+	dim_t n_cases = 0, n_fail = 0;
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( dim_t is = 0; is < n_sizes; ++is )
+	for ( int ib = 0; ib < 3; ++ib )
+	for ( int ivar = 0; ivar < 3; ++ivar )
+	for ( dim_t nt = 1; nt <= 4; nt += 3 )
+	{
+		const num_t   dt        = dts[ idt ];
+		const double  tol       = bli_dt_prec_is_single( dt ) ? 1e-5 : 1e-13;
+		const trans_t transa    = ( ivar == 1 ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE );
+		const trans_t transb    = ( ivar == 1 ? BLIS_CONJ_TRANSPOSE : BLIS_NO_TRANSPOSE );
+		const bool    row_major = ( ivar == 2 );
+		const bool    share_b   = ( ivar == 2 );
+
+		double diff = check_batch( dt, sizes[ is ][ 0 ], sizes[ is ][ 1 ], sizes[ is ][ 2 ],
+		                           batches[ ib ], transa, transb, row_major, share_b, nt );
+
+		n_cases += 1;
+
+		if ( !( diff < tol ) )
+		{
+			n_fail += 1;
+			printf( "FAILED: dt = %d m = %d n = %d k = %d batch = %d var = %d nt = %d (diff = %g)\n",
+			        ( int )dt, ( int )sizes[ is ][ 0 ], ( int )sizes[ is ][ 1 ],
+			        ( int )sizes[ is ][ 2 ], ( int )batches[ ib ], ivar, ( int )nt, diff );
+		}
+	}
+
+	printf( "%d of %d cases passed.\n", ( int )( n_cases - n_fail ), ( int )n_cases );
+
+	return n_fail != 0;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t nt       = ( argc > 1 ? atoi( argv[1] ) : 1 );
+	dim_t nrepeats = ( argc > 2 ? atoi( argv[2] ) : 3 );
+
+	bli_init();
+
+	int r_val = check();
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	const dim_t shapes[][ 2 ] =
+	{
+		{   16, 4096 },
+		{   48, 1024 },
+		{  128,  256 },
+		{  256,   64 },
+		{  512,    8 },
+		{ 1024,    2 },
+	};
+	const dim_t n_shapes = sizeof( shapes ) / sizeof( shapes[ 0 ] );
+
+	printf( "%5s %6s %14s %14s %8s\n", "m=n=k", "batch", "loop (ms)", "batch (ms)", "speedup" );
+
+	for ( dim_t is = 0; is < n_shapes; ++is )
+	{
+		const dim_t m     = shapes[ is ][ 0 ];
+		const dim_t batch = shapes[ is ][ 1 ];
+		const inc_t s     = m * m;
+		obj_t a, b, c;
+
+		test_create_batch( BLIS_DOUBLE, m, m, false, m, s, batch, &a );
+		test_create_batch( BLIS_DOUBLE, m, m, false, m, s, batch, &b );
+		test_create_batch( BLIS_DOUBLE, m, m, false, m, s, batch, &c );
+
+		double t_loop = 1.0e9, t_batch = 1.0e9;
+
+		for ( dim_t r = 0; r < nrepeats; ++r )
+		{
+			double t0 = bli_clock();
+			for ( dim_t i = 0; i < batch; ++i )
+			{
+				obj_t a_i, b_i, c_i;
+				test_acquire_batch( i, s, &a, &a_i );
+				test_acquire_batch( i, s, &b, &b_i );
+				test_acquire_batch( i, s, &c, &c_i );
+				bli_gemm_ex( &BLIS_ONE, &a_i, &b_i, &BLIS_ZERO, &c_i, NULL, &rntm );
+			}
+			t_loop = bli_clock_min_diff( t_loop, t0 );
+
+			t0 = bli_clock();
+			bli_gemm_batch_strided_ex( &BLIS_ONE, &a, s, &b, s, &BLIS_ZERO, &c, s,
+			                           batch, NULL, &rntm );
+			t_batch = bli_clock_min_diff( t_batch, t0 );
+		}
+
+		printf( "%5d %6d %14.2f %14.2f %8.2f\n", ( int )m, ( int )batch,
+		        1e3 * t_loop, 1e3 * t_batch, t_loop / t_batch );
+
+		test_free_batch( &a );
+		test_free_batch( &b );
+		test_free_batch( &c );
+	}
+
+	bli_finalize();
+
+	return r_val;
+}
@@ -0,0 +1,404 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <stdio.h>
+#include <math.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Checks the sup implementation of gemmt against bli_gemm() restricted to
+// the stored triangle of C, for both real datatypes, lower and upper C,
+// row- and column-stored operands, transposed and non-transposed A and B,
+// rank-k updates in which B aliases A^T, and with the rntm_t requesting
+// packing of A, B or both. Skinny problems with a long k dimension are
+// also run on several threads so that the k dimension is parallelized.
+// The unstored triangle of C must not be modified, and C must not be read
+// when beta is zero.
+//
+// For the complex datatypes, herk and her2k with sup enabled are checked
+// against the same operations with sup disabled, over the same variations,
+// and the imaginary parts of the diagonal of C must be exactly zero. Since
+// not every configuration enables sup for complex datatypes, the sup
+// thresholds of the complex datatypes are raised in the global context
+// before these cases run. Usage:
+//
+//   ./test_gemmt_sup.x
+//
+
+#define PACK_A 1
+#define PACK_B 2
+
+static dim_t n_cases = 0, n_fail = 0;
+
+// Return the largest difference between c and c_ref in the stored triangle
+// of c, and the largest difference between c and c_orig in the unstored
+// triangle (where NaN matches NaN).
+static void diff_tri( obj_t* c, obj_t* c_ref, obj_t* c_orig,
+                      double* d_in, double* d_out )
+{
+	const bool  lower = bli_obj_is_lower( c );
+	const dim_t m     = bli_obj_length( c );
+
+	*d_in = *d_out = 0.0;
+
+	for ( dim_t j = 0; j < m; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		double cij, ci, rij, ri;
+
+		bli_getijm( i, j, c, &cij, &ci );
+
+		if ( lower ? i >= j : i <= j )
+		{
+			bli_getijm( i, j, c_ref, &rij, &ri );
+
+			const double t = hypot( cij - rij, ci - ri );
+			if ( !( t <= *d_in ) ) *d_in = ( isnan( t ) ? INFINITY : t );
+		}
+		else
+		{
+			bli_getijm( i, j, c_orig, &rij, &ri );
+
+			if ( isnan( cij ) && isnan( rij ) ) continue;
+
+			const double t = hypot( cij - rij, ci - ri );
+			if ( !( t <= *d_out ) ) *d_out = ( isnan( t ) ? INFINITY : t );
+		}
+	}
+}
+
+static void run
+     (
+       num_t   dt,
+       uplo_t  uploc,
+       bool    row_c,
+       bool    row_ab,
+       trans_t transa,
+       trans_t transb,
+       bool    rankk,
+       dim_t   m,
+       dim_t   k,
+       double  beta,
+       int     pack,
+       dim_t   nt
+     )
+{
+	const double tol = bli_dt_prec_is_single( dt ) ? 1e-6 : 1e-14;
+
+	obj_t a, b, c, c_ref, c_orig, beta_o;
+
+	test_create_op( dt, row_ab, transa, m, k, 3, &a );
+	bli_randm( &a );
+
+	if ( rankk )
+	{
+		// B = A^T, as in syrk.
+		transb = bli_trans_toggled( transa );
+		bli_obj_alias_to( &a, &b );
+	}
+	else
+	{
+		test_create_op( dt, row_ab, transb, k, m, 3, &b );
+		bli_randm( &b );
+	}
+
+	bli_obj_set_onlytrans( transa, &a );
+	bli_obj_set_onlytrans( transb, &b );
+
+	test_create_op( dt, row_c, BLIS_NO_TRANSPOSE, m, m, 3, &c );
+	test_create_op( dt, row_c, BLIS_NO_TRANSPOSE, m, m, 3, &c_ref );
+	test_create_op( dt, row_c, BLIS_NO_TRANSPOSE, m, m, 3, &c_orig );
+
+	bli_randm( &c_orig );
+	if ( beta == 0.0 ) bli_setm( &BLIS_NAN, &c_orig );
+
+	bli_copym( &c_orig, &c );
+	bli_randm( &c_ref );
+	if ( beta != 0.0 ) bli_copym( &c_orig, &c_ref );
+
+	bli_obj_scalar_init_detached( dt, &beta_o );
+	bli_setsc( beta, 0.0, &beta_o );
+
+	// The reference: a full gemm.
+	bli_gemm( &BLIS_ONE, &a, &b, &beta_o, &c_ref );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+
+	if ( 1 < nt )
+	{
+		bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+		bli_rntm_set_num_threads( nt, &rntm );
+	}
+	bli_rntm_set_pack_a( ( pack & PACK_A ) != 0, &rntm );
+	bli_rntm_set_pack_b( ( pack & PACK_B ) != 0, &rntm );
+
+	bli_obj_set_uplo( uploc, &c );
+	bli_gemmt_ex( &BLIS_ONE, &a, &b, &beta_o, &c, NULL, &rntm );
+
+	double d_in, d_out;
+	diff_tri( &c, &c_ref, &c_orig, &d_in, &d_out );
+
+	n_cases += 1;
+
+	if ( d_in > tol * k || d_out != 0.0 )
+	{
+		n_fail += 1;
+		printf( "FAIL: %s %s m = %ld k = %ld %s-stored C, %s-stored A/B "
+		        "trans%c%c%s beta = %g pack%s%s nt = %ld "
+		        "(diff %g, outside %g)\n",
+		        bli_dt_string( dt ), bli_is_lower( uploc ) ? "lower" : "upper",
+		        ( long )m, ( long )k, row_c ? "row" : "col",
+		        row_ab ? "row" : "col",
+		        bli_does_trans( transa ) ? 't' : 'n',
+		        bli_does_trans( transb ) ? 't' : 'n',
+		        rankk ? " (B = A^T)" : "", beta,
+		        pack & PACK_A ? " A" : "", pack & PACK_B ? " B" : "",
+		        ( long )nt, d_in, d_out );
+	}
+
+	bli_obj_free( &a );
+	if ( !rankk ) bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+	bli_obj_free( &c_orig );
+}
+
+// Check herk (or her2k) with sup enabled against the same operation with sup
+// disabled, using nt threads for the former.
+static void run_herm
+     (
+       num_t   dt,
+       uplo_t  uploc,
+       bool    row_c,
+       bool    row_ab,
+       trans_t transa,
+       bool    her2k,
+       dim_t   m,
+       dim_t   k,
+       double  beta,
+       int     pack,
+       dim_t   nt
+     )
+{
+	const double tol = bli_dt_prec_is_single( dt ) ? 1e-6 : 1e-14;
+
+	obj_t a, b, c, c_ref, c_orig, alpha_o, beta_o;
+
+	test_create_op( dt, row_ab, transa, m, k, 3, &a );
+	test_create_op( dt, row_ab, transa, m, k, 3, &b );
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_obj_set_onlytrans( transa, &a );
+	bli_obj_set_onlytrans( transa, &b );
+
+	test_create_op( dt, row_c, BLIS_NO_TRANSPOSE, m, m, 3, &c );
+	test_create_op( dt, row_c, BLIS_NO_TRANSPOSE, m, m, 3, &c_ref );
+	test_create_op( dt, row_c, BLIS_NO_TRANSPOSE, m, m, 3, &c_orig );
+
+	bli_randm( &c_orig );
+	if ( beta == 0.0 ) bli_setm( &BLIS_NAN, &c_orig );
+
+	bli_copym( &c_orig, &c );
+	bli_copym( &c_orig, &c_ref );
+
+	bli_obj_set_struc( BLIS_HERMITIAN, &c );
+	bli_obj_set_struc( BLIS_HERMITIAN, &c_ref );
+	bli_obj_set_uplo( uploc, &c );
+	bli_obj_set_uplo( uploc, &c_ref );
+
+	// herk only uses the real part of alpha.
+	bli_obj_scalar_init_detached( dt, &alpha_o );
+	bli_obj_scalar_init_detached( dt, &beta_o );
+	bli_setsc( 0.8, her2k ? -0.3 : 0.0, &alpha_o );
+	bli_setsc( beta, 0.0, &beta_o );
+
+	rntm_t rntm_ref = BLIS_RNTM_INITIALIZER;
+	rntm_t rntm     = BLIS_RNTM_INITIALIZER;
+
+	bli_rntm_disable_l3_sup( &rntm_ref );
+
+	if ( 1 < nt )
+	{
+		bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+		bli_rntm_set_num_threads( nt, &rntm );
+	}
+	bli_rntm_set_pack_a( ( pack & PACK_A ) != 0, &rntm );
+	bli_rntm_set_pack_b( ( pack & PACK_B ) != 0, &rntm );
+
+	if ( her2k )
+	{
+		bli_her2k_ex( &alpha_o, &a, &b, &beta_o, &c_ref, NULL, &rntm_ref );
+		bli_her2k_ex( &alpha_o, &a, &b, &beta_o, &c,     NULL, &rntm );
+	}
+	else
+	{
+		bli_herk_ex( &alpha_o, &a, &beta_o, &c_ref, NULL, &rntm_ref );
+		bli_herk_ex( &alpha_o, &a, &beta_o, &c,     NULL, &rntm );
+	}
+
+	double d_in, d_out, d_diag = 0.0;
+	diff_tri( &c, &c_ref, &c_orig, &d_in, &d_out );
+
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		double re, im;
+		bli_getijm( i, i, &c, &re, &im );
+		if ( !( fabs( im ) <= d_diag ) ) d_diag = ( isnan( im ) ? INFINITY : fabs( im ) );
+	}
+
+	n_cases += 1;
+
+	if ( d_in > tol * 2 * k || d_out != 0.0 || d_diag != 0.0 )
+	{
+		n_fail += 1;
+		printf( "FAIL: %s %s %s m = %ld k = %ld %s-stored C, %s-stored A/B "
+		        "trans%c beta = %g pack%s%s nt = %ld "
+		        "(diff %g, outside %g, imag(diag) %g)\n",
+		        her2k ? "her2k" : "herk",
+		        bli_dt_string( dt ), bli_is_lower( uploc ) ? "lower" : "upper",
+		        ( long )m, ( long )k, row_c ? "row" : "col",
+		        row_ab ? "row" : "col",
+		        bli_does_trans( transa ) ? 't' : 'n', beta,
+		        pack & PACK_A ? " A" : "", pack & PACK_B ? " B" : "",
+		        ( long )nt, d_in, d_out, d_diag );
+	}
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+	bli_obj_free( &c_orig );
+}
+
+int main( void )
+{
+	const num_t   dts[]    = { BLIS_FLOAT, BLIS_DOUBLE };
+	const uplo_t  uplos[]  = { BLIS_LOWER, BLIS_UPPER };
+	const trans_t transs[] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE };
+	const double  betas[]  = { 0.0, 0.7 };
+
+	// Problems within the sup thresholds, including ones with several
+	// blocks of rows and partial microtiles.
+	const dim_t   dims[][ 2 ] =
+	{
+		{   1,   1 },
+		{   5,  37 },
+		{  17,   9 },
+		{  64, 300 },
+		{ 150,  64 },
+		{ 260,  50 },
+	};
+
+	for ( int idt = 0; idt < 2; ++idt )
+	for ( int iu  = 0; iu  < 2; ++iu  )
+	for ( int id  = 0; id  < 6; ++id  )
+	for ( int sto = 0; sto < 4; ++sto )
+	for ( int tr  = 0; tr  < 5; ++tr  )
+	for ( int ib  = 0; ib  < 2; ++ib  )
+	{
+		// tr = 4 is a rank-k update with B = A^T.
+		const bool    rankk  = ( tr == 4 );
+		const trans_t transa = transs[ tr % 2 ];
+		const trans_t transb = transs[ ( tr / 2 ) % 2 ];
+
+		// Cycle through the packing requests.
+		const int     pack   = ( id + sto + tr ) % 4;
+
+		run( dts[ idt ], uplos[ iu ], sto & 1, sto & 2, transa, transb,
+		     rankk, dims[ id ][ 0 ], dims[ id ][ 1 ], betas[ ib ], pack, 1 );
+	}
+
+	// Skinny problems with a long k dimension on several threads, for which
+	// the k dimension is parallelized (and the partial products reduced).
+	for ( int idt  = 0; idt  < 2; ++idt  )
+	for ( int iu   = 0; iu   < 2; ++iu   )
+	for ( int sto  = 0; sto  < 4; ++sto  )
+	for ( int rk   = 0; rk   < 2; ++rk   )
+	for ( int pack = 0; pack < 4; ++pack )
+	for ( dim_t nt = 2; nt <= 4; nt += 2 )
+	{
+		run( dts[ idt ], uplos[ iu ], sto & 1, sto & 2,
+		     BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE, rk, 20, 3000,
+		     betas[ ( sto + pack ) % 2 ], pack, nt );
+	}
+
+	// Let the complex datatypes use sup for the problems below, as the real
+	// datatypes do.
+	const num_t   cdts[]   = { BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	cntx_t*       cntx     = ( cntx_t* )bli_gks_query_cntx();
+
+	for ( int idt = 0; idt < 2; ++idt )
+	{
+		bli_cntx_set_blksz_def_dt( cdts[ idt ], BLIS_MT, 201, cntx );
+		bli_cntx_set_blksz_def_dt( cdts[ idt ], BLIS_NT, 201, cntx );
+		bli_cntx_set_blksz_def_dt( cdts[ idt ], BLIS_KT, 201, cntx );
+	}
+
+	for ( int idt = 0; idt < 2; ++idt )
+	for ( int iu  = 0; iu  < 2; ++iu  )
+	for ( int id  = 0; id  < 5; ++id  )
+	for ( int sto = 0; sto < 4; ++sto )
+	for ( int tr  = 0; tr  < 4; ++tr  )
+	{
+		// tr selects herk or her2k, and whether A (and B) are transposed.
+		const bool    her2k  = ( tr / 2 == 1 );
+		const trans_t transa = transs[ tr % 2 ];
+		const int     pack   = ( id + sto + tr ) % 4;
+
+		run_herm( cdts[ idt ], uplos[ iu ], sto & 1, sto & 2, transa, her2k,
+		          dims[ id ][ 0 ], dims[ id ][ 1 ], betas[ ( id + tr ) % 2 ],
+		          pack, 1 );
+	}
+
+	// Skinny problems with a long k dimension on several threads. (The
+	// complex microtiles are larger, so m is smaller than above to leave
+	// few enough microtiles for the k dimension to be parallelized.)
+	for ( int idt  = 0; idt  < 2; ++idt  )
+	for ( int iu   = 0; iu   < 2; ++iu   )
+	for ( int sto  = 0; sto  < 4; ++sto  )
+	for ( int h2   = 0; h2   < 2; ++h2   )
+	for ( int pack = 0; pack < 4; ++pack )
+	for ( dim_t nt = 2; nt <= 4; nt += 2 )
+	{
+		run_herm( cdts[ idt ], uplos[ iu ], sto & 1, sto & 2,
+		          BLIS_NO_TRANSPOSE, h2, 8, 3000,
+		          betas[ ( sto + pack ) % 2 ], pack, nt );
+	}
+
+	printf( "%ld cases, %ld failed\n", ( long )n_cases, ( long )n_fail );
+
+	return n_fail == 0 ? 0 : 1;
+}
@@ -0,0 +1,264 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Checks the gemm kernels generated at runtime against a reference loop over
+// a range of shapes, storage schemes (column- and row-stored operands, with
+// and without transposition) and values of alpha and beta, and then compares
+// the performance of bli_gemm() for small square problems with and without
+// generated kernels. Usage:
+//
+//   ./test_jit.x [nrepeats]
+//
+
+static dim_t dims[] = { 1, 2, 3, 4, 5, 7, 8, 9, 12, 13, 16, 17, 23, 24, 31, 33, 48, 64 };
+static dim_t ks[]   = { 1, 2, 3, 5, 8, 16, 37, 300 };
+
+#define N_DIMS ( sizeof( dims ) / sizeof( dims[0] ) )
+#define N_KS   ( sizeof( ks ) / sizeof( ks[0] ) )
+
+// Compute c := beta * c + alpha * trans(a) * trans(b) in double precision.
+static void gemm_ref( double alpha, obj_t* a, obj_t* b, double beta, obj_t* c )
+{
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		double ab = 0.0, cij, im;
+
+		for ( dim_t p = 0; p < k; ++p )
+		{
+			double aip, bpj;
+			bli_getijm( bli_obj_has_trans( a ) ? p : i, bli_obj_has_trans( a ) ? i : p, a, &aip, &im );
+			bli_getijm( bli_obj_has_trans( b ) ? j : p, bli_obj_has_trans( b ) ? p : j, b, &bpj, &im );
+			ab += aip * bpj;
+		}
+
+		bli_getijm( i, j, c, &cij, &im );
+		bli_setijm( beta == 0.0 ? alpha * ab : beta * cij + alpha * ab, 0.0, i, j, c );
+	}
+}
+
+static double max_rel_diff( obj_t* x, obj_t* y )
+{
+	double diff = 0.0, xij, yij, im;
+
+	for ( dim_t j = 0; j < bli_obj_width( x ); ++j )
+	for ( dim_t i = 0; i < bli_obj_length( x ); ++i )
+	{
+		bli_getijm( i, j, x, &xij, &im );
+		bli_getijm( i, j, y, &yij, &im );
+
+		// NaN compares unequal to everything, including itself.
+		if ( !( fabs( xij - yij ) <= diff * ( 1.0 + fabs( yij ) ) ) )
+			diff = isnan( xij ) ? INFINITY : fabs( xij - yij ) / ( 1.0 + fabs( yij ) );
+	}
+
+	return diff;
+}
+
+static int check( void )
+{
+	const num_t   dts[]    = { BLIS_FLOAT, BLIS_DOUBLE };
+	const double  alphas[] = { 1.0, -0.5 };
+	const double  betas[]  = { 0.0, 1.0, 0.7 };
+
+	dim_t n_cases = 0, n_jit = 0, n_fail = 0;
+
+	for ( int idt = 0; idt < 2; ++idt )
+	{
+		const num_t  dt  = dts[ idt ];
+		const double tol = ( dt == BLIS_FLOAT ? 1e-4 : 1e-12 );
+
+		for ( int sto = 0; sto < 8; ++sto )
+		for ( dim_t im = 0; im < N_DIMS; ++im )
+		{
+		// Start each range of shapes with an empty kernel cache, since the
+		// number of shapes checked exceeds its capacity.
+		bli_finalize();
+		bli_init();
+
+		for ( dim_t in = 0; in < N_DIMS; ++in )
+		for ( dim_t ik = 0; ik < N_KS;   ++ik )
+		{
+			const dim_t m = dims[ im ], n = dims[ in ], k = ks[ ik ];
+
+			// Skip some of the larger shapes to keep the run time short.
+			if ( ( m + n ) * k > 20000 || ( im + in + ik + sto ) % 3 != 0 ) continue;
+
+			// Bit 0: C is row-stored; bit 1: A is transposed; bit 2: B is
+			// transposed. A and B are stored like C.
+			const bool    row    = sto & 1;
+			const trans_t transa = ( sto & 2 ) ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE;
+			const trans_t transb = ( sto & 4 ) ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE;
+
+			obj_t a, b, c, c_ref;
+
+			test_create_op( dt, row, transa, m, k, 3, &a );
+			test_create_op( dt, row, transb, k, n, 3, &b );
+			test_create_op( dt, row, BLIS_NO_TRANSPOSE, m, n, 3, &c );
+			test_create_op( BLIS_DOUBLE, row, BLIS_NO_TRANSPOSE, m, n, 3, &c_ref );
+
+			bli_randm( &a );
+			bli_randm( &b );
+
+			// A and B are stored as trans(A) and trans(B).
+			bli_obj_set_onlytrans( transa, &a );
+			bli_obj_set_onlytrans( transb, &b );
+
+			for ( int ia = 0; ia < 2; ++ia )
+			for ( int ib = 0; ib < 3; ++ib )
+			{
+				obj_t alpha, beta;
+				bli_obj_scalar_init_detached( dt, &alpha );
+				bli_obj_scalar_init_detached( dt, &beta );
+				bli_setsc( alphas[ ia ], 0.0, &alpha );
+				bli_setsc( betas[ ib ], 0.0, &beta );
+
+				bli_randm( &c );
+
+				// C must not be read when beta is zero.
+				if ( betas[ ib ] == 0.0 ) bli_setm( &BLIS_NAN, &c );
+
+				bli_castm( &c, &c_ref );
+				gemm_ref( alphas[ ia ], &a, &b, betas[ ib ], &c_ref );
+
+				n_cases += 1;
+
+				if ( bli_jit_gemm( &alpha, &a, &b, &beta, &c ) != BLIS_SUCCESS )
+					continue;
+
+				n_jit += 1;
+
+				const double diff = max_rel_diff( &c, &c_ref );
+
+				if ( diff > tol )
+				{
+					if ( n_fail < 10 )
+						printf( "FAIL: %c m=%d n=%d k=%d sto=%d alpha=%g beta=%g diff=%g\n",
+						        dt == BLIS_FLOAT ? 's' : 'd', ( int )m, ( int )n, ( int )k,
+						        sto, alphas[ ia ], betas[ ib ], diff );
+					n_fail += 1;
+				}
+			}
+
+			bli_obj_free( &a );
+			bli_obj_free( &b );
+			bli_obj_free( &c );
+			bli_obj_free( &c_ref );
+		}
+		}
+	}
+
+	printf( "correctness: %d cases, %d used generated kernels, %d failed\n",
+	        ( int )n_cases, ( int )n_jit, ( int )n_fail );
+
+	return n_fail == 0 ? 0 : 1;
+}
+
+static double time_gemm( dim_t n, dim_t nrepeats )
+{
+	obj_t a, b, c;
+
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &c );
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+
+	// Each timed sample consists of enough calls to take a measurable time.
+	const dim_t n_calls = bli_max( 1, 2000000 / ( n * n * n ) );
+	double      dtime   = 1.0e9;
+
+	for ( dim_t r = 0; r < nrepeats; ++r )
+	{
+		double t0 = bli_clock();
+
+		for ( dim_t i = 0; i < n_calls; ++i )
+			bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ONE, &c );
+
+		dtime = bli_clock_min_diff( dtime, t0 );
+	}
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return dtime / n_calls;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t nrepeats = ( argc > 1 ? atoi( argv[1] ) : 5 );
+
+	bli_init();
+
+	if ( !bli_jit_is_available() )
+	{
+		printf( "Kernels cannot be generated on this configuration (%s).\n",
+		        bli_arch_string( bli_arch_query_id() ) );
+		return 0;
+	}
+
+	int r_val = check();
+
+	printf( "%5s %12s %12s %8s\n", "n", "sup (us)", "jit (us)", "speedup" );
+
+	for ( dim_t n = 2; n <= 32; n *= 2 )
+	for ( dim_t n2 = n; n2 <= n + n / 2 && n2 <= 32; n2 += bli_max( 1, n / 2 ) )
+	{
+		bli_jit_disable();
+		double t_sup = time_gemm( n2, nrepeats );
+
+		bli_jit_enable();
+		double t_jit = time_gemm( n2, nrepeats );
+
+		printf( "%5d %12.3f %12.3f %8.2f\n", ( int )n2, 1e6 * t_sup, 1e6 * t_jit,
+		        t_sup / t_jit );
+	}
+
+	bli_finalize();
+
+	return r_val;
+}
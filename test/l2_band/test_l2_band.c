@@ -0,0 +1,616 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Checks the band (gbmv, hbmv, sbmv, tbmv, tbsv) and packed (hpmv, spmv,
+// hpr, spr, tpmv, tpsv) typed interfaces against the corresponding dense
+// object-based operations applied to the same matrices, and then compares
+// the time taken by dgbmv and dspmv against that of straightforward
+// column-oriented loops such as those of the reference BLAS. Usage:
+//
+//   ./test_l2_band.x [nthreads] [nrepeats]
+//
+
+// Call the typed interface of the given operation for datatype dt. Pointer
+// arguments are passed as void* and converted implicitly.
+#define TCALL( dt, op, ... ) \
+	switch ( dt ) \
+	{ \
+		case BLIS_FLOAT:    bli_s ## op ## _ex( __VA_ARGS__ ); break; \
+		case BLIS_DOUBLE:   bli_d ## op ## _ex( __VA_ARGS__ ); break; \
+		case BLIS_SCOMPLEX: bli_c ## op ## _ex( __VA_ARGS__ ); break; \
+		default:            bli_z ## op ## _ex( __VA_ARGS__ ); break; \
+	}
+
+// Create a randomized vector of length n stored with increment inc.
+static void create_vec( num_t dt, dim_t n, inc_t inc, obj_t* x )
+{
+	const dim_t n_elem = bli_max( n * inc, 1 );
+	err_t       r_val;
+
+	void* buf = bli_malloc_user( n_elem * bli_dt_size( dt ), &r_val );
+
+	obj_t v;
+	bli_obj_create_with_attached_buffer( dt, n_elem, 1, buf, 1, n_elem, &v );
+	bli_randm( &v );
+
+	bli_obj_create_with_attached_buffer( dt, n, 1, buf, inc, n_elem, x );
+}
+
+// Create a band matrix with kl subdiagonals and ku superdiagonals, stored
+// as in the BLAS (by columns) or the CBLAS with row-major order (by rows),
+// together with a dense copy of it that is zero outside of the band. The
+// band storage is padded so that unused elements are garbage.
+static void create_band( num_t dt, dim_t m, dim_t n, dim_t kl, dim_t ku,
+                         bool row_major, obj_t* band, void** a, inc_t* rs_a,
+                         inc_t* cs_a, obj_t* dense )
+{
+	const inc_t lda = kl + ku + 3;
+
+	create_vec( dt, ( row_major ? m : n ) * lda, 1, band );
+
+	char* buf = bli_obj_buffer( band );
+	inc_t off;
+
+	if ( row_major ) { off = kl; *rs_a = lda - 1; *cs_a = 1; }
+	else             { off = ku; *rs_a = 1;       *cs_a = lda - 1; }
+
+	*a = buf + off * bli_dt_size( dt );
+
+	bli_obj_create( dt, m, n, 0, 0, dense );
+	bli_setm( &BLIS_ZERO, dense );
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = bli_max( 0, j - ku ); i < bli_min( m, j + kl + 1 ); ++i )
+	{
+		double re, im;
+		bli_getijv( off + i * *rs_a + j * *cs_a, band, &re, &im );
+		bli_setijm( re, im, i, j, dense );
+	}
+}
+
+// Create a packed matrix and a dense copy of its stored triangle.
+static void create_packed( num_t dt, uplo_t uplo, dim_t m, obj_t* packed, obj_t* dense )
+{
+	create_vec( dt, ( m * ( m + 1 ) ) / 2, 1, packed );
+
+	bli_obj_create( dt, m, m, 0, 0, dense );
+	bli_setm( &BLIS_ZERO, dense );
+
+	for ( dim_t j = 0; j < m; ++j )
+	for ( dim_t i = ( bli_is_lower( uplo ) ? j : 0 ); i < ( bli_is_lower( uplo ) ? m : j + 1 ); ++i )
+	{
+		double re, im;
+		bli_getijv( bli_packed_col_off( uplo, m, j ) + ( bli_is_lower( uplo ) ? i - j : i ),
+		            packed, &re, &im );
+		bli_setijm( re, im, i, j, dense );
+	}
+}
+
+// Copy the stored triangle of a dense matrix to a packed matrix.
+static void pack_dense( uplo_t uplo, const obj_t* dense, obj_t* packed )
+{
+	const dim_t m = bli_obj_length( dense );
+
+	for ( dim_t j = 0; j < m; ++j )
+	for ( dim_t i = ( bli_is_lower( uplo ) ? j : 0 ); i < ( bli_is_lower( uplo ) ? m : j + 1 ); ++i )
+	{
+		double re, im;
+		bli_getijm( i, j, dense, &re, &im );
+		bli_setijv( re, im, bli_packed_col_off( uplo, m, j ) + ( bli_is_lower( uplo ) ? i - j : i ),
+		            packed );
+	}
+}
+
+// Make a triangular matrix well-conditioned, even with a unit diagonal, by
+// making its off-diagonal elements small.
+static void condition_tri( dim_t k, obj_t* dense )
+{
+	obj_t scale;
+
+	bli_obj_scalar_init_detached( bli_obj_dt( dense ), &scale );
+	bli_setsc( 0.5 / ( double )( k + 1 ), 0.0, &scale );
+	bli_scalm( &scale, dense );
+	bli_shiftd( &BLIS_ONE, dense );
+}
+
+static void free_obj( obj_t* x )
+{
+	bli_free_user( bli_obj_buffer( x ) );
+}
+
+// Operations under test.
+enum { GBMV, HBMV, SBMV, TBMV, TBSV, HPMV, SPMV, HPR, SPR, TPMV, TPSV, N_OPS };
+
+static const char* op_names[ N_OPS ] =
+{
+	"gbmv", "hbmv", "sbmv", "tbmv", "tbsv", "hpmv", "spmv", "hpr", "spr", "tpmv", "tpsv"
+};
+
+// Check one case of an operation. For the square operations, m is the
+// order of A and k its number of off-diagonals (kl and ku are used only by
+// gbmv). The variant bits select uplo, transa/conja, conjx, diag, and the
+// storage of the band.
+static double check_op( int op, num_t dt, dim_t m, dim_t n, dim_t kl, dim_t ku,
+                        int var, inc_t incx, inc_t incy, dim_t nt )
+{
+	const uplo_t  uplo      = ( var & 1 ? BLIS_UPPER : BLIS_LOWER );
+	const trans_t transa    = ( var & 2 ? ( var & 4 ? BLIS_CONJ_TRANSPOSE : BLIS_TRANSPOSE )
+	                                    : ( var & 4 ? BLIS_CONJ_NO_TRANSPOSE : BLIS_NO_TRANSPOSE ) );
+	const conj_t  conja     = bli_extract_conj( transa );
+	const conj_t  conjx     = ( var & 8 ? BLIS_CONJUGATE : BLIS_NO_CONJUGATE );
+	const diag_t  diag      = ( var & 16 ? BLIS_UNIT_DIAG : BLIS_NONUNIT_DIAG );
+	const bool    row_major = ( var & 32 );
+	const dim_t   k         = kl;
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	obj_t alpha, beta, alpha_r;
+
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_obj_scalar_init_detached( dt, &beta );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &alpha_r );
+	bli_setsc( 1.5, -0.5, &alpha );
+	bli_setsc( ( var & 8 ? 0.0 : 0.75 ), 0.25, &beta );
+	bli_setsc( -1.25, 0.0, &alpha_r );
+
+	void* ap = bli_obj_buffer( &alpha );
+	void* bp = bli_obj_buffer( &beta );
+
+	obj_t stor, a, x, y, y_ref;
+	void* a_buf;
+	inc_t rs_a = 0, cs_a = 0;
+	double diff;
+
+	if ( op == GBMV )
+	{
+		create_band( dt, m, n, kl, ku, row_major, &stor, &a_buf, &rs_a, &cs_a, &a );
+
+		const dim_t m_y = ( bli_does_trans( transa ) ? n : m );
+		const dim_t n_x = ( bli_does_trans( transa ) ? m : n );
+
+		create_vec( dt, n_x, incx, &x );
+		create_vec( dt, m_y, incy, &y );
+		create_vec( dt, m_y, 1, &y_ref );
+		bli_copyv( &y, &y_ref );
+
+		TCALL( dt, gbmv, transa, conjx, m, n, kl, ku, ap, a_buf, rs_a, cs_a,
+		       bli_obj_buffer( &x ), incx, bp, bli_obj_buffer( &y ), incy, NULL, &rntm );
+
+		bli_obj_set_conjtrans( transa, &a );
+		bli_obj_set_conj( conjx, &x );
+		bli_gemv( &alpha, &a, &x, &beta, &y_ref );
+		bli_obj_set_conj( BLIS_NO_CONJUGATE, &x );
+
+		diff = test_rel_diff( &y, &y_ref );
+
+		free_obj( &stor ); bli_obj_free( &a );
+		free_obj( &x ); free_obj( &y ); free_obj( &y_ref );
+
+		return diff;
+	}
+
+	const bool band = ( op <= TBSV );
+
+	if ( band )
+		create_band( dt, m, m, ( bli_is_lower( uplo ) ? k : 0 ), ( bli_is_lower( uplo ) ? 0 : k ),
+		             row_major, &stor, &a_buf, &rs_a, &cs_a, &a );
+	else
+		create_packed( dt, uplo, m, &stor, &a );
+
+	a_buf = ( band ? a_buf : bli_obj_buffer( &stor ) );
+
+	bli_obj_set_uplo( uplo, &a );
+
+	if ( op == TBMV || op == TBSV || op == TPMV || op == TPSV )
+	{
+		// Condition the dense copy and then copy it back to the band or
+		// packed storage.
+		condition_tri( ( band ? k : m ), &a );
+
+		if ( band )
+		{
+			const inc_t off = ( ( char* )a_buf - ( char* )bli_obj_buffer( &stor ) ) / bli_dt_size( dt );
+
+			for ( dim_t i = 0; i < m; ++i )
+			for ( dim_t j = bli_max( 0, i - k ); j <= bli_min( m - 1, i + k ); ++j )
+			{
+				if ( bli_is_lower( uplo ) ? j > i : j < i ) continue;
+
+				double re, im;
+				bli_getijm( i, j, &a, &re, &im );
+				bli_setijv( re, im, off + i*rs_a + j*cs_a, &stor );
+			}
+		}
+		else pack_dense( uplo, &a, &stor );
+
+		create_vec( dt, m, incx, &x );
+		create_vec( dt, m, 1, &y_ref );
+		bli_copyv( &x, &y_ref );
+
+		if      ( op == TBMV ) TCALL( dt, tbmv, uplo, transa, diag, m, k, ap, a_buf, rs_a, cs_a,
+		                              bli_obj_buffer( &x ), incx, NULL, &rntm )
+		else if ( op == TBSV ) TCALL( dt, tbsv, uplo, transa, diag, m, k, ap, a_buf, rs_a, cs_a,
+		                              bli_obj_buffer( &x ), incx, NULL, &rntm )
+		else if ( op == TPMV ) TCALL( dt, tpmv, uplo, transa, diag, m, ap, a_buf,
+		                              bli_obj_buffer( &x ), incx, NULL, &rntm )
+		else                   TCALL( dt, tpsv, uplo, transa, diag, m, ap, a_buf,
+		                              bli_obj_buffer( &x ), incx, NULL, &rntm )
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+		bli_obj_set_diag( diag, &a );
+		bli_obj_set_conjtrans( transa, &a );
+
+		if ( op == TBMV || op == TPMV ) bli_trmv( &alpha, &a, &y_ref );
+		else                            bli_trsv( &alpha, &a, &y_ref );
+
+		diff = test_rel_diff( &x, &y_ref );
+
+		free_obj( &x ); free_obj( &y_ref );
+	}
+	else if ( op == HPR || op == SPR )
+	{
+		// Compare the packed result with the stored triangle of the dense
+		// result.
+		obj_t stor_ref;
+
+		create_vec( dt, m, incx, &x );
+		create_vec( dt, bli_obj_length( &stor ), 1, &stor_ref );
+
+		if ( op == HPR ) TCALL( dt, hpr, uplo, conjx, m, bli_obj_buffer( &alpha_r ),
+		                        bli_obj_buffer( &x ), incx, a_buf, NULL, &rntm )
+		else             TCALL( dt, spr, uplo, conjx, m, ap,
+		                        bli_obj_buffer( &x ), incx, a_buf, NULL, &rntm )
+
+		bli_obj_set_struc( op == HPR ? BLIS_HERMITIAN : BLIS_SYMMETRIC, &a );
+		bli_obj_set_conj( conjx, &x );
+
+		if ( op == HPR ) bli_her( &alpha_r, &x, &a );
+		else             bli_syr( &alpha, &x, &a );
+
+		pack_dense( uplo, &a, &stor_ref );
+
+		diff = test_rel_diff( &stor, &stor_ref );
+
+		free_obj( &x ); free_obj( &stor_ref );
+	}
+	else
+	{
+		create_vec( dt, m, incx, &x );
+		create_vec( dt, m, incy, &y );
+		create_vec( dt, m, 1, &y_ref );
+		bli_copyv( &y, &y_ref );
+
+		void* xb = bli_obj_buffer( &x );
+		void* yb = bli_obj_buffer( &y );
+
+		if      ( op == HBMV ) TCALL( dt, hbmv, uplo, conja, conjx, m, k, ap, a_buf, rs_a, cs_a,
+		                              xb, incx, bp, yb, incy, NULL, &rntm )
+		else if ( op == SBMV ) TCALL( dt, sbmv, uplo, conja, conjx, m, k, ap, a_buf, rs_a, cs_a,
+		                              xb, incx, bp, yb, incy, NULL, &rntm )
+		else if ( op == HPMV ) TCALL( dt, hpmv, uplo, conja, conjx, m, ap, a_buf,
+		                              xb, incx, bp, yb, incy, NULL, &rntm )
+		else                   TCALL( dt, spmv, uplo, conja, conjx, m, ap, a_buf,
+		                              xb, incx, bp, yb, incy, NULL, &rntm )
+
+		const bool herm = ( op == HBMV || op == HPMV );
+
+		bli_obj_set_struc( herm ? BLIS_HERMITIAN : BLIS_SYMMETRIC, &a );
+		bli_obj_set_conj( conja, &a );
+		bli_obj_set_conj( conjx, &x );
+
+		if ( herm ) bli_hemv( &alpha, &a, &x, &beta, &y_ref );
+		else        bli_symv( &alpha, &a, &x, &beta, &y_ref );
+
+		diff = test_rel_diff( &y, &y_ref );
+
+		free_obj( &x ); free_obj( &y ); free_obj( &y_ref );
+	}
+
+	free_obj( &stor ); bli_obj_free( &a );
+
+	return diff;
+}
+
+static int check( void )
+{
+	const num_t dts[]        = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t sizes[][ 2 ] =
+	{
+		{  1,  1 },
+		{  7,  5 },
+		{ 40, 33 },
+		{ 33, 40 },
+		{ 40, 40 },
+	};
+	const dim_t n_sizes      = sizeof( sizes ) / sizeof( sizes[ 0 ] );
+	const dim_t bands[][ 2 ] =
+	{
+		{  0,  0 },
+		{  1,  1 },
+		{  0,  3 },
+		{  4,  0 },
+		{  2,  9 },
+		{ 11,  5 },
+		{ 50, 50 },
+	};
+	const dim_t n_bands      = sizeof( bands ) / sizeof( bands[ 0 ] );
+
+	// The variant bits used by each operation.
+	const int var_mask[ N_OPS ] =
+	{
+		2|4|8|32, 1|4|8|32, 1|4|8|32, 1|2|4|16|32, 1|2|4|16|32,
+		1|4|8,    1|4|8,    1|8,      1|8,         1|2|4|16,    1|2|4|16
+	};
+
+	dim_t n_cases = 0, n_fail = 0;
+
+	for ( int op = 0; op < N_OPS; ++op )
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( dim_t is = 0; is <= n_sizes; ++is )
+	for ( dim_t ib = 0; ib < n_bands; ++ib )
+	for ( int var = 0; var < 64; ++var )
+	{
+		const num_t  dt  = dts[ idt ];
+		const double tol = bli_dt_prec_is_single( dt ) ? 1e-4 : 1e-12;
+
+		// The last size is a problem large enough to be computed with
+		// multiple threads. It is checked for a subset of the cases.
+		const bool large = ( is == n_sizes );
+
+		if ( var & ~var_mask[ op ] ) continue;
+		if ( op != GBMV && !large && sizes[ is ][ 0 ] != sizes[ is ][ 1 ] ) continue;
+		if ( op >= HPMV && ib > 0 ) continue;
+		if ( large && ( ib > 1 || ( var & 12 ) || bli_dt_prec_is_single( dt ) ) ) continue;
+
+		const dim_t m    = ( large ? ( op >= HPMV ? 700 : 3000 ) : sizes[ is ][ 0 ] );
+		const dim_t n    = ( large ? m + 17 * ( dim_t )ib : sizes[ is ][ 1 ] );
+		const dim_t kl   = ( large ? 30 + 10 * ( dim_t )ib : bands[ ib ][ 0 ] );
+		const dim_t ku   = ( large ? 30 : bands[ ib ][ 1 ] );
+		const inc_t incx = ( var % 3 == 1 ? 2 : 1 );
+		const inc_t incy = ( var % 5 == 2 ? 3 : 1 );
+		const dim_t nt   = ( large || ( var + ib ) % 2 ? 4 : 1 );
+
+		double diff = check_op( op, dt, m, ( op == GBMV ? n : m ), kl, ku, var,
+		                        incx, incy, nt );
+
+		n_cases += 1;
+
+		if ( !( diff < tol ) )
+		{
+			n_fail += 1;
+			printf( "FAILED: %s dt = %d m = %d n = %d kl = %d ku = %d var = %d nt = %d (diff = %g)\n",
+			        op_names[ op ], ( int )dt, ( int )m, ( int )n, ( int )kl, ( int )ku,
+			        var, ( int )nt, diff );
+		}
+	}
+
+	printf( "%d of %d cases passed.\n", ( int )( n_cases - n_fail ), ( int )n_cases );
+
+	return n_fail != 0;
+}
+
+// y := beta * y + alpha * op( A ) * x for a band matrix A stored by columns,
+// computed as in the reference BLAS.
+static void ref_dgbmv( bool trans, dim_t m, dim_t n, dim_t kl, dim_t ku, double alpha,
+                       const double* a, inc_t lda, const double* x, double beta, double* y )
+{
+	const dim_t m_y = ( trans ? n : m );
+
+	for ( dim_t i = 0; i < m_y; ++i ) y[ i ] *= beta;
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		const double* a_j = a + ku - j + j * lda;
+		const dim_t   i0  = bli_max( 0, j - ku );
+		const dim_t   i1  = bli_min( m, j + kl + 1 );
+
+		if ( !trans )
+		{
+			const double temp = alpha * x[ j ];
+			for ( dim_t i = i0; i < i1; ++i ) y[ i ] += temp * a_j[ i ];
+		}
+		else
+		{
+			double temp = 0.0;
+			for ( dim_t i = i0; i < i1; ++i ) temp += a_j[ i ] * x[ i ];
+			y[ j ] += alpha * temp;
+		}
+	}
+}
+
+// Solve A * x = b, overwriting b with x, for a lower triangular band
+// matrix A stored by columns, computed as in the reference BLAS.
+static void ref_dtbsv( dim_t m, dim_t k, const double* a, inc_t lda, double* x )
+{
+	for ( dim_t j = 0; j < m; ++j )
+	{
+		const double* a_j = a - j + j * lda;
+
+		x[ j ] /= a_j[ j ];
+
+		for ( dim_t i = j + 1; i < bli_min( m, j + k + 1 ); ++i )
+			x[ i ] -= x[ j ] * a_j[ i ];
+	}
+}
+
+// y := beta * y + alpha * A * x for a symmetric matrix A whose lower
+// triangle is packed, computed as in the reference BLAS.
+static void ref_dspmv( dim_t m, double alpha, const double* ap, const double* x,
+                       double beta, double* y )
+{
+	for ( dim_t i = 0; i < m; ++i ) y[ i ] *= beta;
+
+	for ( dim_t j = 0; j < m; ++j )
+	{
+		const double* a_j   = ap + bli_packed_col_off( BLIS_LOWER, m, j ) - j;
+		const double  temp1 = alpha * x[ j ];
+		double        temp2 = 0.0;
+
+		y[ j ] += temp1 * a_j[ j ];
+
+		for ( dim_t i = j + 1; i < m; ++i )
+		{
+			y[ i ] += temp1 * a_j[ i ];
+			temp2  += a_j[ i ] * x[ i ];
+		}
+
+		y[ j ] += alpha * temp2;
+	}
+}
+
+int main( int argc, char** argv )
+{
+	dim_t nt       = ( argc > 1 ? atoi( argv[1] ) : 1 );
+	dim_t nrepeats = ( argc > 2 ? atoi( argv[2] ) : 3 );
+
+	bli_init();
+
+	int r_val = check();
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	// Each shape is m, kl, and ku. The first is a tridiagonal matrix.
+	const dim_t shapes[][ 3 ] =
+	{
+		{ 200000,   1,   1 },
+		{  50000,   4,   4 },
+		{  20000,  16,   8 },
+		{   5000, 128, 128 },
+	};
+	const dim_t n_shapes = sizeof( shapes ) / sizeof( shapes[ 0 ] );
+
+	printf( "%7s %4s %4s %6s %12s %12s %8s\n", "m", "kl", "ku", "op", "ref (ms)", "blis (ms)", "speedup" );
+
+	for ( dim_t is = 0; is < n_shapes; ++is )
+	for ( int iop = 0; iop < 3; ++iop )
+	{
+		const dim_t m   = shapes[ is ][ 0 ];
+		const dim_t kl  = shapes[ is ][ 1 ];
+		const dim_t ku  = ( iop == 2 ? 0 : shapes[ is ][ 2 ] );
+		const inc_t lda = kl + ku + 1;
+		obj_t a, x, y;
+
+		create_vec( BLIS_DOUBLE, m * lda, 1, &a );
+		create_vec( BLIS_DOUBLE, m, 1, &x );
+		create_vec( BLIS_DOUBLE, m, 1, &y );
+
+		      double* ab = bli_obj_buffer( &a );
+		const double* xb = bli_obj_buffer( &x );
+		      double* yb = bli_obj_buffer( &y );
+
+		// Make the triangular solves well-conditioned.
+		if ( iop == 2 )
+			for ( dim_t j = 0; j < m; ++j ) ab[ j * lda ] = ( double )( kl + 2 );
+
+		double alpha = 1.0, beta = 0.5;
+		double t_ref = 1.0e9, t_blis = 1.0e9;
+
+		for ( dim_t r = 0; r < nrepeats; ++r )
+		{
+			if ( iop == 2 ) bli_dcopyv( BLIS_NO_CONJUGATE, m, xb, 1, yb, 1 );
+
+			double t0 = bli_clock();
+			if ( iop == 2 ) ref_dtbsv( m, kl, ab, lda, yb );
+			else            ref_dgbmv( iop, m, m, kl, ku, alpha, ab, lda, xb, beta, yb );
+			t_ref = bli_clock_min_diff( t_ref, t0 );
+
+			if ( iop == 2 ) bli_dcopyv( BLIS_NO_CONJUGATE, m, xb, 1, yb, 1 );
+
+			t0 = bli_clock();
+			if ( iop == 2 )
+				bli_dtbsv_ex( BLIS_LOWER, BLIS_NO_TRANSPOSE, BLIS_NONUNIT_DIAG, m, kl,
+				              &alpha, ab, 1, lda - 1, yb, 1, NULL, &rntm );
+			else
+				bli_dgbmv_ex( ( iop ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE ), BLIS_NO_CONJUGATE,
+				              m, m, kl, ku, &alpha, ab + ku, 1, lda - 1, xb, 1, &beta, yb, 1,
+				              NULL, &rntm );
+			t_blis = bli_clock_min_diff( t_blis, t0 );
+		}
+
+		const char* op_name[] = { "gbmv", "gbmv^T", "tbsv" };
+
+		printf( "%7d %4d %4d %6s %12.3f %12.3f %8.2f\n", ( int )m, ( int )kl, ( int )ku,
+		        op_name[ iop ], 1e3 * t_ref, 1e3 * t_blis, t_ref / t_blis );
+
+		free_obj( &a ); free_obj( &x ); free_obj( &y );
+	}
+
+	const dim_t sizes[] = { 100, 500, 2000 };
+
+	for ( dim_t is = 0; is < 3; ++is )
+	{
+		const dim_t m = sizes[ is ];
+		obj_t a, x, y;
+
+		create_vec( BLIS_DOUBLE, ( m * ( m + 1 ) ) / 2, 1, &a );
+		create_vec( BLIS_DOUBLE, m, 1, &x );
+		create_vec( BLIS_DOUBLE, m, 1, &y );
+
+		const double* ab = bli_obj_buffer( &a );
+		const double* xb = bli_obj_buffer( &x );
+		      double* yb = bli_obj_buffer( &y );
+
+		double alpha = 1.0, beta = 0.5;
+		double t_ref = 1.0e9, t_blis = 1.0e9;
+
+		for ( dim_t r = 0; r < nrepeats; ++r )
+		{
+			double t0 = bli_clock();
+			ref_dspmv( m, alpha, ab, xb, beta, yb );
+			t_ref = bli_clock_min_diff( t_ref, t0 );
+
+			t0 = bli_clock();
+			bli_dspmv_ex( BLIS_LOWER, BLIS_NO_CONJUGATE, BLIS_NO_CONJUGATE, m, &alpha, ab,
+			              xb, 1, &beta, yb, 1, NULL, &rntm );
+			t_blis = bli_clock_min_diff( t_blis, t0 );
+		}
+
+		printf( "%7d %4s %4s %6s %12.3f %12.3f %8.2f\n", ( int )m, "-", "-", "spmv",
+		        1e3 * t_ref, 1e3 * t_blis, t_ref / t_blis );
+
+		free_obj( &a ); free_obj( &x ); free_obj( &y );
+	}
+
+	bli_finalize();
+
+	return r_val;
+}
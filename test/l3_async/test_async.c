@@ -0,0 +1,198 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Tests the non-blocking level-3 interfaces. Two independent gemms are
+// started on background threads while the calling thread keeps working, and
+// their results are compared against those of the blocking interface. A
+// non-blocking trsm with an alpha that goes out of scope before the
+// operation completes checks that scalars are captured at the time of call,
+// and one on subviews of a matrix object that goes out of scope checks that
+// the operands do not refer to the caller's root object.
+//
+
+static int n_fail = 0;
+
+static void check( const char* what, obj_t* x, obj_t* y )
+{
+	double d = test_max_diff( x, y );
+
+	if ( d > 1e-9 ) { printf( "FAIL: %s (maxdiff %g)\n", what, d ); n_fail++; }
+}
+
+static l3_async_t* start_trsm( obj_t* l, obj_t* b )
+{
+	l3_async_t* h;
+	obj_t       alpha;
+
+	// alpha lives only until this function returns.
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &alpha );
+	bli_setsc( 2.0, 0.0, &alpha );
+
+	bli_trsm_async( BLIS_LEFT, &alpha, l, b, NULL, NULL, &h );
+
+	return h;
+}
+
+static l3_async_t* start_trsm_sub( obj_t* l, obj_t* x, dim_t off )
+{
+	l3_async_t* h;
+	obj_t       l_root, x_root, l11, x1;
+
+	// The subviews refer to root objects that live only until this function
+	// returns.
+	bli_obj_alias_to( l, &l_root ); bli_obj_set_as_root( &l_root );
+	bli_obj_alias_to( x, &x_root ); bli_obj_set_as_root( &x_root );
+
+	dim_t m = bli_obj_length( l ) - off;
+
+	bli_acquire_mpart( off, off, m, m, &l_root, &l11 );
+	bli_acquire_mpart( off, 0, m, bli_obj_width( x ), &x_root, &x1 );
+
+	bli_trsm_async( BLIS_LEFT, &BLIS_ONE, &l11, &x1, NULL, NULL, &h );
+
+	// Clobber the root objects in case the operation has not started yet.
+	memset( &l_root, 0xff, sizeof( obj_t ) );
+	memset( &x_root, 0xff, sizeof( obj_t ) );
+
+	return h;
+}
+
+int main( void )
+{
+	const dim_t m = 240, n = 200, k = 180;
+
+	obj_t a1, b1, c1, c1_ref;
+	obj_t a2, b2, c2, c2_ref;
+
+	bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &a1 );
+	bli_obj_create( BLIS_DOUBLE, k, n, 0, 0, &b1 );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c1 );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c1_ref );
+	bli_obj_create( BLIS_DOUBLE, n, k, 0, 0, &a2 );
+	bli_obj_create( BLIS_DOUBLE, k, m, 0, 0, &b2 );
+	bli_obj_create( BLIS_DOUBLE, n, m, 0, 0, &c2 );
+	bli_obj_create( BLIS_DOUBLE, n, m, 0, 0, &c2_ref );
+
+	bli_randm( &a1 ); bli_randm( &b1 ); bli_randm( &c1 );
+	bli_randm( &a2 ); bli_randm( &b2 ); bli_randm( &c2 );
+	bli_copym( &c1, &c1_ref );
+	bli_copym( &c2, &c2_ref );
+
+	bli_gemm( &BLIS_ONE, &a1, &b1, &BLIS_ONE, &c1_ref );
+	bli_gemm( &BLIS_ONE, &a2, &b2, &BLIS_MINUS_ONE, &c2_ref );
+
+	// Start two independent gemms, each with its own team of two threads.
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+	bli_rntm_set_num_threads( 2, &rntm );
+
+	l3_async_t* h1;
+	l3_async_t* h2;
+
+	bli_gemm_async( &BLIS_ONE, &a1, &b1, &BLIS_ONE,       &c1, NULL, &rntm, &h1 );
+	bli_gemm_async( &BLIS_ONE, &a2, &b2, &BLIS_MINUS_ONE, &c2, NULL, &rntm, &h2 );
+
+	// Keep the calling thread busy until both have completed.
+	long   n_polls = 0;
+	double work    = 0.0;
+
+	while ( !bli_l3_async_test( h1 ) || !bli_l3_async_test( h2 ) )
+	{
+		for ( int i = 0; i < 100; ++i ) work += 1.0 / ( 1.0 + i + n_polls );
+		n_polls++;
+	}
+
+	bli_l3_async_wait( h1 );
+	bli_l3_async_wait( h2 );
+
+	check( "gemm 1", &c1, &c1_ref );
+	check( "gemm 2", &c2, &c2_ref );
+
+	// A trsm whose alpha goes out of scope before it completes.
+	obj_t l, x, x_ref;
+
+	bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &l );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &x );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &x_ref );
+
+	bli_randm( &l );
+	bli_obj_set_struc( BLIS_TRIANGULAR, &l );
+	bli_obj_set_uplo( BLIS_LOWER, &l );
+	bli_shiftd( &BLIS_TWO, &l );
+	bli_shiftd( &BLIS_TWO, &l );
+	bli_randm( &x );
+	bli_copym( &x, &x_ref );
+
+	obj_t two;
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &two );
+	bli_setsc( 2.0, 0.0, &two );
+	bli_trsm( BLIS_LEFT, &two, &l, &x_ref );
+
+	l3_async_t* h3 = start_trsm( &l, &x );
+	bli_l3_async_wait( h3 );
+
+	check( "trsm", &x, &x_ref );
+
+	// A trsm on subviews whose root objects go out of scope before it
+	// completes.
+	const dim_t off = m / 3;
+	obj_t       l11, x1_ref;
+
+	bli_randm( &x );
+	bli_copym( &x, &x_ref );
+	bli_acquire_mpart( off, off, m - off, m - off, &l, &l11 );
+	bli_acquire_mpart( off, 0, m - off, n, &x_ref, &x1_ref );
+	bli_trsm( BLIS_LEFT, &BLIS_ONE, &l11, &x1_ref );
+
+	l3_async_t* h4 = start_trsm_sub( &l, &x, off );
+	bli_l3_async_wait( h4 );
+
+	check( "trsm on subviews", &x, &x_ref );
+
+	printf( "%s (%ld polls while waiting, work %.3f)\n",
+	        n_fail == 0 ? "PASS" : "FAIL", n_polls, work );
+
+	bli_obj_free( &a1 ); bli_obj_free( &b1 ); bli_obj_free( &c1 ); bli_obj_free( &c1_ref );
+	bli_obj_free( &a2 ); bli_obj_free( &b2 ); bli_obj_free( &c2 ); bli_obj_free( &c2_ref );
+	bli_obj_free( &l );  bli_obj_free( &x );  bli_obj_free( &x_ref );
+
+	return n_fail == 0 ? 0 : 1;
+}
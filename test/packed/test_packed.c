@@ -0,0 +1,223 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Checks chains of products C1 := alpha A B + beta C1; C2 := alpha C1 D
+// (or C2 := alpha D C1) in which C1 and C2 are stored as packed micro-panels
+// (see bli_obj_create_packed()) against the same chains computed with
+// conventionally stored matrices, and then compares the time taken by both
+// variants of the chain for double-precision problems shaped like the layers
+// of a multilayer perceptron (m x 256 times 256 x 256, twice). Usage:
+//
+//   ./test_packed.x [nrepeats]
+//
+
+static double check_chain( num_t dt, side_t side, dim_t m, dim_t k, dim_t n, dim_t q, dim_t nt )
+{
+	obj_t alpha, beta, zero;
+	obj_t a, b, d, c1, c2, c1p, c2p, c2u;
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_obj_scalar_init_detached( dt, &beta );
+	bli_obj_scalar_init_detached( dt, &zero );
+	bli_setsc(  1.5, 0.5, &alpha );
+	bli_setsc( -0.5, 0.0, &beta );
+	bli_setsc(  0.0, 0.0, &zero );
+
+	bli_obj_create( dt, m, k, 0, 0, &a );
+	bli_obj_create( dt, k, n, 0, 0, &b );
+	bli_obj_create( dt, m, n, 0, 0, &c1 );
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c1 );
+
+	// C1 is packed as the A operand of the second product if D is applied
+	// from the right, and as the B operand otherwise.
+	const side_t side_c1 = ( bli_is_right( side ) ? BLIS_LEFT : BLIS_RIGHT );
+	const side_t side_c2 = ( bli_is_right( side ) ? BLIS_RIGHT : BLIS_LEFT );
+
+	bli_obj_create_packed( side_c1, dt, m, n, NULL, &c1p );
+	bli_copym_to_packed( &c1, &c1p );
+
+	bli_gemm_ex( &alpha, &a, &b, &beta, &c1,  NULL, &rntm );
+	bli_gemm_ex( &alpha, &a, &b, &beta, &c1p, NULL, &rntm );
+
+	if ( bli_is_right( side ) )
+	{
+		bli_obj_create( dt, n, q, 0, 0, &d );
+		bli_obj_create( dt, m, q, 0, 0, &c2 );
+		bli_obj_create_packed( side_c2, dt, m, q, NULL, &c2p );
+		bli_randm( &d );
+
+		bli_gemm_ex( &alpha, &c1,  &d, &zero, &c2,  NULL, &rntm );
+		bli_gemm_ex( &alpha, &c1p, &d, &zero, &c2p, NULL, &rntm );
+	}
+	else
+	{
+		bli_obj_create( dt, q, m, 0, 0, &d );
+		bli_obj_create( dt, q, n, 0, 0, &c2 );
+		bli_obj_create_packed( side_c2, dt, q, n, NULL, &c2p );
+		bli_randm( &d );
+
+		bli_gemm_ex( &alpha, &d, &c1,  &zero, &c2,  NULL, &rntm );
+		bli_gemm_ex( &alpha, &d, &c1p, &zero, &c2p, NULL, &rntm );
+	}
+
+	bli_obj_create_conf_to( &c2, &c2u );
+	bli_copym_from_packed( &c2p, &c2u );
+
+	double diff = test_rel_diff( &c2u, &c2 );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &d );
+	bli_obj_free( &c1 );
+	bli_obj_free( &c2 );
+	bli_obj_free( &c1p );
+	bli_obj_free( &c2p );
+	bli_obj_free( &c2u );
+
+	return diff;
+}
+
+static int check( void )
+{
+	const num_t dts[]     = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t sizes[][ 4 ] =
+	{
+		{    1,   1,   1,   1 },
+		{    7,   5,   9,   3 },
+		{   64,  64,  64,  64 },
+		{  301, 257, 333, 129 },
+		{ 1000, 300, 777, 501 },
+	};
+	const dim_t n_sizes = sizeof( sizes ) / sizeof( sizes[ 0 ] );
+
+	dim_t n_cases = 0, n_fail = 0;
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( dim_t is = 0; is < n_sizes; ++is )
+	for ( int iside = 0; iside < 2; ++iside )
+	for ( dim_t nt = 1; nt <= 4; nt += 3 )
+	{
+		const num_t  dt   = dts[ idt ];
+		const side_t side = ( iside ? BLIS_LEFT : BLIS_RIGHT );
+		const double tol  = bli_dt_prec_is_single( dt ) ? 1e-5 : 1e-13;
+
+		double diff = check_chain( dt, side, sizes[ is ][ 0 ], sizes[ is ][ 1 ],
+		                           sizes[ is ][ 2 ], sizes[ is ][ 3 ], nt );
+
+		n_cases += 1;
+
+		if ( !( diff < tol ) )
+		{
+			n_fail += 1;
+			printf( "FAILED: dt = %d side = %s m = %d k = %d n = %d q = %d nt = %d (diff = %g)\n",
+			        ( int )dt, ( iside ? "left" : "right" ),
+			        ( int )sizes[ is ][ 0 ], ( int )sizes[ is ][ 1 ],
+			        ( int )sizes[ is ][ 2 ], ( int )sizes[ is ][ 3 ], ( int )nt, diff );
+		}
+	}
+
+	printf( "%d of %d cases passed.\n", ( int )( n_cases - n_fail ), ( int )n_cases );
+
+	return n_fail != 0;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t nrepeats = ( argc > 1 ? atoi( argv[1] ) : 3 );
+
+	bli_init();
+
+	int r_val = check();
+
+	printf( "%5s %14s %14s %8s\n", "m", "chain (ms)", "packed (ms)", "speedup" );
+
+	const dim_t n = 256;
+
+	for ( dim_t m = 1000; m <= 8000; m *= 2 )
+	{
+		obj_t a, b, d, c1, c2, c1p, c2p;
+
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &a );
+		bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &b );
+		bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &d );
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c1 );
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c2 );
+		bli_obj_create_packed( BLIS_LEFT, BLIS_DOUBLE, m, n, NULL, &c1p );
+		bli_obj_create_packed( BLIS_LEFT, BLIS_DOUBLE, m, n, NULL, &c2p );
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &d );
+
+		double t_chain = 1.0e9, t_packed = 1.0e9;
+
+		for ( dim_t r = 0; r < nrepeats; ++r )
+		{
+			double t0 = bli_clock();
+			bli_gemm( &BLIS_ONE, &a,  &b, &BLIS_ZERO, &c1 );
+			bli_gemm( &BLIS_ONE, &c1, &d, &BLIS_ZERO, &c2 );
+			t_chain = bli_clock_min_diff( t_chain, t0 );
+
+			t0 = bli_clock();
+			bli_gemm( &BLIS_ONE, &a,   &b, &BLIS_ZERO, &c1p );
+			bli_gemm( &BLIS_ONE, &c1p, &d, &BLIS_ZERO, &c2p );
+			t_packed = bli_clock_min_diff( t_packed, t0 );
+		}
+
+		printf( "%5d %14.2f %14.2f %8.2f\n", ( int )m, 1e3 * t_chain,
+		        1e3 * t_packed, t_chain / t_packed );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &d );
+		bli_obj_free( &c1 );
+		bli_obj_free( &c2 );
+		bli_obj_free( &c1p );
+		bli_obj_free( &c2p );
+	}
+
+	bli_finalize();
+
+	return r_val;
+}
@@ -0,0 +1,15 @@
+#!/bin/bash
+
+#
+# Run the startup benchmark in a number of fresh processes, since the costs
+# it measures are only incurred once per process.
+#
+# Usage: ./runme.sh [nruns] [m]
+#
+
+nruns=${1:-20}
+m=${2:-64}
+
+for (( r = 0; r < nruns; ++r )); do
+	./test_startup.x ${m}
+done
@@ -0,0 +1,105 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "blis.h"
+
+//
+// Measure the cost of library startup, i.e., the time spent in bli_init()
+// (registering the subconfigurations and building the context for the
+// active one) and the extra latency of the first (small) dgemm relative to
+// the second one. Since these costs are only paid once per process, each
+// invocation reports a single sample; run the executable repeatedly (see
+// runme.sh) to obtain a distribution.
+//
+
+int main( int argc, char** argv )
+{
+	dim_t m = 64;
+
+	if ( argc > 1 ) m = atoi( argv[1] );
+
+	double* a = malloc( m * m * sizeof( double ) );
+	double* b = malloc( m * m * sizeof( double ) );
+	double* c = malloc( m * m * sizeof( double ) );
+
+	for ( dim_t i = 0; i < m * m; ++i )
+	{
+		a[ i ] = 1.0;
+		b[ i ] = 1.0;
+		c[ i ] = 0.0;
+	}
+
+	double one  = 1.0;
+	double zero = 0.0;
+
+	double t0 = bli_clock();
+
+	bli_init();
+
+	double t1 = bli_clock();
+
+	bli_dgemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m, m, m,
+	           &one, a, 1, m, b, 1, m, &zero, c, 1, m );
+
+	double t2 = bli_clock();
+
+	bli_dgemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m, m, m,
+	           &one, a, 1, m, b, 1, m, &zero, c, 1, m );
+
+	double t3 = bli_clock();
+
+	// Sanity check so that the dgemm calls cannot be optimized away.
+	if ( c[ 0 ] != ( double )m )
+	{
+		printf( "test_startup: unexpected result %g (expected %d)\n",
+		        c[ 0 ], ( int )m );
+		return 1;
+	}
+
+	printf( "arch: %-12s init: %9.1f us  first gemm: %9.1f us  second gemm: %9.1f us\n",
+	        bli_arch_string( bli_arch_query_id() ),
+	        ( t1 - t0 ) * 1.0e6,
+	        ( t2 - t1 ) * 1.0e6,
+	        ( t3 - t2 ) * 1.0e6 );
+
+	bli_finalize();
+
+	free( a );
+	free( b );
+	free( c );
+
+	return 0;
+}
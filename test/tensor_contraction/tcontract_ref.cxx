@@ -81,7 +81,7 @@ void tcontract_ref( const std::vector<dim_t>& m, const std::vector<dim_t>& n, co
 #define GENTFUNC(ctype,ch,op) \
 static auto PASTEMAC(ch,op) = &tcontract_ref<ctype>;
 
-INSERT_GENTFUNC_BASIC0(tcontract_ref);
+INSERT_GENTFUNC_BASIC( tcontract_ref )
 
 static decltype(&tcontract_ref<void>) GENARRAY( tcontract_ref_impl, tcontract_ref );
 
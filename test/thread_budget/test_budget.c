@@ -0,0 +1,187 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Tests the process-wide thread budget. A single caller must be granted no
+// more threads than the budget allows, and concurrent callers must share the
+// budget without changing their results. Every reserved thread must be
+// returned to the budget once the calls complete.
+//
+
+#define BUDGET      4
+#define N_CALLERS   3
+#define N_REPS      20
+
+static int n_fail = 0;
+static pthread_mutex_t fail_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void fail( const char* msg, long v )
+{
+	pthread_mutex_lock( &fail_mutex );
+	printf( "FAIL: %s (%ld)\n", msg, v );
+	n_fail++;
+	pthread_mutex_unlock( &fail_mutex );
+}
+
+// Run one gemm with the given rntm_t and return the rntm_t it ran with.
+static double run_gemm( dim_t m, dim_t n, dim_t k, rntm_t* rntm, rntm_t* used )
+{
+	obj_t a, b, c, c_ref;
+
+	bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, k, n, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c_ref );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_setm( &BLIS_ZERO, &c );
+	bli_setm( &BLIS_ZERO, &c_ref );
+
+	rntm_t rntm_st = BLIS_RNTM_INITIALIZER;
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c_ref, NULL, &rntm_st );
+
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c, NULL, rntm );
+	bli_thread_get_last_rntm( used );
+
+	double d = test_max_diff( &c, &c_ref );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+
+	return d;
+}
+
+static void* caller_main( void* arg )
+{
+	dim_t id = ( dim_t )( size_t )arg;
+
+	for ( int r = 0; r < N_REPS; ++r )
+	{
+		rntm_t rntm = BLIS_RNTM_INITIALIZER;
+		rntm_t used;
+
+		bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+		bli_rntm_set_num_threads( 2, &rntm );
+
+		// Alternate between the sup and conventional code paths.
+		dim_t m = ( r % 2 == 0 ? 40 : 200 ) + id;
+
+		double d = run_gemm( m, 64, 48, &rntm, &used );
+
+		if ( d > 1e-10 ) fail( "concurrent gemm result differs", ( long )id );
+
+		dim_t nt = bli_rntm_num_threads( &used );
+		if ( nt < 1 || 2 < nt ) fail( "concurrent gemm granted threads", ( long )nt );
+	}
+
+	return NULL;
+}
+
+int main( void )
+{
+	rntm_t rntm, used;
+
+	bli_thread_set_budget( BUDGET );
+
+	if ( bli_thread_get_budget() != BUDGET )
+		fail( "budget not set", ( long )bli_thread_get_budget() );
+
+	// A single caller asking for more threads than the budget is shrunk to
+	// the budget, for both conventional and sup problem sizes.
+	for ( dim_t m = 40; m <= 200; m += 160 )
+	{
+		rntm = ( rntm_t )BLIS_RNTM_INITIALIZER;
+		bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+		bli_rntm_set_num_threads( 8, &rntm );
+
+		if ( run_gemm( m, 64, 48, &rntm, &used ) > 1e-10 )
+			fail( "shrunk gemm result differs", ( long )m );
+		if ( bli_rntm_num_threads( &used ) != BUDGET )
+			fail( "shrunk num_threads", ( long )bli_rntm_num_threads( &used ) );
+	}
+
+	// Explicit ways that exceed the budget are refactorized.
+	rntm = ( rntm_t )BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+	bli_rntm_set_ways( 2, 1, 3, 1, 1, &rntm );
+
+	if ( run_gemm( 200, 64, 48, &rntm, &used ) > 1e-10 )
+		fail( "refactorized gemm result differs", 0 );
+	if ( bli_rntm_num_threads( &used ) > BUDGET )
+		fail( "refactorized num_threads", ( long )bli_rntm_num_threads( &used ) );
+
+	// Requests within the budget are left alone.
+	rntm = ( rntm_t )BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+	bli_rntm_set_ways( 1, 1, 2, 1, 1, &rntm );
+
+	run_gemm( 200, 64, 48, &rntm, &used );
+	if ( bli_rntm_ic_ways( &used ) != 2 )
+		fail( "ic ways within budget", ( long )bli_rntm_ic_ways( &used ) );
+
+	// Concurrent callers share the budget.
+	pthread_t callers[ N_CALLERS ];
+
+	for ( dim_t i = 0; i < N_CALLERS; ++i )
+		pthread_create( &callers[ i ], NULL, caller_main, ( void* )( size_t )i );
+	for ( dim_t i = 0; i < N_CALLERS; ++i )
+		pthread_join( callers[ i ], NULL );
+
+	if ( bli_thread_get_budget_active() != 0 )
+		fail( "threads still reserved", ( long )bli_thread_get_budget_active() );
+
+	// Disabling the budget restores the requested parallelism.
+	bli_thread_set_budget( 0 );
+
+	rntm = ( rntm_t )BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+	bli_rntm_set_num_threads( 6, &rntm );
+
+	run_gemm( 200, 64, 48, &rntm, &used );
+	if ( bli_rntm_num_threads( &used ) != 6 )
+		fail( "unbudgeted num_threads", ( long )bli_rntm_num_threads( &used ) );
+
+	printf( "%s\n", n_fail == 0 ? "PASS" : "FAIL" );
+
+	return n_fail == 0 ? 0 : 1;
+}
@@ -0,0 +1,394 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// A test backend for the custom threading implementation. The launcher runs
+// BLIS's tasks on a small pool of persistent threads owned by this program,
+// and the barrier checks its own semantics: every waiter must belong to the
+// group, no thread may wait twice within one barrier episode, and no thread
+// may leave an episode before all of its peers have arrived. Level-3 results
+// computed on the pool are compared against single-threaded results.
+//
+
+#define MAX_WORKERS 8
+
+// -- Thread pool --------------------------------------------------------------
+
+typedef struct app_worker_s
+{
+	pthread_t             thread;
+	pthread_mutex_t       mutex;
+	pthread_cond_t        cond;
+
+	thread_custom_task_ft task;
+	void*                 task_data;
+	dim_t                 tid;
+	bool                  busy;
+	bool                  quit;
+} app_worker_t;
+
+typedef struct app_pool_s
+{
+	app_worker_t        workers[ MAX_WORKERS ];
+	dim_t           n_workers;
+
+	long            n_launches;
+} app_pool_t;
+
+static void* worker_main( void* arg )
+{
+	app_worker_t* w = arg;
+
+	pthread_mutex_lock( &w->mutex );
+
+	while ( 1 )
+	{
+		while ( !w->busy && !w->quit ) pthread_cond_wait( &w->cond, &w->mutex );
+		if ( w->quit ) break;
+
+		pthread_mutex_unlock( &w->mutex );
+		w->task( w->tid, w->task_data );
+		pthread_mutex_lock( &w->mutex );
+
+		w->busy = FALSE;
+		pthread_cond_broadcast( &w->cond );
+	}
+
+	pthread_mutex_unlock( &w->mutex );
+
+	return NULL;
+}
+
+static void pool_init( app_pool_t* pool, dim_t n_workers )
+{
+	pool->n_workers  = n_workers;
+	pool->n_launches = 0;
+
+	for ( dim_t i = 0; i < n_workers; ++i )
+	{
+		app_worker_t* w = &pool->workers[ i ];
+
+		pthread_mutex_init( &w->mutex, NULL );
+		pthread_cond_init( &w->cond, NULL );
+		w->busy = FALSE;
+		w->quit = FALSE;
+		pthread_create( &w->thread, NULL, worker_main, w );
+	}
+}
+
+static void pool_finalize( app_pool_t* pool )
+{
+	for ( dim_t i = 0; i < pool->n_workers; ++i )
+	{
+		app_worker_t* w = &pool->workers[ i ];
+
+		pthread_mutex_lock( &w->mutex );
+		w->quit = TRUE;
+		pthread_cond_broadcast( &w->cond );
+		pthread_mutex_unlock( &w->mutex );
+
+		pthread_join( w->thread, NULL );
+		pthread_mutex_destroy( &w->mutex );
+		pthread_cond_destroy( &w->cond );
+	}
+}
+
+// The launcher: tids 1..nt-1 run on pool workers, tid 0 on the caller.
+static void pool_launch
+     (
+       dim_t                 nt,
+       thread_custom_task_ft task,
+       void*                 task_data,
+       void*                 user_data
+     )
+{
+	app_pool_t* pool = user_data;
+
+	if ( nt - 1 > pool->n_workers )
+	{
+		printf( "pool_launch: %d threads requested but only %d workers.\n",
+		        ( int )nt, ( int )pool->n_workers + 1 );
+		exit( 1 );
+	}
+
+	pool->n_launches++;
+
+	for ( dim_t tid = 1; tid < nt; ++tid )
+	{
+		app_worker_t* w = &pool->workers[ tid - 1 ];
+
+		pthread_mutex_lock( &w->mutex );
+		w->task      = task;
+		w->task_data = task_data;
+		w->tid       = tid;
+		w->busy      = TRUE;
+		pthread_cond_broadcast( &w->cond );
+		pthread_mutex_unlock( &w->mutex );
+	}
+
+	task( 0, task_data );
+
+	for ( dim_t tid = 1; tid < nt; ++tid )
+	{
+		app_worker_t* w = &pool->workers[ tid - 1 ];
+
+		pthread_mutex_lock( &w->mutex );
+		while ( w->busy ) pthread_cond_wait( &w->cond, &w->mutex );
+		pthread_mutex_unlock( &w->mutex );
+	}
+}
+
+// -- Checking barrier ---------------------------------------------------------
+
+typedef struct app_barrier_s
+{
+	pthread_mutex_t mutex;
+	pthread_cond_t  cond;
+
+	dim_t           nt;
+	dim_t           arrived;
+	long            episode;
+	long*           phase;
+} app_barrier_t;
+
+static pthread_mutex_t stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+static long            n_created   = 0;
+static long            n_freed     = 0;
+static long            n_waits     = 0;
+static long            n_errors    = 0;
+
+static void record( long* counter )
+{
+	pthread_mutex_lock( &stats_mutex );
+	( *counter )++;
+	pthread_mutex_unlock( &stats_mutex );
+}
+
+static void* barrier_create( dim_t nt, void* user_data )
+{
+	app_barrier_t* b = malloc( sizeof( app_barrier_t ) );
+
+	pthread_mutex_init( &b->mutex, NULL );
+	pthread_cond_init( &b->cond, NULL );
+	b->nt      = nt;
+	b->arrived = 0;
+	b->episode = 0;
+	b->phase   = calloc( nt, sizeof( long ) );
+
+	record( &n_created );
+
+	return b;
+}
+
+static void barrier_wait( void* barrier, dim_t tid, void* user_data )
+{
+	app_barrier_t* b = barrier;
+
+	record( &n_waits );
+
+	pthread_mutex_lock( &b->mutex );
+
+	const long episode = b->episode;
+
+	// The waiter must be a member of the group and must not already have
+	// arrived during the current episode.
+	if ( tid < 0 || b->nt <= tid || b->phase[ tid ] != episode )
+	{
+		record( &n_errors );
+		pthread_mutex_unlock( &b->mutex );
+		return;
+	}
+
+	b->phase[ tid ] = episode + 1;
+
+	if ( ++b->arrived == b->nt )
+	{
+		// Every member must have arrived before anyone is released.
+		for ( dim_t i = 0; i < b->nt; ++i )
+			if ( b->phase[ i ] != episode + 1 ) record( &n_errors );
+
+		b->arrived = 0;
+		b->episode = episode + 1;
+		pthread_cond_broadcast( &b->cond );
+	}
+	else
+	{
+		while ( b->episode == episode ) pthread_cond_wait( &b->cond, &b->mutex );
+	}
+
+	pthread_mutex_unlock( &b->mutex );
+}
+
+static void barrier_free( void* barrier, void* user_data )
+{
+	app_barrier_t* b = barrier;
+
+	if ( b->arrived != 0 ) record( &n_errors );
+
+	pthread_mutex_destroy( &b->mutex );
+	pthread_cond_destroy( &b->cond );
+	free( b->phase );
+	free( b );
+
+	record( &n_freed );
+}
+
+// -- Tests --------------------------------------------------------------------
+
+static int test_ops( num_t dt, dim_t m, dim_t n, dim_t k, const rntm_t* rntm )
+{
+	obj_t a, b, c, c_ref, l, x, x_ref;
+	int   fails = 0;
+	double tol  = bli_is_double_prec( dt ) ? 1e-10 : 1e-3;
+
+	rntm_t rntm_st = BLIS_RNTM_INITIALIZER;
+
+	bli_obj_create( dt, m, k, 0, 0, &a );
+	bli_obj_create( dt, k, n, 0, 0, &b );
+	bli_obj_create( dt, m, n, 0, 0, &c );
+	bli_obj_create( dt, m, n, 0, 0, &c_ref );
+	bli_obj_create( dt, m, m, 0, 0, &l );
+	bli_obj_create( dt, m, n, 0, 0, &x );
+	bli_obj_create( dt, m, n, 0, 0, &x_ref );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c_ref );
+	bli_copym( &c_ref, &c );
+
+	// gemm
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c_ref, NULL, &rntm_st );
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c,     NULL, rntm );
+	if ( test_max_diff( &c, &c_ref ) > tol * k ) { printf( "gemm failed\n" ); fails++; }
+
+	// trsm (with a diagonally dominant lower triangular matrix)
+	bli_randm( &l );
+	bli_shiftd( &BLIS_TWO, &l );
+	bli_obj_set_struc( BLIS_TRIANGULAR, &l );
+	bli_obj_set_uplo( BLIS_LOWER, &l );
+	bli_obj_set_diag_offset( 0, &l );
+	bli_copym( &c_ref, &x_ref );
+	bli_copym( &c_ref, &x );
+	bli_trsm_ex( BLIS_LEFT, &BLIS_ONE, &l, &x_ref, NULL, &rntm_st );
+	bli_trsm_ex( BLIS_LEFT, &BLIS_ONE, &l, &x,     NULL, rntm );
+	if ( test_max_diff( &x, &x_ref ) > tol * m ) { printf( "trsm failed\n" ); fails++; }
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+	bli_obj_free( &l );
+	bli_obj_free( &x );
+	bli_obj_free( &x_ref );
+
+	return fails;
+}
+
+int main( int argc, char** argv )
+{
+	app_pool_t pool;
+	int     fails = 0;
+
+	pool_init( &pool, 3 );
+
+	thread_custom_t custom;
+	custom.launch         = pool_launch;
+	custom.barrier_create = barrier_create;
+	custom.barrier_wait   = barrier_wait;
+	custom.barrier_free   = barrier_free;
+	custom.user_data      = &pool;
+
+	bli_thread_set_custom( &custom );
+
+	const num_t dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t ways[][ 5 ] =
+	{
+		{ 1, 1, 2, 1, 1 },
+		{ 2, 1, 1, 2, 1 },
+		{ 1, 1, 2, 2, 1 },
+		{ 1, 1, 1, 3, 1 },
+		{ 2, 1, 2, 1, 1 },
+	};
+
+	for ( int i = 0; i < 4; ++i )
+	for ( int w = 0; w < 5; ++w )
+	{
+		rntm_t rntm = BLIS_RNTM_INITIALIZER;
+		bli_rntm_set_thread_impl( BLIS_CUSTOM, &rntm );
+		bli_rntm_set_ways( ways[ w ][ 0 ], ways[ w ][ 1 ], ways[ w ][ 2 ],
+		                   ways[ w ][ 3 ], ways[ w ][ 4 ], &rntm );
+		bli_rntm_set_l3_sup( FALSE, &rntm );
+
+		fails += test_ops( dts[ i ], 150, 130, 90, &rntm );
+	}
+
+	// Also exercise the automatic factorization, the sup path, and BLIS's
+	// own barrier in place of the application's.
+	{
+		rntm_t rntm = BLIS_RNTM_INITIALIZER;
+		bli_rntm_set_thread_impl( BLIS_CUSTOM, &rntm );
+		bli_rntm_set_num_threads( 4, &rntm );
+
+		fails += test_ops( BLIS_DOUBLE, 200, 180, 60, &rntm );
+
+		custom.barrier_create = NULL;
+		custom.barrier_wait   = NULL;
+		custom.barrier_free   = NULL;
+		bli_thread_set_custom( &custom );
+
+		fails += test_ops( BLIS_DOUBLE, 200, 180, 60, &rntm );
+	}
+
+	// All barriers must have been freed once the library is finalized.
+	bli_finalize();
+
+	printf( "launches: %ld  barriers: %ld created, %ld freed  waits: %ld  barrier errors: %ld\n",
+	        pool.n_launches, n_created, n_freed, n_waits, n_errors );
+
+	if ( pool.n_launches == 0 || n_waits == 0 ) fails++;
+	if ( n_created != n_freed ) fails++;
+	fails += n_errors;
+
+	pool_finalize( &pool );
+
+	printf( "%s\n", fails == 0 ? "PASS" : "FAIL" );
+
+	return fails != 0;
+}
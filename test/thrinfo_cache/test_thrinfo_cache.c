@@ -0,0 +1,153 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <stdio.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Checks that the thrinfo_t trees cached by the conventional level-3 code
+// are reused by calls with the same threading factorization (whatever the
+// problem size), that a different factorization does not reuse them, and
+// that bli_thread_set_num_threads() and bli_thread_set_ways() evict them.
+// Every result is compared with a single-threaded gemm. Usage:
+//
+//   ./test_thrinfo_cache.x
+//
+
+static int n_fail = 0;
+
+// Run a multithreaded gemm with the given loop factorization and return
+// the number of cache hits and misses it caused.
+static void run( dim_t m, dim_t ic, dim_t jr, dim_t* hits, dim_t* misses )
+{
+	obj_t  a, b, c, c_ref;
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	dim_t  h0, m0, h1, m1;
+
+	bli_obj_create( BLIS_DOUBLE, m, 300, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, 300, 300, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, m, 300, 0, 0, &c );
+	bli_obj_create( BLIS_DOUBLE, m, 300, 0, 0, &c_ref );
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+	bli_copym( &c, &c_ref );
+
+	// The sup code path does not use the cache.
+	bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+	bli_rntm_set_ways( 1, 1, ic, jr, 1, &rntm );
+	bli_rntm_disable_l3_sup( &rntm );
+
+	bli_l3_thrinfo_cache_query( &h0, &m0, NULL );
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, &rntm );
+	bli_l3_thrinfo_cache_query( &h1, &m1, NULL );
+
+	*hits   = h1 - h0;
+	*misses = m1 - m0;
+
+	bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ONE, &c_ref );
+
+	const double diff = test_rel_diff( &c, &c_ref );
+	if ( diff > 1e-13 )
+	{
+		printf( "FAIL: m = %ld ic = %ld jr = %ld: wrong result (diff %g)\n",
+		        ( long )m, ( long )ic, ( long )jr, diff );
+		n_fail++;
+	}
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+}
+
+static void expect( const char* what, dim_t m, dim_t ic, dim_t jr, bool hit )
+{
+	dim_t hits, misses;
+
+	run( m, ic, jr, &hits, &misses );
+
+	if ( hits != ( hit ? 1 : 0 ) || misses != ( hit ? 0 : 1 ) )
+	{
+		printf( "FAIL: %s: expected a %s, got %ld hits and %ld misses\n",
+		        what, hit ? "hit" : "miss", ( long )hits, ( long )misses );
+		n_fail++;
+	}
+}
+
+static void expect_empty( const char* what )
+{
+	dim_t n_entries;
+
+	bli_l3_thrinfo_cache_query( NULL, NULL, &n_entries );
+
+	if ( n_entries != 0 )
+	{
+		printf( "FAIL: %s: %ld entries left in the cache\n",
+		        what, ( long )n_entries );
+		n_fail++;
+	}
+}
+
+int main( void )
+{
+	if ( !bli_info_get_enable_pthreads() || BLIS_L3_THRINFO_CACHE_SIZE == 0 )
+	{
+		printf( "SKIP (requires pthreads and the thrinfo_t cache)\n" );
+		return 0;
+	}
+
+	expect( "first call",             400, 2, 1, FALSE );
+	expect( "same factorization",     400, 2, 1, TRUE  );
+	expect( "different problem size", 700, 2, 1, TRUE  );
+	expect( "different ways",         400, 1, 2, FALSE );
+	expect( "different ways again",   400, 1, 2, TRUE  );
+	expect( "first ways again",       400, 2, 1, TRUE  );
+	expect( "more threads",           400, 2, 2, FALSE );
+
+	bli_thread_set_num_threads( 2 );
+	expect_empty( "after bli_thread_set_num_threads()" );
+	expect( "after bli_thread_set_num_threads()", 400, 2, 1, FALSE );
+	expect( "after refilling",                    400, 2, 1, TRUE  );
+
+	bli_thread_set_ways( 1, 1, 2, 1, 1 );
+	expect_empty( "after bli_thread_set_ways()" );
+	expect( "after bli_thread_set_ways()", 400, 2, 1, FALSE );
+
+	printf( "%s\n", n_fail == 0 ? "PASS" : "FAIL" );
+
+	return n_fail == 0 ? 0 : 1;
+}
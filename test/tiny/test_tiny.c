@@ -0,0 +1,220 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Checks bli_?gemm_tiny() against bli_?gemm() for all m, n, k up to
+// BLIS_GEMM_TINY_MAX + 1 and a range of storage schemes, transpositions and
+// scalars, and then compares the time per call of bli_dgemm_tiny() and
+// bli_dgemm() for square problems. Usage:
+//
+//   ./test_tiny.x [nrepeats]
+//
+
+static int check( void )
+{
+	const num_t   dts[]    = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const trans_t transs[] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE, BLIS_CONJ_TRANSPOSE };
+	const double  alphas[] = { 1.0, -0.5, 0.0 };
+	const double  betas[]  = { 0.0, 1.0, 0.7 };
+
+	const dim_t max = BLIS_GEMM_TINY_MAX + 1;
+
+	dim_t n_cases = 0, n_fail = 0;
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( dim_t m = 0; m <= max; ++m )
+	for ( dim_t n = 0; n <= max; ++n )
+	for ( dim_t k = 0; k <= max; ++k )
+	{
+		const num_t   dt     = dts[ idt ];
+		const double  tol    = bli_dt_prec_is_single( dt ) ? 1e-5 : 1e-13;
+
+		// Cycle through the storage schemes, transpositions and scalars
+		// rather than testing every combination for every shape.
+		const dim_t   id     = m + 3 * n + 7 * k + idt;
+		const bool    row_c  = ( id     ) % 2;
+		const bool    row_a  = ( id / 2 ) % 2;
+		const bool    row_b  = ( id / 4 ) % 2;
+		const trans_t transa = transs[ ( id / 8  ) % 3 ];
+		const trans_t transb = transs[ ( id / 24 ) % 3 ];
+		const double  alpha  = alphas[ ( id / 3 ) % 3 ];
+		const double  beta   = betas [ ( id / 9 ) % 3 ];
+
+		obj_t a, b, c, c_ref, alpha_o, beta_o, norm;
+
+		test_create_op( dt, row_a, transa, m, k, 2, &a );
+		test_create_op( dt, row_b, transb, k, n, 2, &b );
+		test_create_op( dt, row_c, BLIS_NO_TRANSPOSE, m, n, 2, &c );
+		test_create_op( dt, row_c, BLIS_NO_TRANSPOSE, m, n, 2, &c_ref );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+		bli_copym( &c, &c_ref );
+
+		// The tiny gemm kernels must not read C when beta is zero. (Larger
+		// problems are passed to bli_?gemm() and are tested elsewhere.)
+		if ( beta == 0.0 && m <= BLIS_GEMM_TINY_MAX &&
+		     n <= BLIS_GEMM_TINY_MAX && k <= BLIS_GEMM_TINY_MAX )
+			bli_setm( &BLIS_NAN, &c );
+
+		bli_obj_scalar_init_detached( dt, &alpha_o );
+		bli_obj_scalar_init_detached( dt, &beta_o );
+		bli_setsc( alpha, 0.0, &alpha_o );
+		bli_setsc( beta,  0.0, &beta_o );
+
+		bli_obj_set_onlytrans( transa, &a );
+		bli_obj_set_onlytrans( transb, &b );
+
+		// The reference result.
+		bli_gemm( &alpha_o, &a, &b, &beta_o, &c_ref );
+
+		switch ( dt )
+		{
+			case BLIS_FLOAT: bli_sgemm_tiny
+			( transa, transb, m, n, k, bli_obj_buffer( &alpha_o ),
+			  bli_obj_buffer( &a ), bli_obj_row_stride( &a ), bli_obj_col_stride( &a ),
+			  bli_obj_buffer( &b ), bli_obj_row_stride( &b ), bli_obj_col_stride( &b ),
+			  bli_obj_buffer( &beta_o ),
+			  bli_obj_buffer( &c ), bli_obj_row_stride( &c ), bli_obj_col_stride( &c ) );
+			break;
+			case BLIS_DOUBLE: bli_dgemm_tiny
+			( transa, transb, m, n, k, bli_obj_buffer( &alpha_o ),
+			  bli_obj_buffer( &a ), bli_obj_row_stride( &a ), bli_obj_col_stride( &a ),
+			  bli_obj_buffer( &b ), bli_obj_row_stride( &b ), bli_obj_col_stride( &b ),
+			  bli_obj_buffer( &beta_o ),
+			  bli_obj_buffer( &c ), bli_obj_row_stride( &c ), bli_obj_col_stride( &c ) );
+			break;
+			case BLIS_SCOMPLEX: bli_cgemm_tiny
+			( transa, transb, m, n, k, bli_obj_buffer( &alpha_o ),
+			  bli_obj_buffer( &a ), bli_obj_row_stride( &a ), bli_obj_col_stride( &a ),
+			  bli_obj_buffer( &b ), bli_obj_row_stride( &b ), bli_obj_col_stride( &b ),
+			  bli_obj_buffer( &beta_o ),
+			  bli_obj_buffer( &c ), bli_obj_row_stride( &c ), bli_obj_col_stride( &c ) );
+			break;
+			default: bli_zgemm_tiny
+			( transa, transb, m, n, k, bli_obj_buffer( &alpha_o ),
+			  bli_obj_buffer( &a ), bli_obj_row_stride( &a ), bli_obj_col_stride( &a ),
+			  bli_obj_buffer( &b ), bli_obj_row_stride( &b ), bli_obj_col_stride( &b ),
+			  bli_obj_buffer( &beta_o ),
+			  bli_obj_buffer( &c ), bli_obj_row_stride( &c ), bli_obj_col_stride( &c ) );
+			break;
+		}
+
+		// Compare the two results.
+		double diff = 0.0, im;
+		if ( m > 0 && n > 0 )
+		{
+			bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+			bli_subm( &c_ref, &c );
+			bli_normfm( &c, &norm );
+			bli_getsc( &norm, &diff, &im );
+		}
+
+		n_cases += 1;
+
+		if ( !( diff <= tol * ( 1 + k ) ) )
+		{
+			if ( n_fail < 10 )
+				printf( "FAIL: dt=%d m=%d n=%d k=%d rows(c,a,b)=%d%d%d trans=%d,%d alpha=%g beta=%g diff=%g\n",
+				        ( int )dt, ( int )m, ( int )n, ( int )k, row_c, row_a, row_b,
+				        ( int )transa, ( int )transb, alpha, beta, diff );
+			n_fail += 1;
+		}
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+	}
+
+	printf( "correctness: %d cases, %d failed\n", ( int )n_cases, ( int )n_fail );
+
+	return n_fail == 0 ? 0 : 1;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t nrepeats = ( argc > 1 ? atoi( argv[1] ) : 5 );
+
+	bli_init();
+
+	int r_val = check();
+
+	printf( "%5s %14s %14s %8s\n", "n", "dgemm (ns)", "dgemm_tiny (ns)", "speedup" );
+
+	for ( dim_t n = 2; n <= BLIS_GEMM_TINY_MAX; n += ( n < 8 ? 1 : 4 ) )
+	{
+		double a[ 256 ], b[ 256 ], c[ 256 ];
+		double one = 1.0;
+
+		for ( dim_t i = 0; i < n * n; ++i )
+		{
+			a[ i ] = ( double )( i % 7 ) / 7.0;
+			b[ i ] = ( double )( i % 5 ) / 5.0;
+			c[ i ] = 0.0;
+		}
+
+		const dim_t n_calls = 20000;
+		double      t_gemm  = 1.0e9, t_tiny = 1.0e9;
+
+		for ( dim_t r = 0; r < nrepeats; ++r )
+		{
+			double t0 = bli_clock();
+			for ( dim_t i = 0; i < n_calls; ++i )
+				bli_dgemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, n, n, n, &one,
+				           a, 1, n, b, 1, n, &one, c, 1, n );
+			t_gemm = bli_clock_min_diff( t_gemm, t0 );
+
+			t0 = bli_clock();
+			for ( dim_t i = 0; i < n_calls; ++i )
+				bli_dgemm_tiny( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, n, n, n, &one,
+				                a, 1, n, b, 1, n, &one, c, 1, n );
+			t_tiny = bli_clock_min_diff( t_tiny, t0 );
+		}
+
+		printf( "%5d %14.1f %14.1f %8.2f\n", ( int )n, 1e9 * t_gemm / n_calls,
+		        1e9 * t_tiny / n_calls, t_gemm / t_tiny );
+	}
+
+	bli_finalize();
+
+	return r_val;
+}
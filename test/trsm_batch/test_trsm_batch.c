@@ -0,0 +1,351 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "blis.h"
+#include "test_common.h"
+
+//
+// Checks the batched trsm and trmm interfaces (strided, pointer-array, and
+// object-array) against loops of bli_trsm_ex() and bli_trmm_ex() over the
+// problems of the batch, and then compares the time taken by both for
+// batches of small double-precision triangular solves. Usage:
+//
+//   ./test_trsm_batch.x [nthreads] [nrepeats]
+//
+
+// Make each triangular matrix of a batch well-conditioned.
+static void shift_batch( inc_t stride, dim_t batch, const obj_t* a )
+{
+	obj_t shift;
+
+	bli_obj_scalar_init_detached( bli_obj_dt( a ), &shift );
+	bli_setsc( ( double )bli_obj_length( a ) + 1.0, 0.0, &shift );
+
+	for ( dim_t i = 0; i < ( stride == 0 ? 1 : batch ); ++i )
+	{
+		obj_t a_i;
+		test_acquire_batch( i, stride, a, &a_i );
+		bli_obj_set_struc( BLIS_GENERAL, &a_i );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_i );
+		bli_shiftd( &shift, &a_i );
+	}
+}
+
+// Interfaces under test.
+enum { STRIDED, PTR_ARRAY, OBJ_ARRAY };
+
+static double check_batch( opid_t family, int iface, num_t dt, side_t side, uplo_t uplo,
+                           trans_t transa, diag_t diag, dim_t m, dim_t n, dim_t batch,
+                           bool row_major, bool share_a, dim_t nt )
+{
+	obj_t alpha, a, b, b_ref;
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_setsc( 1.5, -0.5, &alpha );
+
+	const dim_t mn_a = ( bli_is_left( side ) ? m : n );
+
+	// Store the B_i contiguously (without padding) so that problems that
+	// share A may be merged into one.
+	const inc_t ld_a     = mn_a + 3;
+	const inc_t ld_b     = ( row_major ? n : m );
+	const inc_t stride_a = share_a ? 0 : ld_a * mn_a + 5;
+	const inc_t stride_b = ld_b * ( row_major ? m : n );
+
+	test_create_batch( dt, mn_a, mn_a, row_major, ld_a, stride_a, batch, &a );
+	test_create_batch( dt, m,    n,    row_major, ld_b, stride_b, batch, &b );
+	test_create_batch( dt, m,    n,    row_major, ld_b, stride_b, batch, &b_ref );
+
+	shift_batch( stride_a, batch, &a );
+
+	bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+	bli_obj_set_uplo( uplo, &a );
+	bli_obj_set_diag( diag, &a );
+	bli_obj_set_conjtrans( transa, &a );
+
+	for ( dim_t i = 0; i < batch; ++i )
+	{
+		obj_t b_i, b_ref_i;
+		test_acquire_batch( i, stride_b, &b, &b_i );
+		test_acquire_batch( i, stride_b, &b_ref, &b_ref_i );
+		bli_copym( &b_i, &b_ref_i );
+	}
+
+	const num_t dt_r = bli_dt_proj_to_real( dt );
+
+	if ( iface == STRIDED )
+	{
+		if ( family == BLIS_TRSM )
+			bli_trsm_batch_strided_ex( side, &alpha, &a, stride_a, &b, stride_b, batch, NULL, &rntm );
+		else
+			bli_trmm_batch_strided_ex( side, &alpha, &a, stride_a, &b, stride_b, batch, NULL, &rntm );
+	}
+	else if ( iface == OBJ_ARRAY )
+	{
+		obj_t* a_array = malloc( batch * sizeof( obj_t ) );
+		obj_t* b_array = malloc( batch * sizeof( obj_t ) );
+
+		for ( dim_t i = 0; i < batch; ++i )
+		{
+			test_acquire_batch( i, stride_a, &a, &a_array[ i ] );
+			test_acquire_batch( i, stride_b, &b, &b_array[ i ] );
+		}
+
+		if ( family == BLIS_TRSM )
+			bli_trsm_batch_ex( side, &alpha, a_array, b_array, batch, NULL, &rntm );
+		else
+			bli_trmm_batch_ex( side, &alpha, a_array, b_array, batch, NULL, &rntm );
+
+		free( a_array );
+		free( b_array );
+	}
+	else if ( dt_r == BLIS_DOUBLE )
+	{
+		// The typed pointer-array interface is exercised for double and
+		// dcomplex.
+		void** a_array = malloc( batch * sizeof( void* ) );
+		void** b_array = malloc( batch * sizeof( void* ) );
+		const siz_t es = bli_dt_size( dt );
+
+		for ( dim_t i = 0; i < batch; ++i )
+		{
+			a_array[ i ] = ( char* )bli_obj_buffer( &a ) + i * stride_a * es;
+			b_array[ i ] = ( char* )bli_obj_buffer( &b ) + i * stride_b * es;
+		}
+
+		const inc_t rs_a = bli_obj_row_stride( &a ), cs_a = bli_obj_col_stride( &a );
+		const inc_t rs_b = bli_obj_row_stride( &b ), cs_b = bli_obj_col_stride( &b );
+
+		if ( dt == BLIS_DOUBLE && family == BLIS_TRSM )
+			bli_dtrsm_batch_ex( side, uplo, transa, diag, m, n, bli_obj_buffer( &alpha ),
+			                    ( const double* const* )a_array, rs_a, cs_a,
+			                    ( double* const* )b_array, rs_b, cs_b, batch, NULL, &rntm );
+		else if ( dt == BLIS_DOUBLE )
+			bli_dtrmm_batch_ex( side, uplo, transa, diag, m, n, bli_obj_buffer( &alpha ),
+			                    ( const double* const* )a_array, rs_a, cs_a,
+			                    ( double* const* )b_array, rs_b, cs_b, batch, NULL, &rntm );
+		else if ( family == BLIS_TRSM )
+			bli_ztrsm_batch_ex( side, uplo, transa, diag, m, n, bli_obj_buffer( &alpha ),
+			                    ( const dcomplex* const* )a_array, rs_a, cs_a,
+			                    ( dcomplex* const* )b_array, rs_b, cs_b, batch, NULL, &rntm );
+		else
+			bli_ztrmm_batch_ex( side, uplo, transa, diag, m, n, bli_obj_buffer( &alpha ),
+			                    ( const dcomplex* const* )a_array, rs_a, cs_a,
+			                    ( dcomplex* const* )b_array, rs_b, cs_b, batch, NULL, &rntm );
+
+		free( a_array );
+		free( b_array );
+	}
+	else
+	{
+		// The typed strided interface is exercised for float and scomplex.
+		const inc_t rs_a = bli_obj_row_stride( &a ), cs_a = bli_obj_col_stride( &a );
+		const inc_t rs_b = bli_obj_row_stride( &b ), cs_b = bli_obj_col_stride( &b );
+
+		if ( dt == BLIS_FLOAT && family == BLIS_TRSM )
+			bli_strsm_batch_strided_ex( side, uplo, transa, diag, m, n, bli_obj_buffer( &alpha ),
+			                            bli_obj_buffer( &a ), rs_a, cs_a, stride_a,
+			                            bli_obj_buffer( &b ), rs_b, cs_b, stride_b, batch, NULL, &rntm );
+		else if ( dt == BLIS_FLOAT )
+			bli_strmm_batch_strided_ex( side, uplo, transa, diag, m, n, bli_obj_buffer( &alpha ),
+			                            bli_obj_buffer( &a ), rs_a, cs_a, stride_a,
+			                            bli_obj_buffer( &b ), rs_b, cs_b, stride_b, batch, NULL, &rntm );
+		else if ( family == BLIS_TRSM )
+			bli_ctrsm_batch_strided_ex( side, uplo, transa, diag, m, n, bli_obj_buffer( &alpha ),
+			                            bli_obj_buffer( &a ), rs_a, cs_a, stride_a,
+			                            bli_obj_buffer( &b ), rs_b, cs_b, stride_b, batch, NULL, &rntm );
+		else
+			bli_ctrmm_batch_strided_ex( side, uplo, transa, diag, m, n, bli_obj_buffer( &alpha ),
+			                            bli_obj_buffer( &a ), rs_a, cs_a, stride_a,
+			                            bli_obj_buffer( &b ), rs_b, cs_b, stride_b, batch, NULL, &rntm );
+	}
+
+	double diff = 0.0;
+
+	for ( dim_t i = 0; i < batch; ++i )
+	{
+		obj_t a_i, b_i, b_ref_i;
+		test_acquire_batch( i, stride_a, &a, &a_i );
+		test_acquire_batch( i, stride_b, &b, &b_i );
+		test_acquire_batch( i, stride_b, &b_ref, &b_ref_i );
+
+		if ( family == BLIS_TRSM ) bli_trsm_ex( side, &alpha, &a_i, &b_ref_i, NULL, &rntm );
+		else                       bli_trmm_ex( side, &alpha, &a_i, &b_ref_i, NULL, &rntm );
+
+		diff = bli_max( diff, test_rel_diff( &b_i, &b_ref_i ) );
+	}
+
+	test_free_batch( &a );
+	test_free_batch( &b );
+	test_free_batch( &b_ref );
+
+	return diff;
+}
+
+static int check( void )
+{
+	const num_t dts[]     = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t sizes[][ 2 ] =
+	{
+		{   1,   1 },
+		{   8,   3 },
+		{  13,  16 },
+		{  64,  64 },
+		{ 150,  70 },
+	};
+	const dim_t n_sizes   = sizeof( sizes ) / sizeof( sizes[ 0 ] );
+	const dim_t batches[] = { 1, 7 };
+
+	dim_t n_cases = 0, n_fail = 0;
+
+	for ( int ifam = 0; ifam < 2; ++ifam )
+	for ( int iface = STRIDED; iface <= OBJ_ARRAY; ++iface )
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( dim_t is = 0; is < n_sizes; ++is )
+	for ( int ib = 0; ib < 2; ++ib )
+	for ( int ivar = 0; ivar < 8; ++ivar )
+	for ( dim_t nt = 1; nt <= 4; nt += 3 )
+	{
+		const opid_t  family    = ( ifam ? BLIS_TRMM : BLIS_TRSM );
+		const num_t   dt        = dts[ idt ];
+		const double  tol       = bli_dt_prec_is_single( dt ) ? 1e-4 : 1e-12;
+		const side_t  side      = ( ivar & 1 ? BLIS_RIGHT : BLIS_LEFT );
+		const uplo_t  uplo      = ( ivar & 2 ? BLIS_UPPER : BLIS_LOWER );
+		const trans_t transa    = ( ivar & 4 ? BLIS_CONJ_TRANSPOSE : BLIS_NO_TRANSPOSE );
+		const diag_t  diag      = ( ivar == 5 ? BLIS_UNIT_DIAG : BLIS_NONUNIT_DIAG );
+		const bool    row_major = ( ivar == 3 || ivar == 6 );
+		const bool    share_a   = ( ivar == 1 || ivar == 4 || ivar == 6 );
+
+		double diff = check_batch( family, iface, dt, side, uplo, transa, diag,
+		                           sizes[ is ][ 0 ], sizes[ is ][ 1 ], batches[ ib ],
+		                           row_major, share_a, nt );
+
+		n_cases += 1;
+
+		if ( !( diff < tol ) )
+		{
+			n_fail += 1;
+			printf( "FAILED: %s iface = %d dt = %d m = %d n = %d batch = %d var = %d nt = %d (diff = %g)\n",
+			        ( ifam ? "trmm" : "trsm" ), iface, ( int )dt,
+			        ( int )sizes[ is ][ 0 ], ( int )sizes[ is ][ 1 ],
+			        ( int )batches[ ib ], ivar, ( int )nt, diff );
+		}
+	}
+
+	printf( "%d of %d cases passed.\n", ( int )( n_cases - n_fail ), ( int )n_cases );
+
+	return n_fail != 0;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t nt       = ( argc > 1 ? atoi( argv[1] ) : 1 );
+	dim_t nrepeats = ( argc > 2 ? atoi( argv[2] ) : 3 );
+
+	bli_init();
+
+	int r_val = check();
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	const dim_t shapes[][ 3 ] =
+	{
+		{  8,  8, 4096 },
+		{ 16, 16, 2048 },
+		{ 32, 32, 1024 },
+		{ 64, 64,  256 },
+		{ 32,  1, 4096 },
+	};
+	const dim_t n_shapes = sizeof( shapes ) / sizeof( shapes[ 0 ] );
+
+	printf( "%4s %4s %6s %14s %14s %8s\n", "m", "n", "batch", "loop (ms)", "batch (ms)", "speedup" );
+
+	for ( dim_t is = 0; is < n_shapes; ++is )
+	{
+		const dim_t m     = shapes[ is ][ 0 ];
+		const dim_t n     = shapes[ is ][ 1 ];
+		const dim_t batch = shapes[ is ][ 2 ];
+		const inc_t s_a   = m * m;
+		const inc_t s_b   = m * n;
+		obj_t a, b;
+
+		test_create_batch( BLIS_DOUBLE, m, m, false, m, s_a, batch, &a );
+		test_create_batch( BLIS_DOUBLE, m, n, false, m, s_b, batch, &b );
+		shift_batch( s_a, batch, &a );
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+		bli_obj_set_uplo( BLIS_LOWER, &a );
+
+		double t_loop = 1.0e9, t_batch = 1.0e9;
+
+		// Alternate between solving with A and multiplying by A so that B
+		// stays bounded across repeats.
+		for ( dim_t r = 0; r < nrepeats; ++r )
+		{
+			double t0 = bli_clock();
+			for ( dim_t i = 0; i < batch; ++i )
+			{
+				obj_t a_i, b_i;
+				test_acquire_batch( i, s_a, &a, &a_i );
+				test_acquire_batch( i, s_b, &b, &b_i );
+				bli_trsm_ex( BLIS_LEFT, &BLIS_ONE, &a_i, &b_i, NULL, &rntm );
+			}
+			t_loop = bli_clock_min_diff( t_loop, t0 );
+
+			bli_trmm_batch_strided_ex( BLIS_LEFT, &BLIS_ONE, &a, s_a, &b, s_b, batch, NULL, &rntm );
+
+			t0 = bli_clock();
+			bli_trsm_batch_strided_ex( BLIS_LEFT, &BLIS_ONE, &a, s_a, &b, s_b, batch, NULL, &rntm );
+			t_batch = bli_clock_min_diff( t_batch, t0 );
+
+			bli_trmm_batch_strided_ex( BLIS_LEFT, &BLIS_ONE, &a, s_a, &b, s_b, batch, NULL, &rntm );
+		}
+
+		printf( "%4d %4d %6d %14.2f %14.2f %8.2f\n", ( int )m, ( int )n, ( int )batch,
+		        1e3 * t_loop, 1e3 * t_batch, t_loop / t_batch );
+
+		test_free_batch( &a );
+		test_free_batch( &b );
+	}
+
+	bli_finalize();
+
+	return r_val;
+}
@@ -592,8 +592,18 @@ void libblis_test_read_params_file( char* input_filename, test_params_t* params
 	libblis_test_read_next_line( buffer, input_stream );
 	sscanf( buffer, "%u ", &(params->p_inc) );
 
-	// Read whether to enable 1m.
+	// Read whether to enable 3m. Input files that predate 3m do not have
+	// this line, so it is only consumed if its comment mentions 3m.
+	// Otherwise, 3m stays disabled and the line is read as the 1m switch.
+	params->ind_enable[ BLIS_3M ] = 0;
 	libblis_test_read_next_line( buffer, input_stream );
+	if ( libblis_test_line_comment_has( buffer, "3m" ) )
+	{
+		sscanf( buffer, "%u ", &(params->ind_enable[ BLIS_3M ]) );
+		libblis_test_read_next_line( buffer, input_stream );
+	}
+
+	// Read whether to enable 1m.
 	sscanf( buffer, "%u ", &(params->ind_enable[ BLIS_1M ]) );
 
 	// Read whether to native (complex) execution.
@@ -611,13 +621,15 @@ void libblis_test_read_params_file( char* input_filename, test_params_t* params
 	// threads.
 	if ( params->n_app_threads > 1 )
 	{
-		if ( params->ind_enable[ BLIS_1M ] )
+		if ( params->ind_enable[ BLIS_3M ] ||
+		     params->ind_enable[ BLIS_1M ] )
 		{
 			// Due to an inherent race condition in the way induced methods
 			// are enabled and disabled at runtime, all induced methods must be
 			// disabled when simulating multiple application threads.
 			libblis_test_printf_infoc( "simulating multiple application threads; disabling induced methods.\n" );
 
+			params->ind_enable[ BLIS_3M   ] = 0;
 			params->ind_enable[ BLIS_1M   ] = 0;
 		}
 	}
@@ -835,6 +847,7 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	if      ( ti == BLIS_OPENMP ) sprintf( def_impl_set_str, "openmp" );
 	else if ( ti == BLIS_POSIX  ) sprintf( def_impl_set_str, "pthreads" );
 	else if ( ti == BLIS_HPX    ) sprintf( def_impl_set_str, "hpx" );
+	else if ( ti == BLIS_CUSTOM ) sprintf( def_impl_set_str, "custom" );
 	else                          sprintf( def_impl_set_str, "single" );
 
 	// Describe the status of jrir thread partitioning.
@@ -1241,6 +1254,7 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "problem size: max to test    %u\n", params->p_max );
 	libblis_test_fprintf_c( os, "problem size increment       %u\n", params->p_inc );
 	libblis_test_fprintf_c( os, "complex implementations        \n" );
+	libblis_test_fprintf_c( os, "  3m?                        %u\n", params->ind_enable[ BLIS_3M ] );
 	libblis_test_fprintf_c( os, "  1m?                        %u\n", params->ind_enable[ BLIS_1M ] );
 	libblis_test_fprintf_c( os, "  native?                    %u\n", params->ind_enable[ BLIS_NAT ] );
 	libblis_test_fprintf_c( os, "simulated app-level threads  %u\n", params->n_app_threads );
@@ -2004,7 +2018,10 @@ void libblis_test_op_driver
 			// If the operation is level-3, and all operand domains are complex,
 			// then we iterate over all induced methods.
 			if ( bli_opid_is_level3( op->opid ) && has_cd_only )
-				ind_first = 0;
+			{
+				ind_first = BLIS_IND_FIRST;
+				ind_last  = BLIS_IND_LAST;
+			}
 
 			// Loop over induced methods (or just BLIS_NAT).
 			for ( unsigned int indi = ind_first; indi <= ind_last; ++indi )
@@ -2673,6 +2690,16 @@ void libblis_test_fopen_check_stream( char* filename_str,
 
 
 
+bool libblis_test_line_comment_has( const char* buffer, const char* str )
+{
+	const char* comment = strchr( buffer, INPUT_COMMENT_CHAR );
+
+	// Only search the part of the line that follows the comment character.
+	return comment != NULL && strstr( comment, str ) != NULL;
+}
+
+
+
 void libblis_test_read_next_line( char* buffer, FILE* input_stream )
 {
 	char temp[ INPUT_BUFFER_SIZE ];
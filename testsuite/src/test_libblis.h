@@ -448,6 +448,7 @@ void libblis_test_fopen_ofile( char* op_str, iface_t iface, FILE** output_stream
 void libblis_test_fclose_ofile( FILE* output_stream );
 void libblis_test_fopen_check_stream( char* filename_str, FILE* stream );
 
+bool libblis_test_line_comment_has( const char* buffer, const char* str );
 void libblis_test_read_next_line( char* buffer, FILE* input_stream );
 
 // --- Custom fprintf-related ---